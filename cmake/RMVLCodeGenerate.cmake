@@ -830,6 +830,9 @@ function(rmvl_generate_msg file)
   set(serialize_content)
   set(deserialize_content)
   set(json_field_info) # Store field type info for JSON serialization
+  set(view_fields_cpp)
+  set(view_parse_content)
+  set(view_to_msg_content)
 
   foreach(n ${type_and_ids})
     string(REPLACE "@" ";" parts "${n}")
@@ -961,6 +964,61 @@ function(rmvl_generate_msg file)
       string(APPEND deserialize_content "    _msg__.${id} = read_scalar<${cpp_base_type}>(_p__);\n")
     endif()
 
+    # Generate bounds-checked view code
+    if(array_type STREQUAL "SCALAR")
+      if(type STREQUAL "string")
+        string(APPEND view_fields_cpp "    std::string_view ${id}{};\n")
+        string(APPEND view_parse_content "    if (!_r__.string(_v__.${id}))\n        return false;\n")
+        string(APPEND view_to_msg_content "    _msg__.${id} = std::string(${id});\n")
+      elseif(is_custom_type)
+        string(APPEND view_fields_cpp "    ${cpp_base_type}View ${id}{};\n")
+        string(APPEND view_parse_content "    if (!${cpp_base_type}View::parse(_r__, _v__.${id}))\n        return false;\n")
+        string(APPEND view_to_msg_content "    _msg__.${id} = ${id}.to_msg();\n")
+      else()
+        string(APPEND view_fields_cpp "    ${cpp_base_type} ${id}{};\n")
+        string(APPEND view_parse_content "    if (!_r__.scalar(_v__.${id}))\n        return false;\n")
+        string(APPEND view_to_msg_content "    _msg__.${id} = ${id};\n")
+      endif()
+    else()
+      if(array_type STREQUAL "VARIABLE_ARRAY")
+        set(view_count "${id}_size__")
+        string(APPEND view_parse_content "    uint32_t ${id}_size__{};\n    if (!_r__.scalar(${id}_size__))\n        return false;\n")
+      else()
+        set(view_count "${array_size}")
+      endif()
+      if(is_custom_type OR type STREQUAL "string")
+        if(type STREQUAL "string")
+          set(view_elem_type "std::string_view")
+          set(view_elem_expr "std::string(v)")
+        else()
+          set(view_elem_type "${cpp_base_type}View")
+          set(view_elem_expr "v.to_msg()")
+        endif()
+        string(APPEND view_fields_cpp "    rm::msg::SeqView<${view_elem_type}> ${id}{};\n")
+        string(APPEND view_parse_content "    if (!rm::msg::SeqView<${view_elem_type}>::parse(_r__, ${view_count}, _v__.${id}))\n        return false;\n")
+        if(array_type STREQUAL "VARIABLE_ARRAY")
+          string(APPEND view_to_msg_content "    _msg__.${id}.reserve(${id}.size());\n    for (const auto &v : ${id})\n        _msg__.${id}.push_back(${view_elem_expr});\n")
+        else()
+          string(APPEND view_to_msg_content "    std::size_t ${id}_idx__{};\n    for (const auto &v : ${id})\n        _msg__.${id}[${id}_idx__++] = ${view_elem_expr};\n")
+        endif()
+      elseif(type MATCHES "^(u?int8|char)$")
+        string(APPEND view_fields_cpp "    std::span<const ${cpp_base_type}> ${id}{};\n")
+        string(APPEND view_parse_content "    if (!_r__.bytes(${view_count}, _v__.${id}))\n        return false;\n")
+        if(array_type STREQUAL "VARIABLE_ARRAY")
+          string(APPEND view_to_msg_content "    _msg__.${id}.assign(${id}.begin(), ${id}.end());\n")
+        else()
+          string(APPEND view_to_msg_content "    std::copy(${id}.begin(), ${id}.end(), _msg__.${id}.begin());\n")
+        endif()
+      else()
+        string(APPEND view_fields_cpp "    rm::msg::ArrayView<${cpp_base_type}> ${id}{};\n")
+        string(APPEND view_parse_content "    if (!_r__.array(${view_count}, _v__.${id}))\n        return false;\n")
+        if(array_type STREQUAL "VARIABLE_ARRAY")
+          string(APPEND view_to_msg_content "    _msg__.${id}.resize(${id}.size());\n")
+        endif()
+        string(APPEND view_to_msg_content "    ${id}.copy_to(_msg__.${id}.data());\n")
+      endif()
+    endif()
+
     # Record field type info for JSON serialization
     list(FIND json_fields "${id}" json_idx)
     if(NOT json_idx EQUAL -1)
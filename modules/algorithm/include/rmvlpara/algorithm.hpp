@@ -0,0 +1,85 @@
+/**
+ * @file algorithm.hpp
+ * @author RMVL Community
+ * @brief AlgorithmParam module header file (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#pragma once
+
+#include <rmvl/rmvl_modules.hpp>
+
+#ifdef HAVE_OPENCV
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#else
+#include <string>
+#include <vector>
+#endif
+
+#include "rmvl/core/rmvldef.hpp"
+
+//! @addtogroup rmvlpara
+//! @{
+//! @defgroup para_algorithm algorithm 的参数模块
+//! @addtogroup para_algorithm
+//! @{
+//! @brief 与 @ref algorithm 相关的参数模块，包含...
+//! @} para_algorithm
+//! @} rmvlpara
+
+namespace rm::para {
+
+//! @addtogroup para_algorithm
+//! @{
+//! @details
+//! - 类名： AlgorithmParam ，对应的全局参数变量： `rm::para::algorithm_param`
+//! @} para_algorithm
+
+//! @addtogroup para_algorithm
+//! @{
+
+////////////////////// 扩展部分 //////////////////////
+
+
+////////////////////// 参数部分 //////////////////////
+
+//! AlgorithmParam 参数模块
+class RMVL_EXPORTS_W AlgorithmParam {
+public:
+    //! 离散 Newton 弦截法用于近似求导的步长 @details 默认值：`1e-3`
+    RMVL_W_RW double SECANT_STEP = 1e-3;
+    //! 外罚函数法求解约束优化问题时的惩罚系数 @details 默认值：`1e3`
+    RMVL_W_RW double EXTERIOR = 1e3;
+
+
+    //! 创建 AlgorithmParam 参数对象 @warning 不建议手动创建对象
+    RMVL_W AlgorithmParam() = default;
+
+    /**
+     * @brief 从指定 `YAML` 文件中加载，并读取至 `AlgorithmParam` 中
+     *
+     * @note `YAML` 文件的后缀允许是 `*.yml` 和 `*.yaml`
+     * @param[in] path 参数路径
+     * @return 是否读取成功
+     */
+    RMVL_W bool read(const std::string &path);
+
+    /**
+     * @brief 将 `AlgorithmParam` 的数据写入指定的 `YAML` 文件中
+     *
+     * @note `YAML` 文件的后缀允许是 `*.yml` 和 `*.yaml`
+     * @param[in] path 参数路径
+     * @return 是否写入成功
+     */
+    RMVL_W bool write(const std::string &path) const;
+};
+
+//! AlgorithmParam 参数模块
+RMVL_W_RW inline AlgorithmParam algorithm_param;
+
+//! @} para_algorithm
+
+} // namespace rm::para
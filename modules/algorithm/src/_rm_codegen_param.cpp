@@ -0,0 +1,57 @@
+/**
+ * @file _rm_codegen_param.cpp
+ * @author RMVL Community
+ * @brief AlgorithmParam module source file (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "rmvlpara/algorithm.hpp"
+#include "rmvl/core/yaml.hpp"
+
+namespace rm::para {
+
+static std::shared_mutex g_paramtx__{};
+
+
+
+bool AlgorithmParam::read(const std::string &_path__) {
+    std::unique_lock _lk__(g_paramtx__);
+    auto _result__ = yaml::load(_path__);
+    if (!_result__)
+        return false;
+    const auto &_root__ = *_result__;
+    yaml::Node _node__;
+    bool _ok__ = true;
+
+    _node__ = _root__["SECANT_STEP"];
+    if (_node__.valid())
+        _ok__ = _node__.read(SECANT_STEP) && _ok__;
+    _node__ = _root__["EXTERIOR"];
+    if (_node__.valid())
+        _ok__ = _node__.read(EXTERIOR) && _ok__;
+
+    return _ok__;
+}
+
+bool AlgorithmParam::write(const std::string &_path__) const {
+    std::shared_lock _lk__(g_paramtx__);
+    auto _root__ = yaml::Node::createMap();
+    bool _ok__ = true;
+
+    _ok__ = _root__.set("SECANT_STEP", SECANT_STEP) && _ok__;
+    _ok__ = _root__.set("EXTERIOR", EXTERIOR) && _ok__;
+
+#ifdef HAVE_OPENCV
+    return _ok__ && yaml::saveOpenCv(_path__, _root__);
+#else
+    return _ok__ && yaml::save(_path__, _root__);
+#endif
+}
+
+} // rm::para
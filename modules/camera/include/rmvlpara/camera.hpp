@@ -0,0 +1,27 @@
+/**
+ * @file camera.hpp
+ * @author RMVL Community
+ * @brief camera header file (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#pragma once
+
+//! @addtogroup rmvlpara
+//! @{
+
+//! @defgroup para_camera camera 的参数模块
+//! @{
+
+#include <rmvl/rmvl_modules.hpp>
+
+//! @} para_camera
+
+//! @addtogroup para_camera
+//! @{
+//! @brief 与 @ref camera 相关的参数模块，包含...
+//! @} para_camera
+
+//! @} rmvlpara
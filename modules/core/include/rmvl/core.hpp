@@ -13,8 +13,8 @@
 
 /**
  * @defgroup core RMVL 核心模块
- * @brief 提供异常处理、定时器、编程工具和 YAML 数据读写等基础功能
- * @see core_reflect、core_meta、core_str、core_timer、core_yaml
+ * @brief 提供异常处理、定时器、编程工具、并行计算和 YAML 数据读写等基础功能
+ * @see core_reflect、core_meta、core_str、core_timer、core_parallel、core_yaml
  */
 
 /**
@@ -36,6 +36,7 @@
 #include <rmvl/rmvl_modules.hpp>
 
 // 通用
+#include "core/parallel.hpp"
 #include "core/str.hpp"
 #include "core/timer.hpp"
 #include "core/util.hpp"
@@ -0,0 +1,76 @@
+/**
+ * @file parallel.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 常驻工作线程池
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @defgroup core_parallel 并行计算
+ * @ingroup core
+ * @brief 提供供各模块复用的常驻工作线程池
+ */
+
+namespace rm {
+
+//! @addtogroup core_parallel
+//! @{
+
+/**
+ * @brief 常驻工作线程池
+ * @details 构造时创建后台线程，每次调用 run 只唤醒已有线程，由后台线程与调用线程以各自的线程序号执行同一任务，
+ *          任务内部自行划分工作（例如以原子计数器动态领取分块），全部线程返回后 run 才返回
+ * @note 同一时刻只能有一个调用方，任务不得抛出异常
+ */
+class WorkerPool {
+public:
+    /**
+     * @brief 创建线程池
+     *
+     * @param[in] workers 后台线程数量，为 0 时任务只在调用线程上执行
+     */
+    explicit WorkerPool(std::size_t workers);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    //! 参与计算的线程总数（含调用线程）
+    std::size_t size() const noexcept { return _threads.size() + 1; }
+
+    /**
+     * @brief 在每个线程上以各自的线程序号 `[0, size())` 执行一次任务，全部返回后结束
+     *
+     * @param[in] task 任务，参数为线程序号，调用线程的序号为 0
+     */
+    void run(const std::function<void(std::size_t)> &task);
+
+private:
+    void loop(std::size_t worker);
+
+    std::vector<std::thread> _threads{};
+    std::mutex _mtx{};
+    std::condition_variable _start_cv{};
+    std::condition_variable _done_cv{};
+    const std::function<void(std::size_t)> *_task{};
+    uint64_t _generation{};
+    std::size_t _pending{};
+    bool _stop{};
+};
+
+//! @} core_parallel
+
+} // namespace rm
@@ -29,6 +29,7 @@
 #else
 #include <array>
 #include <string>
+#include <vector>
 #endif
 
 #include "rmvl/core/rmvldef.hpp"
@@ -0,0 +1,71 @@
+/**
+ * @file parallel.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 常驻工作线程池
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/core/parallel.hpp"
+
+namespace rm {
+
+WorkerPool::WorkerPool(std::size_t workers) {
+    _threads.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i)
+        _threads.emplace_back(&WorkerPool::loop, this, i + 1);
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard lock(_mtx);
+        _stop = true;
+    }
+    _start_cv.notify_all();
+    for (auto &t : _threads)
+        t.join();
+}
+
+void WorkerPool::run(const std::function<void(std::size_t)> &task) {
+    if (_threads.empty()) {
+        task(0);
+        return;
+    }
+    {
+        std::lock_guard lock(_mtx);
+        _task = &task;
+        _pending = _threads.size();
+        ++_generation;
+    }
+    _start_cv.notify_all();
+    task(0);
+    std::unique_lock lock(_mtx);
+    _done_cv.wait(lock, [this] { return _pending == 0; });
+    _task = nullptr;
+}
+
+void WorkerPool::loop(std::size_t worker) {
+    uint64_t seen = 0;
+    for (;;) {
+        const std::function<void(std::size_t)> *task{};
+        {
+            std::unique_lock lock(_mtx);
+            _start_cv.wait(lock, [&] { return _stop || _generation != seen; });
+            if (_stop)
+                return;
+            seen = _generation;
+            task = _task;
+        }
+        (*task)(worker);
+        {
+            std::lock_guard lock(_mtx);
+            if (--_pending == 0)
+                _done_cv.notify_one();
+        }
+    }
+}
+
+} // namespace rm
@@ -0,0 +1,37 @@
+/**
+ * @file test_parallel.cpp
+ * @brief 并行计算模块单元测试
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/parallel.hpp"
+
+namespace rm_test {
+
+TEST(Core_parallel, runs_task_once_per_thread_on_every_call) {
+    rm::WorkerPool pool(3);
+    ASSERT_EQ(pool.size(), 4u);
+    for (int round = 0; round < 50; ++round) {
+        std::vector<std::atomic_int> counts(pool.size());
+        pool.run([&](std::size_t index) { counts[index]++; });
+        for (std::size_t i = 0; i < counts.size(); ++i)
+            EXPECT_EQ(counts[i].load(), 1) << "round " << round << ", thread " << i;
+    }
+}
+
+TEST(Core_parallel, empty_pool_runs_on_caller) {
+    rm::WorkerPool pool(0);
+    EXPECT_EQ(pool.size(), 1u);
+    std::thread::id runner{};
+    std::size_t index = 1;
+    pool.run([&](std::size_t i) { runner = std::this_thread::get_id(), index = i; });
+    EXPECT_EQ(runner, std::this_thread::get_id());
+    EXPECT_EQ(index, 0u);
+}
+
+} // namespace rm_test
@@ -0,0 +1,85 @@
+/**
+ * @file io.hpp
+ * @author RMVL Community
+ * @brief IoParam module header file (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#pragma once
+
+#include <rmvl/rmvl_modules.hpp>
+
+#ifdef HAVE_OPENCV
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#else
+#include <string>
+#include <vector>
+#endif
+
+#include "rmvl/core/rmvldef.hpp"
+
+//! @addtogroup rmvlpara
+//! @{
+//! @defgroup para_io io 的参数模块
+//! @addtogroup para_io
+//! @{
+//! @brief 与 @ref io 相关的参数模块，包含...
+//! @} para_io
+//! @} rmvlpara
+
+namespace rm::para {
+
+//! @addtogroup para_io
+//! @{
+//! @details
+//! - 类名： IoParam ，对应的全局参数变量： `rm::para::io_param`
+//! @} para_io
+
+//! @addtogroup para_io
+//! @{
+
+////////////////////// 扩展部分 //////////////////////
+
+
+////////////////////// 参数部分 //////////////////////
+
+//! IoParam 参数模块
+class RMVL_EXPORTS_W IoParam {
+public:
+    //! 队列最大消息数 @details 默认值：`10`
+    RMVL_W_RW int MQ_MAX_MSG = 10;
+    //! 每条消息最大字节数，不超过 4096 @details 默认值：`4096`
+    RMVL_W_RW int MQ_MSG_SIZE = 4096;
+
+
+    //! 创建 IoParam 参数对象 @warning 不建议手动创建对象
+    RMVL_W IoParam() = default;
+
+    /**
+     * @brief 从指定 `YAML` 文件中加载，并读取至 `IoParam` 中
+     *
+     * @note `YAML` 文件的后缀允许是 `*.yml` 和 `*.yaml`
+     * @param[in] path 参数路径
+     * @return 是否读取成功
+     */
+    RMVL_W bool read(const std::string &path);
+
+    /**
+     * @brief 将 `IoParam` 的数据写入指定的 `YAML` 文件中
+     *
+     * @note `YAML` 文件的后缀允许是 `*.yml` 和 `*.yaml`
+     * @param[in] path 参数路径
+     * @return 是否写入成功
+     */
+    RMVL_W bool write(const std::string &path) const;
+};
+
+//! IoParam 参数模块
+RMVL_W_RW inline IoParam io_param;
+
+//! @} para_io
+
+} // namespace rm::para
@@ -0,0 +1,75 @@
+/**
+ * @file hik_light_control.h
+ * @author RMVL Community
+ * @brief HikLightControlParam module header file (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#pragma once
+
+#include <rmvl/rmvl_modules.hpp>
+
+#ifdef HAVE_OPENCV
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#else
+#include <string>
+#include <vector>
+#endif
+
+#include "rmvl/core/rmvldef.hpp"
+
+
+namespace rm::para {
+
+//! @addtogroup para_light
+//! @{
+//! @details
+//! - 类名： HikLightControlParam ，对应的全局参数变量： `rm::para::hik_light_control_param`
+//! @} para_light
+
+//! @addtogroup para_light
+//! @{
+
+////////////////////// 扩展部分 //////////////////////
+
+
+////////////////////// 参数部分 //////////////////////
+
+//! HikLightControlParam 参数模块
+class RMVL_EXPORTS_W HikLightControlParam {
+public:
+    //! 串口写入后的延时时间，单位 ms @details 默认值：`10`
+    RMVL_W_RW int64_t DELAY_AFTER_WRITE = 10;
+
+
+    //! 创建 HikLightControlParam 参数对象 @warning 不建议手动创建对象
+    RMVL_W HikLightControlParam() = default;
+
+    /**
+     * @brief 从指定 `YAML` 文件中加载，并读取至 `HikLightControlParam` 中
+     *
+     * @note `YAML` 文件的后缀允许是 `*.yml` 和 `*.yaml`
+     * @param[in] path 参数路径
+     * @return 是否读取成功
+     */
+    RMVL_W bool read(const std::string &path);
+
+    /**
+     * @brief 将 `HikLightControlParam` 的数据写入指定的 `YAML` 文件中
+     *
+     * @note `YAML` 文件的后缀允许是 `*.yml` 和 `*.yaml`
+     * @param[in] path 参数路径
+     * @return 是否写入成功
+     */
+    RMVL_W bool write(const std::string &path) const;
+};
+
+//! HikLightControlParam 参数模块
+RMVL_W_RW inline HikLightControlParam hik_light_control_param;
+
+//! @} para_light
+
+} // namespace rm::para
@@ -36,16 +36,17 @@ enum class ControlStatus : uint8_t {
  * @param[in] fb_in msg::JointState 表示的反馈值
  * @param[out] d_out std::vector 表示的期望值，供控制律计算使用
  * @param[out] fb_out std::vector 表示的反馈值，供控制律计算使用
- * @details 用户可自定义此类函数实现复杂的提取逻辑，如多字段融合等
+ * @details 用户可自定义此类函数实现复杂的提取逻辑，如多字段融合等。@p d_out 与 @p fb_out 是控制律预分配的缓冲区，
+ *          应通过拷贝赋值或 `assign` 写入以复用其容量，避免在控制周期内分配内存
  */
 using InSampleMapping = void (*)(const msg::JointState &d_in, const msg::JointState &fb_in, std::vector<double> &d_out, std::vector<double> &fb_out) noexcept;
 
 /**
  * @brief 输出采样映射，定义了如何将控制律计算结果写回 JointState 输出
  * @param[in] cmd_in std::vector 表示的控制量，这是控制律的直接输出
- * @param[out] cmd_out msg::JointState 表示的控制量，供用户使用
+ * @param[out] cmd_out msg::JointState 表示的控制量，供用户使用，应通过拷贝赋值或 `assign` 写入以复用其容量
  */
-using OutSampleMapping = void (*)(std::vector<double> cmd_in, msg::JointState &cmd_out) noexcept;
+using OutSampleMapping = void (*)(const std::vector<double> &cmd_in, msg::JointState &cmd_out) noexcept;
 
 //! 基础位置采样输入映射，从 position 字段提取
 void basic_pos_imapping(const msg::JointState &d_in, const msg::JointState &fb_in, std::vector<double> &d_out, std::vector<double> &fb_out) noexcept;
@@ -57,13 +58,13 @@ void basic_vel_imapping(const msg::JointState &d_in, const msg::JointState &fb_i
 void basic_eff_imapping(const msg::JointState &d_in, const msg::JointState &fb_in, std::vector<double> &d_out, std::vector<double> &fb_out) noexcept;
 
 //! 基础位置采样输出映射，将结果写回 position 字段
-void basic_pos_omapping(std::vector<double> cmd_in, msg::JointState &cmd_out) noexcept;
+void basic_pos_omapping(const std::vector<double> &cmd_in, msg::JointState &cmd_out) noexcept;
 
 //! 基础速度采样输出映射，将结果写回 velocity 字段
-void basic_vel_omapping(std::vector<double> cmd_in, msg::JointState &cmd_out) noexcept;
+void basic_vel_omapping(const std::vector<double> &cmd_in, msg::JointState &cmd_out) noexcept;
 
 //! 基础力矩采样输出映射，将结果写回 effort 字段
-void basic_eff_omapping(std::vector<double> cmd_in, msg::JointState &cmd_out) noexcept;
+void basic_eff_omapping(const std::vector<double> &cmd_in, msg::JointState &cmd_out) noexcept;
 
 /**
  * @brief 【控制律组件】控制律基类，供 RobotController 组合调用
@@ -93,6 +94,14 @@ public:
      */
     virtual void reset() noexcept = 0;
 
+    /**
+     * @brief 按自由度预分配内部缓冲区
+     * @details 在配置阶段调用后，维度不超过 @p dof 的 compute 不再分配内存
+     *
+     * @param[in] dof 自由度
+     */
+    void reserve(std::size_t dof);
+
     /**
      * @brief 执行一次控制计算
      * @details
@@ -103,7 +112,7 @@ public:
      * @param[in] desired 当前时刻期望状态
      * @param[in] fb 当前反馈状态
      * @param[in] period 控制周期（毫秒）
-     * @param[out] command 控制命令输出
+     * @param[out] command 控制命令输出，各字段容量足够时不会重新分配内存
      * @return 控制计算状态
      */
     ControlStatus compute(const msg::JointState &desired, const msg::JointState &fb, int32_t period, msg::JointState &command) noexcept;
@@ -116,7 +125,7 @@ protected:
      * @param[in] desired 期望状态向量
      * @param[in] fb 反馈状态向量
      * @param[in] period 控制周期（毫秒）
-     * @param[out] command 控制命令输出向量
+     * @param[out] command 控制命令输出向量，调用前已置为与 @p desired 等长的零向量，实现中应原位写入
      * @return 控制计算状态
      */
     virtual ControlStatus do_compute(const std::vector<double> &desired, const std::vector<double> &fb, int32_t period, std::vector<double> &command) noexcept = 0;
@@ -124,6 +133,10 @@ protected:
 private:
     InSampleMapping _input_fn;   //!< 输入采样映射函数
     OutSampleMapping _output_fn; //!< 输出采样映射函数
+
+    std::vector<double> _desired_vec{}; //!< 期望状态向量缓冲区
+    std::vector<double> _fb_vec{};      //!< 反馈状态向量缓冲区
+    std::vector<double> _cmd_vec{};     //!< 控制命令向量缓冲区
 };
 
 //! 【控制律组件】单位传递函数，\f$G(s)=1\f$
@@ -27,6 +27,8 @@
 #include "rmvlmsg/geometry/transform.hpp"
 #include "rmvlmsg/sensor/image.hpp"
 
+#include "rmvl/lpss/image_transport.hpp"
+
 namespace rm {
 
 //! @addtogroup lpss
@@ -136,6 +138,120 @@ cv::Mat from_msg(const msg::Image &img_msg);
  */
 msg::Image to_msg(cv::Mat img, uint8_t encoding);
 
+/**
+ * @brief 以 cv::Mat 头引用 Image 消息的像素缓冲区，不复制像素数据
+ * @note
+ * - 返回的矩阵不持有数据，不能在 @p img_msg 析构或 `data` 重新分配之后使用
+ * - 修改矩阵的像素即修改消息中的数据
+ *
+ * @param[in] img_msg Image 图像消息
+ * @return 引用消息数据的 cv::Mat，编码未知或数据长度与尺寸不符时返回空矩阵
+ */
+cv::Mat view(msg::Image &img_msg);
+
+/**
+ * @brief 以 cv::Mat 头引用 Image 消息的像素缓冲区，不复制像素数据
+ * @note
+ * - 返回的矩阵不持有数据，不能在 @p img_msg 析构或 `data` 重新分配之后使用
+ * - 消息为只读对象，不得通过返回的矩阵修改像素
+ *
+ * @param[in] img_msg Image 图像消息
+ * @return 引用消息数据的 cv::Mat，编码未知或数据长度与尺寸不符时返回空矩阵
+ */
+cv::Mat view(const msg::Image &img_msg);
+
+#if __cplusplus >= 202002L
+/**
+ * @brief 以 cv::Mat 头引用 Image 消息视图中的像素数据，用于订阅回调中零拷贝地处理接收缓冲区
+ * @note 返回的矩阵只在回调期间有效，且不得修改像素，需要保留时调用 `clone()`
+ *
+ * @param[in] img_view Image 消息视图
+ * @return 引用接收缓冲区的 cv::Mat，编码未知或数据长度与尺寸不符时返回空矩阵
+ */
+cv::Mat view(const msg::ImageView &img_view);
+#endif
+
+/**
+ * @brief 直接持有 cv::Mat 的图像消息，话题类型与 msg::Image 相同，均为 `sensor/Image`
+ * @details
+ * - 发布端构造时只增加 cv::Mat 的引用计数，不复制像素，序列化时按行直接写入发送缓冲区，省去 to_msg 的整帧复制
+ * - 订阅端反序列化时把像素一次性复制到新分配的 cv::Mat 中，省去 msg::Image 与 from_msg 的两次复制
+ * - 与使用 msg::Image 的发布者、订阅者可以互通
+ */
+class MatImage {
+public:
+    msg::Header header{}; //!< 消息头
+    uint8_t encoding{};   //!< 图像编码格式，必须是 msg::Image 中定义的编码类型之一
+    cv::Mat image{};      //!< 图像矩阵，可以是不连续的 ROI
+
+    static constexpr const char msg_type[] = "sensor/Image"; //!< 消息类型字符串常量
+
+#if __cplusplus >= 202002L
+    using View = msg::ImageView; //!< 对应的只读消息视图类型
+#endif
+
+    MatImage() = default;
+
+    /**
+     * @brief 持有已有的 cv::Mat 构造图像消息，不复制像素
+     *
+     * @param[in] img OpenCV 图像矩阵，`yuv420` 编码时行数为图像高度的 1.5 倍
+     * @param[in] enc 图像编码格式
+     * @param[in] hdr 消息头
+     */
+    MatImage(cv::Mat img, uint8_t enc, const msg::Header &hdr = {}) : header(hdr), encoding(enc), image(std::move(img)) {}
+
+    /**
+     * @brief 消息序列化，序列化结果与 msg::Image 一致
+     *
+     * @return 序列化后的字符串
+     */
+    std::string serialize() const noexcept;
+
+    /**
+     * @brief 消息反序列化
+     *
+     * @param[in] str 待反序列化的字符串指针
+     * @return 反序列化得到的消息对象，编码未知或数据长度与尺寸不符时图像矩阵为空
+     */
+    static MatImage deserialize(const char *const str) noexcept;
+
+    //! 获取消息紧凑序列化后的大小（单位：字节）
+    std::size_t compact_size() const noexcept;
+
+    //! 复制像素数据，构造 msg::Image 消息
+    msg::Image to_msg() const;
+};
+
+/**
+ * @brief 从 CompressedImage 消息解码为 cv::Mat
+ * @details 按消息中的 `format` 自动选择图像传输解码，差分帧依赖 @p decoder 中保存的关键帧
+ *
+ * @param[in] img_msg CompressedImage 图像消息
+ * @param[in,out] decoder 该话题使用的图像解码器
+ * @return cv::Mat 表示的图像矩阵，解码失败时返回空矩阵
+ */
+cv::Mat from_msg(const msg::CompressedImage &img_msg, lpss::ImageDecoder &decoder);
+
+/**
+ * @brief 从 CompressedImage 消息解码为 cv::Mat
+ * @details 使用临时的图像解码器，无法解码依赖关键帧的差分帧，连续接收图像流时应使用带 lpss::ImageDecoder 的重载
+ *
+ * @param[in] img_msg CompressedImage 图像消息
+ * @return cv::Mat 表示的图像矩阵，解码失败时返回空矩阵
+ */
+cv::Mat from_msg(const msg::CompressedImage &img_msg);
+
+/**
+ * @brief 从 cv::Mat 编码为 CompressedImage 消息
+ *
+ * @param[in] img OpenCV 图像矩阵
+ * @param[in] encoding 图像编码格式，必须是 msg::Image 中定义的编码类型之一
+ * @param[in,out] encoder 该话题使用的图像编码器
+ * @return CompressedImage 图像消息
+ */
+msg::CompressedImage to_msg(cv::Mat img, uint8_t encoding, lpss::ImageEncoder &encoder);
+
 } // namespace cvmsg
 
 //! @} lpss
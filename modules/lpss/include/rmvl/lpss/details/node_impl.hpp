@@ -27,7 +27,7 @@ void Publisher<MsgType>::publish(const MsgType &msg) {
 }
 
 template <typename MsgType, typename Enable>
-Publisher<MsgType> Node::createPublisher(std::string_view topic) noexcept {
+Publisher<MsgType> Node::createPublisher(std::string_view topic, const QoS &qos) noexcept {
     if (topic.size() > 63 || std::string_view(MsgType::msg_type).size() > 63) {
         WARNING_("[LPSS Node] MTP limits topic and message type names to 63 bytes");
         return nullptr;
@@ -36,14 +36,14 @@ Publisher<MsgType> Node::createPublisher(std::string_view topic) noexcept {
         return nullptr;
     Guid pub_guid = _uid;
     pub_guid.set_entity(_next_eid.fetch_add(1, std::memory_order_relaxed));
-    DataWriterBase::ptr writer = std::make_shared<DataWriter<MsgType>>(pub_guid, topic);
+    DataWriterBase::ptr writer = std::make_shared<DataWriter<MsgType>>(pub_guid, topic, qos, _domain);
     // 设置 SHM 通道和 UDPv4 缓存
     {
         std::shared_lock lk(_discovered_mtx);
         auto it = _discovered_readers.find(std::string(topic));
         if (it != _discovered_readers.end())
             for (const auto &[reader_guid, locator] : it->second.readers)
-                writer->add(reader_guid, locator);
+                writer->add(reader_guid, locator, it->second.multicast.count(reader_guid) != 0);
     }
     // 注册本地 DataWriter
     {
@@ -59,7 +59,7 @@ Publisher<MsgType> Node::createPublisher(std::string_view topic) noexcept {
 }
 
 template <typename MsgType, typename SubscribeMsgCallback, typename Enable>
-Subscriber<MsgType> Node::createSubscriber(std::string_view topic, SubscribeMsgCallback &&callback) noexcept {
+Subscriber<MsgType> Node::createSubscriber(std::string_view topic, SubscribeMsgCallback &&callback, const QoS &qos) noexcept {
     if (topic.size() > 63 || std::string_view(MsgType::msg_type).size() > 63) {
         WARNING_("[LPSS Node] MTP limits topic and message type names to 63 bytes");
         return nullptr;
@@ -69,7 +69,7 @@ Subscriber<MsgType> Node::createSubscriber(std::string_view topic, SubscribeMsgC
     Guid sub_guid = _uid;
     sub_guid.set_entity(_next_eid.fetch_add(1, std::memory_order_relaxed));
     // 注册本地 DataReader
-    DataReaderBase::ptr reader = std::make_shared<DataReader<MsgType>>(sub_guid, topic, callback);
+    DataReaderBase::ptr reader = std::make_shared<DataReader<MsgType>>(sub_guid, topic, callback, qos, _domain);
     {
         std::shared_lock lk(_discovered_mtx);
         auto it = _discovered_writers.find(std::string(topic));
@@ -82,7 +82,7 @@ Subscriber<MsgType> Node::createSubscriber(std::string_view topic, SubscribeMsgC
         _local_readers[std::string(topic)] = reader;
     }
     // 向已发现的节点发送 addReader 的 EDP 消息
-    REDPMessage redp_msg = REDPMessage::addReader(sub_guid, topic, reader->port(), reader->msgtype());
+    REDPMessage redp_msg = REDPMessage::addReader(sub_guid, topic, reader->port(), reader->msgtype(), reader->multicast());
     std::shared_lock lk(_discovered_mtx);
     for (const auto &discovered_node : _discovered_nodes)
         sendREDPMessage(discovered_node.second.ctrl_loc, redp_msg);
@@ -138,7 +138,7 @@ void Publisher<MsgType>::publish(const MsgType &msg) {
 }
 
 template <typename MsgType, typename Enable>
-typename Publisher<MsgType>::ptr Node::createPublisher(std::string_view topic) noexcept {
+typename Publisher<MsgType>::ptr Node::createPublisher(std::string_view topic, const QoS &qos) noexcept {
     if (topic.size() > 63 || std::string_view(MsgType::msg_type).size() > 63) {
         WARNING_("[LPSS Node] MTP limits topic and message type names to 63 bytes");
         return nullptr;
@@ -147,7 +147,8 @@ typename Publisher<MsgType>::ptr Node::createPublisher(std::string_view topic) n
         return nullptr;
     Guid pub_guid = _uid;
     pub_guid.set_entity(_next_eid++);
-    DataWriterBase::ptr writer = std::make_shared<DataWriter<MsgType>>(_ctx, pub_guid, topic);
+    DataWriterBase::ptr writer = std::make_shared<DataWriter<MsgType>>(_ctx, pub_guid, topic, qos);
+    writer->start();
     // 设置 SHM 通道和 UDPv4 缓存
     auto it = _discovered_readers.find(std::string(topic));
     if (it != _discovered_readers.end())
@@ -163,7 +164,7 @@ typename Publisher<MsgType>::ptr Node::createPublisher(std::string_view topic) n
 }
 
 template <typename MsgType, typename SubscribeMsgCallback, typename Enable>
-typename Subscriber<MsgType>::ptr Node::createSubscriber(std::string_view topic, SubscribeMsgCallback callback) noexcept {
+typename Subscriber<MsgType>::ptr Node::createSubscriber(std::string_view topic, SubscribeMsgCallback callback, const QoS &qos) noexcept {
     if (topic.size() > 63 || std::string_view(MsgType::msg_type).size() > 63) {
         WARNING_("[LPSS Node] MTP limits topic and message type names to 63 bytes");
         return nullptr;
@@ -173,7 +174,7 @@ typename Subscriber<MsgType>::ptr Node::createSubscriber(std::string_view topic,
     Guid sub_guid = _uid;
     sub_guid.set_entity(_next_eid++);
     // 注册本地 DataReader
-    auto typed_reader = std::make_shared<DataReader<MsgType>>(_ctx, sub_guid, topic, std::move(callback));
+    auto typed_reader = std::make_shared<DataReader<MsgType>>(_ctx, sub_guid, topic, std::move(callback), qos);
     DataReaderBase::ptr reader = typed_reader;
     auto writer_it = _discovered_writers.find(std::string(topic));
     if (writer_it != _discovered_writers.end())
@@ -361,6 +362,7 @@ template <typename MsgType>
 void Node::destroyPublisher(std::shared_ptr<Publisher<MsgType>> pub) {
     if (!pub || pub->invalid())
         return;
+    pub->_writer->stop();
     // 移除本地 DataWriter
     _local_writers.erase(pub->_topic);
     // 向已发现的节点发送 removeWriter 的 EDP 消息
@@ -13,7 +13,7 @@
 
 #include <atomic>
 #include <chrono>
-#include <map>
+#include <deque>
 #include <memory>
 #include <optional>
 #include <shared_mutex>
@@ -21,7 +21,13 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#include "rmvl/core/util.hpp"
 #include "rmvl/io/ipc.hpp"
+#include "rmvl/lpss/qos.hpp"
 
 #include "node_util.hpp"
 
@@ -31,8 +37,10 @@ namespace rm::lpss {
 
 //! MTP 数据发送目标
 struct MTPWriterTarget {
-    Locator locator{};  //!< 目标定位器
-    uint32_t mtu{1500}; //!< 发送目标对应的本地接口 MTU
+    Locator locator{};                 //!< 目标定位器
+    uint32_t mtu{1500};                //!< 发送目标对应的本地接口 MTU
+    bool multicast{};                  //!< 目标是否已加入话题的多播组
+    std::array<uint8_t, 4> outbound{}; //!< 发送目标对应的本地接口地址，用于选择多播出口
 };
 
 //! MTP 共享内存写入目标
@@ -67,17 +75,133 @@ struct MTPAsmKeyHash {
     }
 };
 
-//! MTP 未完成载荷
+/**
+ * @brief MTP 未完成载荷
+ * @details 分片直接写入按 `total_size` 预分配的缓冲区，以位图和计数器记录接收进度。非末尾分片的载荷大小在收到分片
+ *          0、任意两个不同分片或可判定为末尾的分片后确定，在此之前至多暂存一个无法定位的分片
+ */
 struct MTPAsm {
-    uint32_t total_size{};
-    std::map<uint16_t, std::string> fragments{};
-    std::size_t bytes{};
-    std::chrono::steady_clock::time_point updated{};
+    uint32_t total_size{};                                   //!< 载荷总大小
+    std::string data{};                                      //!< 预分配的完整载荷缓冲区
+    std::vector<uint64_t> received{};                        //!< 已接收分片位图
+    uint32_t capacity{};                                     //!< 非末尾分片的载荷大小，0 表示尚未确定
+    uint32_t fragment_count{};                               //!< 分片总数
+    uint32_t received_count{};                               //!< 已接收的分片数
+    uint32_t highest{};                                      //!< 已接收的最大分片 ID
+    std::optional<std::pair<uint16_t, std::string>> staged{}; //!< 分片大小确定前暂存的分片
+    std::chrono::steady_clock::time_point updated{};         //!< 最近一次收到分片的时间
+};
+
+//! MTP 数据来源索引，对应写入器的 UDPv4 通道地址
+struct MTPSourceKey {
+    std::string addr{};
+    uint16_t port{};
+
+    bool operator==(const MTPSourceKey &other) const noexcept { return addr == other.addr && port == other.port; }
+};
+
+struct MTPSourceKeyHash {
+    std::size_t operator()(const MTPSourceKey &key) const noexcept {
+        std::size_t seed = std::hash<std::string>{}(key.addr);
+        seed ^= static_cast<std::size_t>(key.port) + 0x9e3779b9U + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+};
+
+//! MTP 数据来源的接收状态，用于可靠传输的缺失检测与去重
+struct MTPSourceState {
+    uint16_t base{};                                 //!< 接收窗口起始序列号
+    uint64_t completed{};                            //!< 接收窗口内已完成重组的消息位图
+    bool reliable{};                                 //!< 是否已收到该来源的可靠传输心跳
+    std::chrono::steady_clock::time_point updated{}; //!< 最近一次收到该来源数据的时间
+};
+
+/**
+ * @brief MTP 分片重组器
+ * @details 按写入器地址、端口与序列号重组 UDPv4 分片，并维护可靠传输所需的来源接收窗口
+ */
+class MTPReassembler {
+public:
+    /**
+     * @brief 创建分片重组器
+     *
+     * @param[in] type 消息类型
+     * @param[in] topic 监听话题
+     */
+    MTPReassembler(std::string_view type, std::string_view topic) : _type(type), _topic(topic) {}
+
+    //! 获取 MTP 分片头部大小
+    std::size_t header_size() const noexcept;
+
+    /**
+     * @brief 接收一个 MTP 分片
+     *
+     * @param[in] header 分片头部
+     * @param[in] payload 分片载荷
+     * @param[in] addr 写入器地址
+     * @param[in] port 写入器端口
+     * @return 重组完成的完整载荷，未完成或分片无效时返回 std::nullopt
+     */
+    std::optional<std::string> fragment(std::string_view header, std::string_view payload, std::string_view addr, uint16_t port);
+
+    /**
+     * @brief 接收可靠写入器的心跳
+     *
+     * @param[in] data 心跳报文
+     * @param[in] addr 写入器地址
+     * @param[in] port 写入器端口
+     * @return 需要发送回写入器的 NACK 报文列表
+     */
+    std::vector<std::string> heartbeat(std::string_view data, std::string_view addr, uint16_t port);
+
+private:
+    std::string_view _type{};                                                      //!< 消息类型
+    std::string _topic{};                                                          //!< 监听话题
+    std::unordered_map<MTPAsmKey, MTPAsm, MTPAsmKeyHash> _asms{};                  //!< MTP 重组缓存
+    std::size_t _asm_bytes{};                                                      //!< 重组缓冲区占用字节数
+    std::unordered_map<MTPSourceKey, MTPSourceState, MTPSourceKeyHash> _sources{}; //!< MTP 数据来源接收状态
+};
+
+//! 写入器的历史消息，用于可靠传输的重传与本地暂存消息的补发
+struct MTPHistory {
+    uint16_t sequence{};                                 //!< 消息序列号
+    std::string data{};                                  //!< 完整载荷
+    std::unordered_map<uint64_t, uint8_t> retransmits{}; //!< 各读取器定位器已触发的重传次数
+    std::chrono::steady_clock::time_point stamp{};       //!< 写入时间，用于判断生命周期
+};
+
+/**
+ * @brief 截止期限监视器
+ * @details 记录最近一次事件的时间，相邻事件间隔内每完整经过一个截止期限计为一次错过，首个事件之前不计数
+ */
+class DeadlineMonitor {
+public:
+    /**
+     * @brief 创建截止期限监视器
+     *
+     * @param[in] deadline 截止期限，0 表示不检测
+     */
+    explicit DeadlineMonitor(std::chrono::milliseconds deadline) noexcept : _deadline(std::chrono::nanoseconds(deadline).count()) {}
+
+    //! 记录一次事件
+    void mark() noexcept;
+
+    //! 获取已错过的截止期限数，包含最近一次事件至今已经过的完整期限
+    uint64_t missed() const noexcept;
+
+private:
+    int64_t _deadline{};            //!< 截止期限（纳秒）
+    std::atomic_int64_t _last{};    //!< 最近一次事件的时间（纳秒），0 表示尚未发生
+    std::atomic_uint64_t _missed{}; //!< 已结算的错过次数
 };
 
 /**
  * @brief 数据写入器基类
- * @details 每个 DataWriter 都对应一个动态分配端口的 UDPv4 通道以及设置指定话题的 MPMC SHM 通道
+ * @details
+ * - 每个 DataWriter 都对应一个动态分配端口的 UDPv4 通道以及设置指定话题的 MPMC SHM 通道
+ * - 可靠写入器额外缓存最近的消息，并在后台线程中周期发送心跳、响应读取器的 NACK 重传请求
+ * - 多播写入器对同一出口接口下已加入多播组的读取器只发送一份数据，心跳与重传仍使用单播
+ * - 本地暂存写入器在匹配到新的读取器时补发缓存的历史消息
  */
 class DataWriterBase {
 public:
@@ -89,10 +213,12 @@ public:
      * @param[in] guid 含 Entity ID 的 GUID
      * @param[in] type 消息类型，使用 `<MsgType>::msg_type` 获取
      * @param[in] topic 写入话题，用于共享内存通道
+     * @param[in] qos 服务质量配置
+     * @param[in] domain 域 ID，用于确定话题的多播组
      */
-    DataWriterBase(const Guid &guid, std::string_view type, std::string_view topic);
+    DataWriterBase(const Guid &guid, std::string_view type, std::string_view topic, const QoS &qos = {}, uint8_t domain = 0);
 
-    virtual ~DataWriterBase() = default;
+    virtual ~DataWriterBase();
 
     //! 获取写入器所属实体 GUID
     inline const Guid &guid() const noexcept { return _guid; }
@@ -100,13 +226,20 @@ public:
     //! 获取写入话题的消息类型
     inline std::string_view msgtype() const noexcept { return _type; }
 
+    //! 获取服务质量配置
+    inline const QoS &qos() const noexcept { return _qos; }
+
+    //! 获取错过的写入截止期限数
+    inline uint64_t missedDeadlines() const noexcept { return _deadline.missed(); }
+
     /**
      * @brief 添加数据接收端点
      *
      * @param[in] guid 端点所属实体 GUID，根据 GUID MAC 区分 SHM 或 UDPv4 通道
      * @param[in] loc 端点监听定位器，用于 UDPv4 通道，端口部分同样作为 SHM 通道标识
+     * @param[in] multicast 端点是否已加入话题的多播组
      */
-    void add(const Guid &guid, Locator loc) noexcept;
+    void add(const Guid &guid, Locator loc, bool multicast = false) noexcept;
 
     /**
      * @brief 移除数据接收端点
@@ -135,6 +268,44 @@ protected:
     //! 目标共享内存通道缓存集合
     std::unordered_map<Guid, MTPShmTarget, GuidHash> _shm_targets;
     std::atomic_uint16_t _sequence{}; //!< MTP 发送序列号
+    Locator _group{};                 //!< 话题的多播组定位器，未启用多播时无效
+
+    QoS _qos{};                        //!< 服务质量配置
+    std::mutex _history_mtx{};         //!< 保护历史消息
+    std::deque<MTPHistory> _history{}; //!< 可靠传输的历史消息
+    std::atomic_uint8_t _heartbeats{}; //!< 剩余的心跳重发次数
+    std::atomic_bool _running{true};   //!< 可靠传输服务线程运行状态
+    std::thread _reliable_thrd{};      //!< 可靠传输服务线程
+    DeadlineMonitor _deadline;         //!< 写入截止期限监视器
+
+private:
+    //! 是否需要保留历史消息
+    bool keep_history() const noexcept;
+
+    //! 历史消息是否已超出生命周期
+    bool expired(const MTPHistory &entry, std::chrono::steady_clock::time_point now) const noexcept;
+
+    /**
+     * @brief 向新匹配的读取器补发缓存的历史消息
+     *
+     * @param[in] guid 读取器所属实体 GUID
+     */
+    void replay(const Guid &guid);
+
+    //! 可靠传输服务：周期发送心跳并响应 NACK
+    void reliable_service();
+
+    //! 向全部 UDPv4 目标发送心跳
+    void send_heartbeat();
+
+    /**
+     * @brief 处理读取器发送的 NACK 并重传缺失的分片
+     *
+     * @param[in] data NACK 数据报
+     * @param[in] addr NACK 发送方地址
+     * @param[in] port NACK 发送方端口
+     */
+    void retransmit(std::string_view data, std::string_view addr, uint16_t port);
 };
 
 //! 发现的发布者端点存储信息
@@ -145,7 +316,9 @@ struct DiscoveredWriterStorageInfo {
 
 /**
  * @brief 数据读取器基类
- * @details 每个 DataReader 都对应一个监听端口的 UDPv4 通道以及设置指定话题的 MPMC SHM 通道
+ * @details
+ * - 每个 DataReader 都对应一个监听端口的 UDPv4 通道以及设置指定话题的 MPMC SHM 通道
+ * - 启用多播的 DataReader 额外监听话题的多播组，加入失败时仅使用单播
  */
 class DataReaderBase {
 public:
@@ -157,8 +330,10 @@ public:
      * @param[in] guid 含 Entity ID 的 GUID
      * @param[in] type 消息类型，使用 `<MsgType>::msg_type` 获取`
      * @param[in] topic 监听话题，用于共享内存通道
+     * @param[in] qos 服务质量配置
+     * @param[in] domain 域 ID，用于确定话题的多播组
      */
-    DataReaderBase(const Guid &guid, std::string_view type, std::string_view topic);
+    DataReaderBase(const Guid &guid, std::string_view type, std::string_view topic, const QoS &qos = {}, uint8_t domain = 0);
 
     virtual ~DataReaderBase() = default;
 
@@ -181,6 +356,12 @@ public:
     //! 获取监听的端口
     inline uint16_t port() const noexcept { return _port; }
 
+    //! 是否已加入话题的多播组
+    inline bool multicast() const noexcept { return _multicast.has_value(); }
+
+    //! 获取错过的接收截止期限数
+    inline uint64_t missedDeadlines() const noexcept { return _deadline.missed(); }
+
     /**
      * @brief 添加数据写入端点
      *
@@ -199,15 +380,58 @@ protected:
     uint16_t _port{};                                                //!< 监听端口
     Guid _guid;                                                      //!< 读取器所属实体 GUID
     DgramSocket _udpv4;                                              //!< UDPv4 通道
+    std::optional<DgramSocket> _multicast{};                         //!< 多播通道，未启用或加入多播组失败时为空
     std::string_view _type{};                                        //!< 消息类型
     std::string _topic{};                                            //!< 监听话题
     std::atomic_bool _stopped{};                                     //!< 是否已停止读取
-    std::unordered_map<MTPAsmKey, MTPAsm, MTPAsmKeyHash> _asms{};    //!< MTP 重组缓存
-    std::size_t _asm_bytes{};                                        //!< 待重组载荷占用字节数
+    MTPReassembler _reassembler;                                     //!< MTP 分片重组器
     std::shared_mutex _shm_mtx{};                                    //!< 保护共享内存读取源
     std::unordered_map<Guid, MTPShmSource, GuidHash> _shm_sources{}; //!< 共享内存读取源缓存集合
+    DeadlineMonitor _deadline;                                       //!< 接收截止期限监视器
+
+private:
+    //! 从共享内存与 UDPv4 通道接收一条完整消息
+    std::string receive() noexcept;
 };
 
+//! 判断回调函数是否仅接收消息视图 `MsgType::View`，同时接收消息本身时优先使用消息
+template <typename MsgType, typename Callback, typename = void>
+struct is_view_callback : std::false_type {};
+
+#if __cplusplus >= 202002L
+template <typename MsgType, typename Callback>
+struct is_view_callback<MsgType, Callback, std::void_t<typename MsgType::View>>
+    : std::bool_constant<!std::is_invocable_v<Callback, const MsgType &> && std::is_invocable_v<Callback, const typename MsgType::View &>> {};
+#endif
+
+template <typename MsgType, typename Callback>
+constexpr bool is_view_callback_v = is_view_callback<MsgType, Callback>::value;
+
+//! 判断回调函数是否可作为 `MsgType` 的订阅回调
+template <typename MsgType, typename Callback>
+constexpr bool is_msg_callback_v = std::is_invocable_v<Callback, const MsgType &> || is_view_callback_v<MsgType, Callback>;
+
+/**
+ * @brief 将接收到的完整载荷分发至订阅回调
+ * @details 视图回调在数据越界或长度不一致时丢弃该载荷，消息回调沿用 `MsgType::deserialize`
+ *
+ * @param[in] cb 订阅回调函数
+ * @param[in] data 接收到的完整载荷
+ */
+template <typename MsgType, typename Callback>
+inline void dispatch_msg(Callback &cb, const std::string &data) {
+#if __cplusplus >= 202002L
+    if constexpr (is_view_callback_v<MsgType, Callback>) {
+        auto view = MsgType::View::parse(std::as_bytes(std::span(data.data(), data.size())));
+        if (view)
+            cb(*view);
+        else
+            WARNING_("[LPSS MTP] Dropped a malformed '%s' message of %zu bytes", MsgType::msg_type, data.size());
+    } else
+#endif
+        cb(MsgType::deserialize(data.data()));
+}
+
 /**
  * @brief 底层数据写入器
  * @details
@@ -219,7 +443,8 @@ protected:
 template <typename MsgType>
 class DataWriter : public DataWriterBase {
 public:
-    DataWriter(const Guid &guid, std::string_view topic) : DataWriterBase(guid, MsgType::msg_type, topic) {}
+    DataWriter(const Guid &guid, std::string_view topic, const QoS &qos = {}, uint8_t domain = 0)
+        : DataWriterBase(guid, MsgType::msg_type, topic, qos, domain) {}
 };
 
 /**
@@ -239,9 +464,12 @@ public:
      * @param[in] guid 含 Entity ID 的 GUID
      * @param[in] topic 监听话题，用于共享内存通道，UDPv4 通道的监听端口自动分配
      * @param[in] callback 消息回调函数
+     * @param[in] qos 服务质量配置
+     * @param[in] domain 域 ID，用于确定话题的多播组
      */
-    template <typename Callback, typename = std::enable_if_t<std::is_invocable_v<Callback, const MsgType &>>>
-    DataReader(const Guid &guid, std::string_view topic, Callback callback) : DataReaderBase(guid, MsgType::msg_type, topic) {
+    template <typename Callback, typename = std::enable_if_t<is_msg_callback_v<MsgType, Callback>>>
+    DataReader(const Guid &guid, std::string_view topic, Callback callback, const QoS &qos = {}, uint8_t domain = 0)
+        : DataReaderBase(guid, MsgType::msg_type, topic, qos, domain) {
         _thrd = std::thread([this, cb = std::move(callback)]() {
             while (_running.load(std::memory_order_acquire)) {
                 auto data = this->read();
@@ -249,7 +477,7 @@ public:
                     break;
                 if (data.empty())
                     continue;
-                cb(MsgType::deserialize(data.data()));
+                dispatch_msg<MsgType>(cb, data);
             }
         });
     }
@@ -276,9 +504,13 @@ namespace async {
 
 /**
  * @brief 异步数据写入器基类
- * @details 每个 async::DataWriter 都对应一个动态分配端口的 UDPv4 通道以及设置指定话题的 MPMC SHM 通道
+ * @details
+ * - 每个 async::DataWriter 都对应一个动态分配端口的 UDPv4 通道以及设置指定话题的 MPMC SHM 通道
+ * - 可靠写入器额外缓存最近的消息，并在协程中周期发送心跳、响应读取器的 NACK 重传请求
+ * - 本地暂存写入器在匹配到新的读取器时补发缓存的历史消息
+ * - 不支持多播数据通道，`QoS::multicast` 被忽略
  */
-class DataWriterBase {
+class DataWriterBase : public std::enable_shared_from_this<DataWriterBase> {
 public:
     using ptr = std::shared_ptr<DataWriterBase>;
 
@@ -289,8 +521,9 @@ public:
      * @param[in] guid 含 Entity ID 的 GUID
      * @param[in] type 消息类型，使用 `<MsgType>::msg_type` 获取
      * @param[in] topic 写入话题，用于共享内存通道
+     * @param[in] qos 服务质量配置
      */
-    DataWriterBase(rm::async::IOContext &io_context, const Guid &guid, std::string_view type, std::string_view topic);
+    DataWriterBase(rm::async::IOContext &io_context, const Guid &guid, std::string_view type, std::string_view topic, const QoS &qos = {});
 
     virtual ~DataWriterBase() = default;
 
@@ -300,11 +533,26 @@ public:
     //! 获取写入话题的消息类型
     inline std::string_view msgtype() const noexcept { return _type; }
 
+    //! 获取服务质量配置
+    inline const QoS &qos() const noexcept { return _qos; }
+
+    //! 获取错过的写入截止期限数
+    inline uint64_t missedDeadlines() const noexcept { return _deadline.missed(); }
+
     //! 是否已匹配数据接收端点
     inline bool matched() const noexcept { return !_udpv4_targets.empty() || !_shm_targets.empty(); }
 
+    //! @cond
+    //! 启动可靠传输的心跳与 NACK 处理协程，写入器需由 `std::shared_ptr` 管理
+    void start();
+    //! @endcond
+
+    //! 停止可靠传输协程
+    void stop() noexcept;
+
     /**
      * @brief 添加数据接收端点
+     * @note 本地暂存写入器向新端点补发历史消息时需由 `std::shared_ptr` 管理
      *
      * @param[in] guid 端点所属实体 GUID，根据 GUID MAC 区分 SHM 或 UDPv4 通道
      * @param[in] loc 端点监听定位器，用于 UDPv4 通道，端口部分同样作为 SHM 通道标识
@@ -338,11 +586,75 @@ protected:
     std::atomic_uint16_t _sequence{};      //!< MTP 发送序列号
     std::optional<std::string> _pending{}; //!< 发送中收到的最新待发送消息
     bool _sending{};                       //!< 是否已有发送协程正在运行
+
+    rm::async::IOContextRef _ctx;      //!< 异步 IO 上下文引用
+    QoS _qos{};                        //!< 服务质量配置
+    std::deque<MTPHistory> _history{}; //!< 可靠传输与本地暂存的历史消息
+    uint8_t _heartbeats{};             //!< 剩余的心跳重发次数
+    bool _running{true};               //!< 可靠传输协程运行状态
+    DeadlineMonitor _deadline;         //!< 写入截止期限监视器
+
+private:
+    //! 是否需要保留历史消息
+    bool keep_history() const noexcept;
+
+    //! 历史消息是否已超出生命周期
+    bool expired(const MTPHistory &entry, std::chrono::steady_clock::time_point now) const noexcept;
+
+    /**
+     * @brief 向定位器发送一个数据报
+     * @note 可靠写入器的套接字上始终挂起 NACK 读取，同一描述符不能再注册写事件，此时改用同步发送
+     *
+     * @param[in] loc 目标定位器
+     * @param[in] head 数据报头部
+     * @param[in] payload 紧随头部的载荷，可为空
+     * @return 是否发送成功
+     */
+    rm::async::Task<bool> send_datagram(const Locator &loc, std::string_view head, std::string_view payload = {});
+
+    /**
+     * @brief 向 UDPv4 目标发送一条消息的分片
+     *
+     * @param[in] target 目标定位器与 MTU
+     * @param[in] data 完整载荷
+     * @param[in] sequence 消息序列号
+     * @param[in] bits NACK 位图覆盖的分片数量，`bitmap` 为空时发送全部分片
+     * @param[in] bitmap NACK 缺失分片位图
+     */
+    rm::async::Task<> send_fragments(const MTPWriterTarget &target, std::string_view data, uint16_t sequence,
+                                     uint32_t bits = 0, std::string_view bitmap = {});
+
+    /**
+     * @brief 向新匹配的读取器补发缓存的历史消息
+     *
+     * @param[in] guid 读取器所属实体 GUID
+     */
+    rm::async::Task<> replay(Guid guid);
+
+    //! 可靠传输服务：响应 NACK
+    rm::async::Task<> reliable_service();
+
+    //! 可靠传输服务：周期发送心跳
+    rm::async::Task<> heartbeat_service();
+
+    //! 向全部 UDPv4 目标发送心跳
+    rm::async::Task<> send_heartbeat();
+
+    /**
+     * @brief 处理读取器发送的 NACK 并重传缺失的分片
+     *
+     * @param[in] data NACK 数据报
+     * @param[in] addr NACK 发送方地址
+     * @param[in] port NACK 发送方端口
+     */
+    rm::async::Task<> retransmit(std::string data, std::string addr, uint16_t port);
 };
 
 /**
  * @brief 异步数据读取器基类
- * @details 每个 async::DataReader 都对应一个监听端口的 UDPv4 通道以及设置指定话题的 MPMC SHM 通道
+ * @details
+ * - 每个 async::DataReader 都对应一个监听端口的 UDPv4 通道以及设置指定话题的 MPMC SHM 通道
+ * - 收到可靠写入器的心跳后自动以 NACK 请求重传，不加入多播组
  */
 class DataReaderBase {
 public:
@@ -355,8 +667,9 @@ public:
      * @param[in] guid 含 Entity ID 的 GUID
      * @param[in] type 消息类型，使用 `<MsgType>::msg_type` 获取
      * @param[in] topic 监听话题，用于共享内存通道
+     * @param[in] qos 服务质量配置，仅使用其中的截止期限
      */
-    DataReaderBase(rm::async::IOContext &io_context, const Guid &guid, std::string_view type, std::string_view topic);
+    DataReaderBase(rm::async::IOContext &io_context, const Guid &guid, std::string_view type, std::string_view topic, const QoS &qos = {});
 
     virtual ~DataReaderBase() = default;
 
@@ -382,6 +695,9 @@ public:
     //! 是否已匹配数据写入端点
     inline bool matched() const noexcept { return !_matched_writers.empty(); }
 
+    //! 获取错过的接收截止期限数
+    inline uint64_t missedDeadlines() const noexcept { return _deadline.missed(); }
+
     /**
      * @brief 添加数据写入端点
      *
@@ -402,10 +718,10 @@ protected:
     rm::async::DgramSocket _udpv4;                                   //!< UDPv4 通道
     std::string_view _type{};                                        //!< 消息类型
     std::string _topic{};                                            //!< 监听话题
-    std::unordered_map<MTPAsmKey, MTPAsm, MTPAsmKeyHash> _asms{};    //!< MTP 重组缓存
-    std::size_t _asm_bytes{};                                        //!< 待重组载荷占用字节数
+    MTPReassembler _reassembler;                                     //!< MTP 分片重组器
     std::unordered_set<Guid, GuidHash> _matched_writers{};           //!< 已匹配数据写入端点
     std::unordered_map<Guid, MTPShmSource, GuidHash> _shm_sources{}; //!< 共享内存读取源缓存集合
+    DeadlineMonitor _deadline;                                       //!< 接收截止期限监视器
 };
 
 /**
@@ -419,7 +735,8 @@ protected:
 template <typename MsgType>
 class DataWriter : public DataWriterBase {
 public:
-    DataWriter(rm::async::IOContext &io_context, const Guid &guid, std::string_view topic) : DataWriterBase(io_context, guid, MsgType::msg_type, topic) {}
+    DataWriter(rm::async::IOContext &io_context, const Guid &guid, std::string_view topic, const QoS &qos = {})
+        : DataWriterBase(io_context, guid, MsgType::msg_type, topic, qos) {}
 };
 
 /**
@@ -434,7 +751,7 @@ template <typename MsgType>
 class DataReader : public DataReaderBase, public std::enable_shared_from_this<DataReader<MsgType>> {
 public:
     using ptr = std::shared_ptr<DataReader<MsgType>>;
-    using CallbackType = std::function<void(const MsgType &)>;
+    using CallbackType = std::function<void(const std::string &)>;
 
     /**
      * @brief 创建数据读取器
@@ -442,10 +759,12 @@ public:
      * @param[in] guid 含 Entity ID 的 GUID
      * @param[in] topic 监听话题，用于共享内存通道，UDPv4 通道的监听端口自动分配
      * @param[in] callback 消息回调函数
+     * @param[in] qos 服务质量配置
      */
-    template <typename Callback, typename = std::enable_if_t<std::is_invocable_v<Callback, const MsgType &>>>
-    DataReader(rm::async::IOContext &io_context, const Guid &guid, std::string_view topic, Callback callback)
-        : DataReaderBase(io_context, guid, MsgType::msg_type, topic), _ctx(io_context), _callback(std::move(callback)) {}
+    template <typename Callback, typename = std::enable_if_t<is_msg_callback_v<MsgType, Callback>>>
+    DataReader(rm::async::IOContext &io_context, const Guid &guid, std::string_view topic, Callback callback, const QoS &qos = {})
+        : DataReaderBase(io_context, guid, MsgType::msg_type, topic, qos), _ctx(io_context),
+          _callback([cb = std::move(callback)](const std::string &data) mutable { dispatch_msg<MsgType>(cb, data); }) {}
 
     //! @cond
     void start() { co_spawn(_ctx, &DataReader<MsgType>::read_task, this->shared_from_this()); }
@@ -461,7 +780,7 @@ private:
                 co_return;
             if (data.empty())
                 continue;
-            _callback(MsgType::deserialize(data.data()));
+            _callback(data);
         }
     }
 
@@ -15,6 +15,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "node_util.hpp"
 
@@ -45,8 +46,8 @@ struct REDPMessage {
     static REDPMessage deserialize(const char *data) noexcept;
 
     //! 创建添加读取端点消息
-    static inline REDPMessage addReader(const Guid &g, std::string_view topic, uint16_t port, std::string_view msgtype) noexcept {
-        return {Action::Add, Type::Reader, g, port, std::string(topic), std::string(msgtype)};
+    static inline REDPMessage addReader(const Guid &g, std::string_view topic, uint16_t port, std::string_view msgtype, bool multicast = false) noexcept {
+        return {Action::Add, Type::Reader, g, port, std::string(topic), std::string(msgtype), multicast};
     }
 
     //! 创建添加写入端点消息
@@ -78,6 +79,7 @@ struct REDPMessage {
     uint16_t port{};       //!< 监听端口
     std::string topic{};   //!< 话题名称
     std::string msgtype{}; //!< 消息类型
+    bool multicast{};      //!< 读取端点是否已加入话题的多播组
 };
 
 //! 节点存储信息
@@ -90,6 +92,7 @@ struct NodeStorageInfo {
 //! 发现的订阅者端点存储信息
 struct DiscoveredReaderStorageInfo {
     std::unordered_map<Guid, Locator, GuidHash> readers; //!< 相关的端点 GUID 与定位器映射表 [Guid: Locator]
+    std::unordered_set<Guid, GuidHash> multicast;        //!< 已加入话题多播组的端点 GUID 集合
     std::string msgtype;                                 //!< 消息类型
 };
 
@@ -0,0 +1,171 @@
+/**
+ * @file image_transport.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 可插拔的图像传输编解码
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "rmvlmsg/sensor/compressed_image.hpp"
+#include "rmvlmsg/sensor/image.hpp"
+
+namespace rm::lpss {
+
+//! @defgroup lpss_image_transport 图像传输
+//! @ingroup lpss
+//! @{
+//! @brief 以 `sensor/CompressedImage` 消息在话题上传输编码后的图像，编码方式按发布者选择，订阅者按消息中的 `format` 自动解码
+//! @details 内置的图像传输包括
+//! - `raw`：不压缩，支持全部像素编码
+//! - `qoi`：QOI 风格的无损压缩，支持 8 位 1/3/4 通道的像素编码
+//! - `delta`：关键帧 + 差分帧，关键帧以 `qoi` 无损压缩，差分帧仅记录与关键帧不同的字节，适合大部分区域静止的场景
+//! - `jpeg`、`png`：基于 OpenCV 编解码器的有损/无损压缩，仅在启用 OpenCV 时可用
+
+//! 图像传输参数
+struct ImageTransportOptions {
+    int quality{90};                //!< `jpeg` 压缩质量 [0, 100]
+    int compression{1};             //!< `png` 压缩等级 [0, 9]
+    uint32_t keyframe_interval{30}; //!< `delta` 关键帧间隔（帧），为 0 时仅在图像尺寸或编码变化时发送关键帧
+    uint8_t delta_threshold{0};     //!< `delta` 差分阈值，与关键帧之差不超过该值的字节视为未变化，为 0 时无损
+};
+
+//! 图像传输编解码器接口，每个实例只服务于一路图像流，可以在编解码之间保存状态
+class ImageTransport {
+public:
+    using ptr = std::unique_ptr<ImageTransport>;
+
+    virtual ~ImageTransport() = default;
+
+    /**
+     * @brief 编码图像
+     * @details 调用方负责填写 `header`、`height`、`width`、`encoding`、`format` 与 `sequence`，编码器负责 `reference` 与 `data`
+     *
+     * @param[in] image 原始图像
+     * @param[in,out] packet 编码结果
+     * @return 是否编码成功，不支持的像素编码返回 `false`
+     */
+    virtual bool encode(const msg::Image &image, msg::CompressedImage &packet) = 0;
+
+    /**
+     * @brief 解码图像
+     *
+     * @param[in] packet 编码后的图像
+     * @param[out] image 解码结果，`header`、`height`、`width` 与 `encoding` 已由调用方填写
+     * @return 是否解码成功，数据损坏或缺少依赖的关键帧时返回 `false`
+     */
+    virtual bool decode(const msg::CompressedImage &packet, msg::Image &image) = 0;
+};
+
+//! 图像传输工厂函数
+using ImageTransportFactory = std::function<ImageTransport::ptr(const ImageTransportOptions &)>;
+
+/**
+ * @brief 注册图像传输
+ *
+ * @param[in] name 图像传输名称，即 `sensor/CompressedImage` 中的 `format`
+ * @param[in] factory 工厂函数
+ * @return 是否注册成功，名称已存在时返回 `false`
+ */
+bool registerImageTransport(std::string_view name, ImageTransportFactory factory);
+
+/**
+ * @brief 创建图像传输实例
+ *
+ * @param[in] name 图像传输名称
+ * @param[in] options 图像传输参数
+ * @return 图像传输实例，名称不存在时返回空指针
+ */
+ImageTransport::ptr createImageTransport(std::string_view name, const ImageTransportOptions &options = {});
+
+//! 获取全部已注册的图像传输名称
+std::vector<std::string> imageTransports();
+
+//! 发布端图像编码器，每个话题使用一个实例
+class ImageEncoder {
+public:
+    /**
+     * @brief 创建图像编码器
+     *
+     * @param[in] transport 图像传输名称
+     * @param[in] options 图像传输参数
+     */
+    explicit ImageEncoder(std::string_view transport = "raw", const ImageTransportOptions &options = {});
+
+    /**
+     * @brief 编码图像
+     * @details 选定的图像传输不支持该图像的像素编码时，以 `raw` 格式发送
+     *
+     * @param[in] image 原始图像
+     * @param[out] packet 编码结果，可在多帧之间复用以减少内存分配
+     */
+    void encode(const msg::Image &image, msg::CompressedImage &packet);
+
+    /**
+     * @brief 编码图像
+     *
+     * @param[in] image 原始图像
+     * @return 编码结果
+     */
+    msg::CompressedImage encode(const msg::Image &image);
+
+    //! 图像传输名称
+    const std::string &transport() const noexcept { return _name; }
+
+private:
+    std::string _name{};
+    ImageTransport::ptr _transport{};
+    ImageTransport::ptr _raw{};
+    uint32_t _sequence{};
+};
+
+//! 订阅端图像解码器，按消息中的 `format` 自动选择图像传输，每个话题使用一个实例
+class ImageDecoder {
+public:
+    ImageDecoder() = default;
+
+    /**
+     * @brief 解码图像
+     *
+     * @param[in] packet 编码后的图像
+     * @param[out] image 解码结果，可在多帧之间复用以减少内存分配
+     * @return 是否解码成功，未注册的格式、数据损坏或缺少依赖的关键帧时返回 `false`
+     */
+    bool decode(const msg::CompressedImage &packet, msg::Image &image);
+
+    /**
+     * @brief 解码图像
+     *
+     * @param[in] packet 编码后的图像
+     * @return 解码结果，失败时返回空图像
+     */
+    msg::Image decode(const msg::CompressedImage &packet);
+
+private:
+    std::unordered_map<std::string, ImageTransport::ptr> _transports{};
+};
+
+/**
+ * @brief 获取图像数据应有的字节数
+ *
+ * @param[in] height 图像高度
+ * @param[in] width 图像宽度
+ * @param[in] encoding 像素编码
+ * @return 图像数据字节数，未知编码或尺寸非法时返回 0
+ */
+std::size_t imageBytes(int32_t height, int32_t width, uint8_t encoding) noexcept;
+
+//! @} lpss_image_transport
+
+} // namespace rm::lpss
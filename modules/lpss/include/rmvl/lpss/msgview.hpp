@@ -0,0 +1,332 @@
+/**
+ * @file msgview.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief LPSS 消息视图工具，为自动生成的 `<MsgType>View` 提供带边界检查的只读解析能力
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#if __cplusplus >= 202002L
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace rm::msg {
+
+//! @addtogroup rmvlmsg
+//! @{
+
+template <typename Tp>
+class ArrayView;
+
+/**
+ * @brief 带边界检查的消息视图读取游标
+ * @details 所有读取操作在剩余字节不足时返回 `false` 且不移动游标，读取成功时游标前移相应字节数
+ */
+class ViewReader {
+public:
+    ViewReader() = default;
+
+    /**
+     * @brief 创建读取游标
+     *
+     * @param[in] buf 待解析的字节缓冲区
+     */
+    explicit ViewReader(std::span<const std::byte> buf) noexcept : _p(buf.data()), _end(buf.data() + buf.size()) {}
+
+    //! 获取当前读取位置
+    const std::byte *pos() const noexcept { return _p; }
+
+    //! 获取剩余可读取字节数
+    std::size_t remain() const noexcept { return static_cast<std::size_t>(_end - _p); }
+
+    /**
+     * @brief 读取标量
+     *
+     * @param[out] value 读取到的标量，`bool` 类型按非零字节解释
+     * @return 是否读取成功
+     */
+    template <typename Tp>
+    bool scalar(Tp &value) noexcept {
+        if (remain() < sizeof(Tp))
+            return false;
+        if constexpr (std::is_same_v<Tp, bool>)
+            value = std::to_integer<uint8_t>(*_p) != 0;
+        else
+            std::memcpy(&value, _p, sizeof(Tp));
+        _p += sizeof(Tp);
+        return true;
+    }
+
+    /**
+     * @brief 截取指定字节数的原始数据
+     *
+     * @param[in] size 截取的字节数
+     * @param[out] data 截取到的数据首地址
+     * @return 是否截取成功
+     */
+    bool take(std::size_t size, const std::byte *&data) noexcept {
+        if (remain() < size)
+            return false;
+        data = _p;
+        _p += size;
+        return true;
+    }
+
+    /**
+     * @brief 读取带 `uint32_t` 长度前缀的字符串
+     *
+     * @param[out] str 指向缓冲区的字符串视图
+     * @return 是否读取成功
+     */
+    bool string(std::string_view &str) noexcept {
+        auto saved = _p;
+        uint32_t size{};
+        const std::byte *data{};
+        if (!scalar(size) || !take(size, data)) {
+            _p = saved;
+            return false;
+        }
+        str = {reinterpret_cast<const char *>(data), size};
+        return true;
+    }
+
+    /**
+     * @brief 读取单字节元素数组
+     *
+     * @param[in] count 元素个数
+     * @param[out] out 指向缓冲区的连续数组视图
+     * @return 是否读取成功
+     */
+    template <typename Tp>
+    bool bytes(std::size_t count, std::span<const Tp> &out) noexcept {
+        static_assert(sizeof(Tp) == 1, "bytes() only supports single-byte element types");
+        const std::byte *data{};
+        if (!take(count, data))
+            return false;
+        out = {reinterpret_cast<const Tp *>(data), count};
+        return true;
+    }
+
+    /**
+     * @brief 读取多字节基础类型数组
+     *
+     * @param[in] count 元素个数
+     * @param[out] out 指向缓冲区的数组视图
+     * @return 是否读取成功
+     */
+    template <typename Tp>
+    bool array(std::size_t count, ArrayView<Tp> &out) noexcept {
+        const std::byte *data{};
+        if (count > remain() / sizeof(Tp) || !take(count * sizeof(Tp), data))
+            return false;
+        out = {data, count};
+        return true;
+    }
+
+private:
+    const std::byte *_p{};   //!< 当前读取位置
+    const std::byte *_end{}; //!< 缓冲区末尾
+};
+
+/**
+ * @brief 多字节基础类型数组视图
+ * @details 接收缓冲区不保证元素对齐，因此元素通过 `memcpy` 按值读取
+ *
+ * @tparam Tp 元素类型
+ */
+template <typename Tp>
+class ArrayView {
+    static_assert(std::is_trivially_copyable_v<Tp>, "ArrayView only supports trivially copyable element types");
+
+public:
+    //! 数组视图只读迭代器
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Tp;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Tp;
+
+        iterator() = default;
+        iterator(const ArrayView *view, std::size_t idx) noexcept : _view(view), _idx(idx) {}
+
+        Tp operator*() const noexcept { return (*_view)[_idx]; }
+        iterator &operator++() noexcept { return ++_idx, *this; }
+        iterator operator++(int) noexcept { return {_view, _idx++}; }
+        bool operator==(const iterator &other) const noexcept { return _idx == other._idx; }
+
+    private:
+        const ArrayView *_view{};
+        std::size_t _idx{};
+    };
+
+    ArrayView() = default;
+
+    /**
+     * @brief 创建数组视图
+     *
+     * @param[in] data 数组首字节地址
+     * @param[in] size 元素个数
+     */
+    ArrayView(const std::byte *data, std::size_t size) noexcept : _data(data), _size(size) {}
+
+    //! 元素个数
+    std::size_t size() const noexcept { return _size; }
+    //! 是否为空
+    bool empty() const noexcept { return _size == 0; }
+    //! 数组在缓冲区中的原始字节
+    std::span<const std::byte> bytes() const noexcept { return {_data, _size * sizeof(Tp)}; }
+
+    //! 按值读取第 `idx` 个元素
+    Tp operator[](std::size_t idx) const noexcept {
+        Tp value{};
+        if constexpr (std::is_same_v<Tp, bool>)
+            value = std::to_integer<uint8_t>(_data[idx]) != 0;
+        else
+            std::memcpy(&value, _data + idx * sizeof(Tp), sizeof(Tp));
+        return value;
+    }
+
+    /**
+     * @brief 将全部元素复制到目标内存
+     *
+     * @param[out] dst 目标内存，至少能容纳 `size()` 个元素
+     */
+    void copy_to(Tp *dst) const noexcept {
+        if constexpr (std::is_same_v<Tp, bool>)
+            for (std::size_t i = 0; i < _size; ++i)
+                dst[i] = (*this)[i];
+        else if (_size != 0)
+            std::memcpy(dst, _data, _size * sizeof(Tp));
+    }
+
+    iterator begin() const noexcept { return {this, 0}; }
+    iterator end() const noexcept { return {this, _size}; }
+
+private:
+    const std::byte *_data{};
+    std::size_t _size{};
+};
+
+template <typename View>
+class SeqView;
+
+//! @cond
+namespace detail {
+
+template <typename View>
+inline bool parse_view(ViewReader &reader, View &view) noexcept {
+    if constexpr (std::is_same_v<View, std::string_view>)
+        return reader.string(view);
+    else
+        return View::parse(reader, view);
+}
+
+} // namespace detail
+//! @endcond
+
+/**
+ * @brief 变长元素序列视图，用于字符串数组和嵌套消息数组
+ * @details 元素长度不固定，因此仅支持顺序遍历，每个元素在 `parse` 阶段已完成边界检查
+ *
+ * @tparam View 元素视图类型，为 `std::string_view` 或生成的 `<MsgType>View`
+ */
+template <typename View>
+class SeqView {
+public:
+    //! 序列视图只读迭代器
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = View;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const View *;
+        using reference = const View &;
+
+        iterator() = default;
+        iterator(std::span<const std::byte> buf, std::size_t left) noexcept : _reader(buf), _left(left) { load(); }
+
+        const View &operator*() const noexcept { return _cur; }
+        const View *operator->() const noexcept { return &_cur; }
+        iterator &operator++() noexcept {
+            --_left;
+            load();
+            return *this;
+        }
+        iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+        bool operator==(const iterator &other) const noexcept { return _left == other._left; }
+
+    private:
+        void load() noexcept {
+            if (_left != 0)
+                detail::parse_view(_reader, _cur);
+        }
+
+        ViewReader _reader{};
+        std::size_t _left{};
+        View _cur{};
+    };
+
+    SeqView() = default;
+
+    //! 元素个数
+    std::size_t size() const noexcept { return _size; }
+    //! 是否为空
+    bool empty() const noexcept { return _size == 0; }
+    //! 序列在缓冲区中的原始字节
+    std::span<const std::byte> bytes() const noexcept { return _bytes; }
+
+    iterator begin() const noexcept { return {_bytes, _size}; }
+    iterator end() const noexcept { return {}; }
+
+    /**
+     * @brief 从读取游标中解析并校验 `count` 个元素
+     *
+     * @param[in] reader 读取游标
+     * @param[in] count 元素个数
+     * @param[out] out 解析得到的序列视图
+     * @return 是否解析成功
+     */
+    static bool parse(ViewReader &reader, std::size_t count, SeqView &out) noexcept {
+        auto begin = reader.pos();
+        View element{};
+        for (std::size_t i = 0; i < count; ++i) {
+            auto before = reader.pos();
+            if (!detail::parse_view(reader, element))
+                return false;
+            // 零长度元素之后的元素全部相同，无需继续遍历恶意构造的超大计数
+            if (reader.pos() == before)
+                break;
+        }
+        out._bytes = {begin, reader.pos()};
+        out._size = count;
+        return true;
+    }
+
+private:
+    std::span<const std::byte> _bytes{};
+    std::size_t _size{};
+};
+
+//! @} rmvlmsg
+
+} // namespace rm::msg
+
+#endif
@@ -85,6 +85,9 @@ public:
     //! 判断发布者是否无效
     bool invalid() const noexcept { return !_writer; }
 
+    //! 获取错过的写入截止期限数，需在 QoS 中设置 `deadline`，无效时返回 0
+    uint64_t missedDeadlines() const noexcept { return _writer ? _writer->missedDeadlines() : 0; }
+
     /**
      * @brief 发布消息到指定话题
      *
@@ -126,6 +129,9 @@ public:
     //! 判断订阅者是否无效
     bool invalid() const noexcept { return !_reader; }
 
+    //! 获取错过的接收截止期限数，需在 QoS 中设置 `deadline`，无效时返回 0
+    uint64_t missedDeadlines() const noexcept { return _reader ? _reader->missedDeadlines() : 0; }
+
 private:
     DataReaderBase::ptr _reader; //!< 底层数据读取器
     std::string _topic;          //!< 话题名称
@@ -158,10 +164,12 @@ public:
      *
      * @tparam MsgType 消息类型
      * @param[in] topic 话题名称
+     * @param[in] qos 服务质量配置，使用 `QoS::reliable()` 对跨主机的大消息启用基于 NACK 的分片重传，启用 `QoS::multicast`
+     *                时对多个跨主机的多播读取器只发送一份数据
      * @return Publisher<MsgType> 发布者对象
      */
     template <typename MsgType, typename = std::enable_if_t<is_msg_v<MsgType>>>
-    Publisher<MsgType> createPublisher(std::string_view topic) noexcept;
+    Publisher<MsgType> createPublisher(std::string_view topic, const QoS &qos = {}) noexcept;
 
     /**
      * @brief 创建订阅者
@@ -169,11 +177,12 @@ public:
      * @tparam MsgType 消息类型
      * @tparam SubscribeMsgCallback 订阅回调函数类型
      * @param[in] topic 话题名称
-     * @param[in] callback 订阅回调函数
+     * @param[in] callback 订阅回调函数，形如 `void(const MsgType &)`，或形如 `void(const typename MsgType::View &)` 以零拷贝方式处理消息
+     * @param[in] qos 服务质量配置，启用 `QoS::multicast` 时加入话题的多播组以接收多播写入器的数据
      * @return Subscriber<MsgType> 订阅者对象
      */
-    template <typename MsgType, typename SubscribeMsgCallback, typename = std::enable_if_t<is_msg_v<MsgType> && std::is_invocable_v<SubscribeMsgCallback, const MsgType &>>>
-    Subscriber<MsgType> createSubscriber(std::string_view topic, SubscribeMsgCallback &&callback) noexcept;
+    template <typename MsgType, typename SubscribeMsgCallback, typename = std::enable_if_t<is_msg_v<MsgType> && is_msg_callback_v<MsgType, SubscribeMsgCallback>>>
+    Subscriber<MsgType> createSubscriber(std::string_view topic, SubscribeMsgCallback &&callback, const QoS &qos = {}) noexcept;
 
     /**
      * @brief 销毁发布者
@@ -212,6 +221,7 @@ private:
     std::atomic_bool _running{true};   //!< 运行状态
     std::atomic_uint16_t _next_eid{1}; //!< 用于生成实体 ID 的原子计数器
 
+    uint8_t _domain{};     //!< 域 ID
     uint16_t _rndp_port{}; //!< RNDP 广播端口号
     uint16_t _redp_port{}; //!< REDP 监听端口号
 
@@ -371,6 +381,9 @@ public:
     //! 判断发布者是否无效
     bool invalid() const noexcept { return !_writer; }
 
+    //! 获取错过的写入截止期限数，需在 QoS 中设置 `deadline`，无效时返回 0
+    uint64_t missedDeadlines() const noexcept { return _writer ? _writer->missedDeadlines() : 0; }
+
     /**
      * @brief 发布消息到指定话题
      *
@@ -415,6 +428,9 @@ public:
     //! 判断订阅者是否无效
     bool invalid() const noexcept { return !_reader; }
 
+    //! 获取错过的接收截止期限数，需在 QoS 中设置 `deadline`，无效时返回 0
+    uint64_t missedDeadlines() const noexcept { return _reader ? _reader->missedDeadlines() : 0; }
+
 private:
     rm::async::IOContextRef _ctx; //!< 异步 IO 上下文引用
     DataReaderBase::ptr _reader;  //!< 底层数据读取器
@@ -586,10 +602,11 @@ public:
      *
      * @tparam MsgType 消息类型
      * @param[in] topic 话题名称
+     * @param[in] qos 服务质量配置，异步节点不支持多播，`QoS::multicast` 被忽略
      * @return 发布者对象的智能指针
      */
     template <typename MsgType, typename = std::enable_if_t<is_msg_v<MsgType>>>
-    typename Publisher<MsgType>::ptr createPublisher(std::string_view topic) noexcept;
+    typename Publisher<MsgType>::ptr createPublisher(std::string_view topic, const QoS &qos = {}) noexcept;
 
     /**
      * @brief 创建订阅者
@@ -597,11 +614,12 @@ public:
      * @tparam MsgType 消息类型
      * @tparam SubscribeMsgCallback 订阅回调函数类型
      * @param[in] topic 话题名称
-     * @param[in] callback 订阅回调函数
+     * @param[in] callback 订阅回调函数，形如 `void(const MsgType &)`，或形如 `void(const typename MsgType::View &)` 以零拷贝方式处理消息
+     * @param[in] qos 服务质量配置，订阅者仅使用其中的截止期限，可靠传输由发布者决定
      * @return 订阅者对象的智能指针
      */
-    template <typename MsgType, typename SubscribeMsgCallback, typename = std::enable_if_t<is_msg_v<MsgType> && std::is_invocable_v<SubscribeMsgCallback, const MsgType &>>>
-    typename Subscriber<MsgType>::ptr createSubscriber(std::string_view topic, SubscribeMsgCallback callback) noexcept;
+    template <typename MsgType, typename SubscribeMsgCallback, typename = std::enable_if_t<is_msg_v<MsgType> && is_msg_callback_v<MsgType, SubscribeMsgCallback>>>
+    typename Subscriber<MsgType>::ptr createSubscriber(std::string_view topic, SubscribeMsgCallback callback, const QoS &qos = {}) noexcept;
 
     /**
      * @brief 创建异步服务端
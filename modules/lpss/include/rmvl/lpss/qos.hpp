@@ -0,0 +1,71 @@
+/**
+ * @file qos.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 轻量发布订阅服务：话题服务质量（QoS）配置
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace rm::lpss {
+
+//! @addtogroup lpss
+//! @{
+
+//! 话题可靠性策略
+enum class Reliability : uint8_t {
+    BestEffort, //!< 尽力而为，丢失的 UDP 分片不会重传，未完成的消息在超时后丢弃
+    Reliable,   //!< 可靠传输，写入器缓存最近的消息，读取器通过心跳检测缺失并以 NACK 位图请求重传
+};
+
+//! 话题持久性策略
+enum class Durability : uint8_t {
+    Volatile,       //!< 易失，读取器只能收到匹配之后写入的消息
+    TransientLocal, //!< 本地暂存，写入器缓存最近 `depth` 条消息，并在 EDP 匹配到新的读取器时向其补发
+};
+
+/**
+ * @brief 话题服务质量配置
+ * @details
+ * - 可靠性由写入器决定，读取器在收到可靠写入器的心跳后自动启用缺失检测与 NACK 反馈
+ * - 可靠传输仅作用于跨主机的 UDPv4 通道，同主机的共享内存通道不受影响
+ * - 多播需由读写双方同时启用：读取器加入由域 ID 与话题哈希确定的多播组，并通过 REDP 告知写入器；写入器在已加入多播组的
+ *   跨主机读取器数量达到 `MTP_MULTICAST_MIN_READERS` 时对其只发送一份多播数据，其余读取器仍使用单播，异步节点不支持多播
+ * - 历史深度、持久性与生命周期作用于写入器的消息缓存，同主机的共享内存通道仅保留最新一条消息，补发时只写入最新的缓存消息
+ * - 截止期限对写入器表示承诺的最长写入间隔，对读取器表示期望的最长接收间隔，超出的周期数可通过发布者或订阅者查询
+ */
+struct QoS {
+    Reliability reliability{Reliability::BestEffort}; //!< 可靠性策略
+    bool multicast{};                                 //!< 是否启用多播数据通道，未能加入多播组时自动回退至单播
+    Durability durability{Durability::Volatile};      //!< 持久性策略
+    uint8_t depth{};                                  //!< 写入器保留的历史消息数，0 表示使用默认值
+    std::chrono::milliseconds deadline{};             //!< 截止期限，0 表示不检测
+    std::chrono::milliseconds lifespan{};             //!< 缓存消息的生命周期，过期的消息不再补发或重传，0 表示不过期
+
+    //! 尽力而为的默认配置
+    static constexpr QoS bestEffort() noexcept { return {}; }
+
+    //! 可靠传输配置
+    static constexpr QoS reliable() noexcept { return {Reliability::Reliable}; }
+
+    //! 启用多播数据通道的尽力而为配置
+    static constexpr QoS multicastBestEffort() noexcept { return {Reliability::BestEffort, true}; }
+
+    /**
+     * @brief 可靠且本地暂存的配置，适用于 URDF、静态坐标变换等仅发布一次、需要后加入的读取器也能收到的数据
+     *
+     * @param[in] depth 写入器保留并向新读取器补发的历史消息数
+     */
+    static constexpr QoS transientLocal(uint8_t depth = 1) noexcept { return {Reliability::Reliable, false, Durability::TransientLocal, depth}; }
+};
+
+//! @} lpss
+
+} // namespace rm::lpss
@@ -40,6 +40,132 @@ namespace lpss {
 //! @addtogroup lpss_robot
 //! @{
 
+//! 逆运动学求解参数
+struct IKOptions {
+    double tolerance{1e-5};            //!< 加权任务空间误差的收敛阈值
+    unsigned int max_iterations{5000}; //!< LMA 最大迭代次数
+    bool warm_start{true};             //!< solveIK 是否以该运动链上一次成功的解作为初值，失败时再以当前关节状态重试
+};
+
+//! 轨迹时间参数化方法
+enum class TimeParameterization : uint8_t {
+    Quintic, //!< 逐段五次多项式插值，在每个途经点处停止，各段时长由速度/加速度限制估算
+    TOPPRA,  //!< 时间最优参数化（TOPP-RA），平滑经过途经点，同时受速度、加速度与加加速度限制
+};
+
+//! 批量逆运动学求解结果
+struct IKBatchResult {
+    std::vector<std::string> joint_names{}; //!< 运动链上各活动关节名称
+    std::vector<double> positions{};        //!< 按目标顺序排列的关节位置，第 i 个目标的解位于 `[i * dof, (i + 1) * dof)`
+    std::vector<uint8_t> success{};         //!< 各目标是否求解成功，失败目标对应的关节位置为 0
+
+    //! 运动链自由度
+    std::size_t dof() const noexcept { return joint_names.size(); }
+
+    //! 第 @p i 个目标的解的首地址
+    const double *solution(std::size_t i) const noexcept { return positions.data() + i * dof(); }
+};
+
+//! 可达性地图构建参数
+struct ReachabilityOptions {
+    msg::Point min{};                             //!< 采样区域下界（相对于根连杆）
+    msg::Point max{};                             //!< 采样区域上界（相对于根连杆）
+    double resolution{0.05};                      //!< 体素边长 (m)
+    std::vector<msg::Quaternion> orientations{}; //!< 每个体素中心测试的末端姿态，为空时仅测试单位姿态
+    std::size_t restarts{2};                      //!< 以当前关节状态为初值求解失败后，额外尝试的均匀分布初值数量
+};
+
+/**
+ * @brief 工作空间可达性体素地图
+ * @details 每个体素保存其中心处可达姿态所占比例（量化为 8 位），查询复杂度为 \f$O(1)\f$，
+ *          可通过 `serialize` / `deserialize` 离线保存与加载
+ */
+class ReachabilityMap {
+public:
+    ReachabilityMap() = default;
+
+    /**
+     * @brief 创建全部体素不可达的地图
+     *
+     * @param[in] origin 地图下界角点
+     * @param[in] resolution 体素边长，必须大于 0
+     * @param[in] size 三个方向上的体素数量
+     */
+    ReachabilityMap(const msg::Point &origin, double resolution, const std::array<uint32_t, 3> &size);
+
+    //! 地图是否为空
+    bool empty() const noexcept { return _scores.empty(); }
+
+    //! 地图下界角点
+    const msg::Point &origin() const noexcept { return _origin; }
+
+    //! 体素边长
+    double resolution() const noexcept { return _resolution; }
+
+    //! 三个方向上的体素数量
+    const std::array<uint32_t, 3> &size() const noexcept { return _size; }
+
+    //! 体素中心坐标
+    msg::Point center(uint32_t ix, uint32_t iy, uint32_t iz) const noexcept;
+
+    //! 设置体素可达比例，取值截断到 \f$[0,1]\f$
+    void set(uint32_t ix, uint32_t iy, uint32_t iz, double score) noexcept;
+
+    /**
+     * @brief 查询点所在体素的可达比例
+     *
+     * @param[in] point 相对于根连杆的位置
+     * @return 可达姿态比例 \f$[0,1]\f$，地图范围外返回 0
+     */
+    double score(const msg::Point &point) const noexcept;
+
+    //! 点所在体素是否存在可达姿态
+    bool reachable(const msg::Point &point) const noexcept { return score(point) > 0.0; }
+
+    //! 序列化为二进制字符串
+    std::string serialize() const;
+
+    /**
+     * @brief 从二进制字符串反序列化
+     *
+     * @param[in] data `serialize` 的输出
+     * @return 可达性地图，数据格式错误时返回空地图
+     */
+    static ReachabilityMap deserialize(std::string_view data) noexcept;
+
+private:
+    msg::Point _origin{};
+    double _resolution{};
+    std::array<uint32_t, 3> _size{};
+    std::vector<uint8_t> _scores{};
+};
+
+//! 基本碰撞几何体类型
+enum class CollisionShapeType : uint8_t {
+    Box,      //!< 长方体，`size` 为 x、y、z 方向的边长
+    Sphere,   //!< 球体，`size[0]` 为半径
+    Cylinder, //!< 圆柱体，轴线沿局部 z 轴，`size[0]` 为半径，`size[1]` 为长度
+    Capsule,  //!< 胶囊体，轴线沿局部 z 轴，`size[0]` 为半径，`size[1]` 为两端半球球心之间的长度
+};
+
+//! 基本碰撞几何体
+struct CollisionShape {
+    CollisionShapeType type{CollisionShapeType::Sphere}; //!< 几何体类型
+    std::array<double, 3> size{};                        //!< 几何体尺寸，含义参见 CollisionShapeType
+    msg::Pose origin{{0, 0, 0}, {0, 0, 0, 1}};           //!< 几何体中心在所属连杆（环境物体为根连杆）坐标系下的位姿
+};
+
+//! 碰撞检测结果
+struct CollisionResult {
+    bool collision{};      //!< 是否存在碰撞
+    std::size_t segment{}; //!< 首个碰撞位置所在的轨迹段，位于 `points[segment]` 与 `points[segment + 1]` 之间
+    double fraction{};     //!< 首个碰撞位置在该段内的插值比例 \f$[0,1]\f$
+    std::string first{};   //!< 发生碰撞的连杆名称
+    std::string second{};  //!< 与之碰撞的连杆或环境物体名称
+
+    explicit operator bool() const noexcept { return collision; }
+};
+
 //! 机器人规划模块，提供 URDF 解析、正/逆运动学求解、轨迹规划等运动学功能
 class RobotPlanner {
 public:
@@ -99,10 +225,20 @@ public:
      */
     msg::JointTrajectory plan(const msg::JointState &target) const;
 
+    /**
+     * @brief 关节空间多段途经点规划
+     * @details 从当前关节角出发依次经过各途经点，时间参数化方法由 setTimeParameterization 指定
+     *
+     * @param[in] waypoints 途经关节状态列表（仅使用 position 字段，顺序与 joints() 一致）
+     * @return 关节轨迹，若关节数为 0 或途经点为空则返回空轨迹
+     */
+    msg::JointTrajectory plan(const std::vector<msg::JointState> &waypoints) const;
+
     /**
      * @brief 笛卡尔空间点到点规划
      * @details
-     * - 已知末端目标位姿，先用逆运动学（LMA 迭代）求出对应关节角，再从当前关节角出发做五次多项式插值。
+     * - 已知末端目标位姿，先以当前关节角为初值用逆运动学（LMA 迭代）求出对应关节角，再从当前关节角出发做五次多项式插值，
+     *   目标解与起点位于同一构型分支，不受 IKOptions::warm_start 影响。
      * - 若目标位姿超出工作空间或逆运动学不收敛，返回空轨迹。
      *
      * @param[in] frame 目标连杆名称（末端执行器所在连杆）
@@ -115,7 +251,9 @@ public:
      * @brief 笛卡尔空间多段途经点规划
      * @details
      * - 末端依次经过多个目标位姿，对每段分别做逆运动学 + 五次多项式插值，各段轨迹首尾拼接，每段根据关节速度/加速度限制自动估算时长。
+     * - 每段逆运动学以上一途经点的解作为初值，使相邻途经点尽量落在同一构型分支上。
      * - 若某段逆运动学失败，返回已成功规划的部分轨迹。
+     * - 时间参数化为 TimeParameterization::TOPPRA 时，先求出全部途经点的关节角，再对整条路径做时间最优参数化。
      *
      * @param[in] frame 目标连杆名称（末端执行器所在连杆）
      * @param[in] waypoints 途经位姿列表，按顺序依次到达，每个位姿均相对于根连杆（一般是 `base_link`）
@@ -123,6 +261,63 @@ public:
      */
     msg::JointTrajectory plan(std::string_view frame, const std::vector<msg::Pose> &waypoints) const;
 
+    /**
+     * @brief 逆运动学求解
+     * @details 每个目标连杆对应的运动链与 LMA 求解器在首次求解时构建并缓存，后续调用直接复用，
+     *          初值选取策略参见 IKOptions::warm_start
+     *
+     * @param[in] frame 目标连杆名称（末端执行器所在连杆）
+     * @param[in] target 相对于根连杆的目标位姿
+     * @return 运动链上各活动关节的名称与位置，连杆不存在或求解失败时返回空的关节状态
+     */
+    msg::JointState solveIK(std::string_view frame, const msg::Pose &target) const;
+
+    /**
+     * @brief 批量逆运动学求解
+     * @details 各目标相互独立，均以当前关节状态为初值，由内部线程池中每个线程各自持有的求解器实例并行求解。
+     *          可与单目标求解和轨迹规划并发调用，但不能与 `load` 或 `update` 并发调用
+     *
+     * @param[in] frame 目标连杆名称（末端执行器所在连杆）
+     * @param[in] targets 相对于根连杆的目标位姿数组
+     * @param[in] count 目标数量
+     * @return 批量求解结果，连杆不存在时返回空结果
+     */
+    IKBatchResult solveIKBatch(std::string_view frame, const msg::Pose *targets, std::size_t count) const;
+
+#if __cplusplus >= 202002L
+    /**
+     * @brief 批量逆运动学求解
+     * @see solveIKBatch(std::string_view, const msg::Pose *, std::size_t) const
+     *
+     * @param[in] frame 目标连杆名称（末端执行器所在连杆）
+     * @param[in] targets 相对于根连杆的目标位姿
+     * @return 批量求解结果，连杆不存在时返回空结果
+     */
+    IKBatchResult solveIKBatch(std::string_view frame, std::span<const msg::Pose> targets) const { return solveIKBatch(frame, targets.data(), targets.size()); }
+#endif
+
+    /**
+     * @brief 离线构建工作空间可达性地图
+     * @details 对每个体素中心与每个候选姿态做批量逆运动学求解，体素分数为可达姿态所占比例，
+     *          求解失败时按 `ReachabilityOptions::restarts` 更换初值重试以减少局部极小值造成的误判
+     *
+     * @param[in] frame 目标连杆名称（末端执行器所在连杆）
+     * @param[in] options 采样区域、分辨率与候选姿态
+     * @return 可达性地图，连杆不存在时全部体素不可达
+     */
+    ReachabilityMap buildReachabilityMap(std::string_view frame, const ReachabilityOptions &options) const;
+
+    /**
+     * @brief 设置逆运动学求解参数
+     * @details 修改参数会清空已缓存的求解器及其上一次的解
+     *
+     * @param[in] options 求解参数，容差不大于 0 或迭代次数为 0 时保持默认值
+     */
+    void setIKOptions(const IKOptions &options);
+
+    //! 获取逆运动学求解参数
+    const IKOptions &getIKOptions() const noexcept;
+
     /**
      * @brief 获取指定连杆相对于基坐标系的位姿（正运动学）
      *
@@ -159,6 +354,67 @@ public:
      */
     double getMaxAccelerationScalingFactor() const noexcept;
 
+    /**
+     * @brief 设置轨迹时间参数化方法
+     * @details TimeParameterization::TOPPRA 使用 URDF `<limit>` 中的 `velocity`、由 `effort` 估算的加速度以及可选的 `jerk`
+     *          属性作为约束，速度缩放因子作用于速度，加速度缩放因子同时作用于加速度与加加速度
+     *
+     * @param[in] method 时间参数化方法，默认为 TimeParameterization::Quintic
+     */
+    void setTimeParameterization(TimeParameterization method) noexcept;
+
+    //! 获取轨迹时间参数化方法
+    TimeParameterization getTimeParameterization() const noexcept;
+
+    /**
+     * @brief 添加或替换环境碰撞物体
+     *
+     * @param[in] name 物体名称，不能与连杆同名，同名物体将被替换
+     * @param[in] shape 碰撞几何体，位姿相对于根连杆
+     */
+    void addCollisionObject(std::string_view name, const CollisionShape &shape);
+
+    /**
+     * @brief 移除环境碰撞物体
+     *
+     * @param[in] name 物体名称
+     * @return 物体是否存在
+     */
+    bool removeCollisionObject(std::string_view name);
+
+    //! 移除全部环境碰撞物体
+    void clearCollisionObjects() noexcept;
+
+    /**
+     * @brief 设置允许碰撞矩阵中的一项
+     * @details 由关节直接相连的两个连杆默认允许碰撞，其余连杆之间、连杆与环境物体之间默认不允许碰撞
+     *
+     * @param[in] first 连杆或环境物体名称
+     * @param[in] second 连杆或环境物体名称
+     * @param[in] allowed 是否允许二者碰撞，允许时不再检测该对物体
+     */
+    void setAllowedCollision(std::string_view first, std::string_view second, bool allowed = true);
+
+    /**
+     * @brief 检测关节状态下的自碰撞与环境碰撞
+     * @details 碰撞模型来自 URDF `<collision>` 中的 `box`、`sphere`、`cylinder` 与 `capsule` 几何体，`mesh` 将被忽略
+     *
+     * @param[in] state 关节状态（仅使用 name 与 position 字段），未出现的关节取当前关节状态
+     * @return 碰撞检测结果，`segment` 与 `fraction` 恒为 0
+     */
+    CollisionResult checkCollision(const msg::JointState &state) const;
+
+    /**
+     * @brief 沿关节轨迹检测自碰撞与环境碰撞
+     * @details 在相邻轨迹点之间做关节空间线性插值，使相邻采样的关节位移不超过 @p max_step ，
+     *          每个采样先以 AABB 树做粗检测，再对包围盒相交的几何体做 GJK 精确检测，遇到首个碰撞即返回
+     *
+     * @param[in] traj 关节轨迹，未出现在 `joint_names` 中的关节取当前关节状态，规划器中不存在的关节将被忽略
+     * @param[in] max_step 相邻采样的最大关节位移 (rad 或 m)
+     * @return 碰撞检测结果
+     */
+    CollisionResult checkCollision(const msg::JointTrajectory &traj, double max_step = 0.02) const;
+
 protected:
     class Impl;
     std::unique_ptr<Impl> _impl{};
@@ -169,6 +425,7 @@ class RobotController {
 public:
     /**
      * @brief 构造机器人控制器
+     * @details 期望状态与控制律的内部缓冲区在构造时按关节数量预分配
      *
      * @param[in] joint_names 机器人关节名称列表，必须是 RobotPlanner 管理的关节集合的非空子集
      * @param[in] ctl_law 控制律对象指针，默认为单位传递函数配合位置映射
@@ -182,6 +439,7 @@ public:
      * - 时间轴校验：`points[i].time_from_start` 必须严格递增
      * - 维度校验：每个轨迹点的位置/速度/加速度/力矩向量长度与轨迹关节数量一致（字段为空则按策略补全）
      *
+     * 受控关节到轨迹关节的名称映射在提交时一次性解析，采样时仅按下标访问
      * @param[in] traj 输入关节轨迹
      * @return 是否成功提交，失败时一般是由于轨迹校验未通过
      */
@@ -198,6 +456,18 @@ public:
      */
     msg::JointState sample(const msg::JointState &feedback = {}) noexcept;
 
+    /**
+     * @brief 采样并得到控制系统的输入值，实时控制循环使用的版本
+     * @details 期望状态写入构造时预分配的缓冲区，控制命令原位写入 @p command。@p command 在首次调用后已具备足够容量，
+     *          在关节数量不变的情况下，后续每个控制周期均不会分配堆内存
+     *
+     * @param[in] feedback 当前反馈状态，具体是否需要传入由控制律实现决定
+     * @param[out] command 控制命令输出，建议在控制循环外创建并复用
+     * @return 控制计算状态，控制律计算失败时 @p command 为保持当前位置的命令，既无轨迹又无反馈时返回
+     *         `ControlStatus::InvalidInput` 并清空 @p command
+     */
+    ctl::ControlStatus sample(const msg::JointState &feedback, msg::JointState &command) noexcept;
+
 private:
     //! 受控关节信息结构体
     struct ControlledJointInfo {
@@ -208,6 +478,7 @@ private:
     std::vector<ControlledJointInfo> _ctl_joints{}; //!< 受控关节
     msg::JointTrajectory _traj_cache{};             //!< 轨迹缓存
     ctl::ControlLawBase::ptr _ctl_law{};            //!< 控制律对象
+    msg::JointState _desired{};                     //!< 期望状态缓冲区，关节名称在构造时写入
 };
 
 /**
@@ -14,9 +14,14 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string_view>
 
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
 #include "rmvlmsg/geometry/point.hpp"
 #include "rmvlmsg/geometry/pose.hpp"
 #include "rmvlmsg/geometry/transform.hpp"
@@ -87,6 +92,28 @@ enum class Status : uint8_t {
     TimestampOutOfRange,   //!< 插入时间已超出当前历史缓存窗口
 };
 
+//! 动态边外推模式
+enum class Extrapolation : uint8_t {
+    None,             //!< 不外推，查询时间越出历史区间时返回 `ExtrapolationPast` 或 `ExtrapolationFuture`
+    ConstantVelocity, //!< 按边界处相邻两个样本估计的线速度与角速度匀速外推，不限制外推时长
+    BoundedHorizon,   //!< 与 `ConstantVelocity` 相同，但外推时长超过 `horizon` 时仍返回越界状态
+};
+
+//! 动态边外推策略
+struct ExtrapolationPolicy {
+    Extrapolation mode{Extrapolation::None}; //!< 外推模式
+    std::chrono::nanoseconds horizon{};      //!< `BoundedHorizon` 模式下允许的最大外推时长
+
+    //! 不外推
+    static constexpr ExtrapolationPolicy none() noexcept { return {}; }
+
+    //! 匀速外推
+    static constexpr ExtrapolationPolicy constantVelocity() noexcept { return {Extrapolation::ConstantVelocity, {}}; }
+
+    //! 有界匀速外推
+    static constexpr ExtrapolationPolicy bounded(std::chrono::nanoseconds horizon) noexcept { return {Extrapolation::BoundedHorizon, horizon}; }
+};
+
 //! 获取坐标变换状态的稳定文本描述
 const char *to_string(Status status) noexcept;
 
@@ -99,13 +126,54 @@ struct LookupResult {
     explicit operator bool() const noexcept { return status == Status::Ok; }
 };
 
+//! 基于坐标系句柄的查询结果，不携带坐标系名称
+struct TransformResult {
+    Status status{Status::FrameNotFound}; //!< 查询状态
+    msg::Time stamp{};                    //!< 查询成功时变换对应的时间
+    msg::Transform transform{};           //!< 查询成功时的变换 \f$T_{target,source}\f$
+
+    //! 查询是否成功
+    explicit operator bool() const noexcept { return status == Status::Ok; }
+};
+
+class Buffer;
+
+/**
+ * @brief 坐标系句柄
+ * @details 由 `Buffer::frame` 驻留坐标系名称后得到，在所属 Buffer 的生命周期内保持有效，`clear()` 不会使其失效。
+ *          句柄只能用于创建它的 Buffer，默认构造的句柄无效。
+ */
+class FrameId {
+public:
+    constexpr FrameId() noexcept = default;
+
+    //! 句柄是否有效
+    constexpr bool valid() const noexcept { return _id != npos; }
+
+    //! 句柄在所属 Buffer 中的序号
+    constexpr uint32_t value() const noexcept { return _id; }
+
+    constexpr bool operator==(const FrameId &rhs) const noexcept { return _id == rhs._id; }
+    constexpr bool operator!=(const FrameId &rhs) const noexcept { return _id != rhs._id; }
+
+private:
+    friend class Buffer;
+    static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+    explicit constexpr FrameId(uint32_t id) noexcept : _id(id) {}
+
+    uint32_t _id{npos};
+};
+
 /**
  * @brief 线程安全的坐标变换缓存
  * @details
  * - 坐标关系组成单父节点、无环的森林，其中，互不连通的树允许分别维护；
  * - 静态边保存单个变换，查询时不受时间限制，动态边按时间保存历史；
  * - 查询时间为零时使用整条路径上所有动态边的最新公共时间，全静态路径返回零时间；
- * - 动态变换使用平移线性插值和单位四元数 SLERP，不允许向缓存区间外外推。
+ * - 动态变换使用平移线性插值和单位四元数 SLERP，默认不允许向缓存区间外外推，可通过 `setExtrapolation` 启用匀速外推；
+ * - 写入方基于不可变快照复制修改后整体发布，查询方通过纪元保护读取当前快照，查询不加锁，
+ *   也不会被并发写入阻塞；基于 FrameId 的查询不分配内存。
  */
 class Buffer {
 public:
@@ -141,6 +209,14 @@ public:
      */
     Status setStatic(const msg::TF &transforms);
 
+    /**
+     * @brief 驻留坐标系名称并获取其句柄
+     * @details 名称尚未出现时会分配新句柄，但不会因此使该坐标系可被查询
+     * @param[in] name 坐标系名称
+     * @return 坐标系句柄，名称为空时返回无效句柄
+     */
+    FrameId frame(std::string_view name);
+
     /**
      * @brief 查询 source 坐标系到 target 坐标系的变换
      * @param[in] target_frame 目标坐标系
@@ -150,15 +226,129 @@ public:
      */
     LookupResult lookup(std::string_view target_frame, std::string_view source_frame, const msg::Time &time = {}) const;
 
+    /**
+     * @brief 使用坐标系句柄查询 source 坐标系到 target 坐标系的变换
+     * @param[in] target_frame 目标坐标系句柄
+     * @param[in] source_frame 源坐标系句柄
+     * @param[in] time 查询时间；零时间表示最新公共时间
+     * @return 查询结果，成功时得到 \f$T_{target,source}\f$，无效句柄返回 `Status::InvalidArgument`
+     */
+    TransformResult lookup(FrameId target_frame, FrameId source_frame, const msg::Time &time = {}) const;
+
+    /**
+     * @brief 跨时间查询变换
+     * @details 以 @p fixed_frame 作为不随时间变化的参考坐标系，计算 @p source_time 时刻 source 中的坐标在
+     *          @p target_time 时刻 target 中的表示，即 \f$T_{target,fixed}(t_{target})\,T_{fixed,source}(t_{source})\f$，
+     *          常用于补偿图像时间戳与云台最新状态之间的延迟
+     * @param[in] target_frame 目标坐标系
+     * @param[in] target_time 目标时间；零时间表示 target 与 fixed 之间的最新公共时间
+     * @param[in] source_frame 源坐标系
+     * @param[in] source_time 源时间；零时间表示 source 与 fixed 之间的最新公共时间
+     * @param[in] fixed_frame 参考坐标系
+     * @return 查询结果，时间戳为目标时间
+     */
+    LookupResult lookup(std::string_view target_frame, const msg::Time &target_time,
+                        std::string_view source_frame, const msg::Time &source_time,
+                        std::string_view fixed_frame) const;
+
+    //! 使用坐标系句柄跨时间查询变换，参数含义同上
+    TransformResult lookup(FrameId target_frame, const msg::Time &target_time,
+                           FrameId source_frame, const msg::Time &source_time,
+                           FrameId fixed_frame) const;
+
     //! 判断指定时间是否可完成坐标变换
     bool can(std::string_view target_frame, std::string_view source_frame, const msg::Time &time = {}) const;
 
+    //! 使用坐标系句柄判断指定时间是否可完成坐标变换
+    bool can(FrameId target_frame, FrameId source_frame, const msg::Time &time = {}) const;
+
+    /**
+     * @brief 批量转换点坐标
+     * @details 坐标链只解析一次，随后按块将点集转为 SoA 布局并应用同一变换，允许 @p output 与 @p input 指向同一数组
+     * @param[in] target_frame 目标坐标系
+     * @param[in] source_frame 点所在的源坐标系
+     * @param[in] time 查询时间；零时间表示最新公共时间
+     * @param[in] input 源坐标系下的点
+     * @param[out] output 目标坐标系下的点，查询失败时保持不变
+     * @param[in] count 点的数量
+     * @return 查询状态
+     */
+    Status transform(std::string_view target_frame, std::string_view source_frame, const msg::Time &time,
+                     const msg::Point *input, msg::Point *output, std::size_t count) const;
+
+    //! 使用坐标系句柄批量转换点坐标，参数含义同上
+    Status transform(FrameId target_frame, FrameId source_frame, const msg::Time &time,
+                     const msg::Point *input, msg::Point *output, std::size_t count) const;
+
+    /**
+     * @brief 批量转换位姿
+     * @details 坐标链只解析一次，位置与姿态分别按块以 SoA 布局计算，允许 @p output 与 @p input 指向同一数组
+     * @param[in] target_frame 目标坐标系
+     * @param[in] source_frame 位姿所在的源坐标系
+     * @param[in] time 查询时间；零时间表示最新公共时间
+     * @param[in] input 源坐标系下的位姿
+     * @param[out] output 目标坐标系下的位姿，查询失败时保持不变
+     * @param[in] count 位姿的数量
+     * @return 查询状态
+     */
+    Status transform(std::string_view target_frame, std::string_view source_frame, const msg::Time &time,
+                     const msg::Pose *input, msg::Pose *output, std::size_t count) const;
+
+    //! 使用坐标系句柄批量转换位姿，参数含义同上
+    Status transform(FrameId target_frame, FrameId source_frame, const msg::Time &time,
+                     const msg::Pose *input, msg::Pose *output, std::size_t count) const;
+
+#if __cplusplus >= 202002L
+    /**
+     * @brief 批量转换点坐标
+     * @param[in] target_frame 目标坐标系
+     * @param[in] source_frame 点所在的源坐标系
+     * @param[in] time 查询时间；零时间表示最新公共时间
+     * @param[in] input 源坐标系下的点
+     * @param[out] output 目标坐标系下的点，长度须与 @p input 相同，否则返回 `Status::InvalidArgument`
+     * @return 查询状态
+     */
+    template <typename FrameType>
+    Status transform(FrameType target_frame, FrameType source_frame, const msg::Time &time,
+                     std::span<const msg::Point> input, std::span<msg::Point> output) const {
+        if (input.size() != output.size())
+            return Status::InvalidArgument;
+        return transform(target_frame, source_frame, time, input.data(), output.data(), input.size());
+    }
+
+    /**
+     * @brief 批量转换位姿
+     * @param[in] target_frame 目标坐标系
+     * @param[in] source_frame 位姿所在的源坐标系
+     * @param[in] time 查询时间；零时间表示最新公共时间
+     * @param[in] input 源坐标系下的位姿
+     * @param[out] output 目标坐标系下的位姿，长度须与 @p input 相同，否则返回 `Status::InvalidArgument`
+     * @return 查询状态
+     */
+    template <typename FrameType>
+    Status transform(FrameType target_frame, FrameType source_frame, const msg::Time &time,
+                     std::span<const msg::Pose> input, std::span<msg::Pose> output) const {
+        if (input.size() != output.size())
+            return Status::InvalidArgument;
+        return transform(target_frame, source_frame, time, input.data(), output.data(), input.size());
+    }
+#endif
+
     //! 设置动态历史缓存时长；负值按零处理，并立即裁剪现有历史
     void setCacheDuration(std::chrono::nanoseconds cache_duration) noexcept;
 
     //! 获取动态历史缓存时长
     std::chrono::nanoseconds cacheDuration() const noexcept;
 
+    /**
+     * @brief 设置动态边外推策略
+     * @details 外推速度由越界一侧最近的两个样本估计，只有一个样本时保持该样本不变；零时间查询不受影响
+     */
+    void setExtrapolation(const ExtrapolationPolicy &policy) noexcept;
+
+    //! 获取动态边外推策略
+    ExtrapolationPolicy extrapolation() const noexcept;
+
     //! 获取当前坐标树边数
     std::size_t size() const noexcept;
 
@@ -166,8 +356,6 @@ public:
     void clear() noexcept;
 
 private:
-    Status setImpl(const msg::TransformStamped &transform, bool is_static);
-
     class Impl;
     std::unique_ptr<Impl> _impl;
 };
@@ -213,7 +401,8 @@ private:
 
 /**
  * @brief 静态坐标变换发布器
- * @details 发布到 `<name>/tf_static`，Node 的生命周期必须长于发布器。
+ * @details 发布到 `<name>/tf_static`，Node 的生命周期必须长于发布器。发布器按 `child_frame_id` 保存已发布的全部静态变换，
+ *          每次发布都携带完整集合，因此本地暂存的最近一条消息即可让后加入的监听器获得所有静态坐标系。
  */
 class StaticBroadcaster {
 public:
@@ -236,10 +425,10 @@ public:
     StaticBroadcaster(const StaticBroadcaster &) = delete;
     StaticBroadcaster &operator=(const StaticBroadcaster &) = delete;
 
-    //! 发布单条静态坐标变换
+    //! 发布单条静态坐标变换，与已发布的静态变换合并后整体发布
     void send(const msg::TransformStamped &transform);
 
-    //! 批量发布静态坐标变换
+    //! 批量发布静态坐标变换，与已发布的静态变换合并后整体发布
     void send(const msg::TF &transforms);
 
     //! 判断底层发布器是否无效
@@ -0,0 +1,125 @@
+/**
+ * @file multi_dofjoint_state.hpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief MultiDOFJointState header file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rmvl/lpss/msgview.hpp"
+
+#include "rmvlmsg/std/header.hpp"
+#include "rmvlmsg/geometry/transform.hpp"
+#include "rmvlmsg/geometry/twist.hpp"
+#include "rmvlmsg/geometry/wrench.hpp"
+
+//! LPSS 消息类型命名空间
+namespace rm::msg {
+
+//! @addtogroup rmvlmsg
+//! @{
+
+#if __cplusplus >= 202002L
+class MultiDOFJointStateView;
+#endif
+
+/**
+ * @brief MultiDOFJointState 消息类型：`sensor/MultiDOFJointState`
+ * @see
+ * - 详细描述请参考 @ref tutorial_table_of_content_rmvlmsg 的 **自动代码生成** 章节；
+ * - LPSS 使用教程请参考 @ref tutorial_modules_lpss 。
+ */
+class MultiDOFJointState {
+public:
+    rm::msg::Header header{};
+    std::vector<std::string> joint_names{};
+    std::vector<rm::msg::Transform> transforms{};
+    std::vector<rm::msg::Twist> twist{};
+    std::vector<rm::msg::Wrench> wrench{};
+
+
+    static constexpr const char msg_type[] = "sensor/MultiDOFJointState"; //!< 消息类型字符串常量
+
+#if __cplusplus >= 202002L
+    using View = MultiDOFJointStateView; //!< 对应的只读消息视图类型
+#endif
+
+    /**
+     * @brief 消息序列化
+     *
+     * @return 序列化后的字符串 
+     */
+    std::string serialize() const noexcept;
+
+    //! 将消息序列化为 JSON 字符串
+    std::string json() const noexcept;
+
+    /**
+     * @brief 消息反序列化
+     *
+     * @param[in] str 待反序列化的字符串指针
+     * @return 反序列化得到的消息对象
+     */
+    static MultiDOFJointState deserialize(const char *const str) noexcept;
+
+    //! 获取消息紧凑序列化后的大小（单位：字节）
+    std::size_t compact_size() const noexcept;
+};
+
+#if __cplusplus >= 202002L
+
+/**
+ * @brief MultiDOFJointState 消息视图类型：`sensor/MultiDOFJointState`
+ * @details
+ * - 带边界检查地解析序列化数据，数组与字符串直接引用接收缓冲区，不发生复制
+ * - 视图的生命周期不能超过被解析的缓冲区
+ */
+class MultiDOFJointStateView {
+public:
+    rm::msg::HeaderView header{};
+    rm::msg::SeqView<std::string_view> joint_names{};
+    rm::msg::SeqView<rm::msg::TransformView> transforms{};
+    rm::msg::SeqView<rm::msg::TwistView> twist{};
+    rm::msg::SeqView<rm::msg::WrenchView> wrench{};
+
+    /**
+     * @brief 解析完整的序列化缓冲区
+     *
+     * @param[in] buf 序列化数据，长度必须与消息的紧凑序列化大小一致
+     * @return 解析得到的消息视图，数据越界或长度不一致时返回 `std::nullopt`
+     */
+    static std::optional<MultiDOFJointStateView> parse(std::span<const std::byte> buf) noexcept;
+
+    /**
+     * @brief 从读取游标中解析消息视图，用于嵌套消息
+     *
+     * @param[in] reader 读取游标，解析成功后前移至该消息末尾
+     * @param[out] view 解析得到的消息视图
+     * @return 是否解析成功
+     */
+    static bool parse(ViewReader &reader, MultiDOFJointStateView &view) noexcept;
+
+    //! 复制视图引用的数据，构造拥有数据所有权的 MultiDOFJointState 消息
+    MultiDOFJointState to_msg() const;
+
+    //! 获取该消息在缓冲区中的原始字节
+    std::span<const std::byte> bytes() const noexcept { return _bytes__; }
+
+private:
+    std::span<const std::byte> _bytes__{};
+};
+
+#endif
+
+//! @} rmvlmsg
+
+} // namespace rm::msg
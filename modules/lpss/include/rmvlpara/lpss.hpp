@@ -0,0 +1,101 @@
+/**
+ * @file lpss.hpp
+ * @author RMVL Community
+ * @brief LpssParam module header file (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#pragma once
+
+#include <rmvl/rmvl_modules.hpp>
+
+#ifdef HAVE_OPENCV
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#else
+#include <string>
+#include <vector>
+#endif
+
+#include "rmvl/core/rmvldef.hpp"
+
+//! @addtogroup rmvlpara
+//! @{
+//! @defgroup para_lpss lpss 的参数模块
+//! @addtogroup para_lpss
+//! @{
+//! @brief 与 @ref lpss 相关的参数模块，包含...
+//! @} para_lpss
+//! @} rmvlpara
+
+namespace rm::para {
+
+//! @addtogroup para_lpss
+//! @{
+//! @details
+//! - 类名： LpssParam ，对应的全局参数变量： `rm::para::lpss_param`
+//! @} para_lpss
+
+//! @addtogroup para_lpss
+//! @{
+
+////////////////////// 扩展部分 //////////////////////
+
+
+////////////////////// 参数部分 //////////////////////
+
+//! LpssParam 参数模块
+class RMVL_EXPORTS_W LpssParam {
+public:
+    //! 节点的最大心跳周期 @details 默认值：`2`
+    RMVL_W_RW uint8_t MAX_NODE_HEARTBEAT_PERIOD = 2;
+    //! MTP 未完成分片重组超时（毫秒） @details 默认值：`1000`
+    RMVL_W_RW uint32_t MTP_FRAGMENT_TIMEOUT = 1000;
+    //! 每个读取器允许缓存的 MTP 分片总字节数 @details 默认值：`16777216`
+    RMVL_W_RW uint32_t MTP_REASSEMBLY_MAX_BYTES = 16777216;
+    //! 可靠写入器缓存的最近消息数 @details 默认值：`16`
+    RMVL_W_RW uint8_t MTP_RELIABLE_HISTORY_DEPTH = 16;
+    //! 可靠写入器重发心跳的周期（毫秒） @details 默认值：`20`
+    RMVL_W_RW uint32_t MTP_RELIABLE_HEARTBEAT_PERIOD = 20;
+    //! 每次写入或重传后心跳的最大重发次数 @details 默认值：`5`
+    RMVL_W_RW uint8_t MTP_RELIABLE_HEARTBEAT_REPEATS = 5;
+    //! 单条消息对单个读取器的最大重传次数 @details 默认值：`8`
+    RMVL_W_RW uint8_t MTP_RELIABLE_MAX_RETRANSMIT = 8;
+    //! MTP 多播数据端口基数，实际端口为基数与域 ID 之和 @details 默认值：`7000`
+    RMVL_W_RW uint16_t MTP_MULTICAST_PORT_BASE = 7000;
+    //! 写入器启用多播所需的最少多播读取器数量 @details 默认值：`2`
+    RMVL_W_RW uint8_t MTP_MULTICAST_MIN_READERS = 2;
+    //! 是否将多播数据环回至本机，同主机读取器默认已使用共享内存通道 @details 默认值：`false`
+    RMVL_W_RW bool MTP_MULTICAST_LOOPBACK = false;
+
+
+    //! 创建 LpssParam 参数对象 @warning 不建议手动创建对象
+    RMVL_W LpssParam() = default;
+
+    /**
+     * @brief 从指定 `YAML` 文件中加载，并读取至 `LpssParam` 中
+     *
+     * @note `YAML` 文件的后缀允许是 `*.yml` 和 `*.yaml`
+     * @param[in] path 参数路径
+     * @return 是否读取成功
+     */
+    RMVL_W bool read(const std::string &path);
+
+    /**
+     * @brief 将 `LpssParam` 的数据写入指定的 `YAML` 文件中
+     *
+     * @note `YAML` 文件的后缀允许是 `*.yml` 和 `*.yaml`
+     * @param[in] path 参数路径
+     * @return 是否写入成功
+     */
+    RMVL_W bool write(const std::string &path) const;
+};
+
+//! LpssParam 参数模块
+RMVL_W_RW inline LpssParam lpss_param;
+
+//! @} para_lpss
+
+} // namespace rm::para
@@ -0,0 +1,56 @@
+/**
+ * @file set_camera_info.hpp
+ * @brief SetCameraInfo service header (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rmvlmsg/sensor/camera_info.hpp"
+
+namespace rm::srv {
+
+//! @addtogroup rmvlsrv
+//! @{
+
+//! SetCameraInfo 服务类型
+struct SetCameraInfo {
+    //! SetCameraInfo 服务请求
+    class Request {
+    public:
+        rm::msg::CameraInfo camera_info{};
+
+
+        static constexpr const char msg_type[] = "sensor/SetCameraInfo_Request";
+
+        std::string serialize() const noexcept;
+        static Request deserialize(const char *str) noexcept;
+        std::size_t compact_size() const noexcept;
+    };
+    
+    //! SetCameraInfo 服务响应
+    class Response {
+    public:
+        bool success{};
+        std::string status_message{};
+
+
+        static constexpr const char msg_type[] = "sensor/SetCameraInfo_Response";
+    
+        std::string serialize() const noexcept;
+        static Response deserialize(const char *str) noexcept;
+        std::size_t compact_size() const noexcept;
+    };
+
+    static constexpr const char srv_type[] = "sensor/SetCameraInfo";
+};
+
+//! @} rmvlsrv
+
+} // namespace rm::srv
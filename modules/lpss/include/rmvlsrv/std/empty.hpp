@@ -0,0 +1,52 @@
+/**
+ * @file empty.hpp
+ * @brief Empty service header (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace rm::srv {
+
+//! @addtogroup rmvlsrv
+//! @{
+
+//! Empty 服务类型
+struct Empty {
+    //! Empty 服务请求
+    class Request {
+    public:
+
+
+        static constexpr const char msg_type[] = "std/Empty_Request";
+
+        std::string serialize() const noexcept;
+        static Request deserialize(const char *str) noexcept;
+        std::size_t compact_size() const noexcept;
+    };
+    
+    //! Empty 服务响应
+    class Response {
+    public:
+
+
+        static constexpr const char msg_type[] = "std/Empty_Response";
+    
+        std::string serialize() const noexcept;
+        static Response deserialize(const char *str) noexcept;
+        std::size_t compact_size() const noexcept;
+    };
+
+    static constexpr const char srv_type[] = "std/Empty";
+};
+
+//! @} rmvlsrv
+
+} // namespace rm::srv
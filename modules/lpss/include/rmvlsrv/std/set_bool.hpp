@@ -0,0 +1,55 @@
+/**
+ * @file set_bool.hpp
+ * @brief SetBool service header (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace rm::srv {
+
+//! @addtogroup rmvlsrv
+//! @{
+
+//! SetBool 服务类型
+struct SetBool {
+    //! SetBool 服务请求
+    class Request {
+    public:
+        bool data{};
+
+
+        static constexpr const char msg_type[] = "std/SetBool_Request";
+
+        std::string serialize() const noexcept;
+        static Request deserialize(const char *str) noexcept;
+        std::size_t compact_size() const noexcept;
+    };
+    
+    //! SetBool 服务响应
+    class Response {
+    public:
+        bool success{};
+        std::string message{};
+
+
+        static constexpr const char msg_type[] = "std/SetBool_Response";
+    
+        std::string serialize() const noexcept;
+        static Response deserialize(const char *str) noexcept;
+        std::size_t compact_size() const noexcept;
+    };
+
+    static constexpr const char srv_type[] = "std/SetBool";
+};
+
+//! @} rmvlsrv
+
+} // namespace rm::srv
@@ -0,0 +1,54 @@
+/**
+ * @file trigger.hpp
+ * @brief Trigger service header (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace rm::srv {
+
+//! @addtogroup rmvlsrv
+//! @{
+
+//! Trigger 服务类型
+struct Trigger {
+    //! Trigger 服务请求
+    class Request {
+    public:
+
+
+        static constexpr const char msg_type[] = "std/Trigger_Request";
+
+        std::string serialize() const noexcept;
+        static Request deserialize(const char *str) noexcept;
+        std::size_t compact_size() const noexcept;
+    };
+    
+    //! Trigger 服务响应
+    class Response {
+    public:
+        bool success{};
+        std::string message{};
+
+
+        static constexpr const char msg_type[] = "std/Trigger_Response";
+    
+        std::string serialize() const noexcept;
+        static Response deserialize(const char *str) noexcept;
+        std::size_t compact_size() const noexcept;
+    };
+
+    static constexpr const char srv_type[] = "std/Trigger";
+};
+
+//! @} rmvlsrv
+
+} // namespace rm::srv
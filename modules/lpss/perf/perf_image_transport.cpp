@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include "rmvl/lpss/image_transport.hpp"
+#include "rmvl/rmvl_modules.hpp"
+
+namespace rm_test {
+
+using namespace rm;
+
+namespace {
+
+constexpr int32_t img_height = 1024;
+constexpr int32_t img_width = 1280;
+
+/**
+ * @brief 生成大部分区域静止的 BGR 场景，仅有一个 64×64 的方块随帧号移动
+ *
+ * @param[in] frame 帧号
+ */
+msg::Image scene(int frame) {
+    msg::Image img{};
+    img.height = img_height;
+    img.width = img_width;
+    img.encoding = msg::Image::encoding_bgr8;
+    img.data.resize(lpss::imageBytes(img_height, img_width, img.encoding));
+    const int bx = (frame * 7) % (img_width - 64), by = 400;
+    for (int32_t y = 0; y < img_height; ++y) {
+        uint8_t *row = img.data.data() + static_cast<std::size_t>(y) * img_width * 3;
+        for (int32_t x = 0; x < img_width; ++x) {
+            const bool box = x >= bx && x < bx + 64 && y >= by && y < by + 64;
+            row[3 * x + 0] = box ? 30 : static_cast<uint8_t>(x / 8 + y / 16);
+            row[3 * x + 1] = box ? 60 : static_cast<uint8_t>((x / 32) * 8);
+            row[3 * x + 2] = box ? 220 : static_cast<uint8_t>(y / 4);
+        }
+    }
+    return img;
+}
+
+//! 30 帧循环的测试序列
+const std::vector<msg::Image> &sequence() {
+    static const auto frames = [] {
+        std::vector<msg::Image> frames{};
+        for (int i = 0; i < 30; ++i)
+            frames.push_back(scene(i));
+        return frames;
+    }();
+    return frames;
+}
+
+/**
+ * @brief 带宽与压缩比计数器，带宽按 30 fps 折算
+ *
+ * @param[in] state 基准测试状态
+ * @param[in] raw 原始总字节数
+ * @param[in] compressed 编码后总字节数
+ */
+void bandwidthCounters(benchmark::State &state, double raw, double compressed) {
+    state.counters["ratio"] = raw / compressed;
+    state.counters["Mbps@30fps"] = compressed / static_cast<double>(state.iterations()) * 8 * 30 / 1e6;
+}
+
+} // namespace
+
+void image_encode(benchmark::State &state, const char *transport) {
+    const auto &frames = sequence();
+    lpss::ImageEncoder encoder(transport);
+    msg::CompressedImage packet{};
+    std::size_t i{}, raw{}, compressed{};
+    for (auto _ : state) {
+        const auto &frame = frames[i++ % frames.size()];
+        encoder.encode(frame, packet);
+        benchmark::DoNotOptimize(packet.data.data());
+        raw += frame.data.size(), compressed += packet.data.size();
+    }
+    bandwidthCounters(state, static_cast<double>(raw), static_cast<double>(compressed));
+    state.SetBytesProcessed(static_cast<int64_t>(raw));
+}
+
+void image_decode(benchmark::State &state, const char *transport) {
+    const auto &frames = sequence();
+    lpss::ImageEncoder encoder(transport);
+    std::vector<msg::CompressedImage> packets{};
+    for (const auto &frame : frames)
+        packets.push_back(encoder.encode(frame));
+
+    lpss::ImageDecoder decoder;
+    msg::Image image{};
+    std::size_t i{}, raw{};
+    for (auto _ : state) {
+        const auto &packet = packets[i++ % packets.size()];
+        if (!decoder.decode(packet, image))
+            state.SkipWithError("decode failed");
+        benchmark::DoNotOptimize(image.data.data());
+        raw += image.data.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(raw));
+}
+
+BENCHMARK_CAPTURE(image_encode, raw, "raw")->Name("LPSS image encode (raw, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(image_encode, qoi, "qoi")->Name("LPSS image encode (qoi, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(image_encode, delta, "delta")->Name("LPSS image encode (delta, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(image_decode, raw, "raw")->Name("LPSS image decode (raw, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(image_decode, qoi, "qoi")->Name("LPSS image decode (qoi, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(image_decode, delta, "delta")->Name("LPSS image decode (delta, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+
+#ifdef HAVE_OPENCV
+BENCHMARK_CAPTURE(image_encode, jpeg, "jpeg")->Name("LPSS image encode (jpeg, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(image_encode, png, "png")->Name("LPSS image encode (png, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(image_decode, jpeg, "jpeg")->Name("LPSS image decode (jpeg, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(image_decode, png, "png")->Name("LPSS image decode (png, 1280x1024 bgr8)")->Unit(benchmark::kMillisecond);
+#endif // HAVE_OPENCV
+
+} // namespace rm_test
@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <numeric>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <arpa/inet.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/lpss/details/node_rmtp.hpp"
+
+namespace rm_test {
+
+using namespace rm;
+
+namespace {
+
+constexpr std::string_view topic = "/perf_reassembly";
+constexpr std::string_view type = "perf/Reassembly";
+
+std::string mtpHeader(uint16_t sequence, uint16_t fragment_id, uint32_t total_size, uint16_t fragment_size) {
+    std::string header{"MT02"};
+    auto topic_size = static_cast<uint8_t>(topic.size());
+    auto type_size = static_cast<uint8_t>(type.size());
+    header.append(reinterpret_cast<const char *>(&topic_size), sizeof(topic_size));
+    header.append(topic);
+    header.append(reinterpret_cast<const char *>(&type_size), sizeof(type_size));
+    header.append(type);
+    sequence = htons(sequence);
+    fragment_id = htons(fragment_id);
+    total_size = htonl(total_size);
+    fragment_size = htons(fragment_size);
+    header.append(reinterpret_cast<const char *>(&sequence), sizeof(sequence));
+    header.append(reinterpret_cast<const char *>(&fragment_id), sizeof(fragment_id));
+    header.append(reinterpret_cast<const char *>(&total_size), sizeof(total_size));
+    header.append(reinterpret_cast<const char *>(&fragment_size), sizeof(fragment_size));
+    return header;
+}
+
+struct Fragment {
+    uint16_t id{};
+    std::string_view payload{};
+};
+
+/**
+ * @brief 按 MTU 1500 切分消息
+ *
+ * @param[in] data 消息载荷
+ * @param[in] reversed 是否逆序投递
+ */
+std::vector<Fragment> split(std::string_view data, bool reversed) {
+    std::size_t capacity = 1500 - 28 - lpss::MTPReassembler(type, topic).header_size();
+    std::vector<Fragment> fragments{};
+    for (std::size_t offset = 0, id = 0; offset < data.size(); offset += capacity, ++id)
+        fragments.push_back({static_cast<uint16_t>(id), data.substr(offset, capacity)});
+    if (reversed)
+        std::reverse(fragments.begin(), fragments.end());
+    return fragments;
+}
+
+} // namespace
+
+void mtp_reassembly(benchmark::State &state) {
+    std::string data(static_cast<std::size_t>(state.range(0)), '\0');
+    std::iota(data.begin(), data.end(), '\0');
+    auto fragments = split(data, state.range(1) != 0);
+
+    lpss::MTPReassembler reassembler(type, topic);
+    uint16_t sequence{};
+    for (auto _ : state) {
+        std::optional<std::string> message{};
+        for (const auto &fragment : fragments) {
+            auto header = mtpHeader(sequence, fragment.id, static_cast<uint32_t>(data.size()), static_cast<uint16_t>(fragment.payload.size()));
+            message = reassembler.fragment(header, fragment.payload, "127.0.0.1", 10000);
+        }
+        benchmark::DoNotOptimize(message);
+        ++sequence;
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(mtp_reassembly)->Name("LPSS MTP Reassembly (in order)")->Args({64 << 10, 0})->Args({1 << 20, 0})->Unit(benchmark::kMicrosecond);
+BENCHMARK(mtp_reassembly)->Name("LPSS MTP Reassembly (reversed)")->Args({64 << 10, 1})->Args({1 << 20, 1})->Unit(benchmark::kMicrosecond);
+
+} // namespace rm_test
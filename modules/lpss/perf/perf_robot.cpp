@@ -0,0 +1,285 @@
+/**
+ * @file perf_robot.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief RobotPlanner 逆运动学、可达性地图、轨迹时间参数化与碰撞检测性能测试
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/lpss/robot.hpp"
+
+using namespace rm;
+using namespace rm::lpss;
+
+namespace rm_test {
+
+#ifdef RMVL_LPSS_WITH_KDL
+
+namespace {
+
+// 与 UR5 尺寸一致的 6-DoF 机械臂
+constexpr const char *k_urdf_6dof = R"(<?xml version="1.0"?>
+<robot name="perf_6dof">
+  <link name="base_link">
+    <collision><origin xyz="0 0 0.045"/><geometry><cylinder radius="0.075" length="0.09"/></geometry></collision>
+  </link>
+  <link name="shoulder_link">
+    <collision><origin xyz="0 0.07 0" rpy="1.570796 0 0"/><geometry><cylinder radius="0.06" length="0.15"/></geometry></collision>
+  </link>
+  <link name="upper_arm_link">
+    <collision><origin xyz="0 0 0.2125"/><geometry><capsule radius="0.06" length="0.425"/></geometry></collision>
+  </link>
+  <link name="forearm_link">
+    <collision><origin xyz="0 0 0.17"/><geometry><capsule radius="0.045" length="0.3"/></geometry></collision>
+  </link>
+  <link name="wrist_1_link">
+    <collision><origin xyz="0 0.05 0" rpy="1.570796 0 0"/><geometry><cylinder radius="0.045" length="0.1"/></geometry></collision>
+  </link>
+  <link name="wrist_2_link">
+    <collision><origin xyz="0 0 0.05"/><geometry><cylinder radius="0.045" length="0.1"/></geometry></collision>
+  </link>
+  <link name="wrist_3_link">
+    <collision><origin xyz="0 0.04 0" rpy="1.570796 0 0"/><geometry><cylinder radius="0.04" length="0.05"/></geometry></collision>
+  </link>
+  <link name="tool0">
+    <collision><origin xyz="0 0 0.03"/><geometry><sphere radius="0.03"/></geometry></collision>
+  </link>
+  <joint name="shoulder_pan_joint" type="revolute">
+    <parent link="base_link"/><child link="shoulder_link"/>
+    <origin xyz="0 0 0.089159" rpy="0 0 0"/><axis xyz="0 0 1"/>
+    <limit lower="-6.28" upper="6.28" velocity="3.15" effort="150" jerk="200"/>
+  </joint>
+  <joint name="shoulder_lift_joint" type="revolute">
+    <parent link="shoulder_link"/><child link="upper_arm_link"/>
+    <origin xyz="0 0.13585 0" rpy="0 1.570796 0"/><axis xyz="0 1 0"/>
+    <limit lower="-6.28" upper="6.28" velocity="3.15" effort="150" jerk="200"/>
+  </joint>
+  <joint name="elbow_joint" type="revolute">
+    <parent link="upper_arm_link"/><child link="forearm_link"/>
+    <origin xyz="0 -0.1197 0.425" rpy="0 0 0"/><axis xyz="0 1 0"/>
+    <limit lower="-3.14" upper="3.14" velocity="3.15" effort="150" jerk="200"/>
+  </joint>
+  <joint name="wrist_1_joint" type="revolute">
+    <parent link="forearm_link"/><child link="wrist_1_link"/>
+    <origin xyz="0 0 0.39225" rpy="0 1.570796 0"/><axis xyz="0 1 0"/>
+    <limit lower="-6.28" upper="6.28" velocity="3.2" effort="28" jerk="200"/>
+  </joint>
+  <joint name="wrist_2_joint" type="revolute">
+    <parent link="wrist_1_link"/><child link="wrist_2_link"/>
+    <origin xyz="0 0.093 0" rpy="0 0 0"/><axis xyz="0 0 1"/>
+    <limit lower="-6.28" upper="6.28" velocity="3.2" effort="28" jerk="200"/>
+  </joint>
+  <joint name="wrist_3_joint" type="revolute">
+    <parent link="wrist_2_link"/><child link="wrist_3_link"/>
+    <origin xyz="0 0 0.09465" rpy="0 0 0"/><axis xyz="0 1 0"/>
+    <limit lower="-6.28" upper="6.28" velocity="3.2" effort="28" jerk="200"/>
+  </joint>
+  <joint name="tool0_joint" type="fixed">
+    <parent link="wrist_3_link"/><child link="tool0"/>
+    <origin xyz="0 0.0823 0" rpy="0 0 1.570796"/>
+  </joint>
+</robot>
+)";
+
+std::string writeURDF() {
+#ifdef _WIN32
+    std::string path = std::string(std::getenv("TEMP")) + "\\perf_6dof.urdf";
+#else
+    std::string path = "/tmp/perf_6dof.urdf";
+#endif
+    std::ofstream(path) << k_urdf_6dof;
+    return path;
+}
+
+//! 沿一条平滑关节空间曲线采样末端位姿，模拟连续跟踪目标
+std::vector<msg::Pose> trackingTargets(RobotPlanner &planner, std::size_t count) {
+    std::vector<msg::Pose> targets{};
+    msg::JointState js = planner.joints();
+    for (std::size_t k = 0; k < count; ++k) {
+        const double s = 0.05 * static_cast<double>(k);
+        for (std::size_t i = 0; i < js.position.size(); ++i)
+            js.position[i] = 0.4 * std::sin(s + 0.7 * static_cast<double>(i)) + (i == 1 ? -0.8 : 0.3);
+        planner.update(js);
+        targets.push_back(planner.linkpose("tool0"));
+    }
+    // 以首个采样点作为当前关节状态
+    for (std::size_t i = 0; i < js.position.size(); ++i)
+        js.position[i] = 0.4 * std::sin(0.7 * static_cast<double>(i)) + (i == 1 ? -0.8 : 0.3);
+    planner.update(js);
+    return targets;
+}
+
+void runIK(benchmark::State &state, bool rebuild, bool warm_start) {
+    RobotPlanner planner(writeURDF());
+    const auto targets = trackingTargets(planner, 128);
+    planner.setIKOptions({1e-5, 5000, warm_start});
+
+    std::size_t k = 0, failures = 0;
+    for (auto _ : state) {
+        if (rebuild)
+            planner.setIKOptions({1e-5, 5000, warm_start});
+        const auto solution = planner.solveIK("tool0", targets[k++ % targets.size()]);
+        failures += solution.position.empty();
+        benchmark::DoNotOptimize(solution);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["failures"] = static_cast<double>(failures);
+}
+
+//! 逐个目标串行求解与批量求解同一组目标，各目标均以当前关节状态为初值
+void runBatchIK(benchmark::State &state, bool batch) {
+    RobotPlanner planner(writeURDF());
+    const auto targets = trackingTargets(planner, 256);
+    planner.setIKOptions({1e-5, 5000, false});
+
+    std::size_t failures = 0;
+    for (auto _ : state) {
+        if (batch) {
+            const auto result = planner.solveIKBatch("tool0", targets.data(), targets.size());
+            failures += static_cast<std::size_t>(std::count(result.success.begin(), result.success.end(), uint8_t{0}));
+            benchmark::DoNotOptimize(result);
+        } else {
+            for (const auto &target : targets) {
+                const auto solution = planner.solveIK("tool0", target);
+                failures += solution.position.empty();
+                benchmark::DoNotOptimize(solution);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(targets.size()));
+    state.counters["failures"] = static_cast<double>(failures) / static_cast<double>(state.iterations());
+}
+
+//! 关节空间途经点，相邻途经点间的转折角较大
+std::vector<msg::JointState> jointWaypoints(const RobotPlanner &planner) {
+    std::vector<msg::JointState> waypoints(6, planner.joints());
+    for (std::size_t k = 0; k < waypoints.size(); ++k)
+        for (std::size_t i = 0; i < waypoints[k].position.size(); ++i)
+            waypoints[k].position[i] = 0.8 * std::sin(1.3 * static_cast<double>(k + 1) + 0.9 * static_cast<double>(i));
+    return waypoints;
+}
+
+//! 关节空间多途经点规划：统计规划耗时、轨迹总时长与最大加加速度
+void runPlan(benchmark::State &state, TimeParameterization method) {
+    RobotPlanner planner(writeURDF());
+    planner.setTimeParameterization(method);
+    const auto waypoints = jointWaypoints(planner);
+
+    msg::JointTrajectory traj{};
+    for (auto _ : state) {
+        traj = planner.plan(waypoints);
+        benchmark::DoNotOptimize(traj);
+    }
+    double max_jerk = 0.0;
+    for (std::size_t k = 1; k < traj.points.size(); ++k) {
+        const auto &p0 = traj.points[k - 1], &p1 = traj.points[k];
+        const double dt = static_cast<double>(p1.time_from_start.nanoseconds - p0.time_from_start.nanoseconds) * 1e-9;
+        if (dt <= 0.0)
+            continue;
+        for (std::size_t i = 0; i < p1.accelerations.size(); ++i)
+            max_jerk = std::max(max_jerk, std::abs(p1.accelerations[i] - p0.accelerations[i]) / dt);
+    }
+    state.counters["trajectory_s"] = static_cast<double>(traj.points.back().time_from_start.nanoseconds) * 1e-9;
+    state.counters["max_jerk"] = max_jerk;
+    state.counters["points"] = static_cast<double>(traj.points.size());
+}
+
+} // namespace
+
+void ik_6dof_uncached(benchmark::State &state) { runIK(state, true, false); }
+void ik_6dof_cached(benchmark::State &state) { runIK(state, false, false); }
+void ik_6dof_cached_warm(benchmark::State &state) { runIK(state, false, true); }
+
+BENCHMARK(ik_6dof_uncached)->Name("LPSS IK 6-DoF (rebuild solver, joint-state seed)");
+BENCHMARK(ik_6dof_cached)->Name("LPSS IK 6-DoF (cached solver, joint-state seed)");
+BENCHMARK(ik_6dof_cached_warm)->Name("LPSS IK 6-DoF (cached solver, warm start)");
+
+void ik_6dof_serial(benchmark::State &state) { runBatchIK(state, false); }
+void ik_6dof_batch(benchmark::State &state) { runBatchIK(state, true); }
+
+BENCHMARK(ik_6dof_serial)->Name("LPSS IK 6-DoF 256 targets (serial)")->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(ik_6dof_batch)->Name("LPSS IK 6-DoF 256 targets (batch, thread pool)")->Unit(benchmark::kMillisecond)->UseRealTime();
+
+void reachability_6dof(benchmark::State &state) {
+    RobotPlanner planner(writeURDF());
+    ReachabilityOptions options{};
+    options.min = {-1.0, -1.0, -0.5};
+    options.max = {1.0, 1.0, 1.5};
+    options.resolution = 0.25;
+    for (auto _ : state) {
+        auto map = planner.buildReachabilityMap("tool0", options);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * 8 * 8 * 8);
+}
+
+BENCHMARK(reachability_6dof)->Name("LPSS reachability map 8x8x8 (identity orientation)")->Unit(benchmark::kMillisecond)->UseRealTime();
+
+void reachability_query(benchmark::State &state) {
+    ReachabilityMap map({-1.0, -1.0, -0.5}, 0.01, {200, 200, 200});
+    for (uint32_t i = 0; i < 200; ++i)
+        map.set(i, i, i, 1.0);
+    msg::Point p{};
+    std::size_t k = 0;
+    for (auto _ : state) {
+        const double s = 0.001 * static_cast<double>(k++ % 2000);
+        p.x = -1.0 + s, p.y = -1.0 + s, p.z = -0.5 + s;
+        benchmark::DoNotOptimize(map.score(p));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(reachability_query)->Name("LPSS reachability map query (200^3 voxels)");
+
+
+void plan_6dof_quintic(benchmark::State &state) { runPlan(state, TimeParameterization::Quintic); }
+void plan_6dof_toppra(benchmark::State &state) { runPlan(state, TimeParameterization::TOPPRA); }
+
+BENCHMARK(plan_6dof_quintic)->Name("LPSS plan 6-DoF 6 waypoints (quintic, stop at waypoints)")->Unit(benchmark::kMicrosecond);
+BENCHMARK(plan_6dof_toppra)->Name("LPSS plan 6-DoF 6 waypoints (TOPP-RA, blended)")->Unit(benchmark::kMicrosecond);
+
+//! 地面与若干障碍物组成的无碰撞环境，沿 TOPP-RA 规划得到的整条轨迹做碰撞检测
+void collision_6dof_trajectory(benchmark::State &state) {
+    RobotPlanner planner(writeURDF());
+    planner.setTimeParameterization(TimeParameterization::TOPPRA);
+    const auto traj = planner.plan(jointWaypoints(planner));
+
+    // 机械臂安装在约 1m 高的底座上
+    CollisionShape floor{};
+    floor.type = CollisionShapeType::Box;
+    floor.size = {4.0, 4.0, 0.1};
+    floor.origin.position = {0.0, 0.0, -1.0};
+    planner.addCollisionObject("floor", floor);
+    for (int k = 0; k < 16; ++k) {
+        CollisionShape obstacle{};
+        obstacle.type = k % 2 ? CollisionShapeType::Box : CollisionShapeType::Sphere;
+        obstacle.size = {0.08, 0.08, 0.08};
+        const double angle = 0.3927 * k;
+        obstacle.origin.position = {1.1 * std::cos(angle), 1.1 * std::sin(angle), 0.1 + 0.05 * (k % 4)};
+        planner.addCollisionObject("obstacle_" + std::to_string(k), obstacle);
+    }
+
+    CollisionResult result{};
+    for (auto _ : state) {
+        result = planner.checkCollision(traj);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["collision"] = result.collision;
+    state.counters["points"] = static_cast<double>(traj.points.size());
+}
+
+BENCHMARK(collision_6dof_trajectory)->Name("LPSS checkCollision 6-DoF trajectory (17 obstacles)")->Unit(benchmark::kMicrosecond);
+
+#endif // RMVL_LPSS_WITH_KDL
+
+} // namespace rm_test
@@ -1,6 +1,10 @@
+#include <span>
+
 #include <benchmark/benchmark.h>
 #include <nlohmann/json.hpp>
 
+#include "rmvlmsg/sensor/image.hpp"
+
 namespace rm::msg {
 
 class TestData {
@@ -99,9 +103,37 @@ void json_data_deserialize(benchmark::State &state) {
     }
 }
 
+static std::string serialized_image() {
+    msg::Image img{};
+    img.header.frame_id = "camera";
+    img.height = 1024;
+    img.width = 1280;
+    img.encoding = msg::Image::encoding_bgr8;
+    img.data.assign(static_cast<std::size_t>(img.height) * img.width * 3, 0x5a);
+    return img.serialize();
+}
+
+void image_deserialize(benchmark::State &state) {
+    auto serialized = serialized_image();
+    for (auto _ : state) {
+        auto img = msg::Image::deserialize(serialized.data());
+        benchmark::DoNotOptimize(img.data.data());
+    }
+}
+
+void image_view_parse(benchmark::State &state) {
+    auto serialized = serialized_image();
+    for (auto _ : state) {
+        auto view = msg::Image::View::parse(std::as_bytes(std::span(serialized.data(), serialized.size())));
+        benchmark::DoNotOptimize(view->data.data());
+    }
+}
+
 BENCHMARK(data_serialize)->Name("LPSS Data Serialize")->Iterations(100000);
 BENCHMARK(data_deserialize)->Name("LPSS Data Deserialize")->Iterations(100000);
 BENCHMARK(json_data_serialize)->Name("JSON Data Serialize")->Iterations(100000);
 BENCHMARK(json_data_deserialize)->Name("JSON Data Deserialize")->Iterations(100000);
+BENCHMARK(image_deserialize)->Name("LPSS Image Deserialize (1280x1024 BGR)")->Iterations(200);
+BENCHMARK(image_view_parse)->Name("LPSS Image View Parse (1280x1024 BGR)")->Iterations(200);
 
 } // namespace rm_test
\ No newline at end of file
@@ -0,0 +1,170 @@
+/**
+ * @file perf_transform.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief tf::Buffer 并发查询与批量变换性能测试
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/lpss/transform.hpp"
+
+using namespace rm;
+using namespace rm::lpss;
+
+namespace rm_test {
+
+namespace {
+
+msg::TransformStamped makeTransform(const char *parent, const char *child, int32_t sec, uint32_t nsec = 0) {
+    msg::TransformStamped result{};
+    result.header.frame_id = parent;
+    result.header.stamp = {sec, nsec};
+    result.child_frame_id = child;
+    result.transform.translation = {0.1, 0.2, 0.3};
+    result.transform.rotation.w = 1.0;
+    return result;
+}
+
+//! 云台坐标树：map → odom → base_link → gimbal_link → camera_link，其中 odom 与 gimbal_link 为动态边
+struct GimbalTree {
+    GimbalTree() : buffer(std::chrono::seconds(2)) {
+        buffer.setStatic(makeTransform("map", "odom", 0));
+        buffer.setStatic(makeTransform("base_link", "gimbal_base", 0));
+        buffer.setStatic(makeTransform("gimbal_link", "camera_link", 0));
+        for (int32_t sec = 0; sec < 2; ++sec) {
+            buffer.set(makeTransform("odom", "base_link", sec));
+            buffer.set(makeTransform("gimbal_base", "gimbal_link", sec));
+        }
+        map = buffer.frame("map");
+        camera = buffer.frame("camera_link");
+    }
+
+    //! 启动以 1 ms 步长持续写入两条动态边的写线程
+    void startWriter() {
+        stop = false;
+        writer = std::thread([this] {
+            uint32_t tick = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                ++tick;
+                const auto sec = static_cast<int32_t>(2 + tick / 1000);
+                const auto nsec = (tick % 1000) * 1'000'000u;
+                buffer.set(makeTransform("odom", "base_link", sec, nsec));
+                buffer.set(makeTransform("gimbal_base", "gimbal_link", sec, nsec));
+            }
+        });
+    }
+
+    void stopWriter() {
+        stop = true;
+        if (writer.joinable())
+            writer.join();
+    }
+
+    tf::Buffer buffer;
+    tf::FrameId map{};
+    tf::FrameId camera{};
+    std::atomic_bool stop{};
+    std::thread writer{};
+};
+
+GimbalTree &tree() {
+    static GimbalTree instance;
+    return instance;
+}
+
+} // namespace
+
+void tf_lookup_frame_id(benchmark::State &state) {
+    auto &gimbal = tree();
+    if (state.thread_index() == 0 && state.range(0) != 0)
+        gimbal.startWriter();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(gimbal.buffer.lookup(gimbal.map, gimbal.camera));
+    if (state.thread_index() == 0)
+        gimbal.stopWriter();
+    state.SetItemsProcessed(state.iterations());
+}
+
+void tf_lookup_string(benchmark::State &state) {
+    auto &gimbal = tree();
+    if (state.thread_index() == 0 && state.range(0) != 0)
+        gimbal.startWriter();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(gimbal.buffer.lookup("map", "camera_link"));
+    if (state.thread_index() == 0)
+        gimbal.stopWriter();
+    state.SetItemsProcessed(state.iterations());
+}
+
+void tf_set_dynamic(benchmark::State &state) {
+    tf::Buffer buffer(std::chrono::seconds(10));
+    buffer.setStatic(makeTransform("map", "odom", 0));
+    uint32_t tick = 0;
+    for (auto _ : state) {
+        ++tick;
+        benchmark::DoNotOptimize(buffer.set(makeTransform("odom", "base_link", static_cast<int32_t>(tick / 1000), (tick % 1000) * 1'000'000u)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+std::vector<msg::Point> makeCloud(std::size_t count) {
+    std::vector<msg::Point> cloud(count);
+    for (std::size_t i = 0; i < count; ++i)
+        cloud[i] = {std::cos(0.001 * i), std::sin(0.001 * i), 0.0001 * i};
+    return cloud;
+}
+
+void tf_transform_cloud_per_point(benchmark::State &state) {
+    auto &gimbal = tree();
+    const auto cloud = makeCloud(static_cast<std::size_t>(state.range(0)));
+    std::vector<msg::Point> output(cloud.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < cloud.size(); ++i)
+            output[i] = gimbal.buffer.lookup(gimbal.map, gimbal.camera).transform * cloud[i];
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void tf_transform_cloud_compose(benchmark::State &state) {
+    auto &gimbal = tree();
+    const auto cloud = makeCloud(static_cast<std::size_t>(state.range(0)));
+    std::vector<msg::Point> output(cloud.size());
+    for (auto _ : state) {
+        const auto chain = gimbal.buffer.lookup(gimbal.map, gimbal.camera).transform;
+        for (std::size_t i = 0; i < cloud.size(); ++i)
+            output[i] = chain * cloud[i];
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void tf_transform_cloud_batch(benchmark::State &state) {
+    auto &gimbal = tree();
+    const auto cloud = makeCloud(static_cast<std::size_t>(state.range(0)));
+    std::vector<msg::Point> output(cloud.size());
+    for (auto _ : state) {
+        gimbal.buffer.transform(gimbal.map, gimbal.camera, {}, cloud.data(), output.data(), cloud.size());
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(tf_lookup_frame_id)->Name("LPSS tf lookup (FrameId)")->Arg(0)->Arg(1)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK(tf_lookup_string)->Name("LPSS tf lookup (string)")->Arg(0)->Arg(1)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK(tf_set_dynamic)->Name("LPSS tf set with 10 s history");
+BENCHMARK(tf_transform_cloud_per_point)->Name("LPSS tf cloud (lookup per point)")->Arg(50000);
+BENCHMARK(tf_transform_cloud_compose)->Name("LPSS tf cloud (lookup + operator*)")->Arg(50000);
+BENCHMARK(tf_transform_cloud_batch)->Name("LPSS tf cloud (batch transform)")->Arg(64)->Arg(50000);
+
+} // namespace rm_test
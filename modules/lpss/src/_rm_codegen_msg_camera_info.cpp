@@ -0,0 +1,155 @@
+/**
+ * @file _rm_codegen_msg_camera_info.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief CameraInfo source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/sensor/camera_info.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string CameraInfo::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(height) + sizeof(width) + sizeof(D) + sizeof(K));
+    _res_.append(header.serialize());
+    append_scalar(_res_, height);
+    append_scalar(_res_, width);
+    append_array(_res_, D.data(), D.size());
+    append_array(_res_, K.data(), K.size());
+
+    return _res_;
+}
+
+std::string CameraInfo::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"height\":";
+    _json_str__ += std::to_string(height);
+    _json_str__ += ",";
+    _json_str__ += "\"width\":";
+    _json_str__ += std::to_string(width);
+    _json_str__ += ",";
+    _json_str__ += "\"D\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < D.size(); ++i) {
+        if (i > 0) _json_str__ += ",";
+        _json_str__ += std::to_string(D[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"K\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < K.size(); ++i) {
+        if (i > 0) _json_str__ += ",";
+        _json_str__ += std::to_string(K[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+CameraInfo CameraInfo::deserialize(const char *const str) noexcept {
+    CameraInfo _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    _msg__.height = read_scalar<uint32_t>(_p__);
+    _msg__.width = read_scalar<uint32_t>(_p__);
+    read_array(_p__, _msg__.D.data(), 5);
+    read_array(_p__, _msg__.K.data(), 9);
+
+    return _msg__;
+}
+
+std::size_t CameraInfo::compact_size() const noexcept {
+    return header.compact_size() + sizeof(height) + sizeof(width) + sizeof(D) + sizeof(K);
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<CameraInfoView> CameraInfoView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    CameraInfoView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool CameraInfoView::parse(ViewReader &_r__, CameraInfoView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    if (!_r__.scalar(_v__.height))
+        return false;
+    if (!_r__.scalar(_v__.width))
+        return false;
+    if (!_r__.array(5, _v__.D))
+        return false;
+    if (!_r__.array(9, _v__.K))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+CameraInfo CameraInfoView::to_msg() const {
+    CameraInfo _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.height = height;
+    _msg__.width = width;
+    D.copy_to(_msg__.D.data());
+    K.copy_to(_msg__.K.data());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
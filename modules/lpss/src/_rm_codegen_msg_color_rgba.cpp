@@ -0,0 +1,136 @@
+/**
+ * @file _rm_codegen_msg_color_rgba.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief ColorRGBA source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/std/color_rgba.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string ColorRGBA::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(sizeof(r) + sizeof(g) + sizeof(b) + sizeof(a));
+    append_scalar(_res_, r);
+    append_scalar(_res_, g);
+    append_scalar(_res_, b);
+    append_scalar(_res_, a);
+
+    return _res_;
+}
+
+std::string ColorRGBA::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"r\":";
+    _json_str__ += std::to_string(r);
+    _json_str__ += ",";
+    _json_str__ += "\"g\":";
+    _json_str__ += std::to_string(g);
+    _json_str__ += ",";
+    _json_str__ += "\"b\":";
+    _json_str__ += std::to_string(b);
+    _json_str__ += ",";
+    _json_str__ += "\"a\":";
+    _json_str__ += std::to_string(a);
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+ColorRGBA ColorRGBA::deserialize(const char *const str) noexcept {
+    ColorRGBA _msg__{};
+    const char *_p__ = str;
+    _msg__.r = read_scalar<float>(_p__);
+    _msg__.g = read_scalar<float>(_p__);
+    _msg__.b = read_scalar<float>(_p__);
+    _msg__.a = read_scalar<float>(_p__);
+
+    return _msg__;
+}
+
+std::size_t ColorRGBA::compact_size() const noexcept {
+    return sizeof(r) + sizeof(g) + sizeof(b) + sizeof(a);
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<ColorRGBAView> ColorRGBAView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    ColorRGBAView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool ColorRGBAView::parse(ViewReader &_r__, ColorRGBAView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!_r__.scalar(_v__.r))
+        return false;
+    if (!_r__.scalar(_v__.g))
+        return false;
+    if (!_r__.scalar(_v__.b))
+        return false;
+    if (!_r__.scalar(_v__.a))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+ColorRGBA ColorRGBAView::to_msg() const {
+    ColorRGBA _msg__{};
+    _msg__.r = r;
+    _msg__.g = g;
+    _msg__.b = b;
+    _msg__.a = a;
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,125 @@
+/**
+ * @file _rm_codegen_msg_header.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Header source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/std/header.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Header::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(stamp.compact_size() + sizeof(uint32_t) + frame_id.size());
+    _res_.append(stamp.serialize());
+    uint32_t frame_id_size__ = static_cast<uint32_t>(frame_id.size());
+    append_scalar(_res_, frame_id_size__);
+    _res_.append(frame_id.data(), frame_id_size__);
+
+    return _res_;
+}
+
+std::string Header::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"stamp\":";
+    _json_str__ += stamp.json();
+    _json_str__ += ",";
+    _json_str__ += "\"frame_id\":";
+    _json_str__ += "\"" + frame_id + "\"";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Header Header::deserialize(const char *const str) noexcept {
+    Header _msg__{};
+    const char *_p__ = str;
+    _msg__.stamp = rm::msg::Time::deserialize(_p__);
+    _p__ += _msg__.stamp.compact_size();
+    uint32_t frame_id_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.frame_id.assign(_p__, frame_id_size__);
+    _p__ += frame_id_size__;
+
+    return _msg__;
+}
+
+std::size_t Header::compact_size() const noexcept {
+    return stamp.compact_size() + sizeof(uint32_t) + frame_id.size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<HeaderView> HeaderView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    HeaderView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool HeaderView::parse(ViewReader &_r__, HeaderView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::TimeView::parse(_r__, _v__.stamp))
+        return false;
+    if (!_r__.string(_v__.frame_id))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Header HeaderView::to_msg() const {
+    Header _msg__{};
+    _msg__.stamp = stamp.to_msg();
+    _msg__.frame_id = std::string(frame_id);
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
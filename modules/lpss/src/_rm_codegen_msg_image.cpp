@@ -0,0 +1,158 @@
+/**
+ * @file _rm_codegen_msg_image.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Image source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/sensor/image.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Image::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(height) + sizeof(width) + sizeof(encoding) + sizeof(uint32_t) + data.size() * sizeof(uint8_t));
+    _res_.append(header.serialize());
+    append_scalar(_res_, height);
+    append_scalar(_res_, width);
+    append_scalar(_res_, encoding);
+    uint32_t data_size__ = static_cast<uint32_t>(data.size());
+    append_scalar(_res_, data_size__);
+    append_array(_res_, data.data(), data.size());
+
+    return _res_;
+}
+
+std::string Image::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"height\":";
+    _json_str__ += std::to_string(height);
+    _json_str__ += ",";
+    _json_str__ += "\"width\":";
+    _json_str__ += std::to_string(width);
+    _json_str__ += ",";
+    _json_str__ += "\"encoding\":";
+    _json_str__ += std::to_string(encoding);
+    _json_str__ += ",";
+    _json_str__ += "\"data\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += std::to_string(data[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Image Image::deserialize(const char *const str) noexcept {
+    Image _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    _msg__.height = read_scalar<int32_t>(_p__);
+    _msg__.width = read_scalar<int32_t>(_p__);
+    _msg__.encoding = read_scalar<uint8_t>(_p__);
+    uint32_t data_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.data.resize(data_size__);
+    read_array(_p__, _msg__.data.data(), data_size__);
+
+    return _msg__;
+}
+
+std::size_t Image::compact_size() const noexcept {
+    return header.compact_size() + sizeof(height) + sizeof(width) + sizeof(encoding) + sizeof(uint32_t) + data.size() * sizeof(uint8_t);
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<ImageView> ImageView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    ImageView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool ImageView::parse(ViewReader &_r__, ImageView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    if (!_r__.scalar(_v__.height))
+        return false;
+    if (!_r__.scalar(_v__.width))
+        return false;
+    if (!_r__.scalar(_v__.encoding))
+        return false;
+    uint32_t data_size__{};
+    if (!_r__.scalar(data_size__))
+        return false;
+    if (!_r__.bytes(data_size__, _v__.data))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Image ImageView::to_msg() const {
+    Image _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.height = height;
+    _msg__.width = width;
+    _msg__.encoding = encoding;
+    _msg__.data.assign(data.begin(), data.end());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,179 @@
+/**
+ * @file _rm_codegen_msg_imu.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Imu source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/sensor/imu.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Imu::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + orientation.compact_size() + sizeof(orientation_covariance) + angular_velocity.compact_size() + sizeof(angular_velocity_covariance) + linear_acceleration.compact_size() + sizeof(linear_acceleration_covariance));
+    _res_.append(header.serialize());
+    _res_.append(orientation.serialize());
+    append_array(_res_, orientation_covariance.data(), orientation_covariance.size());
+    _res_.append(angular_velocity.serialize());
+    append_array(_res_, angular_velocity_covariance.data(), angular_velocity_covariance.size());
+    _res_.append(linear_acceleration.serialize());
+    append_array(_res_, linear_acceleration_covariance.data(), linear_acceleration_covariance.size());
+
+    return _res_;
+}
+
+std::string Imu::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"orientation\":";
+    _json_str__ += orientation.json();
+    _json_str__ += ",";
+    _json_str__ += "\"orientation_covariance\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < orientation_covariance.size(); ++i) {
+        if (i > 0) _json_str__ += ",";
+        _json_str__ += std::to_string(orientation_covariance[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"angular_velocity\":";
+    _json_str__ += angular_velocity.json();
+    _json_str__ += ",";
+    _json_str__ += "\"angular_velocity_covariance\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < angular_velocity_covariance.size(); ++i) {
+        if (i > 0) _json_str__ += ",";
+        _json_str__ += std::to_string(angular_velocity_covariance[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"linear_acceleration\":";
+    _json_str__ += linear_acceleration.json();
+    _json_str__ += ",";
+    _json_str__ += "\"linear_acceleration_covariance\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < linear_acceleration_covariance.size(); ++i) {
+        if (i > 0) _json_str__ += ",";
+        _json_str__ += std::to_string(linear_acceleration_covariance[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Imu Imu::deserialize(const char *const str) noexcept {
+    Imu _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    _msg__.orientation = rm::msg::Quaternion::deserialize(_p__);
+    _p__ += _msg__.orientation.compact_size();
+    read_array(_p__, _msg__.orientation_covariance.data(), 9);
+    _msg__.angular_velocity = rm::msg::Vector3::deserialize(_p__);
+    _p__ += _msg__.angular_velocity.compact_size();
+    read_array(_p__, _msg__.angular_velocity_covariance.data(), 9);
+    _msg__.linear_acceleration = rm::msg::Vector3::deserialize(_p__);
+    _p__ += _msg__.linear_acceleration.compact_size();
+    read_array(_p__, _msg__.linear_acceleration_covariance.data(), 9);
+
+    return _msg__;
+}
+
+std::size_t Imu::compact_size() const noexcept {
+    return header.compact_size() + orientation.compact_size() + sizeof(orientation_covariance) + angular_velocity.compact_size() + sizeof(angular_velocity_covariance) + linear_acceleration.compact_size() + sizeof(linear_acceleration_covariance);
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<ImuView> ImuView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    ImuView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool ImuView::parse(ViewReader &_r__, ImuView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    if (!rm::msg::QuaternionView::parse(_r__, _v__.orientation))
+        return false;
+    if (!_r__.array(9, _v__.orientation_covariance))
+        return false;
+    if (!rm::msg::Vector3View::parse(_r__, _v__.angular_velocity))
+        return false;
+    if (!_r__.array(9, _v__.angular_velocity_covariance))
+        return false;
+    if (!rm::msg::Vector3View::parse(_r__, _v__.linear_acceleration))
+        return false;
+    if (!_r__.array(9, _v__.linear_acceleration_covariance))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Imu ImuView::to_msg() const {
+    Imu _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.orientation = orientation.to_msg();
+    orientation_covariance.copy_to(_msg__.orientation_covariance.data());
+    _msg__.angular_velocity = angular_velocity.to_msg();
+    angular_velocity_covariance.copy_to(_msg__.angular_velocity_covariance.data());
+    _msg__.linear_acceleration = linear_acceleration.to_msg();
+    linear_acceleration_covariance.copy_to(_msg__.linear_acceleration_covariance.data());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
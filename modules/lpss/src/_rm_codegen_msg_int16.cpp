@@ -0,0 +1,112 @@
+/**
+ * @file _rm_codegen_msg_int16.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Int16 source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/std/int16.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Int16::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(sizeof(data));
+    append_scalar(_res_, data);
+
+    return _res_;
+}
+
+std::string Int16::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"data\":";
+    _json_str__ += std::to_string(data);
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Int16 Int16::deserialize(const char *const str) noexcept {
+    Int16 _msg__{};
+    const char *_p__ = str;
+    _msg__.data = read_scalar<int16_t>(_p__);
+
+    return _msg__;
+}
+
+std::size_t Int16::compact_size() const noexcept {
+    return sizeof(data);
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<Int16View> Int16View::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    Int16View _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool Int16View::parse(ViewReader &_r__, Int16View &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!_r__.scalar(_v__.data))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Int16 Int16View::to_msg() const {
+    Int16 _msg__{};
+    _msg__.data = data;
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,210 @@
+/**
+ * @file _rm_codegen_msg_joint_state.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief JointState source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/sensor/joint_state.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string JointState::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(uint32_t) + std::accumulate(name.begin(), name.end(), size_t(0), [](size_t a, const auto& i) { return a + sizeof(uint32_t) + i.size(); }) + sizeof(uint32_t) + position.size() * sizeof(double) + sizeof(uint32_t) + velocity.size() * sizeof(double) + sizeof(uint32_t) + effort.size() * sizeof(double));
+    _res_.append(header.serialize());
+    uint32_t name_size__ = static_cast<uint32_t>(name.size());
+    append_scalar(_res_, name_size__);
+    for (const auto &v : name) {
+        uint32_t v_size__ = static_cast<uint32_t>(v.size());
+        append_scalar(_res_, v_size__);
+        _res_.append(v.data(), v_size__);
+    }
+    uint32_t position_size__ = static_cast<uint32_t>(position.size());
+    append_scalar(_res_, position_size__);
+    append_array(_res_, position.data(), position.size());
+    uint32_t velocity_size__ = static_cast<uint32_t>(velocity.size());
+    append_scalar(_res_, velocity_size__);
+    append_array(_res_, velocity.data(), velocity.size());
+    uint32_t effort_size__ = static_cast<uint32_t>(effort.size());
+    append_scalar(_res_, effort_size__);
+    append_array(_res_, effort.data(), effort.size());
+
+    return _res_;
+}
+
+std::string JointState::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"name\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < name.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += "\"" + name[i] + "\"";
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"position\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < position.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += std::to_string(position[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"velocity\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < velocity.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += std::to_string(velocity[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"effort\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < effort.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += std::to_string(effort[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+JointState JointState::deserialize(const char *const str) noexcept {
+    JointState _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    uint32_t name_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.name.resize(name_size__);
+    for (size_t i = 0; i < name_size__; ++i) {
+        uint32_t v_size__ = read_scalar<uint32_t>(_p__);
+        _msg__.name[i].assign(_p__, v_size__);
+        _p__ += v_size__;
+    }
+    uint32_t position_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.position.resize(position_size__);
+    read_array(_p__, _msg__.position.data(), position_size__);
+    uint32_t velocity_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.velocity.resize(velocity_size__);
+    read_array(_p__, _msg__.velocity.data(), velocity_size__);
+    uint32_t effort_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.effort.resize(effort_size__);
+    read_array(_p__, _msg__.effort.data(), effort_size__);
+
+    return _msg__;
+}
+
+std::size_t JointState::compact_size() const noexcept {
+    return header.compact_size() + sizeof(uint32_t) + std::accumulate(name.begin(), name.end(), size_t(0), [](size_t a, const auto& i) { return a + sizeof(uint32_t) + i.size(); }) + sizeof(uint32_t) + position.size() * sizeof(double) + sizeof(uint32_t) + velocity.size() * sizeof(double) + sizeof(uint32_t) + effort.size() * sizeof(double);
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<JointStateView> JointStateView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    JointStateView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool JointStateView::parse(ViewReader &_r__, JointStateView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    uint32_t name_size__{};
+    if (!_r__.scalar(name_size__))
+        return false;
+    if (!rm::msg::SeqView<std::string_view>::parse(_r__, name_size__, _v__.name))
+        return false;
+    uint32_t position_size__{};
+    if (!_r__.scalar(position_size__))
+        return false;
+    if (!_r__.array(position_size__, _v__.position))
+        return false;
+    uint32_t velocity_size__{};
+    if (!_r__.scalar(velocity_size__))
+        return false;
+    if (!_r__.array(velocity_size__, _v__.velocity))
+        return false;
+    uint32_t effort_size__{};
+    if (!_r__.scalar(effort_size__))
+        return false;
+    if (!_r__.array(effort_size__, _v__.effort))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+JointState JointStateView::to_msg() const {
+    JointState _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.name.reserve(name.size());
+    for (const auto &v : name)
+        _msg__.name.push_back(std::string(v));
+    _msg__.position.resize(position.size());
+    position.copy_to(_msg__.position.data());
+    _msg__.velocity.resize(velocity.size());
+    velocity.copy_to(_msg__.velocity.data());
+    _msg__.effort.resize(effort.size());
+    effort.copy_to(_msg__.effort.data());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
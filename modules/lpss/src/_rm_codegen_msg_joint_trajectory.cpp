@@ -0,0 +1,171 @@
+/**
+ * @file _rm_codegen_msg_joint_trajectory.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief JointTrajectory source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/motion/joint_trajectory.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string JointTrajectory::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(uint32_t) + std::accumulate(joint_names.begin(), joint_names.end(), size_t(0), [](size_t a, const auto& i) { return a + sizeof(uint32_t) + i.size(); }) + sizeof(uint32_t) + std::accumulate(points.begin(), points.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }));
+    _res_.append(header.serialize());
+    uint32_t joint_names_size__ = static_cast<uint32_t>(joint_names.size());
+    append_scalar(_res_, joint_names_size__);
+    for (const auto &v : joint_names) {
+        uint32_t v_size__ = static_cast<uint32_t>(v.size());
+        append_scalar(_res_, v_size__);
+        _res_.append(v.data(), v_size__);
+    }
+    uint32_t points_size__ = static_cast<uint32_t>(points.size());
+    append_scalar(_res_, points_size__);
+    for (const auto &v : points)
+        _res_.append(v.serialize());
+
+    return _res_;
+}
+
+std::string JointTrajectory::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"joint_names\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < joint_names.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += "\"" + joint_names[i] + "\"";
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"points\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += points[i].json();
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+JointTrajectory JointTrajectory::deserialize(const char *const str) noexcept {
+    JointTrajectory _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    uint32_t joint_names_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.joint_names.resize(joint_names_size__);
+    for (size_t i = 0; i < joint_names_size__; ++i) {
+        uint32_t v_size__ = read_scalar<uint32_t>(_p__);
+        _msg__.joint_names[i].assign(_p__, v_size__);
+        _p__ += v_size__;
+    }
+    uint32_t points_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.points.resize(points_size__);
+    for (auto& v : _msg__.points) {
+        v = rm::msg::JointTrajectoryPoint::deserialize(_p__);
+        _p__ += v.compact_size();
+    }
+
+    return _msg__;
+}
+
+std::size_t JointTrajectory::compact_size() const noexcept {
+    return header.compact_size() + sizeof(uint32_t) + std::accumulate(joint_names.begin(), joint_names.end(), size_t(0), [](size_t a, const auto& i) { return a + sizeof(uint32_t) + i.size(); }) + sizeof(uint32_t) + std::accumulate(points.begin(), points.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); });
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<JointTrajectoryView> JointTrajectoryView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    JointTrajectoryView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool JointTrajectoryView::parse(ViewReader &_r__, JointTrajectoryView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    uint32_t joint_names_size__{};
+    if (!_r__.scalar(joint_names_size__))
+        return false;
+    if (!rm::msg::SeqView<std::string_view>::parse(_r__, joint_names_size__, _v__.joint_names))
+        return false;
+    uint32_t points_size__{};
+    if (!_r__.scalar(points_size__))
+        return false;
+    if (!rm::msg::SeqView<rm::msg::JointTrajectoryPointView>::parse(_r__, points_size__, _v__.points))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+JointTrajectory JointTrajectoryView::to_msg() const {
+    JointTrajectory _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.joint_names.reserve(joint_names.size());
+    for (const auto &v : joint_names)
+        _msg__.joint_names.push_back(std::string(v));
+    _msg__.points.reserve(points.size());
+    for (const auto &v : points)
+        _msg__.points.push_back(v.to_msg());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,201 @@
+/**
+ * @file _rm_codegen_msg_joint_trajectory_point.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief JointTrajectoryPoint source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/motion/joint_trajectory_point.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string JointTrajectoryPoint::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(sizeof(uint32_t) + positions.size() * sizeof(double) + sizeof(uint32_t) + velocities.size() * sizeof(double) + sizeof(uint32_t) + accelerations.size() * sizeof(double) + sizeof(uint32_t) + effort.size() * sizeof(double) + time_from_start.compact_size());
+    uint32_t positions_size__ = static_cast<uint32_t>(positions.size());
+    append_scalar(_res_, positions_size__);
+    append_array(_res_, positions.data(), positions.size());
+    uint32_t velocities_size__ = static_cast<uint32_t>(velocities.size());
+    append_scalar(_res_, velocities_size__);
+    append_array(_res_, velocities.data(), velocities.size());
+    uint32_t accelerations_size__ = static_cast<uint32_t>(accelerations.size());
+    append_scalar(_res_, accelerations_size__);
+    append_array(_res_, accelerations.data(), accelerations.size());
+    uint32_t effort_size__ = static_cast<uint32_t>(effort.size());
+    append_scalar(_res_, effort_size__);
+    append_array(_res_, effort.data(), effort.size());
+    _res_.append(time_from_start.serialize());
+
+    return _res_;
+}
+
+std::string JointTrajectoryPoint::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"positions\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < positions.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += std::to_string(positions[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"velocities\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < velocities.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += std::to_string(velocities[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"accelerations\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < accelerations.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += std::to_string(accelerations[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"effort\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < effort.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += std::to_string(effort[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"time_from_start\":";
+    _json_str__ += time_from_start.json();
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+JointTrajectoryPoint JointTrajectoryPoint::deserialize(const char *const str) noexcept {
+    JointTrajectoryPoint _msg__{};
+    const char *_p__ = str;
+    uint32_t positions_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.positions.resize(positions_size__);
+    read_array(_p__, _msg__.positions.data(), positions_size__);
+    uint32_t velocities_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.velocities.resize(velocities_size__);
+    read_array(_p__, _msg__.velocities.data(), velocities_size__);
+    uint32_t accelerations_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.accelerations.resize(accelerations_size__);
+    read_array(_p__, _msg__.accelerations.data(), accelerations_size__);
+    uint32_t effort_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.effort.resize(effort_size__);
+    read_array(_p__, _msg__.effort.data(), effort_size__);
+    _msg__.time_from_start = rm::msg::Duration::deserialize(_p__);
+    _p__ += _msg__.time_from_start.compact_size();
+
+    return _msg__;
+}
+
+std::size_t JointTrajectoryPoint::compact_size() const noexcept {
+    return sizeof(uint32_t) + positions.size() * sizeof(double) + sizeof(uint32_t) + velocities.size() * sizeof(double) + sizeof(uint32_t) + accelerations.size() * sizeof(double) + sizeof(uint32_t) + effort.size() * sizeof(double) + time_from_start.compact_size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<JointTrajectoryPointView> JointTrajectoryPointView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    JointTrajectoryPointView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool JointTrajectoryPointView::parse(ViewReader &_r__, JointTrajectoryPointView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    uint32_t positions_size__{};
+    if (!_r__.scalar(positions_size__))
+        return false;
+    if (!_r__.array(positions_size__, _v__.positions))
+        return false;
+    uint32_t velocities_size__{};
+    if (!_r__.scalar(velocities_size__))
+        return false;
+    if (!_r__.array(velocities_size__, _v__.velocities))
+        return false;
+    uint32_t accelerations_size__{};
+    if (!_r__.scalar(accelerations_size__))
+        return false;
+    if (!_r__.array(accelerations_size__, _v__.accelerations))
+        return false;
+    uint32_t effort_size__{};
+    if (!_r__.scalar(effort_size__))
+        return false;
+    if (!_r__.array(effort_size__, _v__.effort))
+        return false;
+    if (!rm::msg::DurationView::parse(_r__, _v__.time_from_start))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+JointTrajectoryPoint JointTrajectoryPointView::to_msg() const {
+    JointTrajectoryPoint _msg__{};
+    _msg__.positions.resize(positions.size());
+    positions.copy_to(_msg__.positions.data());
+    _msg__.velocities.resize(velocities.size());
+    velocities.copy_to(_msg__.velocities.data());
+    _msg__.accelerations.resize(accelerations.size());
+    accelerations.copy_to(_msg__.accelerations.data());
+    _msg__.effort.resize(effort.size());
+    effort.copy_to(_msg__.effort.data());
+    _msg__.time_from_start = time_from_start.to_msg();
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,230 @@
+/**
+ * @file _rm_codegen_msg_marker.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Marker source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/viz/marker.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Marker::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(uint32_t) + ns.size() + sizeof(id) + sizeof(type) + sizeof(action) + pose.compact_size() + scale.compact_size() + color.compact_size() + sizeof(uint32_t) + std::accumulate(points.begin(), points.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }) + sizeof(uint32_t) + std::accumulate(colors.begin(), colors.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }));
+    _res_.append(header.serialize());
+    uint32_t ns_size__ = static_cast<uint32_t>(ns.size());
+    append_scalar(_res_, ns_size__);
+    _res_.append(ns.data(), ns_size__);
+    append_scalar(_res_, id);
+    append_scalar(_res_, type);
+    append_scalar(_res_, action);
+    _res_.append(pose.serialize());
+    _res_.append(scale.serialize());
+    _res_.append(color.serialize());
+    uint32_t points_size__ = static_cast<uint32_t>(points.size());
+    append_scalar(_res_, points_size__);
+    for (const auto &v : points)
+        _res_.append(v.serialize());
+    uint32_t colors_size__ = static_cast<uint32_t>(colors.size());
+    append_scalar(_res_, colors_size__);
+    for (const auto &v : colors)
+        _res_.append(v.serialize());
+
+    return _res_;
+}
+
+std::string Marker::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"ns\":";
+    _json_str__ += "\"" + ns + "\"";
+    _json_str__ += ",";
+    _json_str__ += "\"id\":";
+    _json_str__ += std::to_string(id);
+    _json_str__ += ",";
+    _json_str__ += "\"type\":";
+    _json_str__ += std::to_string(type);
+    _json_str__ += ",";
+    _json_str__ += "\"action\":";
+    _json_str__ += std::to_string(action);
+    _json_str__ += ",";
+    _json_str__ += "\"pose\":";
+    _json_str__ += pose.json();
+    _json_str__ += ",";
+    _json_str__ += "\"scale\":";
+    _json_str__ += scale.json();
+    _json_str__ += ",";
+    _json_str__ += "\"color\":";
+    _json_str__ += color.json();
+    _json_str__ += ",";
+    _json_str__ += "\"points\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += points[i].json();
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"colors\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < colors.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += colors[i].json();
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Marker Marker::deserialize(const char *const str) noexcept {
+    Marker _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    uint32_t ns_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.ns.assign(_p__, ns_size__);
+    _p__ += ns_size__;
+    _msg__.id = read_scalar<int32_t>(_p__);
+    _msg__.type = read_scalar<uint8_t>(_p__);
+    _msg__.action = read_scalar<uint8_t>(_p__);
+    _msg__.pose = rm::msg::Pose::deserialize(_p__);
+    _p__ += _msg__.pose.compact_size();
+    _msg__.scale = rm::msg::Vector3::deserialize(_p__);
+    _p__ += _msg__.scale.compact_size();
+    _msg__.color = rm::msg::ColorRGBA::deserialize(_p__);
+    _p__ += _msg__.color.compact_size();
+    uint32_t points_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.points.resize(points_size__);
+    for (auto& v : _msg__.points) {
+        v = rm::msg::Point::deserialize(_p__);
+        _p__ += v.compact_size();
+    }
+    uint32_t colors_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.colors.resize(colors_size__);
+    for (auto& v : _msg__.colors) {
+        v = rm::msg::ColorRGBA::deserialize(_p__);
+        _p__ += v.compact_size();
+    }
+
+    return _msg__;
+}
+
+std::size_t Marker::compact_size() const noexcept {
+    return header.compact_size() + sizeof(uint32_t) + ns.size() + sizeof(id) + sizeof(type) + sizeof(action) + pose.compact_size() + scale.compact_size() + color.compact_size() + sizeof(uint32_t) + std::accumulate(points.begin(), points.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }) + sizeof(uint32_t) + std::accumulate(colors.begin(), colors.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); });
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<MarkerView> MarkerView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    MarkerView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool MarkerView::parse(ViewReader &_r__, MarkerView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    if (!_r__.string(_v__.ns))
+        return false;
+    if (!_r__.scalar(_v__.id))
+        return false;
+    if (!_r__.scalar(_v__.type))
+        return false;
+    if (!_r__.scalar(_v__.action))
+        return false;
+    if (!rm::msg::PoseView::parse(_r__, _v__.pose))
+        return false;
+    if (!rm::msg::Vector3View::parse(_r__, _v__.scale))
+        return false;
+    if (!rm::msg::ColorRGBAView::parse(_r__, _v__.color))
+        return false;
+    uint32_t points_size__{};
+    if (!_r__.scalar(points_size__))
+        return false;
+    if (!rm::msg::SeqView<rm::msg::PointView>::parse(_r__, points_size__, _v__.points))
+        return false;
+    uint32_t colors_size__{};
+    if (!_r__.scalar(colors_size__))
+        return false;
+    if (!rm::msg::SeqView<rm::msg::ColorRGBAView>::parse(_r__, colors_size__, _v__.colors))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Marker MarkerView::to_msg() const {
+    Marker _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.ns = std::string(ns);
+    _msg__.id = id;
+    _msg__.type = type;
+    _msg__.action = action;
+    _msg__.pose = pose.to_msg();
+    _msg__.scale = scale.to_msg();
+    _msg__.color = color.to_msg();
+    _msg__.points.reserve(points.size());
+    for (const auto &v : points)
+        _msg__.points.push_back(v.to_msg());
+    _msg__.colors.reserve(colors.size());
+    for (const auto &v : colors)
+        _msg__.colors.push_back(v.to_msg());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,131 @@
+/**
+ * @file _rm_codegen_msg_marker_array.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief MarkerArray source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/viz/marker_array.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string MarkerArray::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(sizeof(uint32_t) + std::accumulate(markers.begin(), markers.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }));
+    uint32_t markers_size__ = static_cast<uint32_t>(markers.size());
+    append_scalar(_res_, markers_size__);
+    for (const auto &v : markers)
+        _res_.append(v.serialize());
+
+    return _res_;
+}
+
+std::string MarkerArray::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"markers\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < markers.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += markers[i].json();
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+MarkerArray MarkerArray::deserialize(const char *const str) noexcept {
+    MarkerArray _msg__{};
+    const char *_p__ = str;
+    uint32_t markers_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.markers.resize(markers_size__);
+    for (auto& v : _msg__.markers) {
+        v = rm::msg::Marker::deserialize(_p__);
+        _p__ += v.compact_size();
+    }
+
+    return _msg__;
+}
+
+std::size_t MarkerArray::compact_size() const noexcept {
+    return sizeof(uint32_t) + std::accumulate(markers.begin(), markers.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); });
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<MarkerArrayView> MarkerArrayView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    MarkerArrayView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool MarkerArrayView::parse(ViewReader &_r__, MarkerArrayView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    uint32_t markers_size__{};
+    if (!_r__.scalar(markers_size__))
+        return false;
+    if (!rm::msg::SeqView<rm::msg::MarkerView>::parse(_r__, markers_size__, _v__.markers))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+MarkerArray MarkerArrayView::to_msg() const {
+    MarkerArray _msg__{};
+    _msg__.markers.reserve(markers.size());
+    for (const auto &v : markers)
+        _msg__.markers.push_back(v.to_msg());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,225 @@
+/**
+ * @file _rm_codegen_msg_multi_dofjoint_state.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief MultiDOFJointState source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/sensor/multi_dofjoint_state.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string MultiDOFJointState::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(uint32_t) + std::accumulate(joint_names.begin(), joint_names.end(), size_t(0), [](size_t a, const auto& i) { return a + sizeof(uint32_t) + i.size(); }) + sizeof(uint32_t) + std::accumulate(transforms.begin(), transforms.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }) + sizeof(uint32_t) + std::accumulate(twist.begin(), twist.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }) + sizeof(uint32_t) + std::accumulate(wrench.begin(), wrench.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }));
+    _res_.append(header.serialize());
+    uint32_t joint_names_size__ = static_cast<uint32_t>(joint_names.size());
+    append_scalar(_res_, joint_names_size__);
+    for (const auto &v : joint_names) {
+        uint32_t v_size__ = static_cast<uint32_t>(v.size());
+        append_scalar(_res_, v_size__);
+        _res_.append(v.data(), v_size__);
+    }
+    uint32_t transforms_size__ = static_cast<uint32_t>(transforms.size());
+    append_scalar(_res_, transforms_size__);
+    for (const auto &v : transforms)
+        _res_.append(v.serialize());
+    uint32_t twist_size__ = static_cast<uint32_t>(twist.size());
+    append_scalar(_res_, twist_size__);
+    for (const auto &v : twist)
+        _res_.append(v.serialize());
+    uint32_t wrench_size__ = static_cast<uint32_t>(wrench.size());
+    append_scalar(_res_, wrench_size__);
+    for (const auto &v : wrench)
+        _res_.append(v.serialize());
+
+    return _res_;
+}
+
+std::string MultiDOFJointState::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"joint_names\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < joint_names.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += "\"" + joint_names[i] + "\"";
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"transforms\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < transforms.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += transforms[i].json();
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"twist\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < twist.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += twist[i].json();
+    }
+    _json_str__ += "]";
+    _json_str__ += ",";
+    _json_str__ += "\"wrench\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < wrench.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += wrench[i].json();
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+MultiDOFJointState MultiDOFJointState::deserialize(const char *const str) noexcept {
+    MultiDOFJointState _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    uint32_t joint_names_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.joint_names.resize(joint_names_size__);
+    for (size_t i = 0; i < joint_names_size__; ++i) {
+        uint32_t v_size__ = read_scalar<uint32_t>(_p__);
+        _msg__.joint_names[i].assign(_p__, v_size__);
+        _p__ += v_size__;
+    }
+    uint32_t transforms_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.transforms.resize(transforms_size__);
+    for (auto& v : _msg__.transforms) {
+        v = rm::msg::Transform::deserialize(_p__);
+        _p__ += v.compact_size();
+    }
+    uint32_t twist_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.twist.resize(twist_size__);
+    for (auto& v : _msg__.twist) {
+        v = rm::msg::Twist::deserialize(_p__);
+        _p__ += v.compact_size();
+    }
+    uint32_t wrench_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.wrench.resize(wrench_size__);
+    for (auto& v : _msg__.wrench) {
+        v = rm::msg::Wrench::deserialize(_p__);
+        _p__ += v.compact_size();
+    }
+
+    return _msg__;
+}
+
+std::size_t MultiDOFJointState::compact_size() const noexcept {
+    return header.compact_size() + sizeof(uint32_t) + std::accumulate(joint_names.begin(), joint_names.end(), size_t(0), [](size_t a, const auto& i) { return a + sizeof(uint32_t) + i.size(); }) + sizeof(uint32_t) + std::accumulate(transforms.begin(), transforms.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }) + sizeof(uint32_t) + std::accumulate(twist.begin(), twist.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }) + sizeof(uint32_t) + std::accumulate(wrench.begin(), wrench.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); });
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<MultiDOFJointStateView> MultiDOFJointStateView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    MultiDOFJointStateView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool MultiDOFJointStateView::parse(ViewReader &_r__, MultiDOFJointStateView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    uint32_t joint_names_size__{};
+    if (!_r__.scalar(joint_names_size__))
+        return false;
+    if (!rm::msg::SeqView<std::string_view>::parse(_r__, joint_names_size__, _v__.joint_names))
+        return false;
+    uint32_t transforms_size__{};
+    if (!_r__.scalar(transforms_size__))
+        return false;
+    if (!rm::msg::SeqView<rm::msg::TransformView>::parse(_r__, transforms_size__, _v__.transforms))
+        return false;
+    uint32_t twist_size__{};
+    if (!_r__.scalar(twist_size__))
+        return false;
+    if (!rm::msg::SeqView<rm::msg::TwistView>::parse(_r__, twist_size__, _v__.twist))
+        return false;
+    uint32_t wrench_size__{};
+    if (!_r__.scalar(wrench_size__))
+        return false;
+    if (!rm::msg::SeqView<rm::msg::WrenchView>::parse(_r__, wrench_size__, _v__.wrench))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+MultiDOFJointState MultiDOFJointStateView::to_msg() const {
+    MultiDOFJointState _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.joint_names.reserve(joint_names.size());
+    for (const auto &v : joint_names)
+        _msg__.joint_names.push_back(std::string(v));
+    _msg__.transforms.reserve(transforms.size());
+    for (const auto &v : transforms)
+        _msg__.transforms.push_back(v.to_msg());
+    _msg__.twist.reserve(twist.size());
+    for (const auto &v : twist)
+        _msg__.twist.push_back(v.to_msg());
+    _msg__.wrench.reserve(wrench.size());
+    for (const auto &v : wrench)
+        _msg__.wrench.push_back(v.to_msg());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,128 @@
+/**
+ * @file _rm_codegen_msg_point32.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Point32 source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/geometry/point32.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Point32::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(sizeof(x) + sizeof(y) + sizeof(z));
+    append_scalar(_res_, x);
+    append_scalar(_res_, y);
+    append_scalar(_res_, z);
+
+    return _res_;
+}
+
+std::string Point32::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"x\":";
+    _json_str__ += std::to_string(x);
+    _json_str__ += ",";
+    _json_str__ += "\"y\":";
+    _json_str__ += std::to_string(y);
+    _json_str__ += ",";
+    _json_str__ += "\"z\":";
+    _json_str__ += std::to_string(z);
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Point32 Point32::deserialize(const char *const str) noexcept {
+    Point32 _msg__{};
+    const char *_p__ = str;
+    _msg__.x = read_scalar<float>(_p__);
+    _msg__.y = read_scalar<float>(_p__);
+    _msg__.z = read_scalar<float>(_p__);
+
+    return _msg__;
+}
+
+std::size_t Point32::compact_size() const noexcept {
+    return sizeof(x) + sizeof(y) + sizeof(z);
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<Point32View> Point32View::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    Point32View _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool Point32View::parse(ViewReader &_r__, Point32View &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!_r__.scalar(_v__.x))
+        return false;
+    if (!_r__.scalar(_v__.y))
+        return false;
+    if (!_r__.scalar(_v__.z))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Point32 Point32View::to_msg() const {
+    Point32 _msg__{};
+    _msg__.x = x;
+    _msg__.y = y;
+    _msg__.z = z;
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,122 @@
+/**
+ * @file _rm_codegen_msg_pose.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Pose source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/geometry/pose.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Pose::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(position.compact_size() + orientation.compact_size());
+    _res_.append(position.serialize());
+    _res_.append(orientation.serialize());
+
+    return _res_;
+}
+
+std::string Pose::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"position\":";
+    _json_str__ += position.json();
+    _json_str__ += ",";
+    _json_str__ += "\"orientation\":";
+    _json_str__ += orientation.json();
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Pose Pose::deserialize(const char *const str) noexcept {
+    Pose _msg__{};
+    const char *_p__ = str;
+    _msg__.position = rm::msg::Point::deserialize(_p__);
+    _p__ += _msg__.position.compact_size();
+    _msg__.orientation = rm::msg::Quaternion::deserialize(_p__);
+    _p__ += _msg__.orientation.compact_size();
+
+    return _msg__;
+}
+
+std::size_t Pose::compact_size() const noexcept {
+    return position.compact_size() + orientation.compact_size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<PoseView> PoseView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    PoseView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool PoseView::parse(ViewReader &_r__, PoseView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::PointView::parse(_r__, _v__.position))
+        return false;
+    if (!rm::msg::QuaternionView::parse(_r__, _v__.orientation))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Pose PoseView::to_msg() const {
+    Pose _msg__{};
+    _msg__.position = position.to_msg();
+    _msg__.orientation = orientation.to_msg();
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
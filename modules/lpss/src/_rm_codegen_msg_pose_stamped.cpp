@@ -0,0 +1,122 @@
+/**
+ * @file _rm_codegen_msg_pose_stamped.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief PoseStamped source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/geometry/pose_stamped.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string PoseStamped::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + pose.compact_size());
+    _res_.append(header.serialize());
+    _res_.append(pose.serialize());
+
+    return _res_;
+}
+
+std::string PoseStamped::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"pose\":";
+    _json_str__ += pose.json();
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+PoseStamped PoseStamped::deserialize(const char *const str) noexcept {
+    PoseStamped _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    _msg__.pose = rm::msg::Pose::deserialize(_p__);
+    _p__ += _msg__.pose.compact_size();
+
+    return _msg__;
+}
+
+std::size_t PoseStamped::compact_size() const noexcept {
+    return header.compact_size() + pose.compact_size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<PoseStampedView> PoseStampedView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    PoseStampedView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool PoseStampedView::parse(ViewReader &_r__, PoseStampedView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    if (!rm::msg::PoseView::parse(_r__, _v__.pose))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+PoseStamped PoseStampedView::to_msg() const {
+    PoseStamped _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.pose = pose.to_msg();
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
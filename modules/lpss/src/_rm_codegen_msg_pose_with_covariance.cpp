@@ -0,0 +1,126 @@
+/**
+ * @file _rm_codegen_msg_pose_with_covariance.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief PoseWithCovariance source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/geometry/pose_with_covariance.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string PoseWithCovariance::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(pose.compact_size() + sizeof(covariance));
+    _res_.append(pose.serialize());
+    append_array(_res_, covariance.data(), covariance.size());
+
+    return _res_;
+}
+
+std::string PoseWithCovariance::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"pose\":";
+    _json_str__ += pose.json();
+    _json_str__ += ",";
+    _json_str__ += "\"covariance\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < covariance.size(); ++i) {
+        if (i > 0) _json_str__ += ",";
+        _json_str__ += std::to_string(covariance[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+PoseWithCovariance PoseWithCovariance::deserialize(const char *const str) noexcept {
+    PoseWithCovariance _msg__{};
+    const char *_p__ = str;
+    _msg__.pose = rm::msg::Pose::deserialize(_p__);
+    _p__ += _msg__.pose.compact_size();
+    read_array(_p__, _msg__.covariance.data(), 36);
+
+    return _msg__;
+}
+
+std::size_t PoseWithCovariance::compact_size() const noexcept {
+    return pose.compact_size() + sizeof(covariance);
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<PoseWithCovarianceView> PoseWithCovarianceView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    PoseWithCovarianceView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool PoseWithCovarianceView::parse(ViewReader &_r__, PoseWithCovarianceView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::PoseView::parse(_r__, _v__.pose))
+        return false;
+    if (!_r__.array(36, _v__.covariance))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+PoseWithCovariance PoseWithCovarianceView::to_msg() const {
+    PoseWithCovariance _msg__{};
+    _msg__.pose = pose.to_msg();
+    covariance.copy_to(_msg__.covariance.data());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,122 @@
+/**
+ * @file _rm_codegen_msg_transform.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Transform source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/geometry/transform.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Transform::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(translation.compact_size() + rotation.compact_size());
+    _res_.append(translation.serialize());
+    _res_.append(rotation.serialize());
+
+    return _res_;
+}
+
+std::string Transform::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"translation\":";
+    _json_str__ += translation.json();
+    _json_str__ += ",";
+    _json_str__ += "\"rotation\":";
+    _json_str__ += rotation.json();
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Transform Transform::deserialize(const char *const str) noexcept {
+    Transform _msg__{};
+    const char *_p__ = str;
+    _msg__.translation = rm::msg::Vector3::deserialize(_p__);
+    _p__ += _msg__.translation.compact_size();
+    _msg__.rotation = rm::msg::Quaternion::deserialize(_p__);
+    _p__ += _msg__.rotation.compact_size();
+
+    return _msg__;
+}
+
+std::size_t Transform::compact_size() const noexcept {
+    return translation.compact_size() + rotation.compact_size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<TransformView> TransformView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    TransformView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool TransformView::parse(ViewReader &_r__, TransformView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::Vector3View::parse(_r__, _v__.translation))
+        return false;
+    if (!rm::msg::QuaternionView::parse(_r__, _v__.rotation))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Transform TransformView::to_msg() const {
+    Transform _msg__{};
+    _msg__.translation = translation.to_msg();
+    _msg__.rotation = rotation.to_msg();
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
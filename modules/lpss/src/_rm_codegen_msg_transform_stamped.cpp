@@ -0,0 +1,134 @@
+/**
+ * @file _rm_codegen_msg_transform_stamped.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief TransformStamped source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/geometry/transform_stamped.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string TransformStamped::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(uint32_t) + child_frame_id.size() + transform.compact_size());
+    _res_.append(header.serialize());
+    uint32_t child_frame_id_size__ = static_cast<uint32_t>(child_frame_id.size());
+    append_scalar(_res_, child_frame_id_size__);
+    _res_.append(child_frame_id.data(), child_frame_id_size__);
+    _res_.append(transform.serialize());
+
+    return _res_;
+}
+
+std::string TransformStamped::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"child_frame_id\":";
+    _json_str__ += "\"" + child_frame_id + "\"";
+    _json_str__ += ",";
+    _json_str__ += "\"transform\":";
+    _json_str__ += transform.json();
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+TransformStamped TransformStamped::deserialize(const char *const str) noexcept {
+    TransformStamped _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    uint32_t child_frame_id_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.child_frame_id.assign(_p__, child_frame_id_size__);
+    _p__ += child_frame_id_size__;
+    _msg__.transform = rm::msg::Transform::deserialize(_p__);
+    _p__ += _msg__.transform.compact_size();
+
+    return _msg__;
+}
+
+std::size_t TransformStamped::compact_size() const noexcept {
+    return header.compact_size() + sizeof(uint32_t) + child_frame_id.size() + transform.compact_size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<TransformStampedView> TransformStampedView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    TransformStampedView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool TransformStampedView::parse(ViewReader &_r__, TransformStampedView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    if (!_r__.string(_v__.child_frame_id))
+        return false;
+    if (!rm::msg::TransformView::parse(_r__, _v__.transform))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+TransformStamped TransformStampedView::to_msg() const {
+    TransformStamped _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.child_frame_id = std::string(child_frame_id);
+    _msg__.transform = transform.to_msg();
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,122 @@
+/**
+ * @file _rm_codegen_msg_twist.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Twist source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/geometry/twist.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Twist::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(linear.compact_size() + angular.compact_size());
+    _res_.append(linear.serialize());
+    _res_.append(angular.serialize());
+
+    return _res_;
+}
+
+std::string Twist::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"linear\":";
+    _json_str__ += linear.json();
+    _json_str__ += ",";
+    _json_str__ += "\"angular\":";
+    _json_str__ += angular.json();
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Twist Twist::deserialize(const char *const str) noexcept {
+    Twist _msg__{};
+    const char *_p__ = str;
+    _msg__.linear = rm::msg::Vector3::deserialize(_p__);
+    _p__ += _msg__.linear.compact_size();
+    _msg__.angular = rm::msg::Vector3::deserialize(_p__);
+    _p__ += _msg__.angular.compact_size();
+
+    return _msg__;
+}
+
+std::size_t Twist::compact_size() const noexcept {
+    return linear.compact_size() + angular.compact_size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<TwistView> TwistView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    TwistView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool TwistView::parse(ViewReader &_r__, TwistView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::Vector3View::parse(_r__, _v__.linear))
+        return false;
+    if (!rm::msg::Vector3View::parse(_r__, _v__.angular))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Twist TwistView::to_msg() const {
+    Twist _msg__{};
+    _msg__.linear = linear.to_msg();
+    _msg__.angular = angular.to_msg();
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
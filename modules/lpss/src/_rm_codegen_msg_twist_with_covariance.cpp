@@ -0,0 +1,126 @@
+/**
+ * @file _rm_codegen_msg_twist_with_covariance.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief TwistWithCovariance source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/geometry/twist_with_covariance.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string TwistWithCovariance::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(twist.compact_size() + sizeof(covariance));
+    _res_.append(twist.serialize());
+    append_array(_res_, covariance.data(), covariance.size());
+
+    return _res_;
+}
+
+std::string TwistWithCovariance::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"twist\":";
+    _json_str__ += twist.json();
+    _json_str__ += ",";
+    _json_str__ += "\"covariance\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < covariance.size(); ++i) {
+        if (i > 0) _json_str__ += ",";
+        _json_str__ += std::to_string(covariance[i]);
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+TwistWithCovariance TwistWithCovariance::deserialize(const char *const str) noexcept {
+    TwistWithCovariance _msg__{};
+    const char *_p__ = str;
+    _msg__.twist = rm::msg::Twist::deserialize(_p__);
+    _p__ += _msg__.twist.compact_size();
+    read_array(_p__, _msg__.covariance.data(), 36);
+
+    return _msg__;
+}
+
+std::size_t TwistWithCovariance::compact_size() const noexcept {
+    return twist.compact_size() + sizeof(covariance);
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<TwistWithCovarianceView> TwistWithCovarianceView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    TwistWithCovarianceView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool TwistWithCovarianceView::parse(ViewReader &_r__, TwistWithCovarianceView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::TwistView::parse(_r__, _v__.twist))
+        return false;
+    if (!_r__.array(36, _v__.covariance))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+TwistWithCovariance TwistWithCovarianceView::to_msg() const {
+    TwistWithCovariance _msg__{};
+    _msg__.twist = twist.to_msg();
+    covariance.copy_to(_msg__.covariance.data());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,128 @@
+/**
+ * @file _rm_codegen_msg_urdf.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief URDF source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/motion/urdf.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string URDF::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(sizeof(uint32_t) + data.size() + sizeof(uint32_t) + mesh_path.size());
+    uint32_t data_size__ = static_cast<uint32_t>(data.size());
+    append_scalar(_res_, data_size__);
+    _res_.append(data.data(), data_size__);
+    uint32_t mesh_path_size__ = static_cast<uint32_t>(mesh_path.size());
+    append_scalar(_res_, mesh_path_size__);
+    _res_.append(mesh_path.data(), mesh_path_size__);
+
+    return _res_;
+}
+
+std::string URDF::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"data\":";
+    _json_str__ += "\"" + data + "\"";
+    _json_str__ += ",";
+    _json_str__ += "\"mesh_path\":";
+    _json_str__ += "\"" + mesh_path + "\"";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+URDF URDF::deserialize(const char *const str) noexcept {
+    URDF _msg__{};
+    const char *_p__ = str;
+    uint32_t data_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.data.assign(_p__, data_size__);
+    _p__ += data_size__;
+    uint32_t mesh_path_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.mesh_path.assign(_p__, mesh_path_size__);
+    _p__ += mesh_path_size__;
+
+    return _msg__;
+}
+
+std::size_t URDF::compact_size() const noexcept {
+    return sizeof(uint32_t) + data.size() + sizeof(uint32_t) + mesh_path.size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<URDFView> URDFView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    URDFView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool URDFView::parse(ViewReader &_r__, URDFView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!_r__.string(_v__.data))
+        return false;
+    if (!_r__.string(_v__.mesh_path))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+URDF URDFView::to_msg() const {
+    URDF _msg__{};
+    _msg__.data = std::string(data);
+    _msg__.mesh_path = std::string(mesh_path);
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,122 @@
+/**
+ * @file _rm_codegen_msg_wrench.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Wrench source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/geometry/wrench.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Wrench::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(force.compact_size() + torque.compact_size());
+    _res_.append(force.serialize());
+    _res_.append(torque.serialize());
+
+    return _res_;
+}
+
+std::string Wrench::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"force\":";
+    _json_str__ += force.json();
+    _json_str__ += ",";
+    _json_str__ += "\"torque\":";
+    _json_str__ += torque.json();
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Wrench Wrench::deserialize(const char *const str) noexcept {
+    Wrench _msg__{};
+    const char *_p__ = str;
+    _msg__.force = rm::msg::Vector3::deserialize(_p__);
+    _p__ += _msg__.force.compact_size();
+    _msg__.torque = rm::msg::Vector3::deserialize(_p__);
+    _p__ += _msg__.torque.compact_size();
+
+    return _msg__;
+}
+
+std::size_t Wrench::compact_size() const noexcept {
+    return force.compact_size() + torque.compact_size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<WrenchView> WrenchView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    WrenchView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool WrenchView::parse(ViewReader &_r__, WrenchView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::Vector3View::parse(_r__, _v__.force))
+        return false;
+    if (!rm::msg::Vector3View::parse(_r__, _v__.torque))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Wrench WrenchView::to_msg() const {
+    Wrench _msg__{};
+    _msg__.force = force.to_msg();
+    _msg__.torque = torque.to_msg();
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
@@ -0,0 +1,89 @@
+/**
+ * @file _rm_codegen_param.cpp
+ * @author RMVL Community
+ * @brief LpssParam module source file (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "rmvlpara/lpss.hpp"
+#include "rmvl/core/yaml.hpp"
+
+namespace rm::para {
+
+static std::shared_mutex g_paramtx__{};
+
+
+
+bool LpssParam::read(const std::string &_path__) {
+    std::unique_lock _lk__(g_paramtx__);
+    auto _result__ = yaml::load(_path__);
+    if (!_result__)
+        return false;
+    const auto &_root__ = *_result__;
+    yaml::Node _node__;
+    bool _ok__ = true;
+
+    _node__ = _root__["MAX_NODE_HEARTBEAT_PERIOD"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MAX_NODE_HEARTBEAT_PERIOD) && _ok__;
+    _node__ = _root__["MTP_FRAGMENT_TIMEOUT"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MTP_FRAGMENT_TIMEOUT) && _ok__;
+    _node__ = _root__["MTP_REASSEMBLY_MAX_BYTES"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MTP_REASSEMBLY_MAX_BYTES) && _ok__;
+    _node__ = _root__["MTP_RELIABLE_HISTORY_DEPTH"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MTP_RELIABLE_HISTORY_DEPTH) && _ok__;
+    _node__ = _root__["MTP_RELIABLE_HEARTBEAT_PERIOD"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MTP_RELIABLE_HEARTBEAT_PERIOD) && _ok__;
+    _node__ = _root__["MTP_RELIABLE_HEARTBEAT_REPEATS"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MTP_RELIABLE_HEARTBEAT_REPEATS) && _ok__;
+    _node__ = _root__["MTP_RELIABLE_MAX_RETRANSMIT"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MTP_RELIABLE_MAX_RETRANSMIT) && _ok__;
+    _node__ = _root__["MTP_MULTICAST_PORT_BASE"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MTP_MULTICAST_PORT_BASE) && _ok__;
+    _node__ = _root__["MTP_MULTICAST_MIN_READERS"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MTP_MULTICAST_MIN_READERS) && _ok__;
+    _node__ = _root__["MTP_MULTICAST_LOOPBACK"];
+    if (_node__.valid())
+        _ok__ = _node__.read(MTP_MULTICAST_LOOPBACK) && _ok__;
+
+    return _ok__;
+}
+
+bool LpssParam::write(const std::string &_path__) const {
+    std::shared_lock _lk__(g_paramtx__);
+    auto _root__ = yaml::Node::createMap();
+    bool _ok__ = true;
+
+    _ok__ = _root__.set("MAX_NODE_HEARTBEAT_PERIOD", MAX_NODE_HEARTBEAT_PERIOD) && _ok__;
+    _ok__ = _root__.set("MTP_FRAGMENT_TIMEOUT", MTP_FRAGMENT_TIMEOUT) && _ok__;
+    _ok__ = _root__.set("MTP_REASSEMBLY_MAX_BYTES", MTP_REASSEMBLY_MAX_BYTES) && _ok__;
+    _ok__ = _root__.set("MTP_RELIABLE_HISTORY_DEPTH", MTP_RELIABLE_HISTORY_DEPTH) && _ok__;
+    _ok__ = _root__.set("MTP_RELIABLE_HEARTBEAT_PERIOD", MTP_RELIABLE_HEARTBEAT_PERIOD) && _ok__;
+    _ok__ = _root__.set("MTP_RELIABLE_HEARTBEAT_REPEATS", MTP_RELIABLE_HEARTBEAT_REPEATS) && _ok__;
+    _ok__ = _root__.set("MTP_RELIABLE_MAX_RETRANSMIT", MTP_RELIABLE_MAX_RETRANSMIT) && _ok__;
+    _ok__ = _root__.set("MTP_MULTICAST_PORT_BASE", MTP_MULTICAST_PORT_BASE) && _ok__;
+    _ok__ = _root__.set("MTP_MULTICAST_MIN_READERS", MTP_MULTICAST_MIN_READERS) && _ok__;
+    _ok__ = _root__.set("MTP_MULTICAST_LOOPBACK", MTP_MULTICAST_LOOPBACK) && _ok__;
+
+#ifdef HAVE_OPENCV
+    return _ok__ && yaml::saveOpenCv(_path__, _root__);
+#else
+    return _ok__ && yaml::save(_path__, _root__);
+#endif
+}
+
+} // rm::para
@@ -0,0 +1,87 @@
+/**
+ * @file _rm_codegen_srv_empty.cpp
+ * @brief Empty service source (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ */
+
+#include <cstring>
+#include <numeric>
+
+#include "rmvlsrv/std/empty.hpp"
+
+namespace rm::srv {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Empty::Request::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(0);
+
+    return _res_;
+}
+
+Empty::Request Empty::Request::deserialize(const char *str) noexcept {
+    Empty::Request _msg__{};
+    [[maybe_unused]] const char *_p__ = str;
+
+    return _msg__;
+}
+
+std::size_t Empty::Request::compact_size() const noexcept {
+    return 0;
+}
+
+std::string Empty::Response::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(0);
+
+    return _res_;
+}
+
+Empty::Response Empty::Response::deserialize(const char *str) noexcept {
+    Empty::Response _msg__{};
+    [[maybe_unused]] const char *_p__ = str;
+
+    return _msg__;
+}
+
+std::size_t Empty::Response::compact_size() const noexcept {
+    return 0;
+}
+
+} // namespace rm::srv
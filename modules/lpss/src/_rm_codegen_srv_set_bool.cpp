@@ -0,0 +1,97 @@
+/**
+ * @file _rm_codegen_srv_set_bool.cpp
+ * @brief SetBool service source (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ */
+
+#include <cstring>
+#include <numeric>
+
+#include "rmvlsrv/std/set_bool.hpp"
+
+namespace rm::srv {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string SetBool::Request::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(sizeof(data));
+    append_scalar(_res_, data);
+
+    return _res_;
+}
+
+SetBool::Request SetBool::Request::deserialize(const char *str) noexcept {
+    SetBool::Request _msg__{};
+    [[maybe_unused]] const char *_p__ = str;
+    _msg__.data = read_scalar<bool>(_p__);
+
+    return _msg__;
+}
+
+std::size_t SetBool::Request::compact_size() const noexcept {
+    return sizeof(data);
+}
+
+std::string SetBool::Response::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(sizeof(success) + sizeof(uint32_t) + message.size());
+    append_scalar(_res_, success);
+    auto message_size__ = static_cast<uint32_t>(message.size());
+    append_scalar(_res_, message_size__);
+    _res_.append(message);
+
+    return _res_;
+}
+
+SetBool::Response SetBool::Response::deserialize(const char *str) noexcept {
+    SetBool::Response _msg__{};
+    [[maybe_unused]] const char *_p__ = str;
+    _msg__.success = read_scalar<bool>(_p__);
+    auto message_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.message.assign(_p__, message_size__);
+    _p__ += message_size__;
+
+    return _msg__;
+}
+
+std::size_t SetBool::Response::compact_size() const noexcept {
+    return sizeof(success) + sizeof(uint32_t) + message.size();
+}
+
+} // namespace rm::srv
@@ -0,0 +1,98 @@
+/**
+ * @file _rm_codegen_srv_set_camera_info.cpp
+ * @brief SetCameraInfo service source (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ */
+
+#include <cstring>
+#include <numeric>
+
+#include "rmvlsrv/sensor/set_camera_info.hpp"
+
+namespace rm::srv {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string SetCameraInfo::Request::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(camera_info.compact_size());
+    _res_.append(camera_info.serialize());
+
+    return _res_;
+}
+
+SetCameraInfo::Request SetCameraInfo::Request::deserialize(const char *str) noexcept {
+    SetCameraInfo::Request _msg__{};
+    [[maybe_unused]] const char *_p__ = str;
+    _msg__.camera_info = rm::msg::CameraInfo::deserialize(_p__);
+    _p__ += _msg__.camera_info.compact_size();
+
+    return _msg__;
+}
+
+std::size_t SetCameraInfo::Request::compact_size() const noexcept {
+    return camera_info.compact_size();
+}
+
+std::string SetCameraInfo::Response::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(sizeof(success) + sizeof(uint32_t) + status_message.size());
+    append_scalar(_res_, success);
+    auto status_message_size__ = static_cast<uint32_t>(status_message.size());
+    append_scalar(_res_, status_message_size__);
+    _res_.append(status_message);
+
+    return _res_;
+}
+
+SetCameraInfo::Response SetCameraInfo::Response::deserialize(const char *str) noexcept {
+    SetCameraInfo::Response _msg__{};
+    [[maybe_unused]] const char *_p__ = str;
+    _msg__.success = read_scalar<bool>(_p__);
+    auto status_message_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.status_message.assign(_p__, status_message_size__);
+    _p__ += status_message_size__;
+
+    return _msg__;
+}
+
+std::size_t SetCameraInfo::Response::compact_size() const noexcept {
+    return sizeof(success) + sizeof(uint32_t) + status_message.size();
+}
+
+} // namespace rm::srv
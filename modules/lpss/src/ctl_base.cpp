@@ -33,25 +33,31 @@ void basic_eff_imapping(const msg::JointState &d_in, const msg::JointState &fb_i
     fb_out = fb_in.effort;
 }
 
-void basic_pos_omapping(std::vector<double> cmd_in, msg::JointState &cmd_out) noexcept {
+void basic_pos_omapping(const std::vector<double> &cmd_in, msg::JointState &cmd_out) noexcept {
     const size_t dof = cmd_in.size();
-    cmd_out.position = std::move(cmd_in);
+    cmd_out.position = cmd_in;
     cmd_out.velocity.assign(dof, 0.0);
     cmd_out.effort.assign(dof, 0.0);
 }
 
-void basic_vel_omapping(std::vector<double> cmd_in, msg::JointState &cmd_out) noexcept {
+void basic_vel_omapping(const std::vector<double> &cmd_in, msg::JointState &cmd_out) noexcept {
     const size_t dof = cmd_in.size();
     cmd_out.position.assign(dof, 0.0);
-    cmd_out.velocity = std::move(cmd_in);
+    cmd_out.velocity = cmd_in;
     cmd_out.effort.assign(dof, 0.0);
 }
 
-void basic_eff_omapping(std::vector<double> cmd_in, msg::JointState &cmd_out) noexcept {
+void basic_eff_omapping(const std::vector<double> &cmd_in, msg::JointState &cmd_out) noexcept {
     const size_t dof = cmd_in.size();
     cmd_out.position.assign(dof, 0.0);
     cmd_out.velocity.assign(dof, 0.0);
-    cmd_out.effort = std::move(cmd_in);
+    cmd_out.effort = cmd_in;
+}
+
+void ControlLawBase::reserve(std::size_t dof) {
+    _desired_vec.reserve(dof);
+    _fb_vec.reserve(dof);
+    _cmd_vec.reserve(dof);
 }
 
 ControlStatus ControlLawBase::compute(const msg::JointState &desired, const msg::JointState &fb, int32_t period, msg::JointState &command) noexcept {
@@ -60,24 +66,23 @@ ControlStatus ControlLawBase::compute(const msg::JointState &desired, const msg:
     if (fb.name.size() != dof)
         return ControlStatus::InvalidInput;
 
-    // 调用输入映射函数提取向量对
-    std::vector<double> desired_vec{}, fb_vec{};
-    _input_fn(desired, fb, desired_vec, fb_vec);
+    // 调用输入映射函数提取向量对，写入预分配的缓冲区
+    _input_fn(desired, fb, _desired_vec, _fb_vec);
 
     // 验证提取的向量维度
-    if (desired_vec.size() != dof || fb_vec.size() != dof)
+    if (_desired_vec.size() != dof || _fb_vec.size() != dof)
         return ControlStatus::InvalidInput;
 
     // 调用虚函数进行实际的脉冲传递函数计算
-    std::vector<double> cmd_vec(dof, 0.0);
-    auto res = do_compute(desired_vec, fb_vec, period, cmd_vec);
+    _cmd_vec.assign(dof, 0.0);
+    auto res = do_compute(_desired_vec, _fb_vec, period, _cmd_vec);
     if (res != ControlStatus::Ok)
         return res;
 
-    // 调用输出映射函数将结果写回 JointState
+    // 调用输出映射函数将结果写回 JointState，拷贝赋值复用 command 已有的容量
     command.header.stamp = desired.header.stamp;
     command.name = desired.name;
-    _output_fn(cmd_vec, command);
+    _output_fn(_cmd_vec, command);
 
     return ControlStatus::Ok;
 }
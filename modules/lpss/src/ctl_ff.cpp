@@ -36,19 +36,15 @@ ControlStatus FeedForward::do_compute(const std::vector<double> &desired, const
     // 验证输入维度
     if (desired.size() != dof)
         return ControlStatus::InvalidInput;
-
-    std::vector<double> out(dof, 0.0);
+    command.resize(dof);
 
     // 应用差分方程
     for (std::size_t i = 0; i < dof; ++i)
-        out[i] = (_a0[i] + _a1[i] / T + _a2[i] / (T * T)) * desired[i] - (_a1[i] / T + 2.0 * _a2[i] / (T * T)) * _prev_ds[0][i] + _a2[i] / (T * T) * _prev_ds[1][i];
-
-    // 输出控制命令
-    command = std::move(out);
+        command[i] = (_a0[i] + _a1[i] / T + _a2[i] / (T * T)) * desired[i] - (_a1[i] / T + 2.0 * _a2[i] / (T * T)) * _prev_ds[0][i] + _a2[i] / (T * T) * _prev_ds[1][i];
 
-    // 更新缓存
-    _prev_ds[1] = std::move(_prev_ds[0]);
-    _prev_ds[0] = desired;
+    // 更新缓存，轮换后原位覆盖，不分配内存
+    _prev_ds[1].swap(_prev_ds[0]);
+    std::copy(desired.begin(), desired.end(), _prev_ds[0].begin());
 
     return ControlStatus::Ok;
 }
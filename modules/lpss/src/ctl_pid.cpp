@@ -39,25 +39,20 @@ ControlStatus PID::do_compute(const std::vector<double> &desired, const std::vec
     // 验证输入维度
     if (desired.size() != dof || fb.size() != dof)
         return ControlStatus::InvalidInput;
-    
-    std::vector<double> out(dof, 0.0);
-    
-    // 计算误差
-    std::vector<double> err(dof, 0.0);
-    for (std::size_t i = 0; i < dof; ++i)
-        err[i] = desired[i] - fb[i];
+    command.resize(dof);
     
     // 应用控制律：u[k] - u[k-1] = (Kp + Kd)x[k] + (KiT - Kp - 2Kd)x[k-1] + Kd*x[k-2]
-    for (std::size_t i = 0; i < dof; ++i)
-        out[i] = _prev_out[i] + (_kp[i] + _kd[i]) * err[i] + (_ki[i] * T - _kp[i] - 2.0 * _kd[i]) * _prev_errs[0][i] + _kd[i] * _prev_errs[1][i];
-    
-    // 输出控制命令
-    command = std::move(out);
-    
+    // 误差缓存轮换复用，x[k] 写入最旧的一组缓存，整个过程不分配内存
+    auto &err = _prev_errs[1];
+    for (std::size_t i = 0; i < dof; ++i) {
+        const double e = desired[i] - fb[i];
+        command[i] = _prev_out[i] + (_kp[i] + _kd[i]) * e + (_ki[i] * T - _kp[i] - 2.0 * _kd[i]) * _prev_errs[0][i] + _kd[i] * err[i];
+        err[i] = e;
+    }
+
     // 更新缓存
-    _prev_out = command;
-    _prev_errs[1] = std::move(_prev_errs[0]);
-    _prev_errs[0] = std::move(err);
+    std::copy(command.begin(), command.end(), _prev_out.begin());
+    _prev_errs[0].swap(_prev_errs[1]);
 
     return ControlStatus::Ok;
 }
@@ -9,6 +9,9 @@
  *
  */
 
+#include <cstring>
+#include <limits>
+
 #include "rmvl/lpss/cv.hpp"
 
 #ifdef HAVE_OPENCV
@@ -49,51 +52,176 @@ msg::Transform to_msg(const cv::Affine3d &tf) {
 
 #endif
 
-cv::Mat from_msg(const msg::Image &img_msg) {
-    if (img_msg.data.empty()) {
-        return cv::Mat{};
+namespace {
+
+/**
+ * @brief 获取像素编码对应的 cv::Mat 行数与类型
+ *
+ * @param[in] height 图像高度
+ * @param[in] encoding 像素编码
+ * @param[out] rows 矩阵行数
+ * @param[out] type 矩阵类型
+ * @return 是否为已知的像素编码
+ */
+bool matLayout(int32_t height, uint8_t encoding, int64_t &rows, int &type) noexcept {
+    rows = height;
+    switch (encoding) {
+    case msg::Image::encoding_mono8:
+    case msg::Image::encoding_bayer_rggb8:
+    case msg::Image::encoding_bayer_bggr8:
+        type = CV_8UC1;
+        return true;
+    case msg::Image::encoding_bgr8:
+    case msg::Image::encoding_rgb8:
+        type = CV_8UC3;
+        return true;
+    case msg::Image::encoding_rgba8:
+    case msg::Image::encoding_bgra8:
+        type = CV_8UC4;
+        return true;
+    case msg::Image::encoding_mono16:
+    case msg::Image::encoding_bayer_rggb16:
+    case msg::Image::encoding_bayer_bggbr16:
+        type = CV_16UC1;
+        return true;
+    case msg::Image::encoding_yuv422:
+        type = CV_8UC2;
+        return true;
+    case msg::Image::encoding_yuv420:
+        rows = int64_t{height} * 3 / 2;
+        type = CV_8UC1;
+        return true;
+    default:
+        return false;
     }
-    if (img_msg.encoding == msg::Image::encoding_mono8)
-        return cv::Mat(img_msg.height, img_msg.width, CV_8UC1, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else if (img_msg.encoding == msg::Image::encoding_bgr8 || img_msg.encoding == msg::Image::encoding_rgb8)
-        return cv::Mat(img_msg.height, img_msg.width, CV_8UC3, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else if (img_msg.encoding == msg::Image::encoding_rgba8 || img_msg.encoding == msg::Image::encoding_bgra8)
-        return cv::Mat(img_msg.height, img_msg.width, CV_8UC4, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else if (img_msg.encoding == msg::Image::encoding_mono16)
-        return cv::Mat(img_msg.height, img_msg.width, CV_16UC1, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else if (img_msg.encoding == msg::Image::encoding_bayer_rggb8)
-        return cv::Mat(img_msg.height, img_msg.width, CV_8UC1, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else if (img_msg.encoding == msg::Image::encoding_bayer_bggr8)
-        return cv::Mat(img_msg.height, img_msg.width, CV_8UC1, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else if (img_msg.encoding == msg::Image::encoding_bayer_rggb16)
-        return cv::Mat(img_msg.height, img_msg.width, CV_16UC1, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else if (img_msg.encoding == msg::Image::encoding_bayer_bggbr16)
-        return cv::Mat(img_msg.height, img_msg.width, CV_16UC1, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else if (img_msg.encoding == msg::Image::encoding_yuv422)
-        return cv::Mat(img_msg.height, img_msg.width, CV_8UC2, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else if (img_msg.encoding == msg::Image::encoding_yuv420)
-        return cv::Mat(img_msg.height * 3 / 2, img_msg.width, CV_8UC1, const_cast<uint8_t *>(img_msg.data.data())).clone();
-    else
+}
+
+//! 以 cv::Mat 头引用连续的像素数据，编码未知或长度不符时返回空矩阵
+cv::Mat wrap(int32_t height, int32_t width, uint8_t encoding, const uint8_t *data, std::size_t size) {
+    int64_t rows{};
+    int type{};
+    if (data == nullptr || height <= 0 || width <= 0 || !matLayout(height, encoding, rows, type))
+        return cv::Mat{};
+    // rows <= 1.5 * INT32_MAX，三者之积不会溢出 64 位无符号整数
+    if (rows > std::numeric_limits<int>::max() || static_cast<std::size_t>(rows) * static_cast<std::size_t>(width) * CV_ELEM_SIZE(type) != size)
         return cv::Mat{};
+    return cv::Mat(static_cast<int>(rows), width, type, const_cast<uint8_t *>(data));
 }
 
+//! 图像高度，`yuv420` 编码的矩阵行数为图像高度的 1.5 倍
+int32_t imageHeight(const cv::Mat &img, uint8_t encoding) noexcept {
+    return encoding == msg::Image::encoding_yuv420 ? img.rows * 2 / 3 : img.rows;
+}
+
+template <typename Tp>
+void appendScalar(std::string &dst, const Tp &value) {
+    dst.append(reinterpret_cast<const char *>(&value), sizeof(Tp));
+}
+
+template <typename Tp>
+Tp readScalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+} // namespace
+
+cv::Mat view(msg::Image &img_msg) { return wrap(img_msg.height, img_msg.width, img_msg.encoding, img_msg.data.data(), img_msg.data.size()); }
+
+cv::Mat view(const msg::Image &img_msg) { return wrap(img_msg.height, img_msg.width, img_msg.encoding, img_msg.data.data(), img_msg.data.size()); }
+
+#if __cplusplus >= 202002L
+cv::Mat view(const msg::ImageView &img_view) { return wrap(img_view.height, img_view.width, img_view.encoding, img_view.data.data(), img_view.data.size()); }
+#endif
+
+cv::Mat from_msg(const msg::Image &img_msg) { return view(img_msg).clone(); }
+
 msg::Image to_msg(cv::Mat img, uint8_t encoding) {
     if (encoding > msg::Image::encoding_yuv420 || img.empty())
         return msg::Image{};
 
     msg::Image img_msg{};
-    img_msg.height = img.rows;
+    img_msg.height = imageHeight(img, encoding);
     img_msg.width = img.cols;
     img_msg.encoding = encoding;
 
     size_t row_bytes = img.cols * img.elemSize();
     img_msg.data.resize(img.rows * row_bytes);
-    for (int i = 0; i < img.rows; ++i)
-        std::memcpy(img_msg.data.data() + i * row_bytes, img.ptr(i), row_bytes);
+    if (img.isContinuous())
+        std::memcpy(img_msg.data.data(), img.data, img_msg.data.size());
+    else
+        for (int i = 0; i < img.rows; ++i)
+            std::memcpy(img_msg.data.data() + i * row_bytes, img.ptr(i), row_bytes);
+
+    return img_msg;
+}
+
+std::string MatImage::serialize() const noexcept {
+    const std::size_t row_bytes = image.empty() ? 0 : image.cols * image.elemSize();
+    const auto data_size = static_cast<uint32_t>(row_bytes * image.rows);
+    std::string res;
+    res.reserve(compact_size());
+    res.append(header.serialize());
+    appendScalar(res, image.empty() ? int32_t{} : imageHeight(image, encoding));
+    appendScalar(res, static_cast<int32_t>(image.cols));
+    appendScalar(res, encoding);
+    appendScalar(res, data_size);
+    if (image.isContinuous())
+        res.append(reinterpret_cast<const char *>(image.data), data_size);
+    else
+        for (int i = 0; i < image.rows; ++i)
+            res.append(reinterpret_cast<const char *>(image.ptr(i)), row_bytes);
+    return res;
+}
+
+MatImage MatImage::deserialize(const char *const str) noexcept {
+    MatImage res{};
+    const char *p = str;
+    res.header = msg::Header::deserialize(p);
+    p += res.header.compact_size();
+    const auto height = readScalar<int32_t>(p);
+    const auto width = readScalar<int32_t>(p);
+    res.encoding = readScalar<uint8_t>(p);
+    const auto data_size = readScalar<uint32_t>(p);
+    // 先以 cv::Mat 头校验尺寸与 data_size 一致，再复制到新分配的矩阵中，仅复制一次，复制量不超过 data_size
+    const auto view = wrap(height, width, res.encoding, reinterpret_cast<const uint8_t *>(p), data_size);
+    if (view.empty())
+        return res;
+    try {
+        res.image = view.clone();
+    } catch (const std::exception &) {
+        res.image.release();
+    }
+    return res;
+}
 
+std::size_t MatImage::compact_size() const noexcept {
+    const std::size_t data_size = image.empty() ? 0 : image.total() * image.elemSize();
+    return header.compact_size() + sizeof(int32_t) * 2 + sizeof(encoding) + sizeof(uint32_t) + data_size;
+}
+
+msg::Image MatImage::to_msg() const {
+    auto img_msg = cvmsg::to_msg(image, encoding);
+    img_msg.header = header;
     return img_msg;
 }
 
+cv::Mat from_msg(const msg::CompressedImage &img_msg, lpss::ImageDecoder &decoder) {
+    msg::Image img{};
+    if (!decoder.decode(img_msg, img))
+        return cv::Mat{};
+    return from_msg(img);
+}
+
+cv::Mat from_msg(const msg::CompressedImage &img_msg) {
+    lpss::ImageDecoder decoder{};
+    return from_msg(img_msg, decoder);
+}
+
+msg::CompressedImage to_msg(cv::Mat img, uint8_t encoding, lpss::ImageEncoder &encoder) { return encoder.encode(to_msg(img, encoding)); }
+
 } // namespace rm::cvmsg
 
 #endif
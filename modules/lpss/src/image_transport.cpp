@@ -0,0 +1,612 @@
+/**
+ * @file image_transport.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 可插拔的图像传输编解码实现
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+#include "rmvl/core/util.hpp"
+#include "rmvl/lpss/image_transport.hpp"
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_OPENCV
+#include <opencv2/imgcodecs.hpp>
+#endif
+
+namespace rm::lpss {
+
+std::size_t imageBytes(int32_t height, int32_t width, uint8_t encoding) noexcept {
+    if (height <= 0 || width <= 0)
+        return 0;
+    const auto pixels = static_cast<std::size_t>(height) * static_cast<std::size_t>(width);
+    switch (encoding) {
+    case msg::Image::encoding_mono8:
+    case msg::Image::encoding_bayer_rggb8:
+    case msg::Image::encoding_bayer_bggr8:
+        return pixels;
+    case msg::Image::encoding_mono16:
+    case msg::Image::encoding_bayer_rggb16:
+    case msg::Image::encoding_bayer_bggbr16:
+    case msg::Image::encoding_yuv422:
+        return pixels * 2;
+    case msg::Image::encoding_rgb8:
+    case msg::Image::encoding_bgr8:
+        return pixels * 3;
+    case msg::Image::encoding_rgba8:
+    case msg::Image::encoding_bgra8:
+        return pixels * 4;
+    case msg::Image::encoding_yuv420:
+        return static_cast<std::size_t>(height) * 3 / 2 * static_cast<std::size_t>(width);
+    default:
+        return 0;
+    }
+}
+
+namespace {
+
+//! 不压缩，仅校验数据长度
+class RawTransport final : public ImageTransport {
+public:
+    bool encode(const msg::Image &image, msg::CompressedImage &packet) override {
+        packet.reference = packet.sequence;
+        packet.data = image.data;
+        return true;
+    }
+
+    bool decode(const msg::CompressedImage &packet, msg::Image &image) override {
+        const auto bytes = imageBytes(packet.height, packet.width, packet.encoding);
+        if (bytes != 0 && packet.data.size() != bytes)
+            return false;
+        image.data = packet.data;
+        return true;
+    }
+};
+
+//! 8 位像素编码的通道数，其余编码返回 0
+int channels8(uint8_t encoding) noexcept {
+    switch (encoding) {
+    case msg::Image::encoding_mono8:
+    case msg::Image::encoding_bayer_rggb8:
+    case msg::Image::encoding_bayer_bggr8:
+        return 1;
+    case msg::Image::encoding_rgb8:
+    case msg::Image::encoding_bgr8:
+        return 3;
+    case msg::Image::encoding_rgba8:
+    case msg::Image::encoding_bgra8:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief QOI 风格的无损编解码
+ * @details 操作码与 QOI 规范一致，但省略文件头与结束标记（尺寸由消息给出），单通道像素按 \f$(v,v,v,255)\f$ 处理
+ */
+namespace qoi {
+
+constexpr uint8_t op_index = 0x00;
+constexpr uint8_t op_diff = 0x40;
+constexpr uint8_t op_luma = 0x80;
+constexpr uint8_t op_run = 0xc0;
+constexpr uint8_t op_rgb = 0xfe;
+constexpr uint8_t op_rgba = 0xff;
+constexpr uint8_t mask_2 = 0xc0;
+
+struct Pixel {
+    uint8_t r{}, g{}, b{}, a{255};
+
+    bool operator==(const Pixel &rhs) const noexcept { return r == rhs.r && g == rhs.g && b == rhs.b && a == rhs.a; }
+    int hash() const noexcept { return (r * 3 + g * 5 + b * 7 + a * 11) % 64; }
+};
+
+template <int C>
+inline Pixel load(const uint8_t *p) noexcept {
+    if constexpr (C == 1)
+        return {p[0], p[0], p[0], 255};
+    else if constexpr (C == 3)
+        return {p[0], p[1], p[2], 255};
+    else
+        return {p[0], p[1], p[2], p[3]};
+}
+
+template <int C>
+inline void store(uint8_t *p, const Pixel &px) noexcept {
+    p[0] = px.r;
+    if constexpr (C >= 3)
+        p[1] = px.g, p[2] = px.b;
+    if constexpr (C == 4)
+        p[3] = px.a;
+}
+
+template <int C>
+void encode(const uint8_t *src, std::size_t pixels, std::vector<uint8_t> &out) {
+    // 最坏情况：单通道像素使用 op_rgb，多通道像素使用 op_rgb/op_rgba
+    out.resize(pixels * (C == 1 ? 4 : C + 1));
+    uint8_t *dst = out.data();
+    Pixel index[64]{};
+    Pixel prev{0, 0, 0, 255};
+    int run = 0;
+    for (std::size_t i = 0; i < pixels; ++i, src += C) {
+        const Pixel px = load<C>(src);
+        if (px == prev) {
+            if (++run == 62 || i + 1 == pixels)
+                *dst++ = op_run | static_cast<uint8_t>(run - 1), run = 0;
+            continue;
+        }
+        if (run > 0)
+            *dst++ = op_run | static_cast<uint8_t>(run - 1), run = 0;
+        const int h = px.hash();
+        if (index[h] == px) {
+            *dst++ = op_index | static_cast<uint8_t>(h);
+        } else {
+            index[h] = px;
+            if (px.a == prev.a) {
+                const auto vr = static_cast<int8_t>(px.r - prev.r);
+                const auto vg = static_cast<int8_t>(px.g - prev.g);
+                const auto vb = static_cast<int8_t>(px.b - prev.b);
+                const int vg_r = vr - vg, vg_b = vb - vg;
+                if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+                    *dst++ = op_diff | static_cast<uint8_t>((vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+                else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+                    *dst++ = op_luma | static_cast<uint8_t>(vg + 32);
+                    *dst++ = static_cast<uint8_t>((vg_r + 8) << 4 | (vg_b + 8));
+                } else {
+                    *dst++ = op_rgb;
+                    *dst++ = px.r, *dst++ = px.g, *dst++ = px.b;
+                }
+            } else {
+                *dst++ = op_rgba;
+                *dst++ = px.r, *dst++ = px.g, *dst++ = px.b, *dst++ = px.a;
+            }
+        }
+        prev = px;
+    }
+    out.resize(static_cast<std::size_t>(dst - out.data()));
+}
+
+template <int C>
+bool decode(const uint8_t *src, std::size_t size, uint8_t *dst, std::size_t pixels) noexcept {
+    Pixel index[64]{};
+    Pixel px{0, 0, 0, 255};
+    const uint8_t *const end = src + size;
+    uint8_t *const dst_end = dst + pixels * C;
+    while (dst < dst_end) {
+        if (src >= end)
+            return false;
+        const uint8_t b1 = *src++;
+        if (b1 == op_rgb) {
+            if (end - src < 3)
+                return false;
+            px.r = src[0], px.g = src[1], px.b = src[2];
+            src += 3;
+        } else if (b1 == op_rgba) {
+            if (end - src < 4)
+                return false;
+            px.r = src[0], px.g = src[1], px.b = src[2], px.a = src[3];
+            src += 4;
+        } else if ((b1 & mask_2) == op_index) {
+            px = index[b1];
+        } else if ((b1 & mask_2) == op_diff) {
+            px.r += ((b1 >> 4) & 0x03) - 2;
+            px.g += ((b1 >> 2) & 0x03) - 2;
+            px.b += (b1 & 0x03) - 2;
+        } else if ((b1 & mask_2) == op_luma) {
+            if (src >= end)
+                return false;
+            const uint8_t b2 = *src++;
+            const int vg = (b1 & 0x3f) - 32;
+            px.r += vg - 8 + ((b2 >> 4) & 0x0f);
+            px.g += vg;
+            px.b += vg - 8 + (b2 & 0x0f);
+        } else {
+            const std::size_t run = (b1 & 0x3f) + 1;
+            if (static_cast<std::size_t>(dst_end - dst) < run * C)
+                return false;
+            for (std::size_t k = 0; k < run; ++k, dst += C)
+                store<C>(dst, px);
+            continue;
+        }
+        index[px.hash()] = px;
+        store<C>(dst, px);
+        dst += C;
+    }
+    return src == end;
+}
+
+//! 按通道数分派的 QOI 编码，不支持的像素编码返回 `false`
+bool encode(const msg::Image &image, std::vector<uint8_t> &out) {
+    const auto bytes = imageBytes(image.height, image.width, image.encoding);
+    const int c = channels8(image.encoding);
+    if (c == 0 || bytes == 0 || image.data.size() != bytes)
+        return false;
+    const std::size_t pixels = bytes / c;
+    if (c == 1)
+        encode<1>(image.data.data(), pixels, out);
+    else if (c == 3)
+        encode<3>(image.data.data(), pixels, out);
+    else
+        encode<4>(image.data.data(), pixels, out);
+    return true;
+}
+
+//! 按通道数分派的 QOI 解码
+bool decode(const uint8_t *src, std::size_t size, int32_t height, int32_t width, uint8_t encoding, std::vector<uint8_t> &out) {
+    const auto bytes = imageBytes(height, width, encoding);
+    const int c = channels8(encoding);
+    if (c == 0 || bytes == 0)
+        return false;
+    // 单个字节至多展开为 62 个像素（最长游程），在分配输出前拒绝尺寸与载荷不符的数据包
+    const std::size_t pixels = bytes / c;
+    if ((pixels + 61) / 62 > size)
+        return false;
+    out.resize(bytes);
+    if (c == 1)
+        return decode<1>(src, size, out.data(), pixels);
+    if (c == 3)
+        return decode<3>(src, size, out.data(), pixels);
+    return decode<4>(src, size, out.data(), pixels);
+}
+
+} // namespace qoi
+
+class QOITransport final : public ImageTransport {
+public:
+    bool encode(const msg::Image &image, msg::CompressedImage &packet) override {
+        packet.reference = packet.sequence;
+        return qoi::encode(image, packet.data);
+    }
+
+    bool decode(const msg::CompressedImage &packet, msg::Image &image) override {
+        return qoi::decode(packet.data.data(), packet.data.size(), packet.height, packet.width, packet.encoding, image.data);
+    }
+};
+
+/**
+ * @brief 关键帧 + 差分帧
+ * @details 载荷首字节区分帧类型：
+ * - 关键帧 `K`：随后 1 字节表示关键帧格式（0 为不压缩，1 为 QOI），其后为关键帧数据
+ * - 差分帧 `D`：随后为若干 `(跳过字节数, 差分字节数, 差分字节...)` 三元组，两个计数均为 LEB128 变长整数，
+ *   差分字节为当前帧与关键帧之差（模 256）
+ *
+ * 差分帧只依赖关键帧而不依赖前一帧，丢失差分帧不会影响后续帧的解码
+ */
+class DeltaTransport final : public ImageTransport {
+public:
+    explicit DeltaTransport(const ImageTransportOptions &options) : _interval(options.keyframe_interval), _threshold(options.delta_threshold) {}
+
+    bool encode(const msg::Image &image, msg::CompressedImage &packet) override {
+        const auto bytes = imageBytes(image.height, image.width, image.encoding);
+        if (bytes == 0 || image.data.size() != bytes)
+            return false;
+        const bool same_shape = !_key.empty() && _height == image.height && _width == image.width && _encoding == image.encoding;
+        if (same_shape && (_interval == 0 || _since_key < _interval)) {
+            encodeDelta(image.data, packet.data);
+            // 场景大幅变化时差分帧不再划算，改发关键帧
+            if (packet.data.size() < bytes / 2) {
+                ++_since_key;
+                packet.reference = _key_seq;
+                return true;
+            }
+        }
+        _key = image.data;
+        _height = image.height, _width = image.width, _encoding = image.encoding;
+        _key_seq = packet.sequence, _since_key = 1;
+        packet.reference = packet.sequence;
+        packet.data.clear();
+        packet.data.push_back('K');
+        if (qoi::encode(image, _buffer)) {
+            packet.data.push_back(1);
+            packet.data.insert(packet.data.end(), _buffer.begin(), _buffer.end());
+        } else {
+            packet.data.push_back(0);
+            packet.data.insert(packet.data.end(), image.data.begin(), image.data.end());
+        }
+        return true;
+    }
+
+    bool decode(const msg::CompressedImage &packet, msg::Image &image) override {
+        const auto bytes = imageBytes(packet.height, packet.width, packet.encoding);
+        const auto &data = packet.data;
+        if (bytes == 0 || data.empty())
+            return false;
+        if (data[0] == 'K') {
+            if (data.size() < 2)
+                return false;
+            bool ok{};
+            if (data[1] == 1)
+                ok = qoi::decode(data.data() + 2, data.size() - 2, packet.height, packet.width, packet.encoding, _key);
+            else if (data[1] == 0 && data.size() - 2 == bytes)
+                _key.assign(data.begin() + 2, data.end()), ok = true;
+            if (!ok) {
+                _key.clear();
+                return false;
+            }
+            _height = packet.height, _width = packet.width, _encoding = packet.encoding;
+            _key_seq = packet.sequence;
+            image.data = _key;
+            return true;
+        }
+        if (data[0] != 'D' || _key.empty() || packet.reference != _key_seq ||
+            _height != packet.height || _width != packet.width || _encoding != packet.encoding)
+            return false;
+        image.data = _key;
+        return applyDelta(data, image.data);
+    }
+
+private:
+    static void putVarint(std::vector<uint8_t> &out, std::size_t v) {
+        while (v >= 0x80) {
+            out.push_back(static_cast<uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(v));
+    }
+
+    static bool getVarint(const uint8_t *&p, const uint8_t *end, std::size_t &v) noexcept {
+        v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (p >= end)
+                return false;
+            const uint8_t b = *p++;
+            v |= static_cast<std::size_t>(b & 0x7f) << shift;
+            if (!(b & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    //! 当前字节与关键帧对应字节是否视为相同
+    bool same(uint8_t cur, uint8_t key) const noexcept {
+        const int d = cur - key;
+        return d <= _threshold && d >= -static_cast<int>(_threshold);
+    }
+
+    void encodeDelta(const std::vector<uint8_t> &cur, std::vector<uint8_t> &out) const {
+        // 短于该长度的相同字节段并入差分段，避免三元组开销超过收益
+        constexpr std::size_t min_gap = 4;
+        const std::size_t n = cur.size();
+        const uint8_t *c = cur.data(), *k = _key.data();
+        out.clear();
+        out.push_back('D');
+        std::size_t pos = 0, last = 0;
+        while (pos < n) {
+            // 无损模式下按 8 字节块快速跳过相同区域
+            if (_threshold == 0)
+                while (pos + 8 <= n && std::memcmp(c + pos, k + pos, 8) == 0)
+                    pos += 8;
+            while (pos < n && same(c[pos], k[pos]))
+                ++pos;
+            if (pos == n)
+                break;
+            const std::size_t begin = pos;
+            std::size_t gap = 0;
+            for (; pos < n && gap < min_gap; ++pos)
+                gap = same(c[pos], k[pos]) ? gap + 1 : 0;
+            const std::size_t stop = pos - gap;
+            putVarint(out, begin - last);
+            putVarint(out, stop - begin);
+            for (std::size_t i = begin; i < stop; ++i)
+                out.push_back(static_cast<uint8_t>(c[i] - k[i]));
+            last = stop;
+        }
+    }
+
+    static bool applyDelta(const std::vector<uint8_t> &data, std::vector<uint8_t> &img) noexcept {
+        const uint8_t *p = data.data() + 1, *const end = data.data() + data.size();
+        std::size_t pos = 0;
+        while (p < end) {
+            std::size_t skip{}, len{};
+            if (!getVarint(p, end, skip) || !getVarint(p, end, len))
+                return false;
+            if (skip > img.size() - pos || len > img.size() - pos - skip || len > static_cast<std::size_t>(end - p))
+                return false;
+            pos += skip;
+            for (std::size_t i = 0; i < len; ++i)
+                img[pos + i] = static_cast<uint8_t>(img[pos + i] + p[i]);
+            p += len, pos += len;
+        }
+        return true;
+    }
+
+    uint32_t _interval{};
+    uint8_t _threshold{};
+    std::vector<uint8_t> _key{};
+    std::vector<uint8_t> _buffer{};
+    int32_t _height{}, _width{};
+    uint8_t _encoding{};
+    uint32_t _key_seq{};
+    uint32_t _since_key{};
+};
+
+#ifdef HAVE_OPENCV
+
+//! 8 位及 16 位单通道、3/4 通道像素编码对应的 OpenCV 类型，其余编码返回 -1
+int cvType(uint8_t encoding) noexcept {
+    switch (encoding) {
+    case msg::Image::encoding_mono8:
+        return CV_8UC1;
+    case msg::Image::encoding_mono16:
+        return CV_16UC1;
+    case msg::Image::encoding_rgb8:
+    case msg::Image::encoding_bgr8:
+        return CV_8UC3;
+    case msg::Image::encoding_rgba8:
+    case msg::Image::encoding_bgra8:
+        return CV_8UC4;
+    default:
+        return -1;
+    }
+}
+
+//! 基于 OpenCV imgcodecs 的编解码
+class OpenCVTransport final : public ImageTransport {
+public:
+    OpenCVTransport(const char *ext, std::vector<int> params, bool lossy) : _ext(ext), _params(std::move(params)), _lossy(lossy) {}
+
+    bool encode(const msg::Image &image, msg::CompressedImage &packet) override {
+        const int type = cvType(image.encoding);
+        // JPEG 仅支持 8 位 1/3 通道
+        if (type < 0 || (_lossy && type != CV_8UC1 && type != CV_8UC3))
+            return false;
+        // imencode 对空图像抛出异常，交由调用方回退为不压缩的格式
+        if (image.height <= 0 || image.width <= 0 || image.data.size() != imageBytes(image.height, image.width, image.encoding))
+            return false;
+        const cv::Mat mat(image.height, image.width, type, const_cast<uint8_t *>(image.data.data()));
+        packet.reference = packet.sequence;
+        try {
+            return cv::imencode(_ext, mat, packet.data, _params);
+        } catch (const cv::Exception &) {
+            return false;
+        }
+    }
+
+    bool decode(const msg::CompressedImage &packet, msg::Image &image) override {
+        const int type = cvType(packet.encoding);
+        if (type < 0 || packet.data.empty() || packet.data.size() > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+            return false;
+        const cv::Mat buf(1, static_cast<int>(packet.data.size()), CV_8UC1, const_cast<uint8_t *>(packet.data.data()));
+        // 损坏的数据可能使解码器抛出异常
+        cv::Mat mat{};
+        try {
+            mat = cv::imdecode(buf, cv::IMREAD_UNCHANGED);
+        } catch (const cv::Exception &) {
+            return false;
+        }
+        if (mat.empty() || mat.type() != type || mat.rows != packet.height || mat.cols != packet.width || !mat.isContinuous())
+            return false;
+        image.data.assign(mat.data, mat.data + mat.total() * mat.elemSize());
+        return true;
+    }
+
+private:
+    const char *_ext{};
+    std::vector<int> _params{};
+    bool _lossy{};
+};
+
+#endif // HAVE_OPENCV
+
+//! 图像传输注册表，内置传输在首次访问时注册
+class Registry {
+public:
+    static Registry &instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    bool add(std::string_view name, ImageTransportFactory factory) {
+        std::lock_guard lk(_mtx);
+        return _factories.emplace(std::string(name), std::move(factory)).second;
+    }
+
+    ImageTransport::ptr create(std::string_view name, const ImageTransportOptions &options) {
+        ImageTransportFactory factory{};
+        {
+            std::lock_guard lk(_mtx);
+            auto it = _factories.find(std::string(name));
+            if (it == _factories.end())
+                return nullptr;
+            factory = it->second;
+        }
+        return factory ? factory(options) : nullptr;
+    }
+
+    std::vector<std::string> names() {
+        std::lock_guard lk(_mtx);
+        std::vector<std::string> res{};
+        res.reserve(_factories.size());
+        for (const auto &[name, factory] : _factories)
+            res.push_back(name);
+        std::sort(res.begin(), res.end());
+        return res;
+    }
+
+private:
+    Registry() {
+        _factories.emplace("raw", [](const ImageTransportOptions &) { return std::make_unique<RawTransport>(); });
+        _factories.emplace("qoi", [](const ImageTransportOptions &) { return std::make_unique<QOITransport>(); });
+        _factories.emplace("delta", [](const ImageTransportOptions &options) { return std::make_unique<DeltaTransport>(options); });
+#ifdef HAVE_OPENCV
+        _factories.emplace("jpeg", [](const ImageTransportOptions &options) {
+            return std::make_unique<OpenCVTransport>(".jpg", std::vector<int>{cv::IMWRITE_JPEG_QUALITY, std::clamp(options.quality, 0, 100)}, true);
+        });
+        _factories.emplace("png", [](const ImageTransportOptions &options) {
+            return std::make_unique<OpenCVTransport>(".png", std::vector<int>{cv::IMWRITE_PNG_COMPRESSION, std::clamp(options.compression, 0, 9)}, false);
+        });
+#endif
+    }
+
+    std::mutex _mtx{};
+    std::unordered_map<std::string, ImageTransportFactory> _factories{};
+};
+
+} // namespace
+
+bool registerImageTransport(std::string_view name, ImageTransportFactory factory) { return Registry::instance().add(name, std::move(factory)); }
+
+ImageTransport::ptr createImageTransport(std::string_view name, const ImageTransportOptions &options) { return Registry::instance().create(name, options); }
+
+std::vector<std::string> imageTransports() { return Registry::instance().names(); }
+
+ImageEncoder::ImageEncoder(std::string_view transport, const ImageTransportOptions &options)
+    : _name(transport), _transport(createImageTransport(transport, options)) {
+    if (!_transport)
+        RMVL_Error_(RMVL_StsBadArg, "Unknown image transport: \"%s\"", _name.c_str());
+}
+
+void ImageEncoder::encode(const msg::Image &image, msg::CompressedImage &packet) {
+    packet.header = image.header;
+    packet.height = image.height;
+    packet.width = image.width;
+    packet.encoding = image.encoding;
+    packet.format = _name;
+    packet.sequence = _sequence++;
+    if (_transport->encode(image, packet))
+        return;
+    // 不支持的像素编码以不压缩的格式发送
+    if (!_raw)
+        _raw = std::make_unique<RawTransport>();
+    packet.format = "raw";
+    _raw->encode(image, packet);
+}
+
+msg::CompressedImage ImageEncoder::encode(const msg::Image &image) {
+    msg::CompressedImage packet{};
+    encode(image, packet);
+    return packet;
+}
+
+bool ImageDecoder::decode(const msg::CompressedImage &packet, msg::Image &image) {
+    auto it = _transports.find(packet.format);
+    if (it == _transports.end()) {
+        auto transport = createImageTransport(packet.format);
+        if (!transport)
+            return false;
+        it = _transports.emplace(packet.format, std::move(transport)).first;
+    }
+    image.header = packet.header;
+    image.height = packet.height;
+    image.width = packet.width;
+    image.encoding = packet.encoding;
+    return it->second->decode(packet, image);
+}
+
+msg::Image ImageDecoder::decode(const msg::CompressedImage &packet) {
+    msg::Image image{};
+    if (!decode(packet, image))
+        return {};
+    return image;
+}
+
+} // namespace rm::lpss
@@ -63,7 +63,7 @@ std::pair<Guid, std::vector<ip::Networkv4>> generateNodeGuid() {
     return {res, networks};
 }
 
-Node::Node(std::string_view name, uint8_t domain) : _rndp_port(7500 + domain), _rndp_writer(Sender(ip::udp::v4()).create()) {
+Node::Node(std::string_view name, uint8_t domain) : _domain(domain), _rndp_port(7500 + domain), _rndp_writer(Sender(ip::udp::v4()).create()) {
     static_assert(sizeof(Locator) == 6, "Locator size must be 6 bytes");
 
     std::vector<ip::Networkv4> networks{};
@@ -200,7 +200,7 @@ void Node::rndp_listener(DgramSocket rndp_reader) {
                 for (const auto &[topic, writer] : _local_writers)
                     redp_msgs.push_back(REDPMessage::addWriter(writer->guid(), topic, writer->msgtype()));
                 for (const auto &[topic, reader] : _local_readers)
-                    redp_msgs.push_back(REDPMessage::addReader(reader->guid(), topic, reader->port(), reader->msgtype()));
+                    redp_msgs.push_back(REDPMessage::addReader(reader->guid(), topic, reader->port(), reader->msgtype(), reader->multicast()));
             }
             // 向新发现的节点单播包含所有本地 Writers/Readers 的 REDP 消息
             for (const auto &msg : redp_msgs)
@@ -228,6 +228,10 @@ void Node::redp_listener(DgramSocket redp_socket) {
                                 msg.topic.c_str(), _discovered_writers[msg.topic].msgtype.data(), msg.msgtype.data());
             } else { // Reader
                 _discovered_readers[msg.topic].readers[msg.endpoint_guid] = {msg.port, addr};
+                if (msg.multicast)
+                    _discovered_readers[msg.topic].multicast.insert(msg.endpoint_guid);
+                else
+                    _discovered_readers[msg.topic].multicast.erase(msg.endpoint_guid);
                 if (_discovered_readers[msg.topic].msgtype.empty())
                     _discovered_readers[msg.topic].msgtype = msg.msgtype;
                 if (_discovered_readers[msg.topic].msgtype != msg.msgtype)
@@ -242,6 +246,7 @@ void Node::redp_listener(DgramSocket redp_socket) {
                     _discovered_writers.erase(msg.topic);
             } else { // Reader
                 _discovered_readers[msg.topic].readers.erase(msg.endpoint_guid);
+                _discovered_readers[msg.topic].multicast.erase(msg.endpoint_guid);
                 if (_discovered_readers[msg.topic].readers.empty())
                     _discovered_readers.erase(msg.topic);
             }
@@ -252,7 +257,7 @@ void Node::redp_listener(DgramSocket redp_socket) {
             auto it = _local_writers.find(msg.topic);
             if (it != _local_writers.end()) {
                 if (msg.action == REDPMessage::Action::Add)
-                    it->second->add(msg.endpoint_guid, {msg.port, addr});
+                    it->second->add(msg.endpoint_guid, {msg.port, addr}, msg.multicast);
                 else // Remove
                     it->second->remove(msg.endpoint_guid);
             }
@@ -305,6 +310,8 @@ void Node::heartbeat_detect() {
                     auto &reader_storage = it->second;
                     for (auto map_it = reader_storage.readers.begin(); map_it != reader_storage.readers.end();)
                         is_same_node(map_it->first, dead_guid) ? map_it = reader_storage.readers.erase(map_it) : ++map_it;
+                    for (auto set_it = reader_storage.multicast.begin(); set_it != reader_storage.multicast.end();)
+                        is_same_node(*set_it, dead_guid) ? set_it = reader_storage.multicast.erase(set_it) : ++set_it;
                     reader_storage.readers.empty() ? it = _discovered_readers.erase(it) : ++it;
                 }
             }
@@ -258,6 +258,8 @@ void Node::shutdown() noexcept {
     if (!_running.exchange(false, std::memory_order_acq_rel))
         return;
     sendStopMessage(_discovered_nodes, _local_writers, _local_readers);
+    for (const auto &[topic, writer] : _local_writers)
+        writer->stop();
     _local_readers.clear();
     _local_writers.clear();
     _ctx.stop();
@@ -15,6 +15,7 @@
 #pragma comment(lib, "ws2_32.lib")
 #else
 #include <arpa/inet.h>
+#include <poll.h>
 #endif
 
 #include <algorithm>
@@ -22,6 +23,7 @@
 #include <limits>
 #include <mutex>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "rmvl/core/util.hpp"
@@ -38,8 +40,13 @@ constexpr std::size_t IPV4_UDP_HEADER_SIZE = 20 + 8;
 constexpr uint32_t DEFAULT_MTU = 1500;
 constexpr uint8_t NAME_SIZE_MASK = 0x3f;
 constexpr std::string_view MTP_SHM_NOTIFY = "MSHM";
+constexpr std::string_view MTP_HEARTBEAT = "MH01";
+constexpr std::string_view MTP_NACK = "MN01";
+constexpr int MTP_SOURCE_WINDOW = 64;
+constexpr auto MTP_SOURCE_IDLE_TIMEOUT = std::chrono::seconds(30);
 
 using AssemblyMap = std::unordered_map<MTPAsmKey, MTPAsm, MTPAsmKeyHash>;
+using SourceMap = std::unordered_map<MTPSourceKey, MTPSourceState, MTPSourceKeyHash>;
 
 //! 计算 MTP 消息头部大小
 std::size_t mtp_header_size(std::string_view type, std::string_view topic) noexcept { return MTP_FIXED_HEADER_SIZE + topic.size() + type.size(); }
@@ -87,9 +94,10 @@ bool same_subnet(const std::array<uint8_t, 4> &target, const ip::Networkv4 &netw
  * @brief 获取出站数据报的 MTU
  *
  * @param[in] locator 目标定位器
+ * @param[out] address 将向目标定位器发送数据的本地接口地址，未匹配到子网时保持不变
  * @return 将向目标定位器发送数据的本地接口 MTU
  */
-uint32_t outbound_mtu(const Locator &locator) noexcept {
+uint32_t outbound_mtu(const Locator &locator, std::array<uint8_t, 4> *address = nullptr) noexcept {
     uint32_t fallback{};
     uint32_t selected{};
     uint8_t best_prefix{};
@@ -110,6 +118,8 @@ uint32_t outbound_mtu(const Locator &locator) noexcept {
                 matched = true;
                 best_prefix = current_prefix;
                 selected = iface.mtu();
+                if (address != nullptr)
+                    *address = network.address();
             }
         }
     }
@@ -148,6 +158,18 @@ void append_net_u32(std::string &data, uint32_t value) {
     data.append(reinterpret_cast<const char *>(&value), sizeof(value));
 }
 
+uint16_t read_net_u16(std::string_view data, std::size_t offset) noexcept {
+    uint16_t value{};
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return ntohs(value);
+}
+
+uint32_t read_net_u32(std::string_view data, std::size_t offset) noexcept {
+    uint32_t value{};
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return ntohl(value);
+}
+
 //! 可复用的 MTP 消息头部
 struct MTPHeader {
     std::string data;
@@ -238,6 +260,109 @@ std::optional<ParsedFragment> parse_header(std::string_view header, std::string_
     return result;
 }
 
+/**
+ * @brief 创建可靠传输控制报文的公共头部
+ *
+ * @param[in] magic 报文标识，`MH01` 为心跳，`MN01` 为 NACK
+ * @param[in] topic 话题名称
+ * @return 控制报文头部
+ */
+std::string control_header(std::string_view magic, std::string_view topic) {
+    std::string result{magic};
+    uint8_t topic_size = static_cast<uint8_t>(topic.size()) & NAME_SIZE_MASK;
+    result.append(reinterpret_cast<const char *>(&topic_size), sizeof(topic_size));
+    result.append(topic);
+    return result;
+}
+
+/**
+ * @brief 解析可靠传输控制报文的公共头部
+ *
+ * @param[in] data 控制报文
+ * @param[in] magic 期望的报文标识
+ * @param[in] topic 期望的话题名称
+ * @return 公共头部之后的报文内容，如果标识或话题不匹配，则返回 std::nullopt
+ */
+std::optional<std::string_view> parse_control(std::string_view data, std::string_view magic, std::string_view topic) noexcept {
+    if (data.size() < magic.size() + 1 || data.substr(0, magic.size()) != magic)
+        return std::nullopt;
+    auto topic_size = static_cast<std::size_t>(static_cast<uint8_t>(data[magic.size()]) & NAME_SIZE_MASK);
+    data.remove_prefix(magic.size() + 1);
+    if (topic_size != topic.size() || data.substr(0, topic_size) != topic)
+        return std::nullopt;
+    return data.substr(topic_size);
+}
+
+//! 创建心跳报文，声明写入器历史中可供重传的序列号范围 `[first, last]`
+std::string mtp_heartbeat(std::string_view topic, uint16_t first, uint16_t last) {
+    auto result = control_header(MTP_HEARTBEAT, topic);
+    append_net_u16(result, first);
+    append_net_u16(result, last);
+    return result;
+}
+
+/**
+ * @brief 创建 NACK 报文
+ *
+ * @param[in] topic 话题名称
+ * @param[in] sequence 缺失消息的序列号
+ * @param[in] bits 位图覆盖的分片数量，ID 不小于该值的分片均视为缺失，为 0 时表示整条消息缺失
+ * @param[in] bitmap 缺失分片位图，第 `i` 位为 1 表示分片 `i` 缺失
+ * @return NACK 报文
+ */
+std::string mtp_nack(std::string_view topic, uint16_t sequence, uint32_t bits, std::string_view bitmap) {
+    auto result = control_header(MTP_NACK, topic);
+    append_net_u16(result, sequence);
+    append_net_u32(result, bits);
+    result.append(bitmap);
+    return result;
+}
+
+//! 解析后的 NACK 报文
+struct ParsedNack {
+    uint16_t sequence{};       //!< 缺失消息的序列号
+    uint32_t bits{};           //!< 位图覆盖的分片数量
+    std::string_view bitmap{}; //!< 缺失分片位图
+};
+
+std::optional<ParsedNack> parse_nack(std::string_view data, std::string_view topic) noexcept {
+    auto body = parse_control(data, MTP_NACK, topic);
+    if (!body || body->size() < sizeof(uint16_t) + sizeof(uint32_t))
+        return std::nullopt;
+    ParsedNack result{read_net_u16(*body, 0), read_net_u32(*body, sizeof(uint16_t)), body->substr(sizeof(uint16_t) + sizeof(uint32_t))};
+    if (result.bits > static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()) + 1 || result.bitmap.size() != (result.bits + 7) / 8)
+        return std::nullopt;
+    return result;
+}
+
+//! 判断序列号是否早于来源接收窗口，或已在窗口内完成重组
+bool source_completed(const MTPSourceState &source, uint16_t sequence) noexcept {
+    auto diff = static_cast<int16_t>(static_cast<uint16_t>(sequence - source.base));
+    if (diff < 0)
+        return true;
+    return diff < MTP_SOURCE_WINDOW && ((source.completed >> diff) & 1U) != 0;
+}
+
+//! 标记序列号已完成重组，必要时向前滑动接收窗口
+void source_complete(MTPSourceState &source, uint16_t sequence) noexcept {
+    auto diff = static_cast<int16_t>(static_cast<uint16_t>(sequence - source.base));
+    if (diff < 0)
+        return;
+    if (diff >= MTP_SOURCE_WINDOW) {
+        auto shift = diff - (MTP_SOURCE_WINDOW - 1);
+        source.completed = shift >= MTP_SOURCE_WINDOW ? 0 : source.completed >> shift;
+        source.base = static_cast<uint16_t>(source.base + shift);
+        diff = MTP_SOURCE_WINDOW - 1;
+    }
+    source.completed |= uint64_t{1} << diff;
+}
+
+//! 移除长时间未收到数据的来源
+void removeIdleSources(SourceMap &sources, std::chrono::steady_clock::time_point now) noexcept {
+    for (auto it = sources.begin(); it != sources.end();)
+        now - it->second.updated > MTP_SOURCE_IDLE_TIMEOUT ? it = sources.erase(it) : ++it;
+}
+
 /**
  * @brief 移除指定的分片记录
  *
@@ -247,7 +372,7 @@ std::optional<ParsedFragment> parse_header(std::string_view header, std::string_
  * @return 移除后指向的迭代器，适合用于 `for` 循环中继续迭代
  */
 AssemblyMap::iterator removeAsm(AssemblyMap &asms, std::size_t &asm_bytes, AssemblyMap::iterator it) noexcept {
-    asm_bytes -= it->second.bytes;
+    asm_bytes -= it->second.total_size;
     return asms.erase(it);
 }
 
@@ -293,8 +418,78 @@ bool reserve4Memory(AssemblyMap &asms, std::size_t &asm_bytes, const MTPAsmKey &
     return true;
 }
 
+/**
+ * @brief 根据单个分片推断非末尾分片的载荷大小
+ *
+ * @param[in] total 载荷总大小
+ * @param[in] id 分片 ID
+ * @param[in] size 分片载荷大小
+ * @return 非末尾分片的载荷大小，无法仅凭该分片判定时返回 0，分片不合法时返回 std::nullopt
+ */
+std::optional<uint32_t> infer_capacity(uint32_t total, uint16_t id, uint32_t size) noexcept {
+    if (size == total)
+        return id == 0 ? std::optional<uint32_t>(size) : std::nullopt;
+    if (id == 0)
+        return size;
+    auto end = static_cast<uint64_t>(id + 1U) * size;
+    if (end == total)
+        return size;
+    if (end < total)
+        return 0U;
+    // 按自身大小排布会越过载荷末尾的分片只能是末尾分片
+    auto rest = total - size;
+    if (rest % id != 0 || rest / id < size)
+        return std::nullopt;
+    return rest / id;
+}
+
+//! 确定非末尾分片的载荷大小并初始化接收位图
+bool init_layout(MTPAsm &assembly, uint32_t capacity) {
+    std::size_t count = 1 + (static_cast<std::size_t>(assembly.total_size) - 1) / capacity;
+    if (count > static_cast<std::size_t>(std::numeric_limits<uint16_t>::max()) + 1)
+        return false;
+    assembly.capacity = capacity;
+    assembly.fragment_count = static_cast<uint32_t>(count);
+    assembly.received.assign((count + 63) / 64, 0);
+    return true;
+}
+
+//! 判断分片是否已接收
+bool fragment_received(const MTPAsm &assembly, uint32_t id) noexcept {
+    if (assembly.capacity == 0)
+        return assembly.staged && assembly.staged->first == id;
+    return id < assembly.fragment_count && ((assembly.received[id / 64] >> (id % 64)) & 1U) != 0;
+}
+
+/**
+ * @brief 将分片写入预分配的重组缓冲区
+ *
+ * @param[in,out] assembly 已确定分片大小的重组记录
+ * @param[in] id 分片 ID
+ * @param[in] payload 分片载荷
+ * @return 分片是否有效，重复且内容一致的分片同样视为有效
+ */
+bool place_fragment(MTPAsm &assembly, uint16_t id, std::string_view payload) noexcept {
+    if (id >= assembly.fragment_count)
+        return false;
+    auto offset = static_cast<std::size_t>(id) * assembly.capacity;
+    auto expected = id + 1U == assembly.fragment_count ? assembly.total_size - offset : assembly.capacity;
+    if (payload.size() != expected)
+        return false;
+    auto &word = assembly.received[id / 64];
+    auto bit = uint64_t{1} << (id % 64);
+    if ((word & bit) != 0)
+        return std::memcmp(assembly.data.data() + offset, payload.data(), expected) == 0;
+    std::memcpy(assembly.data.data() + offset, payload.data(), expected);
+    word |= bit;
+    ++assembly.received_count;
+    assembly.highest = std::max<uint32_t>(assembly.highest, id);
+    return true;
+}
+
 std::optional<std::string> accept_fragment(std::string_view header, std::string_view payload, std::string_view addr, uint16_t port,
-                                           std::string_view type, std::string_view topic, AssemblyMap &asms, std::size_t &asm_bytes) {
+                                           std::string_view type, std::string_view topic, AssemblyMap &asms, std::size_t &asm_bytes,
+                                           SourceMap &sources) {
     auto now = std::chrono::steady_clock::now();
     removeExpired(asms, asm_bytes, now);
 
@@ -302,51 +497,146 @@ std::optional<std::string> accept_fragment(std::string_view header, std::string_
     if (!parsed || parsed->total_size > para::lpss_param.MTP_REASSEMBLY_MAX_BYTES)
         return std::nullopt;
 
+    MTPSourceKey source_key{std::string(addr), port};
+    auto source_it = sources.find(source_key);
+    if (source_it == sources.end()) {
+        removeIdleSources(sources, now);
+        source_it = sources.emplace(std::move(source_key), MTPSourceState{parsed->sequence, 0, false, now}).first;
+    }
+    auto &source = source_it->second;
+    source.updated = now;
+    // 可靠来源的重传可能与原始分片同时到达，已完成的消息不再重复交付
+    if (source.reliable && source_completed(source, parsed->sequence))
+        return std::nullopt;
+
     MTPAsmKey key{std::string(addr), port, parsed->sequence};
-    auto [it, inserted] = asms.try_emplace(key, MTPAsm{parsed->total_size, {}, 0, now});
-    auto &assembly = it->second;
-    if (!inserted && assembly.total_size != parsed->total_size) {
+    auto it = asms.find(key);
+    // 单分片消息无需进入重组缓存
+    if (it == asms.end() && parsed->fragment_id == 0 && payload.size() == parsed->total_size) {
+        source_complete(source, parsed->sequence);
+        return std::string(payload);
+    }
+    if (it == asms.end()) {
+        if (!reserve4Memory(asms, asm_bytes, key, parsed->total_size))
+            return std::nullopt;
+        MTPAsm assembly{};
+        assembly.total_size = parsed->total_size;
+        assembly.data.resize(parsed->total_size);
+        it = asms.emplace(std::move(key), std::move(assembly)).first;
+        asm_bytes += parsed->total_size;
+    } else if (it->second.total_size != parsed->total_size) {
         removeAsm(asms, asm_bytes, it);
         return std::nullopt;
     }
+    auto &assembly = it->second;
     assembly.updated = now;
 
-    auto fragment = assembly.fragments.find(parsed->fragment_id);
-    if (fragment != assembly.fragments.end()) {
-        if (fragment->second != payload) {
+    if (assembly.capacity == 0) {
+        auto capacity = infer_capacity(parsed->total_size, parsed->fragment_id, static_cast<uint32_t>(payload.size()));
+        if (!capacity) {
             removeAsm(asms, asm_bytes, it);
             return std::nullopt;
         }
-    } else {
-        if (assembly.bytes + payload.size() > assembly.total_size ||
-            !reserve4Memory(asms, asm_bytes, key, payload.size())) {
+        if (*capacity == 0) {
+            if (!assembly.staged) {
+                assembly.staged.emplace(parsed->fragment_id, std::string(payload));
+                return std::nullopt;
+            }
+            if (assembly.staged->first == parsed->fragment_id) {
+                if (assembly.staged->second != payload)
+                    removeAsm(asms, asm_bytes, it);
+                return std::nullopt;
+            }
+            // 两个不同分片中 ID 较小者必然不是末尾分片
+            capacity = static_cast<uint32_t>(parsed->fragment_id < assembly.staged->first ? payload.size() : assembly.staged->second.size());
+        }
+        auto staged = std::move(assembly.staged);
+        assembly.staged.reset();
+        if (!init_layout(assembly, *capacity) || (staged && !place_fragment(assembly, staged->first, staged->second))) {
             removeAsm(asms, asm_bytes, it);
             return std::nullopt;
         }
-        assembly.fragments.emplace(parsed->fragment_id, payload);
-        assembly.bytes += payload.size();
-        asm_bytes += payload.size();
     }
+    if (!place_fragment(assembly, parsed->fragment_id, payload)) {
+        removeAsm(asms, asm_bytes, it);
+        return std::nullopt;
+    }
+    if (assembly.received_count != assembly.fragment_count)
+        return std::nullopt;
 
-    std::size_t expected_fragment{};
-    std::size_t total{};
-    for (const auto &[fragment_id, part] : assembly.fragments) {
-        if (fragment_id != expected_fragment++)
-            return std::nullopt;
-        total += part.size();
-        if (total > assembly.total_size) {
-            removeAsm(asms, asm_bytes, it);
-            return std::nullopt;
+    std::string result = std::move(assembly.data);
+    removeAsm(asms, asm_bytes, it);
+    source_complete(source, parsed->sequence);
+    return result;
+}
+
+/**
+ * @brief 处理可靠写入器的心跳，对窗口内未完成的消息生成 NACK
+ *
+ * @param[in] data 心跳报文
+ * @param[in] addr 写入器地址
+ * @param[in] port 写入器端口
+ * @param[in] topic 监听话题
+ * @param[in] asms 当前的分片记录集合
+ * @param[in,out] sources 数据来源接收状态集合
+ * @return 需要发送回写入器的 NACK 报文列表
+ */
+std::vector<std::string> accept_heartbeat(std::string_view data, std::string_view addr, uint16_t port, std::string_view topic,
+                                          const AssemblyMap &asms, SourceMap &sources) {
+    auto body = parse_control(data, MTP_HEARTBEAT, topic);
+    if (!body || body->size() != sizeof(uint16_t) * 2)
+        return {};
+    auto first = read_net_u16(*body, 0);
+    auto last = read_net_u16(*body, sizeof(uint16_t));
+    if (static_cast<int16_t>(static_cast<uint16_t>(last - first)) < 0)
+        return {};
+
+    auto now = std::chrono::steady_clock::now();
+    MTPSourceKey source_key{std::string(addr), port};
+    auto source_it = sources.find(source_key);
+    if (source_it == sources.end()) {
+        removeIdleSources(sources, now);
+        // 尚未收到该来源的任何分片，仅追补心跳声明的最新一条消息
+        source_it = sources.emplace(source_key, MTPSourceState{last, 0, true, now}).first;
+    }
+    auto &source = source_it->second;
+    source.reliable = true;
+    source.updated = now;
+
+    uint16_t start = first;
+    if (static_cast<int16_t>(static_cast<uint16_t>(source.base - start)) > 0)
+        start = source.base;
+    if (static_cast<int16_t>(static_cast<uint16_t>(last - start)) >= MTP_SOURCE_WINDOW)
+        start = static_cast<uint16_t>(last - (MTP_SOURCE_WINDOW - 1));
+
+    std::vector<std::string> nacks{};
+    for (uint16_t sequence = start; static_cast<int16_t>(static_cast<uint16_t>(last - sequence)) >= 0; ++sequence) {
+        if (source_completed(source, sequence))
+            continue;
+        auto it = asms.find(MTPAsmKey{source_key.addr, port, sequence});
+        if (it == asms.end() || (it->second.capacity == 0 && !it->second.staged) || (it->second.capacity != 0 && it->second.received_count == 0)) {
+            nacks.push_back(mtp_nack(topic, sequence, 0, {}));
+            continue;
         }
+        // 位图覆盖至已收到的最大分片 ID，其后的分片由写入器按缺失处理
+        const auto &assembly = it->second;
+        uint32_t bits = (assembly.capacity == 0 ? assembly.staged->first : assembly.highest) + 1U;
+        std::string bitmap((bits + 7) / 8, '\0');
+        for (uint32_t id = 0; id < bits; ++id)
+            if (!fragment_received(assembly, id))
+                bitmap[id / 8] = static_cast<char>(static_cast<uint8_t>(bitmap[id / 8]) | (1U << (id % 8)));
+        nacks.push_back(mtp_nack(topic, sequence, bits, bitmap));
     }
-    if (total != assembly.total_size)
-        return std::nullopt;
+    return nacks;
+}
 
+//! 拼接 `multiread` 拆分的控制报文，如果数据报不是控制报文，则返回 std::nullopt
+std::optional<std::string> control_datagram(const std::vector<std::string> &parts, std::string_view magic) {
+    if (parts.empty() || std::string_view(parts[0]).substr(0, magic.size()) != magic)
+        return std::nullopt;
     std::string result{};
-    result.reserve(total);
-    for (const auto &map : assembly.fragments)
-        result.append(map.second);
-    removeAsm(asms, asm_bytes, it);
+    for (const auto &part : parts)
+        result.append(part);
     return result;
 }
 
@@ -360,6 +650,32 @@ std::optional<std::string> read_shm_sources(std::unordered_map<Guid, MTPShmSourc
     return std::nullopt;
 }
 
+/**
+ * @brief 按目标 MTU 切分并发送指定的分片
+ *
+ * @param[in] data 完整载荷
+ * @param[in] header 当前消息的可复用 MTP 头部
+ * @param[in] capacity 单个分片的最大载荷大小
+ * @param[in] wanted 判断分片 ID 是否需要发送的谓词
+ * @param[in] send 发送回调函数
+ */
+template <typename WantedPred, typename SendCallback>
+void sendMTPFragments(std::string_view data, MTPHeader &header, std::size_t capacity, WantedPred &&wanted, SendCallback &&send) {
+    std::size_t fragment_count = data.empty() ? 1 : 1 + (data.size() - 1) / capacity;
+    std::size_t sent{};
+    for (std::size_t id = 0; id < fragment_count; ++id) {
+        if (!wanted(id))
+            continue;
+        if (sent > 0 && sent % 10 == 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(2));
+        auto offset = id * capacity;
+        auto size = std::min(capacity, data.size() - offset);
+        header.set(static_cast<uint16_t>(id), static_cast<uint16_t>(size));
+        send(header.data, data.substr(offset, size));
+        ++sent;
+    }
+}
+
 template <typename SendCallback>
 void sendMTPMessage(std::string_view data, std::string_view type, std::string_view topic, uint16_t sequence,
                     const std::vector<MTPWriterTarget> &targets, SendCallback &&send) {
@@ -382,38 +698,249 @@ void sendMTPMessage(std::string_view data, std::string_view type, std::string_vi
         }
     }
 
-    auto total_size = static_cast<uint32_t>(data.size());
-    auto header = MTPHeader::create(type, topic, sequence, total_size);
+    auto header = MTPHeader::create(type, topic, sequence, static_cast<uint32_t>(data.size()));
+    for (const auto &target : targets)
+        sendMTPFragments(data, header, fragment_capacity(target.mtu, header_size), [](std::size_t) { return true; },
+                         [&](std::string_view head, std::string_view payload) { send(target.locator, head, payload); });
+}
+
+/**
+ * @brief 计算话题的多播组定位器
+ * @details 组地址位于管理范围多播地址段 `239.254.0.0/16`，第三字节为域 ID，第四字节为话题名称的 FNV-1a 哈希折叠值，
+ *          哈希冲突的话题共享同一多播组，由读取器按 MTP 头部中的话题名称过滤
+ *
+ * @param[in] domain 域 ID
+ * @param[in] topic 话题名称
+ * @return 多播组定位器
+ */
+Locator multicast_group(uint8_t domain, std::string_view topic) noexcept {
+    uint32_t hash = 2166136261U;
+    for (unsigned char c : topic) {
+        hash ^= c;
+        hash *= 16777619U;
+    }
+    auto folded = static_cast<uint8_t>(hash ^ (hash >> 8) ^ (hash >> 16) ^ (hash >> 24));
+    return {static_cast<uint16_t>(para::lpss_param.MTP_MULTICAST_PORT_BASE + domain), {239, 254, domain, folded}};
+}
+
+//! 同一出口接口下合并发送的多播目标
+struct MTPMulticastBatch {
+    MTPWriterTarget group{};               //!< 多播组目标
+    std::vector<MTPWriterTarget> members{}; //!< 被合并的读取器目标，多播发送失败时回退为单播
+};
+
+/**
+ * @brief 将同一出口接口下已加入多播组的目标合并为多播目标
+ *
+ * @param[in,out] targets 全部 UDPv4 目标，合并后仅保留需要单播的目标
+ * @param[in] group 话题的多播组定位器，无效时不做合并
+ * @return 多播目标列表，每个出口接口至多一个
+ */
+std::vector<MTPMulticastBatch> merge_multicast_targets(std::vector<MTPWriterTarget> &targets, const Locator &group) {
+    std::vector<MTPMulticastBatch> batches{};
+    if (group.invalid())
+        return batches;
     for (const auto &target : targets) {
-        std::size_t capacity = fragment_capacity(target.mtu, header_size);
-        std::size_t fragment_count = data.empty() ? 1 : 1 + (data.size() - 1) / capacity;
-        std::size_t offset{};
-        for (std::size_t id = 0; id < fragment_count; ++id) {
-            if (id > 0 && id % 10 == 0)
-                std::this_thread::sleep_for(std::chrono::microseconds(2));
-            auto size = std::min(capacity, data.size() - offset);
-            header.set(static_cast<uint16_t>(id), static_cast<uint16_t>(size));
-            send(target.locator, header.data, data.substr(offset, size));
-            offset += size;
-        }
+        if (!target.multicast)
+            continue;
+        auto it = std::find_if(batches.begin(), batches.end(), [&](const MTPMulticastBatch &batch) { return batch.group.outbound == target.outbound; });
+        if (it == batches.end())
+            it = batches.insert(batches.end(), {{group, target.mtu, true, target.outbound}, {}});
+        it->group.mtu = std::min(it->group.mtu, target.mtu);
+        it->members.push_back(target);
     }
+    // 多播读取器过少时单播的总开销并不更高，且可避免多播组内无关主机收到数据
+    auto min_readers = std::max<std::size_t>(para::lpss_param.MTP_MULTICAST_MIN_READERS, 1);
+    batches.erase(std::remove_if(batches.begin(), batches.end(), [&](const MTPMulticastBatch &batch) { return batch.members.size() < min_readers; }),
+                  batches.end());
+    targets.erase(std::remove_if(targets.begin(), targets.end(),
+                                 [&](const MTPWriterTarget &target) {
+                                     return target.multicast && std::any_of(batches.begin(), batches.end(), [&](const MTPMulticastBatch &batch) {
+                                                return batch.group.outbound == target.outbound;
+                                            });
+                                 }),
+                  targets.end());
+    return batches;
+}
+
+//! 将定位器压缩为 64 位整数，用于索引重传计数
+uint64_t locator_key(const Locator &loc) noexcept {
+    uint64_t key{};
+    for (auto byte : loc.addr)
+        key = (key << 8) | byte;
+    return (key << 16) | loc.port;
+}
+
+//! 写入器保留的历史消息数，未指定时可靠写入器使用默认深度，仅本地暂存的写入器保留 1 条
+std::size_t history_depth(const QoS &qos) noexcept {
+    std::size_t depth = qos.depth;
+    if (depth == 0)
+        depth = qos.reliability == Reliability::Reliable ? para::lpss_param.MTP_RELIABLE_HISTORY_DEPTH : 1;
+    return std::clamp<std::size_t>(depth, 1, MTP_SOURCE_WINDOW);
+}
+
+/**
+ * @brief 等待 Socket 可读
+ *
+ * @param[in] fd Socket 描述符
+ * @param[in] timeout 最长等待时间
+ * @return 在超时前是否可读
+ */
+bool wait_readable(SocketFd fd, std::chrono::milliseconds timeout) noexcept {
+#ifdef _WIN32
+    WSAPOLLFD pfd{};
+    pfd.fd = fd;
+    pfd.events = POLLRDNORM;
+    return ::WSAPoll(&pfd, 1, static_cast<INT>(timeout.count())) > 0;
+#else
+    pollfd pfd{fd, POLLIN, 0};
+    return ::poll(&pfd, 1, static_cast<int>(timeout.count())) > 0;
+#endif
+}
+
+/**
+ * @brief 阻塞等待两个 Socket 中的任意一个可读
+ *
+ * @param[in] first 优先读取的 Socket 描述符
+ * @param[in] second 另一个 Socket 描述符
+ * @return 可读 Socket 的下标，两者均可读或等待失败时返回 0
+ */
+std::size_t wait_either_readable(SocketFd first, SocketFd second) noexcept {
+#ifdef _WIN32
+    WSAPOLLFD pfds[2]{};
+    pfds[0].fd = first;
+    pfds[0].events = POLLRDNORM;
+    pfds[1].fd = second;
+    pfds[1].events = POLLRDNORM;
+    if (::WSAPoll(pfds, 2, -1) <= 0)
+        return 0;
+#else
+    pollfd pfds[2]{{first, POLLIN, 0}, {second, POLLIN, 0}};
+    if (::poll(pfds, 2, -1) <= 0)
+        return 0;
+#endif
+    return pfds[0].revents == 0 && pfds[1].revents != 0 ? 1 : 0;
 }
 
 } // namespace
 
-DataWriterBase::DataWriterBase(const Guid &guid, std::string_view type, std::string_view topic)
-    : _guid(guid), _socket(Sender(ip::udp::v4()).create()), _type(type), _topic(topic) {}
+void DeadlineMonitor::mark() noexcept {
+    if (_deadline <= 0)
+        return;
+    auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    auto last = _last.exchange(now, std::memory_order_acq_rel);
+    if (last != 0 && now > last)
+        _missed.fetch_add(static_cast<uint64_t>((now - last) / _deadline), std::memory_order_relaxed);
+}
+
+uint64_t DeadlineMonitor::missed() const noexcept {
+    if (_deadline <= 0)
+        return 0;
+    auto missed = _missed.load(std::memory_order_relaxed);
+    auto last = _last.load(std::memory_order_acquire);
+    auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    return last != 0 && now > last ? missed + static_cast<uint64_t>((now - last) / _deadline) : missed;
+}
 
-void DataWriterBase::add(const Guid &guid, Locator loc) noexcept {
-    std::lock_guard lk(_mtx);
-    if (same_host(_guid, guid)) {
-        auto name = shm_channel_name(_guid, guid);
-        _shm_targets[guid] = {name, loc, create_shm_channel(name)};
-        _udpv4_targets.erase(guid);
-    } else {
-        _udpv4_targets[guid] = {loc, outbound_mtu(loc)};
-        _shm_targets.erase(guid);
+std::size_t MTPReassembler::header_size() const noexcept { return mtp_header_size(_type, _topic); }
+
+std::optional<std::string> MTPReassembler::fragment(std::string_view header, std::string_view payload, std::string_view addr, uint16_t port) {
+    return accept_fragment(header, payload, addr, port, _type, _topic, _asms, _asm_bytes, _sources);
+}
+
+std::vector<std::string> MTPReassembler::heartbeat(std::string_view data, std::string_view addr, uint16_t port) {
+    return accept_heartbeat(data, addr, port, _topic, _asms, _sources);
+}
+
+DataWriterBase::DataWriterBase(const Guid &guid, std::string_view type, std::string_view topic, const QoS &qos, uint8_t domain)
+    : _guid(guid), _socket(qos.reliability == Reliability::Reliable ? Listener(Endpoint(ip::udp::v4(), Endpoint::ANY_PORT)).create() : Sender(ip::udp::v4()).create()),
+      _type(type), _topic(topic), _qos(qos), _deadline(qos.deadline) {
+    if (_qos.multicast) {
+        try {
+            _socket.setOption(ip::multicast::Loopback(para::lpss_param.MTP_MULTICAST_LOOPBACK));
+            _group = multicast_group(domain, _topic);
+        } catch (const rm::Exception &) {
+            WARNING_("[LPSS MTP] Failed to configure multicast for topic '%s'; falling back to unicast", _topic.c_str());
+        }
+    }
+    // 可靠写入器需绑定端口以接收 NACK，并在后台线程中发送心跳
+    if (_qos.reliability == Reliability::Reliable)
+        _reliable_thrd = std::thread(&DataWriterBase::reliable_service, this);
+}
+
+DataWriterBase::~DataWriterBase() {
+    _running.store(false, std::memory_order_release);
+    if (_reliable_thrd.joinable()) {
+        _socket.write({127, 0, 0, 1}, Endpoint(ip::udp::v4(), _socket.endpoint().port()), std::string_view("\0", 1));
+        _reliable_thrd.join();
+    }
+}
+
+void DataWriterBase::add(const Guid &guid, Locator loc, bool multicast) noexcept {
+    bool matched{};
+    {
+        std::lock_guard lk(_mtx);
+        matched = _shm_targets.find(guid) == _shm_targets.end() && _udpv4_targets.find(guid) == _udpv4_targets.end();
+        if (same_host(_guid, guid)) {
+            auto name = shm_channel_name(_guid, guid);
+            _shm_targets[guid] = {name, loc, create_shm_channel(name)};
+            _udpv4_targets.erase(guid);
+        } else {
+            MTPWriterTarget target{loc, 1500, multicast, {}};
+            target.mtu = outbound_mtu(loc, &target.outbound);
+            _udpv4_targets[guid] = target;
+            _shm_targets.erase(guid);
+        }
+    }
+    if (matched && _qos.durability == Durability::TransientLocal)
+        replay(guid);
+}
+
+bool DataWriterBase::keep_history() const noexcept {
+    return _qos.reliability == Reliability::Reliable || _qos.durability == Durability::TransientLocal;
+}
+
+bool DataWriterBase::expired(const MTPHistory &entry, std::chrono::steady_clock::time_point now) const noexcept {
+    return _qos.lifespan.count() > 0 && now - entry.stamp > _qos.lifespan;
+}
+
+void DataWriterBase::replay(const Guid &guid) {
+    std::vector<std::pair<uint16_t, std::string>> samples{};
+    {
+        std::lock_guard lk(_history_mtx);
+        auto now = std::chrono::steady_clock::now();
+        for (const auto &entry : _history)
+            if (!expired(entry, now))
+                samples.emplace_back(entry.sequence, entry.data);
     }
+    if (samples.empty())
+        return;
+
+    std::optional<MTPWriterTarget> target{};
+    std::optional<MTPShmTarget> shm_target{};
+    {
+        std::shared_lock lk(_mtx);
+        if (auto it = _udpv4_targets.find(guid); it != _udpv4_targets.end())
+            target = it->second;
+        else if (auto shm_it = _shm_targets.find(guid); shm_it != _shm_targets.end())
+            shm_target = shm_it->second;
+    }
+    // 共享内存通道只保留最新一条消息
+    if (shm_target) {
+        if (shm_target->shm && shm_target->shm->write(samples.back().second))
+            _socket.write(shm_target->locator.addr, Endpoint(ip::udp::v4(), shm_target->locator.port), MTP_SHM_NOTIFY);
+        return;
+    }
+    if (!target)
+        return;
+    // 沿用原序列号，使可靠读取器能够对补发与重传的消息去重
+    for (const auto &[sequence, data] : samples)
+        sendMTPMessage(data, _type, _topic, sequence, {*target}, [this](const Locator &loc, std::string_view header, std::string_view payload) {
+            if (!_socket.multiwrite(loc.addr, Endpoint(ip::udp::v4(), loc.port), header, payload))
+                WARNING_("[LPSS MTP] Failed to replay an MTP UDP fragment");
+        });
+    if (_qos.reliability == Reliability::Reliable)
+        _heartbeats.store(para::lpss_param.MTP_RELIABLE_HEARTBEAT_REPEATS, std::memory_order_release);
 }
 
 void DataWriterBase::remove(const Guid &guid) noexcept {
@@ -444,16 +971,136 @@ void DataWriterBase::write(std::string data) noexcept {
     }
 
     auto sequence = _sequence.fetch_add(1, std::memory_order_relaxed);
-    sendMTPMessage(data, _type, _topic, sequence, targets, [this](const Locator &loc, std::string_view header, std::string_view payload) {
+    auto send = [this](const Locator &loc, std::string_view header, std::string_view payload) {
         if (!_socket.multiwrite(loc.addr, Endpoint(ip::udp::v4(), loc.port), header, payload))
             WARNING_("[LPSS MTP] Failed to send an MTP UDP fragment");
+    };
+    for (auto &batch : merge_multicast_targets(targets, _group)) {
+        try {
+            _socket.setOption(ip::multicast::Interface(batch.group.outbound));
+        } catch (const rm::Exception &) {
+            WARNING_("[LPSS MTP] Failed to select a multicast interface; falling back to unicast");
+            targets.insert(targets.end(), batch.members.begin(), batch.members.end());
+            continue;
+        }
+        sendMTPMessage(data, _type, _topic, sequence, {batch.group}, send);
+    }
+    sendMTPMessage(data, _type, _topic, sequence, targets, send);
+    _deadline.mark();
+
+    if (!keep_history())
+        return;
+    {
+        std::lock_guard lk(_history_mtx);
+        auto now = std::chrono::steady_clock::now();
+        _history.push_back({sequence, std::move(data), {}, now});
+        const auto depth = history_depth(_qos);
+        while (_history.size() > depth || expired(_history.front(), now))
+            _history.pop_front();
+    }
+    if (_qos.reliability != Reliability::Reliable)
+        return;
+    send_heartbeat();
+    _heartbeats.store(para::lpss_param.MTP_RELIABLE_HEARTBEAT_REPEATS, std::memory_order_release);
+}
+
+void DataWriterBase::send_heartbeat() {
+    std::string heartbeat{};
+    {
+        std::lock_guard lk(_history_mtx);
+        if (_history.empty())
+            return;
+        heartbeat = mtp_heartbeat(_topic, _history.front().sequence, _history.back().sequence);
+    }
+    std::shared_lock lk(_mtx);
+    for (const auto &[guid, target] : _udpv4_targets)
+        _socket.write(target.locator.addr, Endpoint(ip::udp::v4(), target.locator.port), heartbeat);
+}
+
+void DataWriterBase::reliable_service() {
+    const auto period = std::chrono::milliseconds(para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD);
+    auto next_heartbeat = std::chrono::steady_clock::now() + period;
+    while (_running.load(std::memory_order_acquire)) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= next_heartbeat) {
+            next_heartbeat = now + period;
+            auto remain = _heartbeats.load(std::memory_order_acquire);
+            if (remain > 0 && _heartbeats.compare_exchange_strong(remain, static_cast<uint8_t>(remain - 1), std::memory_order_acq_rel))
+                send_heartbeat();
+            continue;
+        }
+        if (!wait_readable(_socket.native_handle(), std::chrono::duration_cast<std::chrono::milliseconds>(next_heartbeat - now)))
+            continue;
+        auto [data, addr, port] = _socket.read();
+        if (!_running.load(std::memory_order_acquire))
+            break;
+        retransmit(data, addr, port);
+    }
+}
+
+void DataWriterBase::retransmit(std::string_view data, std::string_view addr, uint16_t port) {
+    auto nack = parse_nack(data, _topic);
+    if (!nack)
+        return;
+    std::optional<MTPWriterTarget> target{};
+    Locator source{port, {}};
+    if (inet_pton(AF_INET, std::string(addr).c_str(), source.addr.data()) != 1)
+        return;
+    {
+        std::shared_lock lk(_mtx);
+        for (const auto &[guid, udpv4_target] : _udpv4_targets)
+            if (udpv4_target.locator.port == source.port && udpv4_target.locator.addr == source.addr)
+                target = udpv4_target;
+    }
+    if (!target)
+        return;
+
+    std::string message{};
+    {
+        std::lock_guard lk(_history_mtx);
+        auto it = std::find_if(_history.begin(), _history.end(), [&](const MTPHistory &entry) { return entry.sequence == nack->sequence; });
+        if (it == _history.end() || expired(*it, std::chrono::steady_clock::now()))
+            return;
+        auto &count = it->retransmits[locator_key(source)];
+        if (count >= para::lpss_param.MTP_RELIABLE_MAX_RETRANSMIT)
+            return;
+        ++count;
+        message = it->data;
+    }
+
+    auto capacity = fragment_capacity(target->mtu, mtp_header_size(_type, _topic));
+    if (capacity == 0)
+        return;
+    auto header = MTPHeader::create(_type, _topic, nack->sequence, static_cast<uint32_t>(message.size()));
+    auto wanted = [&nack](std::size_t id) {
+        return id >= nack->bits || (static_cast<uint8_t>(nack->bitmap[id / 8]) >> (id % 8) & 1U) != 0;
+    };
+    sendMTPFragments(message, header, capacity, wanted, [&](std::string_view head, std::string_view payload) {
+        if (!_socket.multiwrite(target->locator.addr, Endpoint(ip::udp::v4(), target->locator.port), head, payload))
+            WARNING_("[LPSS MTP] Failed to retransmit an MTP UDP fragment");
     });
+    // 重传的分片同样可能丢失，重新开始有限次数的心跳
+    _heartbeats.store(para::lpss_param.MTP_RELIABLE_HEARTBEAT_REPEATS, std::memory_order_release);
 }
 
-DataReaderBase::DataReaderBase(const Guid &guid, std::string_view type, std::string_view topic)
-    : _guid(guid), _udpv4(Listener(Endpoint(ip::udp::v4(), Endpoint::ANY_PORT)).create()), _type(type), _topic(topic) {
+DataReaderBase::DataReaderBase(const Guid &guid, std::string_view type, std::string_view topic, const QoS &qos, uint8_t domain)
+    : _guid(guid), _udpv4(Listener(Endpoint(ip::udp::v4(), Endpoint::ANY_PORT)).create()), _type(type), _topic(topic), _reassembler(type, topic),
+      _deadline(qos.deadline) {
     auto ep = _udpv4.endpoint();
     _port = ep.port();
+    if (!qos.multicast)
+        return;
+    // 多播端口由同域的全部多播读取器共享，依赖 Listener 设置的 SO_REUSEADDR
+    auto group = multicast_group(domain, _topic);
+    char address[INET_ADDRSTRLEN]{};
+    ::inet_ntop(AF_INET, group.addr.data(), address, INET_ADDRSTRLEN);
+    try {
+        auto socket = Listener(Endpoint(ip::udp::v4(), group.port)).create();
+        socket.setOption(ip::multicast::JoinGroup(address));
+        _multicast.emplace(std::move(socket));
+    } catch (const rm::Exception &) {
+        WARNING_("[LPSS MTP] Failed to join multicast group %s:%u for topic '%s'; falling back to unicast", address, group.port, _topic.c_str());
+    }
 }
 
 void DataReaderBase::stop() noexcept {
@@ -465,9 +1112,15 @@ void DataReaderBase::stop() noexcept {
 void DataReaderBase::add(const Guid &guid) noexcept {
     if (!same_host(_guid, guid))
         return;
-    std::lock_guard lk(_shm_mtx);
-    auto name = shm_channel_name(guid, _guid);
-    _shm_sources[guid] = {name, create_shm_channel(name), 0};
+    {
+        std::lock_guard lk(_shm_mtx);
+        if (_shm_sources.find(guid) != _shm_sources.end())
+            return;
+        auto name = shm_channel_name(guid, _guid);
+        _shm_sources[guid] = {name, create_shm_channel(name), 0};
+    }
+    // 写入器可能在匹配前已写入共享内存（如本地暂存补发），其通知数据报已被丢弃，唤醒读取线程重新检查
+    _udpv4.write({127, 0, 0, 1}, Endpoint(ip::udp::v4(), _port), MTP_SHM_NOTIFY);
 }
 
 void DataReaderBase::remove(const Guid &guid) noexcept {
@@ -476,6 +1129,13 @@ void DataReaderBase::remove(const Guid &guid) noexcept {
 }
 
 std::string DataReaderBase::read() noexcept {
+    auto message = receive();
+    if (!message.empty())
+        _deadline.mark();
+    return message;
+}
+
+std::string DataReaderBase::receive() noexcept {
     while (!_stopped.load(std::memory_order_acquire)) {
         {
             std::lock_guard lk(_shm_mtx);
@@ -485,7 +1145,8 @@ std::string DataReaderBase::read() noexcept {
         }
 
         auto header_size = mtp_header_size(_type, _topic);
-        auto [parts, addr, port] = _udpv4.multiread(header_size, MAX_UDP_PAYLOAD - header_size);
+        auto &socket = _multicast && wait_either_readable(_udpv4.native_handle(), _multicast->native_handle()) == 1 ? *_multicast : _udpv4;
+        auto [parts, addr, port] = socket.multiread(header_size, MAX_UDP_PAYLOAD - header_size);
         if (_stopped.load(std::memory_order_acquire))
             return {};
         {
@@ -496,7 +1157,12 @@ std::string DataReaderBase::read() noexcept {
         }
         if (parts.size() != 2)
             continue;
-        auto message = accept_fragment(parts[0], parts[1], addr, port, _type, _topic, _asms, _asm_bytes);
+        if (auto heartbeat = control_datagram(parts, MTP_HEARTBEAT)) {
+            for (const auto &nack : _reassembler.heartbeat(*heartbeat, addr, port))
+                _udpv4.write(addr, Endpoint(ip::udp::v4(), port), nack);
+            continue;
+        }
+        auto message = _reassembler.fragment(parts[0], parts[1], addr, port);
         if (message)
             return std::move(*message);
     }
@@ -507,10 +1173,29 @@ std::string DataReaderBase::read() noexcept {
 
 namespace async {
 
-DataWriterBase::DataWriterBase(rm::async::IOContext &io_context, const Guid &guid, std::string_view type, std::string_view topic)
-    : _guid(guid), _socket(rm::async::Sender(io_context, ip::udp::v4()).create()), _type(type), _topic(topic) {}
+DataWriterBase::DataWriterBase(rm::async::IOContext &io_context, const Guid &guid, std::string_view type, std::string_view topic, const QoS &qos)
+    : _guid(guid),
+      _socket(qos.reliability == Reliability::Reliable ? rm::async::Listener(io_context, Endpoint(ip::udp::v4(), Endpoint::ANY_PORT)).create()
+                                                       : rm::async::Sender(io_context, ip::udp::v4()).create()),
+      _type(type), _topic(topic), _ctx(io_context), _qos(qos), _deadline(qos.deadline) {}
+
+void DataWriterBase::start() {
+    // 可靠写入器需绑定端口以接收 NACK，并周期发送心跳
+    if (_qos.reliability != Reliability::Reliable)
+        return;
+    co_spawn(_ctx, &DataWriterBase::reliable_service, shared_from_this());
+    co_spawn(_ctx, &DataWriterBase::heartbeat_service, shared_from_this());
+}
+
+void DataWriterBase::stop() noexcept {
+    if (!std::exchange(_running, false) || _qos.reliability != Reliability::Reliable)
+        return;
+    // 向自身发送空数据报以唤醒等待 NACK 的协程
+    static_cast<::rm::DgramSocket &>(_socket).write({127, 0, 0, 1}, Endpoint(ip::udp::v4(), _socket.endpoint().port()), std::string_view("\0", 1));
+}
 
 void DataWriterBase::add(const Guid &guid, Locator loc) noexcept {
+    const bool matched = _shm_targets.find(guid) == _shm_targets.end() && _udpv4_targets.find(guid) == _udpv4_targets.end();
     if (same_host(_guid, guid)) {
         auto name = shm_channel_name(_guid, guid);
         _shm_targets[guid] = {name, loc, create_shm_channel(name)};
@@ -519,6 +1204,10 @@ void DataWriterBase::add(const Guid &guid, Locator loc) noexcept {
         _udpv4_targets[guid] = {loc, outbound_mtu(loc)};
         _shm_targets.erase(guid);
     }
+    if (!matched || _qos.durability != Durability::TransientLocal || _history.empty())
+        return;
+    if (auto self = weak_from_this().lock())
+        co_spawn(_ctx, &DataWriterBase::replay, std::move(self), guid);
 }
 
 void DataWriterBase::remove(const Guid &guid) noexcept {
@@ -526,7 +1215,48 @@ void DataWriterBase::remove(const Guid &guid) noexcept {
     erase_endpoint_or_node(_shm_targets, guid);
 }
 
+bool DataWriterBase::keep_history() const noexcept {
+    return _qos.reliability == Reliability::Reliable || _qos.durability == Durability::TransientLocal;
+}
+
+bool DataWriterBase::expired(const MTPHistory &entry, std::chrono::steady_clock::time_point now) const noexcept {
+    return _qos.lifespan.count() > 0 && now - entry.stamp > _qos.lifespan;
+}
+
+rm::async::Task<bool> DataWriterBase::send_datagram(const Locator &loc, std::string_view head, std::string_view payload) {
+    Endpoint endpoint(ip::udp::v4(), loc.port);
+    std::vector<std::string_view> buffers{head};
+    if (!payload.empty())
+        buffers.push_back(payload);
+    if (_qos.reliability == Reliability::Reliable)
+        co_return static_cast<::rm::DgramSocket &>(_socket).multiwrite(loc.addr, endpoint, buffers);
+    co_return co_await _socket.multiwrite(loc.addr, endpoint, buffers);
+}
+
+rm::async::Task<> DataWriterBase::send_fragments(const MTPWriterTarget &target, std::string_view data, uint16_t sequence,
+                                                 uint32_t bits, std::string_view bitmap) {
+    auto capacity = fragment_capacity(target.mtu, mtp_header_size(_type, _topic));
+    if (capacity == 0)
+        co_return;
+    auto header = MTPHeader::create(_type, _topic, sequence, static_cast<uint32_t>(data.size()));
+    std::size_t fragment_count = data.empty() ? 1 : 1 + (data.size() - 1) / capacity;
+    std::size_t sent{};
+    for (std::size_t id = 0; id < fragment_count; ++id) {
+        if (!bitmap.empty() && id < bits && (static_cast<uint8_t>(bitmap[id / 8]) >> (id % 8) & 1U) == 0)
+            continue;
+        if (sent > 0 && sent % 10 == 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(2));
+        auto offset = id * capacity;
+        auto size = std::min(capacity, data.size() - offset);
+        header.set(static_cast<uint16_t>(id), static_cast<uint16_t>(size));
+        if (!(co_await send_datagram(target.locator, header.data, data.substr(offset, size))))
+            WARNING_("[LPSS MTP] Failed to send an MTP UDP fragment");
+        ++sent;
+    }
+}
+
 rm::async::Task<> DataWriterBase::write(std::string data) noexcept {
+    _deadline.mark();
     if (_sending) {
         _pending = std::move(data);
         co_return;
@@ -549,7 +1279,6 @@ rm::async::Task<> DataWriterBase::write(std::string data) noexcept {
 
             auto sequence = _sequence.fetch_add(1, std::memory_order_relaxed);
             auto header_size = mtp_header_size(_type, _topic);
-            std::string_view data_view = current;
             bool can_send = true;
             for (const auto &target : targets) {
                 auto capacity = fragment_capacity(target.mtu, header_size);
@@ -572,23 +1301,20 @@ rm::async::Task<> DataWriterBase::write(std::string data) noexcept {
                         WARNING_("[LPSS MTP] Failed to write an MTP SHM message");
                         continue;
                     }
-                    co_await _socket.write(target.locator.addr, Endpoint(ip::udp::v4(), target.locator.port), MTP_SHM_NOTIFY);
+                    co_await send_datagram(target.locator, MTP_SHM_NOTIFY);
                 }
-
-                auto total_size = static_cast<uint32_t>(current.size());
-                auto header = MTPHeader::create(_type, _topic, sequence, total_size);
-                for (const auto &target : targets) {
-                    auto capacity = fragment_capacity(target.mtu, header_size);
-                    std::size_t fragment_count = current.empty() ? 1 : 1 + (current.size() - 1) / capacity;
-                    std::size_t offset{};
-                    for (std::size_t id = 0; id < fragment_count; ++id) {
-                        if (id > 0 && id % 10 == 0)
-                            std::this_thread::sleep_for(std::chrono::microseconds(2));
-                        auto size = std::min(capacity, current.size() - offset);
-                        header.set(static_cast<uint16_t>(id), static_cast<uint16_t>(size));
-                        if (!(co_await _socket.multiwrite(target.locator.addr, Endpoint(ip::udp::v4(), target.locator.port), header.data, data_view.substr(offset, size))))
-                            WARNING_("[LPSS MTP] Failed to send an MTP UDP fragment");
-                        offset += size;
+                for (const auto &target : targets)
+                    co_await send_fragments(target, current, sequence);
+
+                if (keep_history()) {
+                    auto now = std::chrono::steady_clock::now();
+                    _history.push_back({sequence, std::move(current), {}, now});
+                    const auto depth = history_depth(_qos);
+                    while (_history.size() > depth || expired(_history.front(), now))
+                        _history.pop_front();
+                    if (_qos.reliability == Reliability::Reliable) {
+                        co_await send_heartbeat();
+                        _heartbeats = para::lpss_param.MTP_RELIABLE_HEARTBEAT_REPEATS;
                     }
                 }
             }
@@ -603,18 +1329,109 @@ rm::async::Task<> DataWriterBase::write(std::string data) noexcept {
     }
 }
 
-DataReaderBase::DataReaderBase(rm::async::IOContext &io_context, const Guid &guid, std::string_view type, std::string_view topic)
-    : _guid(guid), _udpv4(rm::async::Listener(io_context, Endpoint(ip::udp::v4(), Endpoint::ANY_PORT)).create()), _type(type), _topic(topic) {
+rm::async::Task<> DataWriterBase::replay(Guid guid) {
+    std::vector<std::pair<uint16_t, std::string>> samples{};
+    auto now = std::chrono::steady_clock::now();
+    for (const auto &entry : _history)
+        if (!expired(entry, now))
+            samples.emplace_back(entry.sequence, entry.data);
+    if (samples.empty())
+        co_return;
+
+    // 共享内存通道只保留最新一条消息
+    if (auto shm_it = _shm_targets.find(guid); shm_it != _shm_targets.end()) {
+        auto target = shm_it->second;
+        if (target.shm && target.shm->write(samples.back().second))
+            co_await send_datagram(target.locator, MTP_SHM_NOTIFY);
+        co_return;
+    }
+    auto it = _udpv4_targets.find(guid);
+    if (it == _udpv4_targets.end())
+        co_return;
+    auto target = it->second;
+    // 沿用原序列号，使可靠读取器能够对补发与重传的消息去重
+    for (const auto &[sequence, data] : samples)
+        co_await send_fragments(target, data, sequence);
+    if (_qos.reliability == Reliability::Reliable)
+        _heartbeats = para::lpss_param.MTP_RELIABLE_HEARTBEAT_REPEATS;
+}
+
+rm::async::Task<> DataWriterBase::send_heartbeat() {
+    if (_history.empty())
+        co_return;
+    auto heartbeat = mtp_heartbeat(_topic, _history.front().sequence, _history.back().sequence);
+    std::vector<Locator> locators{};
+    locators.reserve(_udpv4_targets.size());
+    for (const auto &[guid, target] : _udpv4_targets)
+        locators.push_back(target.locator);
+    for (const auto &loc : locators)
+        co_await send_datagram(loc, heartbeat);
+}
+
+rm::async::Task<> DataWriterBase::heartbeat_service() {
+    rm::async::Timer timer(_ctx);
+    while (_running) {
+        co_await timer.sleep_for(std::chrono::milliseconds(para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD));
+        if (!_running || _heartbeats == 0)
+            continue;
+        --_heartbeats;
+        co_await send_heartbeat();
+    }
+}
+
+rm::async::Task<> DataWriterBase::reliable_service() {
+    while (_running) {
+        auto [data, addr, port] = co_await _socket.read();
+        if (!_running)
+            break;
+        co_await retransmit(std::move(data), std::move(addr), port);
+    }
+}
+
+rm::async::Task<> DataWriterBase::retransmit(std::string data, std::string addr, uint16_t port) {
+    auto nack = parse_nack(data, _topic);
+    if (!nack)
+        co_return;
+    Locator source{port, {}};
+    if (inet_pton(AF_INET, addr.c_str(), source.addr.data()) != 1)
+        co_return;
+    std::optional<MTPWriterTarget> target{};
+    for (const auto &[guid, udpv4_target] : _udpv4_targets)
+        if (udpv4_target.locator.port == source.port && udpv4_target.locator.addr == source.addr)
+            target = udpv4_target;
+    if (!target)
+        co_return;
+
+    auto it = std::find_if(_history.begin(), _history.end(), [&](const MTPHistory &entry) { return entry.sequence == nack->sequence; });
+    if (it == _history.end() || expired(*it, std::chrono::steady_clock::now()))
+        co_return;
+    auto &count = it->retransmits[locator_key(source)];
+    if (count >= para::lpss_param.MTP_RELIABLE_MAX_RETRANSMIT)
+        co_return;
+    ++count;
+    // 发送期间历史可能被新消息淘汰，重传使用消息副本
+    std::string message = it->data;
+    std::string bitmap(nack->bitmap);
+    co_await send_fragments(*target, message, nack->sequence, nack->bits, nack->bits == 0 ? std::string_view{} : std::string_view(bitmap));
+    // 重传的分片同样可能丢失，重新开始有限次数的心跳
+    _heartbeats = para::lpss_param.MTP_RELIABLE_HEARTBEAT_REPEATS;
+}
+
+DataReaderBase::DataReaderBase(rm::async::IOContext &io_context, const Guid &guid, std::string_view type, std::string_view topic, const QoS &qos)
+    : _guid(guid), _udpv4(rm::async::Listener(io_context, Endpoint(ip::udp::v4(), Endpoint::ANY_PORT)).create()), _type(type), _topic(topic),
+      _reassembler(type, topic), _deadline(qos.deadline) {
     auto ep = _udpv4.endpoint();
     _port = ep.port();
 }
 
 void DataReaderBase::add(const Guid &guid) noexcept {
     _matched_writers.insert(guid);
-    if (!same_host(_guid, guid))
+    if (!same_host(_guid, guid) || _shm_sources.find(guid) != _shm_sources.end())
         return;
     auto name = shm_channel_name(guid, _guid);
     _shm_sources[guid] = {name, create_shm_channel(name), 0};
+    // 写入器可能在匹配前已写入共享内存，唤醒等待中的读取协程重新检查
+    static_cast<::rm::DgramSocket &>(_udpv4).write({127, 0, 0, 1}, Endpoint(ip::udp::v4(), _port), MTP_SHM_NOTIFY);
 }
 
 void DataReaderBase::remove(const Guid &guid) noexcept {
@@ -629,6 +1446,7 @@ rm::async::Task<std::string> DataReaderBase::read() noexcept {
         auto shm_message = read_shm_sources(_shm_sources);
         if (shm_message) {
             std::string result = std::move(*shm_message);
+            _deadline.mark();
             co_return result;
         }
 
@@ -637,13 +1455,20 @@ rm::async::Task<std::string> DataReaderBase::read() noexcept {
         shm_message = read_shm_sources(_shm_sources);
         if (shm_message) {
             std::string result = std::move(*shm_message);
+            _deadline.mark();
             co_return result;
         }
         if (parts.size() != 2)
             continue;
-        auto message = accept_fragment(parts[0], parts[1], addr, port, _type, _topic, _asms, _asm_bytes);
+        if (auto heartbeat = control_datagram(parts, MTP_HEARTBEAT)) {
+            for (const auto &nack : _reassembler.heartbeat(*heartbeat, addr, port))
+                co_await _udpv4.write(addr, Endpoint(ip::udp::v4(), port), nack);
+            continue;
+        }
+        auto message = _reassembler.fragment(parts[0], parts[1], addr, port);
         if (message) {
             std::string result = std::move(*message);
+            _deadline.mark();
             co_return result;
         }
     }
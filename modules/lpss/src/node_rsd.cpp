@@ -26,6 +26,8 @@ namespace rm::lpss {
 namespace {
 
 constexpr std::size_t LOCATOR_WIRE_SIZE = sizeof(uint16_t) + 4;
+//! REDP 动作类型字节中表示读取端点已加入多播组的标志位，旧版本解析时忽略该位
+constexpr uint8_t REDP_MULTICAST_FLAG = 0b100;
 
 void write_locator(char *data, const Locator &locator) noexcept {
     const uint16_t net_port = htons(locator.port);
@@ -98,7 +100,7 @@ std::string REDPMessage::serialize() const noexcept {
     // REDP 头部
     ::strcpy(redp_msg.data(), "ED01");
     ::memcpy(redp_msg.data() + 4, &endpoint_guid.full, sizeof(endpoint_guid.full));
-    uint8_t action_type = static_cast<uint8_t>(static_cast<uint8_t>(action) | static_cast<uint8_t>(type));
+    uint8_t action_type = static_cast<uint8_t>(static_cast<uint8_t>(action) | static_cast<uint8_t>(type) | (multicast ? REDP_MULTICAST_FLAG : 0));
     ::memcpy(redp_msg.data() + 4 + sizeof(endpoint_guid.full), &action_type, sizeof(action_type));
 
     // REDP 负载
@@ -121,6 +123,7 @@ REDPMessage REDPMessage::deserialize(const char *data) noexcept {
     ::memcpy(&action_type, data + 4 + sizeof(res.endpoint_guid.full), sizeof(action_type));
     res.action = static_cast<Action>(action_type & 0b01);
     res.type = static_cast<Type>(action_type & 0b10);
+    res.multicast = (action_type & REDP_MULTICAST_FLAG) != 0;
 
     // REDP 负载
     uint16_t net_port{};
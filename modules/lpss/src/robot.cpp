@@ -10,11 +10,10 @@
  */
 
 #include <algorithm> // for clamp in Windows
+#include <cstring>
 #include <limits>
 
-#ifndef RMVL_LPSS_WITH_KDL
 #include <cmath>
-#endif
 
 #include "rmvl/lpss/robot.hpp"
 #include "tinyxml2/tinyxml2.h"
@@ -125,6 +124,41 @@ void URDFModel::parse(std::string_view urdf_str) {
             }
         }
 
+        // 解析 <collision>，仅保留基本几何体
+        for (auto *col = elem->FirstChildElement("collision"); col; col = col->NextSiblingElement("collision")) {
+            auto *geometry = col->FirstChildElement("geometry");
+            if (!geometry)
+                continue;
+            CollisionShape shape{};
+            if (auto *box = geometry->FirstChildElement("box")) {
+                shape.type = CollisionShapeType::Box;
+                if (const char *size = box->Attribute("size"))
+                    std::sscanf(size, "%lf %lf %lf", &shape.size[0], &shape.size[1], &shape.size[2]);
+            } else if (auto *sphere = geometry->FirstChildElement("sphere")) {
+                shape.type = CollisionShapeType::Sphere;
+                sphere->QueryDoubleAttribute("radius", &shape.size[0]);
+            } else if (auto *cylinder = geometry->FirstChildElement("cylinder")) {
+                shape.type = CollisionShapeType::Cylinder;
+                cylinder->QueryDoubleAttribute("radius", &shape.size[0]);
+                cylinder->QueryDoubleAttribute("length", &shape.size[1]);
+            } else if (auto *capsule = geometry->FirstChildElement("capsule")) {
+                shape.type = CollisionShapeType::Capsule;
+                capsule->QueryDoubleAttribute("radius", &shape.size[0]);
+                capsule->QueryDoubleAttribute("length", &shape.size[1]);
+            } else
+                continue; // mesh 等非基本几何体
+            if (auto *origin = col->FirstChildElement("origin")) {
+                std::array<double, 3> xyz{}, rpy{};
+                if (const char *str = origin->Attribute("xyz"))
+                    std::sscanf(str, "%lf %lf %lf", &xyz[0], &xyz[1], &xyz[2]);
+                if (const char *str = origin->Attribute("rpy"))
+                    std::sscanf(str, "%lf %lf %lf", &rpy[0], &rpy[1], &rpy[2]);
+                shape.origin.position = {xyz[0], xyz[1], xyz[2]};
+                shape.origin.orientation = rpy2quat(rpy[0], rpy[1], rpy[2]);
+            }
+            li.collisions.push_back(shape);
+        }
+
         link_index[li.name] = links.size();
         links.push_back(std::move(li));
     }
@@ -170,6 +204,7 @@ void URDFModel::parse(std::string_view urdf_str) {
             limit->QueryDoubleAttribute("upper", &ji.upper);
             limit->QueryDoubleAttribute("velocity", &ji.max_velocity);
             limit->QueryDoubleAttribute("effort", &ji.max_effort);
+            limit->QueryDoubleAttribute("jerk", &ji.max_jerk);
             if (ji.max_velocity <= 0.0)
                 ji.max_velocity = 3.14;
         } else
@@ -403,6 +438,81 @@ int64_t estimateDuration(const double *q_start, const double *q_end, const std::
     return static_cast<int64_t>(std::ceil(t_max * 1000.0));
 }
 
+//! 可达性地图二进制格式标识与版本
+static constexpr char reachability_magic[4] = {'R', 'M', 'R', 'M'};
+static constexpr uint32_t reachability_version = 1;
+
+ReachabilityMap::ReachabilityMap(const msg::Point &origin, double resolution, const std::array<uint32_t, 3> &size)
+    : _origin(origin), _resolution(resolution), _size(size) {
+    if (!(resolution > 0.0))
+        RMVL_Error(RMVL_StsBadArg, "The resolution of the reachability map must be positive");
+    _scores.assign(static_cast<std::size_t>(size[0]) * size[1] * size[2], 0);
+}
+
+msg::Point ReachabilityMap::center(uint32_t ix, uint32_t iy, uint32_t iz) const noexcept {
+    msg::Point p{};
+    p.x = _origin.x + (ix + 0.5) * _resolution;
+    p.y = _origin.y + (iy + 0.5) * _resolution;
+    p.z = _origin.z + (iz + 0.5) * _resolution;
+    return p;
+}
+
+void ReachabilityMap::set(uint32_t ix, uint32_t iy, uint32_t iz, double score) noexcept {
+    if (ix >= _size[0] || iy >= _size[1] || iz >= _size[2])
+        return;
+    const auto idx = (static_cast<std::size_t>(iz) * _size[1] + iy) * _size[0] + ix;
+    _scores[idx] = static_cast<uint8_t>(std::lround(std::clamp(score, 0.0, 1.0) * 255.0));
+}
+
+double ReachabilityMap::score(const msg::Point &point) const noexcept {
+    if (_scores.empty())
+        return 0.0;
+    const double fx = std::floor((point.x - _origin.x) / _resolution);
+    const double fy = std::floor((point.y - _origin.y) / _resolution);
+    const double fz = std::floor((point.z - _origin.z) / _resolution);
+    if (!(fx >= 0.0 && fx < _size[0] && fy >= 0.0 && fy < _size[1] && fz >= 0.0 && fz < _size[2]))
+        return 0.0;
+    const auto idx = (static_cast<std::size_t>(fz) * _size[1] + static_cast<std::size_t>(fy)) * _size[0] + static_cast<std::size_t>(fx);
+    return _scores[idx] / 255.0;
+}
+
+std::string ReachabilityMap::serialize() const {
+    // 布局：标识 | 版本 | 原点 xyz | 分辨率 | 体素数量 xyz | 体素分数，均为本机字节序
+    const double header_f[4] = {_origin.x, _origin.y, _origin.z, _resolution};
+    std::string res(sizeof(reachability_magic) + sizeof(reachability_version) + sizeof(header_f) + sizeof(_size) + _scores.size(), '\0');
+    char *dst = res.data();
+    std::memcpy(dst, reachability_magic, sizeof(reachability_magic)), dst += sizeof(reachability_magic);
+    std::memcpy(dst, &reachability_version, sizeof(reachability_version)), dst += sizeof(reachability_version);
+    std::memcpy(dst, header_f, sizeof(header_f)), dst += sizeof(header_f);
+    std::memcpy(dst, _size.data(), sizeof(_size)), dst += sizeof(_size);
+    if (!_scores.empty())
+        std::memcpy(dst, _scores.data(), _scores.size());
+    return res;
+}
+
+ReachabilityMap ReachabilityMap::deserialize(std::string_view data) noexcept {
+    ReachabilityMap map{};
+    double header_f[4]{};
+    uint32_t version{};
+    constexpr std::size_t header_size = sizeof(reachability_magic) + sizeof(version) + sizeof(header_f) + sizeof(map._size);
+    if (data.size() < header_size || std::memcmp(data.data(), reachability_magic, sizeof(reachability_magic)) != 0)
+        return map;
+    const char *src = data.data() + sizeof(reachability_magic);
+    std::memcpy(&version, src, sizeof(version)), src += sizeof(version);
+    std::memcpy(header_f, src, sizeof(header_f)), src += sizeof(header_f);
+    std::array<uint32_t, 3> size{};
+    std::memcpy(size.data(), src, sizeof(size)), src += sizeof(size);
+    const auto count = static_cast<std::size_t>(size[0]) * size[1] * size[2];
+    if (version != reachability_version || !(header_f[3] > 0.0) || data.size() - header_size != count)
+        return map;
+
+    map._origin.x = header_f[0], map._origin.y = header_f[1], map._origin.z = header_f[2];
+    map._resolution = header_f[3];
+    map._size = size;
+    map._scores.assign(reinterpret_cast<const uint8_t *>(src), reinterpret_cast<const uint8_t *>(src) + count);
+    return map;
+}
+
 void RobotPlanner::setMaxVelocityScalingFactor(double factor) noexcept {
     _impl->velocity_scale = std::clamp(factor, 0.01, 1.0);
 }
@@ -419,6 +529,43 @@ double RobotPlanner::getMaxAccelerationScalingFactor() const noexcept {
     return _impl->acceleration_scale;
 }
 
+void RobotPlanner::setTimeParameterization(TimeParameterization method) noexcept { _impl->parameterization = method; }
+
+TimeParameterization RobotPlanner::getTimeParameterization() const noexcept { return _impl->parameterization; }
+
+std::vector<msg::JointTrajectoryPoint> RobotPlanner::Impl::timeParameterize(const std::vector<std::vector<double>> &waypoints,
+                                                                           const std::vector<const JointInfo *> &joints) const {
+    if (parameterization == TimeParameterization::TOPPRA) {
+        auto pts = parameterizeTOPPRA(waypoints, joints, velocity_scale, acceleration_scale);
+        if (!pts.empty())
+            return pts;
+    }
+    // 逐段五次多项式插值，时间参数化失败或途经点全部重合时同样回退到此方法，两种方法对静止目标的结果一致
+    std::vector<msg::JointTrajectoryPoint> res{};
+    int64_t t_offset = 0;
+    for (std::size_t k = 1; k < waypoints.size(); ++k) {
+        const int64_t duration = estimateDuration(waypoints[k - 1], waypoints[k], joints, velocity_scale, acceleration_scale);
+        auto seg = interpolate(waypoints[k - 1], waypoints[k], t_offset, duration, 20);
+        res.insert(res.end(), std::make_move_iterator(seg.begin()), std::make_move_iterator(seg.end()));
+        t_offset += duration;
+    }
+    return res;
+}
+
+void RobotPlanner::setIKOptions(const IKOptions &options) {
+    const IKOptions defaults{};
+#ifdef RMVL_LPSS_WITH_KDL
+    std::scoped_lock lock(_impl->ik_mutex, _impl->batch_mutex);
+    _impl->ik_cache.clear();
+    _impl->batch_cache.clear();
+#endif
+    _impl->ik_options.tolerance = options.tolerance > 0.0 ? options.tolerance : defaults.tolerance;
+    _impl->ik_options.max_iterations = options.max_iterations > 0 ? options.max_iterations : defaults.max_iterations;
+    _impl->ik_options.warm_start = options.warm_start;
+}
+
+const IKOptions &RobotPlanner::getIKOptions() const noexcept { return _impl->ik_options; }
+
 RobotPlanner::RobotPlanner(std::string_view urdf_path, std::string_view mesh_path) : _impl(std::make_unique<Impl>()) { load(urdf_path, mesh_path); }
 
 RobotPlanner::RobotPlanner(RobotPlanner &&) noexcept = default;
@@ -430,6 +577,10 @@ void RobotPlanner::load(std::string_view urdf_path, std::string_view mesh_path)
     if (_impl->urdf.data.empty())
         RMVL_Error_(RMVL_StsBadArg, "Failed to read URDF file: %s", urdf_path.data());
     _impl->urdf.mesh_path = mesh_path;
+#ifdef RMVL_LPSS_WITH_KDL
+    // 缓存的运动链引用旧模型中的关节，重新加载前必须丢弃
+    _impl->clearIKCache();
+#endif
     _impl->model.parse(_impl->urdf.data);
     _impl->resetJointState();
     _impl->updateTF();
@@ -459,9 +610,30 @@ msg::JointTrajectory RobotPlanner::plan(const msg::JointState &target) const {
         active_joints.push_back(&_impl->model.joints[idx]);
 
     // 起点：当前关节角；终点：目标关节角
-    const int64_t duration = estimateDuration(_impl->joint_state.position, target.position,
-                                              active_joints, _impl->velocity_scale, _impl->acceleration_scale);
-    traj.points = interpolate(_impl->joint_state.position, target.position, 0, duration, 20);
+    traj.points = _impl->timeParameterize({_impl->joint_state.position, target.position}, active_joints);
+    return traj;
+}
+
+msg::JointTrajectory RobotPlanner::plan(const std::vector<msg::JointState> &waypoints) const {
+    msg::JointTrajectory traj{};
+    traj.joint_names = _impl->joint_state.name;
+    const auto dof = _impl->joint_state.position.size();
+    if (dof == 0 || waypoints.empty())
+        return traj;
+
+    std::vector<const JointInfo *> active_joints;
+    active_joints.reserve(_impl->model.active_joint_indices.size());
+    for (auto idx : _impl->model.active_joint_indices)
+        active_joints.push_back(&_impl->model.joints[idx]);
+
+    std::vector<std::vector<double>> path{_impl->joint_state.position};
+    path.reserve(waypoints.size() + 1);
+    for (const auto &wp : waypoints) {
+        if (wp.position.size() != dof)
+            RMVL_Error_(RMVL_StsBadSize, "Waypoint dimension (%zu) does not match the joint count (%zu)", wp.position.size(), dof);
+        path.push_back(wp.position);
+    }
+    traj.points = _impl->timeParameterize(path, active_joints);
     return traj;
 }
 
@@ -495,22 +667,30 @@ msg::Pose RobotPlanner::linkpose(std::string_view link_name) const {
 }
 
 RobotController::RobotController(const std::vector<std::string> &joint_names, ctl::ControlLawBase::ptr ctl_law) : _ctl_law(std::move(ctl_law)) {
-    _ctl_joints.reserve(joint_names.size());
+    const auto dof = joint_names.size();
+    _ctl_joints.reserve(dof);
     for (const auto &name : joint_names)
         _ctl_joints.push_back({name, _ctl_joints.size()});
+
+    // 期望状态与控制律缓冲区一次性分配，采样时只覆盖数值
+    _desired.name = joint_names;
+    _desired.position.assign(dof, 0.0);
+    _desired.velocity.assign(dof, 0.0);
+    _desired.effort.assign(dof, 0.0);
+    _ctl_law->reserve(dof);
 }
 
 bool RobotController::submit(const msg::JointTrajectory &traj) {
     // 关节名校验
     if (traj.joint_names.empty() || traj.points.empty())
         return false;
-    for (auto &joint : _ctl_joints) {
-        auto it = std::find(traj.joint_names.begin(), traj.joint_names.end(), joint.name);
-        if (it == traj.joint_names.end()) {
-            _ctl_joints.clear();
+    // 名称映射在提交时一次性解析，全部校验通过后才生效，采样时仅按下标访问
+    std::vector<std::size_t> remaps(_ctl_joints.size());
+    for (std::size_t i = 0; i < _ctl_joints.size(); ++i) {
+        auto it = std::find(traj.joint_names.begin(), traj.joint_names.end(), _ctl_joints[i].name);
+        if (it == traj.joint_names.end())
             return false;
-        }
-        joint.remap = std::distance(traj.joint_names.begin(), it);
+        remaps[i] = static_cast<std::size_t>(std::distance(traj.joint_names.begin(), it));
     }
     // 时间校验
     if (!std::is_sorted(traj.points.begin(), traj.points.end(), [](const auto &a, const auto &b) {
@@ -524,6 +704,8 @@ bool RobotController::submit(const msg::JointTrajectory &traj) {
             (!pt.accelerations.empty() && pt.accelerations.size() != traj_dof) || (!pt.effort.empty() && pt.effort.size() != traj_dof))
             return false;
 
+    for (std::size_t i = 0; i < _ctl_joints.size(); ++i)
+        _ctl_joints[i].remap = remaps[i];
     _traj_cache = traj;
     _traj_cache.header.stamp = now();
     return true;
@@ -537,24 +719,47 @@ void RobotController::reset() noexcept {
 }
 
 msg::JointState RobotController::sample(const msg::JointState &feedback) noexcept {
+    msg::JointState cmd{};
+    sample(feedback, cmd);
+    return cmd;
+}
+
+//! 保持当前状态的命令：速度与力矩置零
+static void holdCommand(const msg::JointState &state, msg::JointState &command) noexcept {
+    command = state;
+    std::fill(command.velocity.begin(), command.velocity.end(), 0.0);
+    std::fill(command.effort.begin(), command.effort.end(), 0.0);
+}
+
+ctl::ControlStatus RobotController::sample(const msg::JointState &feedback, msg::JointState &command) noexcept {
     // 计算当前时间
     auto now_time = now();
     const auto to_ms = [](const msg::Time &t) noexcept {
         return static_cast<int64_t>(t.sec) * 1000 + static_cast<int64_t>(t.nsec) / 1'000'000;
     };
 
+    if (_traj_cache.points.empty()) {
+        if (feedback.name.empty()) {
+            command.name.clear();
+            command.position.clear();
+            command.velocity.clear();
+            command.effort.clear();
+            return ctl::ControlStatus::InvalidInput;
+        }
+        holdCommand(feedback, command);
+        return ctl::ControlStatus::Ok;
+    }
+
     const auto elapsed_ms = std::max<int64_t>(0, to_ms(now_time) - to_ms(_traj_cache.header.stamp));
     const auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::milliseconds(elapsed_ms)).count();
 
+    // 复用预分配的期望状态，关节名称已在构造时写入
     const auto dof = _ctl_joints.size();
-    msg::JointState desired{};
+    auto &desired = _desired;
     desired.header.stamp = now_time;
-    desired.name.reserve(dof);
-    desired.position.assign(dof, 0.0);
-    desired.velocity.assign(dof, 0.0);
-    desired.effort.assign(dof, 0.0);
-    for (const auto &joint : _ctl_joints)
-        desired.name.push_back(joint.name);
+    std::fill(desired.position.begin(), desired.position.end(), 0.0);
+    std::fill(desired.velocity.begin(), desired.velocity.end(), 0.0);
+    std::fill(desired.effort.begin(), desired.effort.end(), 0.0);
 
     const auto assign_from_point = [&](const msg::JointTrajectoryPoint &pt) {
         for (std::size_t i = 0; i < dof; ++i) {
@@ -568,22 +773,13 @@ msg::JointState RobotController::sample(const msg::JointState &feedback) noexcep
         }
     };
 
-    if (_traj_cache.points.empty()) {
-        if (!feedback.name.empty()) {
-            desired = feedback;
-            desired.velocity.assign(desired.velocity.size(), 0.0);
-            desired.effort.assign(desired.effort.size(), 0.0);
-            return desired;
-        }
-        return {};
-    }
     const auto &pts = _traj_cache.points;
     if (elapsed_ns <= pts.front().time_from_start.nanoseconds)
         assign_from_point(pts.front());
     else if (elapsed_ns >= pts.back().time_from_start.nanoseconds) {
         assign_from_point(pts.back());
-        desired.velocity.assign(desired.velocity.size(), 0.0);
-        desired.effort.assign(desired.effort.size(), 0.0);
+        std::fill(desired.velocity.begin(), desired.velocity.end(), 0.0);
+        std::fill(desired.effort.begin(), desired.effort.end(), 0.0);
     } else {
         const auto it_hi = std::upper_bound(pts.begin(), pts.end(), elapsed_ns, [](int64_t t, const msg::JointTrajectoryPoint &pt) {
             return t < pt.time_from_start.nanoseconds;
@@ -616,15 +812,11 @@ msg::JointState RobotController::sample(const msg::JointState &feedback) noexcep
     }
 
     // 应用控制律
-    msg::JointState cmd{};
     const auto ctl_time_ms = static_cast<int32_t>(std::clamp<int64_t>(elapsed_ms, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()));
-    auto res = _ctl_law->compute(desired, feedback, ctl_time_ms, cmd);
-    if (res != ctl::ControlStatus::Ok) {
-        cmd = !feedback.name.empty() ? feedback : desired;
-        cmd.effort.assign(cmd.effort.size(), 0.0);
-        cmd.velocity.assign(cmd.velocity.size(), 0.0);
-    }
-    return cmd;
+    auto res = _ctl_law->compute(desired, feedback, ctl_time_ms, command);
+    if (res != ctl::ControlStatus::Ok)
+        holdCommand(!feedback.name.empty() ? feedback : desired, command);
+    return res;
 }
 
 using namespace std::chrono_literals;
@@ -637,7 +829,7 @@ static uint32_t validatePublishPeriod(uint32_t period) {
 
 RobotStatePublisher::RobotStatePublisher(std::string_view name, Node &node, RobotPlanner &planner, uint32_t period)
     : _node(node), _planner(planner), _period(validatePublishPeriod(period)),
-      _urdf_pub(node.createPublisher<msg::URDF>(std::string(name) + "/robot_description")),
+      _urdf_pub(node.createPublisher<msg::URDF>(std::string(name) + "/robot_description", QoS::transientLocal())),
       _tf_broadcaster(name, node), _tf_static_broadcaster(name, node),
       _traj_pub(node.createPublisher<msg::JointTrajectory>(std::string(name) + "/trajectory")) {
     if (_urdf_pub.invalid() || _tf_broadcaster.invalid() || _tf_static_broadcaster.invalid() || _traj_pub.invalid())
@@ -726,7 +918,7 @@ namespace async {
 RobotStatePublisher::RobotStatePublisher(std::string_view name, Node &node, RobotPlanner &planner, uint32_t period)
     : _node(node), _planner(planner), _period(validatePublishPeriod(period)),
       _tf_broadcaster(name, node), _tf_static_broadcaster(name, node) {
-    _urdf_pub = node.createPublisher<msg::URDF>(std::string(name) + "/robot_description");
+    _urdf_pub = node.createPublisher<msg::URDF>(std::string(name) + "/robot_description", QoS::transientLocal());
     _traj_pub = node.createPublisher<msg::JointTrajectory>(std::string(name) + "/trajectory");
     if (!_urdf_pub || !_traj_pub || _urdf_pub->invalid() || _tf_broadcaster.invalid() || _tf_static_broadcaster.invalid() || _traj_pub->invalid())
         RMVL_Error(RMVL_StsError, "Failed to create publishers for RobotStatePublisher");
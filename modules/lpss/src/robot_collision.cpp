@@ -0,0 +1,624 @@
+/**
+ * @file robot_collision.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 机器人自碰撞与环境碰撞检测
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "robot_impl.hpp"
+
+namespace rm::lpss {
+
+namespace {
+
+using Vec3 = std::array<double, 3>;
+
+inline Vec3 operator+(const Vec3 &a, const Vec3 &b) noexcept { return {a[0] + b[0], a[1] + b[1], a[2] + b[2]}; }
+inline Vec3 operator-(const Vec3 &a, const Vec3 &b) noexcept { return {a[0] - b[0], a[1] - b[1], a[2] - b[2]}; }
+inline Vec3 operator-(const Vec3 &a) noexcept { return {-a[0], -a[1], -a[2]}; }
+inline Vec3 operator*(double k, const Vec3 &a) noexcept { return {k * a[0], k * a[1], k * a[2]}; }
+inline double dot(const Vec3 &a, const Vec3 &b) noexcept { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; }
+inline Vec3 cross(const Vec3 &a, const Vec3 &b) noexcept { return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]}; }
+
+//! 刚体变换，旋转矩阵按行主序存储
+struct Rigid {
+    std::array<double, 9> r{1, 0, 0, 0, 1, 0, 0, 0, 1}; //!< 旋转矩阵
+    Vec3 t{};                                          //!< 平移
+
+    Vec3 rotate(const Vec3 &v) const noexcept {
+        return {r[0] * v[0] + r[1] * v[1] + r[2] * v[2], r[3] * v[0] + r[4] * v[1] + r[5] * v[2], r[6] * v[0] + r[7] * v[1] + r[8] * v[2]};
+    }
+
+    Vec3 rotateInv(const Vec3 &v) const noexcept {
+        return {r[0] * v[0] + r[3] * v[1] + r[6] * v[2], r[1] * v[0] + r[4] * v[1] + r[7] * v[2], r[2] * v[0] + r[5] * v[1] + r[8] * v[2]};
+    }
+
+    //! 旋转矩阵第 @p i 列，即局部坐标轴在父坐标系下的方向
+    Vec3 axis(int i) const noexcept { return {r[i], r[3 + i], r[6 + i]}; }
+
+    Rigid operator*(const Rigid &rhs) const noexcept {
+        Rigid res{};
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                res.r[3 * i + j] = r[3 * i] * rhs.r[j] + r[3 * i + 1] * rhs.r[3 + j] + r[3 * i + 2] * rhs.r[6 + j];
+        res.t = rotate(rhs.t) + t;
+        return res;
+    }
+};
+
+//! 由位姿构造刚体变换，四元数为零时视为单位旋转
+Rigid toRigid(const msg::Pose &pose) noexcept {
+    Rigid res{};
+    res.t = {pose.position.x, pose.position.y, pose.position.z};
+    double w = pose.orientation.w, x = pose.orientation.x, y = pose.orientation.y, z = pose.orientation.z;
+    const double n = std::sqrt(w * w + x * x + y * y + z * z);
+    if (n < 1e-12)
+        return res;
+    w /= n, x /= n, y /= n, z /= n;
+    res.r = {1 - 2 * (y * y + z * z), 2 * (x * y - w * z), 2 * (x * z + w * y),
+             2 * (x * y + w * z), 1 - 2 * (x * x + z * z), 2 * (y * z - w * x),
+             2 * (x * z - w * y), 2 * (y * z + w * x), 1 - 2 * (x * x + y * y)};
+    return res;
+}
+
+//! 由平移与 RPY 角（固定轴 XYZ）构造刚体变换
+Rigid fromRPY(const Vec3 &xyz, const Vec3 &rpy) noexcept {
+    const double cr = std::cos(rpy[0]), sr = std::sin(rpy[0]);
+    const double cp = std::cos(rpy[1]), sp = std::sin(rpy[1]);
+    const double cy = std::cos(rpy[2]), sy = std::sin(rpy[2]);
+    Rigid res{};
+    res.r = {cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr,
+             sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr,
+             -sp, cp * sr, cp * cr};
+    res.t = xyz;
+    return res;
+}
+
+//! 绕单位轴 @p a 旋转 @p angle 的刚体变换（Rodrigues 公式）
+Rigid axisRotation(const Vec3 &a, double angle) noexcept {
+    const double c = std::cos(angle), s = std::sin(angle), v = 1 - c;
+    Rigid res{};
+    res.r = {c + a[0] * a[0] * v, a[0] * a[1] * v - a[2] * s, a[0] * a[2] * v + a[1] * s,
+             a[1] * a[0] * v + a[2] * s, c + a[1] * a[1] * v, a[1] * a[2] * v - a[0] * s,
+             a[2] * a[0] * v - a[1] * s, a[2] * a[1] * v + a[0] * s, c + a[2] * a[2] * v};
+    return res;
+}
+
+//! 轴对齐包围盒
+struct AABB {
+    Vec3 lo{}, hi{};
+
+    bool overlaps(const AABB &rhs) const noexcept {
+        return lo[0] <= rhs.hi[0] && rhs.lo[0] <= hi[0] && lo[1] <= rhs.hi[1] && rhs.lo[1] <= hi[1] && lo[2] <= rhs.hi[2] && rhs.lo[2] <= hi[2];
+    }
+
+    void merge(const AABB &rhs) noexcept {
+        for (int i = 0; i < 3; ++i)
+            lo[i] = std::min(lo[i], rhs.lo[i]), hi[i] = std::max(hi[i], rhs.hi[i]);
+    }
+};
+
+//! 世界坐标系下的凸几何体
+struct WorldShape {
+    CollisionShapeType type{}; //!< 几何体类型
+    Rigid pose{};              //!< 几何体中心位姿
+    Vec3 half{};               //!< 长方体半边长
+    double radius{};           //!< 球、圆柱、胶囊半径
+    double half_len{};         //!< 圆柱、胶囊沿局部 z 轴的半长
+    std::size_t body{};        //!< 所属物体编号，连杆在前，环境物体在后
+
+    void set(const CollisionShape &shape) noexcept {
+        type = shape.type;
+        half = {0.5 * shape.size[0], 0.5 * shape.size[1], 0.5 * shape.size[2]};
+        radius = shape.size[0];
+        half_len = 0.5 * shape.size[1];
+    }
+
+    AABB aabb() const noexcept {
+        Vec3 ext{};
+        switch (type) {
+        case CollisionShapeType::Box:
+            for (int i = 0; i < 3; ++i)
+                ext[i] = std::abs(pose.r[3 * i]) * half[0] + std::abs(pose.r[3 * i + 1]) * half[1] + std::abs(pose.r[3 * i + 2]) * half[2];
+            break;
+        case CollisionShapeType::Sphere:
+            ext = {radius, radius, radius};
+            break;
+        case CollisionShapeType::Capsule:
+            for (int i = 0; i < 3; ++i)
+                ext[i] = std::abs(pose.r[3 * i + 2]) * half_len + radius;
+            break;
+        case CollisionShapeType::Cylinder:
+            for (int i = 0; i < 3; ++i) {
+                const double a = pose.r[3 * i + 2];
+                ext[i] = std::abs(a) * half_len + radius * std::sqrt(std::max(0.0, 1.0 - a * a));
+            }
+            break;
+        }
+        return {pose.t - ext, pose.t + ext};
+    }
+
+    //! 支撑函数：几何体在方向 @p d 上的最远点
+    Vec3 support(const Vec3 &d) const noexcept {
+        switch (type) {
+        case CollisionShapeType::Box: {
+            const Vec3 l = pose.rotateInv(d);
+            return pose.t + pose.rotate({std::copysign(half[0], l[0]), std::copysign(half[1], l[1]), std::copysign(half[2], l[2])});
+        }
+        case CollisionShapeType::Sphere: {
+            const double n = std::sqrt(dot(d, d));
+            return n < 1e-12 ? pose.t : pose.t + (radius / n) * d;
+        }
+        case CollisionShapeType::Capsule: {
+            const Vec3 a = pose.axis(2);
+            const double n = std::sqrt(dot(d, d));
+            const Vec3 end = pose.t + std::copysign(half_len, dot(d, a)) * a;
+            return n < 1e-12 ? end : end + (radius / n) * d;
+        }
+        case CollisionShapeType::Cylinder: {
+            const Vec3 a = pose.axis(2);
+            const double da = dot(d, a);
+            const Vec3 radial = d - da * a;
+            const double n = std::sqrt(dot(radial, radial));
+            const Vec3 end = pose.t + std::copysign(half_len, da) * a;
+            return n < 1e-12 ? end : end + (radius / n) * radial;
+        }
+        }
+        return pose.t;
+    }
+};
+
+//! Minkowski 差 A - B 在方向 @p d 上的支撑点
+inline Vec3 support(const WorldShape &a, const WorldShape &b, const Vec3 &d) noexcept { return a.support(d) - b.support(-d); }
+
+/**
+ * @brief GJK 相交检测
+ * @details 迭代构造 Minkowski 差内逼近原点的单纯形，点按新旧顺序存放在 `pts[0..n)`
+ */
+class GJK {
+public:
+    bool intersect(const WorldShape &a, const WorldShape &b) noexcept {
+        Vec3 d = a.pose.t - b.pose.t;
+        if (dot(d, d) < 1e-18)
+            d = {1, 0, 0};
+        pts[0] = support(a, b, d);
+        n = 1;
+        d = -pts[0];
+        for (int iter = 0; iter < 64; ++iter) {
+            if (dot(d, d) < 1e-18)
+                return true;
+            const Vec3 p = support(a, b, d);
+            if (dot(p, d) < 0.0)
+                return false;
+            for (int i = n; i > 0; --i)
+                pts[i] = pts[i - 1];
+            pts[0] = p, ++n;
+            if (evolve(d))
+                return true;
+        }
+        // 未收敛时保守地视为碰撞
+        return true;
+    }
+
+private:
+    bool line(Vec3 &d) noexcept {
+        const Vec3 &a = pts[0], ab = pts[1] - a, ao = -a;
+        if (dot(ab, ao) > 0.0) {
+            d = cross(cross(ab, ao), ab);
+            // 原点位于线段上
+            if (dot(d, d) < 1e-18)
+                return true;
+        } else
+            n = 1, d = ao;
+        return false;
+    }
+
+    bool triangle(Vec3 &d) noexcept {
+        const Vec3 a = pts[0], b = pts[1], c = pts[2];
+        const Vec3 ab = b - a, ac = c - a, ao = -a, abc = cross(ab, ac);
+        if (dot(cross(abc, ac), ao) > 0.0) {
+            if (dot(ac, ao) > 0.0) {
+                pts[1] = c, n = 2;
+                d = cross(cross(ac, ao), ac);
+                return dot(d, d) < 1e-18;
+            }
+            n = 2;
+            return line(d);
+        }
+        if (dot(cross(ab, abc), ao) > 0.0) {
+            n = 2;
+            return line(d);
+        }
+        const double side = dot(abc, ao);
+        // 原点位于三角形内
+        if (std::abs(side) < 1e-18)
+            return true;
+        if (side > 0.0)
+            d = abc;
+        else
+            pts[1] = c, pts[2] = b, d = -abc;
+        return false;
+    }
+
+    bool tetrahedron(Vec3 &d) noexcept {
+        const Vec3 a = pts[0], b = pts[1], c = pts[2], e = pts[3];
+        const Vec3 ab = b - a, ac = c - a, ae = e - a, ao = -a;
+        if (dot(cross(ab, ac), ao) > 0.0) {
+            n = 3;
+            return triangle(d);
+        }
+        if (dot(cross(ac, ae), ao) > 0.0) {
+            pts[1] = c, pts[2] = e, n = 3;
+            return triangle(d);
+        }
+        if (dot(cross(ae, ab), ao) > 0.0) {
+            pts[1] = e, pts[2] = b, n = 3;
+            return triangle(d);
+        }
+        return true;
+    }
+
+    bool evolve(Vec3 &d) noexcept {
+        switch (n) {
+        case 2:
+            return line(d);
+        case 3:
+            return triangle(d);
+        default:
+            return tetrahedron(d);
+        }
+    }
+
+    std::array<Vec3, 4> pts{};
+    int n{};
+};
+
+/**
+ * @brief 静态 AABB 树
+ * @details 自顶向下沿最长轴按中位数划分，节点连续存放，叶节点仅含一个几何体
+ */
+class AABBTree {
+public:
+    //! 以 @p boxes 重建整棵树，叶节点保存其在 @p boxes 中的下标
+    void build(const std::vector<AABB> &boxes) {
+        _nodes.clear();
+        _items.resize(boxes.size());
+        for (std::size_t i = 0; i < boxes.size(); ++i)
+            _items[i] = i;
+        if (!boxes.empty())
+            buildRange(boxes, 0, boxes.size());
+    }
+
+    bool empty() const noexcept { return _nodes.empty(); }
+
+    /**
+     * @brief 枚举两棵树中包围盒相交的叶节点对
+     * @param[in] other 另一棵树，可以是自身，此时只报告不同叶节点构成的无序对
+     * @param[in] fn 回调 `bool(std::size_t, std::size_t)`，返回 `true` 时提前结束
+     * @return 是否提前结束
+     */
+    template <typename Fn>
+    bool query(const AABBTree &other, Fn &&fn) const {
+        if (empty() || other.empty())
+            return false;
+        const bool self = this == &other;
+        _stack.clear();
+        _stack.emplace_back(0, 0);
+        while (!_stack.empty()) {
+            const auto [i, j] = _stack.back();
+            _stack.pop_back();
+            const auto &a = _nodes[i], &b = other._nodes[j];
+            if (self && i == j) {
+                if (a.leaf())
+                    continue;
+                _stack.emplace_back(a.left, a.left);
+                _stack.emplace_back(a.right, a.right);
+                _stack.emplace_back(a.left, a.right);
+                continue;
+            }
+            if (!a.box.overlaps(b.box))
+                continue;
+            if (a.leaf() && b.leaf()) {
+                if (fn(a.item, b.item))
+                    return true;
+            } else if (b.leaf() || (!a.leaf() && a.count >= b.count)) {
+                _stack.emplace_back(a.left, j);
+                _stack.emplace_back(a.right, j);
+            } else {
+                _stack.emplace_back(i, b.left);
+                _stack.emplace_back(i, b.right);
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Node {
+        AABB box{};
+        uint32_t left{}, right{}; //!< 子节点下标
+        uint32_t count{};         //!< 子树中的几何体数量
+        std::size_t item{};       //!< 叶节点对应的几何体下标
+
+        bool leaf() const noexcept { return count == 1; }
+    };
+
+    uint32_t buildRange(const std::vector<AABB> &boxes, std::size_t begin, std::size_t end) {
+        const auto idx = static_cast<uint32_t>(_nodes.size());
+        _nodes.emplace_back();
+        AABB box = boxes[_items[begin]];
+        for (std::size_t k = begin + 1; k < end; ++k)
+            box.merge(boxes[_items[k]]);
+        _nodes[idx].box = box;
+        _nodes[idx].count = static_cast<uint32_t>(end - begin);
+        if (end - begin == 1) {
+            _nodes[idx].item = _items[begin];
+            return idx;
+        }
+        int axis = 0;
+        for (int k = 1; k < 3; ++k)
+            if (box.hi[k] - box.lo[k] > box.hi[axis] - box.lo[axis])
+                axis = k;
+        const std::size_t mid = (begin + end) / 2;
+        std::nth_element(_items.begin() + begin, _items.begin() + mid, _items.begin() + end, [&](std::size_t l, std::size_t r) {
+            return boxes[l].lo[axis] + boxes[l].hi[axis] < boxes[r].lo[axis] + boxes[r].hi[axis];
+        });
+        const uint32_t left = buildRange(boxes, begin, mid);
+        const uint32_t right = buildRange(boxes, mid, end);
+        _nodes[idx].left = left, _nodes[idx].right = right;
+        return idx;
+    }
+
+    std::vector<Node> _nodes{};
+    std::vector<std::size_t> _items{};
+    mutable std::vector<std::pair<uint32_t, uint32_t>> _stack{};
+};
+
+//! 单次检测使用的碰撞场景：关节递推顺序、连杆与环境几何体、允许碰撞矩阵
+class CollisionScene {
+public:
+    CollisionScene(const URDFModel &model, const std::vector<std::pair<std::string, CollisionShape>> &objects,
+                   const std::map<std::pair<std::string, std::string>, bool> &acm)
+        : _model(model), _bodies(model.links.size() + objects.size()) {
+        // 自根连杆广度优先得到关节递推顺序，保证父连杆先于子连杆
+        std::vector<std::string_view> queue{model.root_link};
+        for (std::size_t head = 0; head < queue.size(); ++head) {
+            auto it = model.children_joints.find(std::string(queue[head]));
+            if (it == model.children_joints.end())
+                continue;
+            for (auto jidx : it->second) {
+                const auto &joint = model.joints[jidx];
+                auto p = model.link_index.find(joint.parent_link), c = model.link_index.find(joint.child_link);
+                if (p == model.link_index.end() || c == model.link_index.end())
+                    continue;
+                Vec3 axis = joint.axis;
+                const double n = std::sqrt(dot(axis, axis));
+                axis = n > 1e-12 ? (1.0 / n) * axis : Vec3{0, 0, 1};
+                _chain.push_back({jidx, p->second, c->second, fromRPY(joint.origin_xyz, joint.origin_rpy), axis});
+                queue.push_back(joint.child_link);
+            }
+        }
+
+        // 连杆几何体在局部坐标系下的位姿
+        for (std::size_t l = 0; l < model.links.size(); ++l) {
+            for (const auto &shape : model.links[l].collisions) {
+                WorldShape ws{};
+                ws.set(shape);
+                ws.body = l;
+                _robot.push_back(ws);
+                _robot_local.push_back(toRigid(shape.origin));
+            }
+        }
+
+        // 环境几何体位姿固定，一次性建树
+        std::vector<AABB> env_boxes;
+        env_boxes.reserve(objects.size());
+        for (std::size_t k = 0; k < objects.size(); ++k) {
+            WorldShape ws{};
+            ws.set(objects[k].second);
+            ws.pose = toRigid(objects[k].second.origin);
+            ws.body = model.links.size() + k;
+            _env.push_back(ws);
+            env_boxes.push_back(ws.aabb());
+        }
+        _env_tree.build(env_boxes);
+
+        // 允许碰撞矩阵：直接相连的连杆默认允许，显式设置项覆盖默认值
+        std::unordered_map<std::string_view, std::size_t> body_index;
+        for (std::size_t l = 0; l < model.links.size(); ++l)
+            body_index[model.links[l].name] = l;
+        for (std::size_t k = 0; k < objects.size(); ++k)
+            body_index[objects[k].first] = model.links.size() + k;
+        _names.resize(_bodies);
+        for (const auto &[name, idx] : body_index)
+            _names[idx] = name;
+        _allowed.assign(_bodies * _bodies, 0);
+        for (const auto &link : _chain)
+            allow(link.parent, link.child, true);
+        for (const auto &[key, allowed] : acm) {
+            auto a = body_index.find(key.first), b = body_index.find(key.second);
+            if (a != body_index.end() && b != body_index.end())
+                allow(a->second, b->second, allowed);
+        }
+
+        _links.resize(model.links.size());
+        _boxes.resize(_robot.size());
+    }
+
+    //! 关节名称到模型关节下标的映射，不存在时为 `npos`
+    std::size_t jointIndex(const std::string &name) const {
+        auto it = _model.joint_index.find(name);
+        return it == _model.joint_index.end() ? npos : it->second;
+    }
+
+    /**
+     * @brief 检测一组关节位置下的碰撞
+     * @param[in] q 按模型关节顺序排列的关节位置
+     * @param[out] res 碰撞时写入碰撞物体名称
+     * @return 是否碰撞
+     */
+    bool collide(const std::vector<double> &q, CollisionResult &res) {
+        if (_robot.empty())
+            return false;
+        // 正运动学
+        if (auto it = _model.link_index.find(_model.root_link); it != _model.link_index.end())
+            _links[it->second] = Rigid{};
+        for (const auto &link : _chain) {
+            const auto &joint = _model.joints[link.joint];
+            Rigid motion{};
+            if (joint.type == JointType::Revolute || joint.type == JointType::Continuous)
+                motion = axisRotation(link.axis, q[link.joint]);
+            else if (joint.type == JointType::Prismatic)
+                motion.t = q[link.joint] * link.axis;
+            _links[link.child] = _links[link.parent] * link.origin * motion;
+        }
+        for (std::size_t k = 0; k < _robot.size(); ++k) {
+            _robot[k].pose = _links[_robot[k].body] * _robot_local[k];
+            _boxes[k] = _robot[k].aabb();
+        }
+        _robot_tree.build(_boxes);
+
+        auto narrow = [&](const WorldShape &a, const WorldShape &b) {
+            if (a.body == b.body || _allowed[a.body * _bodies + b.body])
+                return false;
+            if (!_gjk.intersect(a, b))
+                return false;
+            res.collision = true;
+            res.first = _names[a.body];
+            res.second = _names[b.body];
+            return true;
+        };
+        if (_robot_tree.query(_robot_tree, [&](std::size_t i, std::size_t j) { return narrow(_robot[i], _robot[j]); }))
+            return true;
+        return _robot_tree.query(_env_tree, [&](std::size_t i, std::size_t j) { return narrow(_robot[i], _env[j]); });
+    }
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+private:
+    void allow(std::size_t a, std::size_t b, bool allowed) noexcept {
+        _allowed[a * _bodies + b] = _allowed[b * _bodies + a] = allowed;
+    }
+
+    //! 关节递推项
+    struct ChainLink {
+        std::size_t joint;  //!< 关节下标
+        std::size_t parent; //!< 父连杆下标
+        std::size_t child;  //!< 子连杆下标
+        Rigid origin;       //!< 关节原点变换
+        Vec3 axis;          //!< 归一化关节轴
+    };
+
+    const URDFModel &_model;
+    std::size_t _bodies{};
+    std::vector<ChainLink> _chain{};
+    std::vector<WorldShape> _robot{};
+    std::vector<Rigid> _robot_local{};
+    std::vector<WorldShape> _env{};
+    AABBTree _env_tree{};
+    AABBTree _robot_tree{};
+    std::vector<std::string_view> _names{};
+    std::vector<uint8_t> _allowed{};
+    std::vector<Rigid> _links{};
+    std::vector<AABB> _boxes{};
+    GJK _gjk{};
+};
+
+} // namespace
+
+CollisionResult RobotPlanner::Impl::checkCollision(const std::vector<std::string> &names, const std::vector<const std::vector<double> *> &points, double max_step) const {
+    CollisionResult res{};
+    CollisionScene scene(model, collision_objects, collision_acm);
+
+    // 未出现在路径中的关节取当前关节状态
+    std::vector<double> base(model.joints.size(), 0.0);
+    for (std::size_t i = 0; i < joint_state.name.size() && i < joint_state.position.size(); ++i)
+        if (auto idx = scene.jointIndex(joint_state.name[i]); idx != CollisionScene::npos)
+            base[idx] = joint_state.position[i];
+    std::vector<std::size_t> remap(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i)
+        remap[i] = scene.jointIndex(names[i]);
+
+    std::vector<double> q = base;
+    auto sample = [&](const std::vector<double> &from, const std::vector<double> &to, double f) {
+        for (std::size_t i = 0; i < remap.size(); ++i)
+            if (remap[i] != CollisionScene::npos)
+                q[remap[i]] = from[i] + f * (to[i] - from[i]);
+        return scene.collide(q, res);
+    };
+
+    if (points.empty())
+        return res;
+    if (sample(*points[0], *points[0], 0.0))
+        return res;
+    max_step = std::max(max_step, 1e-6);
+    for (std::size_t k = 0; k + 1 < points.size(); ++k) {
+        const auto &from = *points[k], &to = *points[k + 1];
+        double dq_max{};
+        for (std::size_t i = 0; i < remap.size(); ++i)
+            dq_max = std::max(dq_max, std::abs(to[i] - from[i]));
+        const auto steps = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(dq_max / max_step)));
+        for (std::size_t s = 1; s <= steps; ++s) {
+            const double f = static_cast<double>(s) / steps;
+            if (sample(from, to, f)) {
+                res.segment = k;
+                res.fraction = f;
+                return res;
+            }
+        }
+    }
+    return res;
+}
+
+void RobotPlanner::addCollisionObject(std::string_view name, const CollisionShape &shape) {
+    if (_impl->model.link_index.count(std::string(name)))
+        RMVL_Error_(RMVL_StsBadArg, "Collision object \"%s\" conflicts with a link name", std::string(name).c_str());
+    auto &objects = _impl->collision_objects;
+    auto it = std::find_if(objects.begin(), objects.end(), [&](const auto &obj) { return obj.first == name; });
+    if (it != objects.end())
+        it->second = shape;
+    else
+        objects.emplace_back(std::string(name), shape);
+}
+
+bool RobotPlanner::removeCollisionObject(std::string_view name) {
+    auto &objects = _impl->collision_objects;
+    auto it = std::find_if(objects.begin(), objects.end(), [&](const auto &obj) { return obj.first == name; });
+    if (it == objects.end())
+        return false;
+    objects.erase(it);
+    return true;
+}
+
+void RobotPlanner::clearCollisionObjects() noexcept { _impl->collision_objects.clear(); }
+
+void RobotPlanner::setAllowedCollision(std::string_view first, std::string_view second, bool allowed) {
+    auto key = first < second ? std::make_pair(std::string(first), std::string(second)) : std::make_pair(std::string(second), std::string(first));
+    _impl->collision_acm[std::move(key)] = allowed;
+}
+
+CollisionResult RobotPlanner::checkCollision(const msg::JointState &state) const {
+    if (state.position.size() != state.name.size())
+        RMVL_Error_(RMVL_StsBadSize, "Joint state position size (%zu) does not match the name size (%zu)", state.position.size(), state.name.size());
+    return _impl->checkCollision(state.name, {&state.position}, 1.0);
+}
+
+CollisionResult RobotPlanner::checkCollision(const msg::JointTrajectory &traj, double max_step) const {
+    std::vector<const std::vector<double> *> points;
+    points.reserve(traj.points.size());
+    for (const auto &pt : traj.points) {
+        if (pt.positions.size() != traj.joint_names.size())
+            RMVL_Error_(RMVL_StsBadSize, "Trajectory point dimension (%zu) does not match the joint count (%zu)", pt.positions.size(), traj.joint_names.size());
+        points.push_back(&pt.positions);
+    }
+    return _impl->checkCollision(traj.joint_names, points, max_step);
+}
+
+} // namespace rm::lpss
@@ -11,10 +11,15 @@
 
 #pragma once
 
+#include <map>
+#include <mutex>
+
+#include "rmvl/core/parallel.hpp"
 #include "rmvl/lpss/robot.hpp"
 
 #ifdef RMVL_LPSS_WITH_KDL
 #include "chain.hpp"
+#include "chainiksolverpos_lma.hpp"
 #include "jntarray.hpp"
 #endif
 
@@ -41,6 +46,7 @@ struct JointInfo {
     double max_velocity{3.14};           //!< 最大关节速度 (rad/s 或 m/s)，来自 URDF `<limit velocity="...">`
     double max_effort{0};                //!< 最大关节力矩 (N·m 或 N)，来自 URDF `<limit effort="...">`
     double max_acceleration{10.0};       //!< 最大关节加速度 (rad/s² 或 m/s²)，由 effort / 转动惯量 估算，默认 10
+    double max_jerk{0};                  //!< 最大关节加加速度 (rad/s³ 或 m/s³)，来自 URDF `<limit jerk="...">`，0 表示不限制
 };
 
 //! 单个连杆描述
@@ -48,6 +54,7 @@ struct LinkInfo {
     std::string name;                                //!< 连杆名称
     double mass{0};                                  //!< 连杆质量 (kg)
     std::array<double, 6> inertia{0, 0, 0, 0, 0, 0}; //!< 惯性张量 [ixx, ixy, ixz, iyy, iyz, izz]
+    std::vector<CollisionShape> collisions{};        //!< `<collision>` 中的基本碰撞几何体
 };
 
 //! URDF 运动学模型
@@ -128,6 +135,43 @@ inline int64_t estimateDuration(const std::vector<double> &q_start, const std::v
     return estimateDuration(q_start.data(), q_end.data(), joints, velocity_scale, acceleration_scale);
 }
 
+/**
+ * @brief 基于可达性分析（TOPP-RA）的时间最优轨迹参数化
+ *
+ * @details
+ * - 以弦长为参数构造经过全部途经点的自然三次样条路径 \f$q(s)\f$，中间途经点处速度不为零；
+ * - 在路径网格上后向计算可控集 \f$\mathcal K_i\f$（\f$x=\dot s^2\f$ 的可行区间），约束为关节速度与加速度限制；
+ * - 前向贪心地在 \f$\mathcal K_{i+1}\f$ 内选取最大的路径加速度 \f$u=\ddot s\f$，加加速度限制换算为 \f$u\f$ 的变化率上界，
+ *   并以后向加加速度受限的制动曲线作为上界，二者冲突时优先保证速度与加速度约束。
+ *
+ * 复杂度 \f$O(N\cdot n^2)\f$，N 为网格点数（每段 50 个），n 为活动关节数。
+ *
+ * @param[in] waypoints 关节空间途经点（首个为起点），每个途经点的长度均为 `joints.size()`
+ * @param[in] joints 活动关节信息指针列表（仅含非 Fixed 关节）
+ * @param[in] velocity_scale 速度缩放因子 (0, 1]
+ * @param[in] acceleration_scale 加速度与加加速度缩放因子 (0, 1]
+ * @return 从 0 时刻开始的轨迹点，首末点静止，去除重合的相邻途经点后不足两个或参数化失败时返回空列表
+ */
+std::vector<msg::JointTrajectoryPoint> parameterizeTOPPRA(const std::vector<std::vector<double>> &waypoints, const std::vector<const JointInfo *> &joints,
+                                                         double velocity_scale, double acceleration_scale);
+
+#ifdef RMVL_LPSS_WITH_KDL
+//! 单条运动链的逆运动学求解器缓存
+struct IKSolverCache {
+    std::string frame{};                                 //!< 目标连杆名称
+    KDL::Chain chain{};                                  //!< 从根连杆到目标连杆的运动链，地址在缓存生命周期内保持不变
+    std::vector<const JointInfo *> path{};               //!< 从根连杆到目标连杆的关节路径
+    std::vector<const JointInfo *> active{};             //!< 路径上的活动关节
+    std::unique_ptr<KDL::ChainIkSolverPos_LMA> solver{}; //!< 绑定到 chain 的 LMA 求解器
+    KDL::JntArray seed{};                                //!< 求解初值暂存
+    KDL::JntArray last{};                                //!< 上一次成功的解
+    bool has_last{};                                     //!< last 是否有效
+};
+
+//! 单条运动链求解器缓存列表，每个实例只能被一个线程访问
+using IKSolverCaches = std::vector<std::unique_ptr<IKSolverCache>>;
+#endif // RMVL_LPSS_WITH_KDL
+
 class RobotPlanner::Impl {
 public:
     URDFModel model{};             //!< URDF 运动学模型
@@ -138,6 +182,29 @@ public:
 
     double velocity_scale{1.0};     //!< 最大速度缩放因子 (0, 1]
     double acceleration_scale{1.0}; //!< 最大加速度缩放因子 (0, 1]
+    IKOptions ik_options{};         //!< 逆运动学求解参数
+
+    TimeParameterization parameterization{TimeParameterization::Quintic}; //!< 轨迹时间参数化方法
+
+    std::vector<std::pair<std::string, CollisionShape>> collision_objects{}; //!< 环境碰撞物体，位姿相对于根连杆
+    std::map<std::pair<std::string, std::string>, bool> collision_acm{};     //!< 显式设置的允许碰撞矩阵项，键中名称按字典序排列
+
+    /**
+     * @brief 沿关节空间路径检测碰撞
+     * @param[in] names 路径各分量对应的关节名称
+     * @param[in] points 路径点，每个点的长度均为 `names.size()`
+     * @param[in] max_step 相邻采样的最大关节位移
+     * @return 碰撞检测结果
+     */
+    CollisionResult checkCollision(const std::vector<std::string> &names, const std::vector<const std::vector<double> *> &points, double max_step) const;
+
+    /**
+     * @brief 按当前时间参数化方法生成经过全部关节空间途经点的轨迹
+     * @param[in] waypoints 关节空间途经点（首个为起点）
+     * @param[in] joints 与途经点各分量对应的活动关节
+     * @return 轨迹点
+     */
+    std::vector<msg::JointTrajectoryPoint> timeParameterize(const std::vector<std::vector<double>> &waypoints, const std::vector<const JointInfo *> &joints) const;
 
     //! 根据当前 joint_state 计算并更新动态与静态 TF 树（正运动学）
     void updateTF();
@@ -155,16 +222,56 @@ public:
      */
     bool buildChain(std::string_view frame, KDL::Chain &chain, std::vector<const JointInfo *> &path) const;
 
+    /**
+     * @brief 获取目标连杆对应的求解器缓存，首次访问时构建运动链与求解器
+     * @note 调用方需独占 @p caches
+     * @param[in,out] caches 求解器缓存列表
+     * @param[in] frame 目标连杆名称
+     * @return 求解器缓存，连杆不存在或路径上没有活动关节时返回空指针
+     */
+    IKSolverCache *ikSolver(IKSolverCaches &caches, std::string_view frame) const;
+
+    //! 获取单目标求解使用的求解器缓存，调用方需持有 ik_mutex
+    IKSolverCache *ikSolver(std::string_view frame) const { return ikSolver(ik_cache, frame); }
+
+    //! 丢弃全部求解器缓存（单目标与批量）
+    void clearIKCache() const;
+
+    /**
+     * @brief 以当前关节状态填充运动链上各活动关节的位置
+     * @param[in] cache 求解器缓存
+     * @param[out] q 关节位置，长度为运动链自由度
+     */
+    void stateOf(const IKSolverCache &cache, KDL::JntArray &q) const;
+
     /**
      * @brief LMA 逆运动学求解
-     * @param[in] chain 运动链
-     * @param[in] path 关节路径
+     * @note 调用方需独占 @p cache
+     * @param[in,out] cache 求解器缓存，成功时更新上一次的解
      * @param[in] target 目标位姿
+     * @param[in] seed 指定初值，为空时按 IKOptions::warm_start 选择初值
      * @param[out] q_out 求解结果
+     * @param[in] retry 首次求解失败时是否以当前关节状态为初值重试
      * @return 是否求解成功
      */
-    bool solveIK(const KDL::Chain &chain, const std::vector<const JointInfo *> &path,
-                 const msg::Pose &target, KDL::JntArray &q_out) const;
+    bool solveIK(IKSolverCache &cache, const msg::Pose &target, const KDL::JntArray *seed, KDL::JntArray &q_out, bool retry = true) const;
+
+    /**
+     * @brief 在线程池上批量逆运动学求解
+     * @param[in] frame 目标连杆名称
+     * @param[in] targets 目标位姿数组
+     * @param[in] count 目标数量
+     * @param[in] restarts 当前关节状态初值失败后，额外尝试的均匀分布初值数量
+     * @return 批量求解结果
+     */
+    IKBatchResult solveBatch(std::string_view frame, const msg::Pose *targets, std::size_t count, std::size_t restarts) const;
+
+    mutable std::mutex ik_mutex{};    //!< 保护单目标求解器缓存
+    mutable IKSolverCaches ik_cache{}; //!< 按目标连杆缓存的单目标求解器
+
+    mutable std::mutex batch_mutex{};                  //!< 保护线程池与批量求解器缓存
+    mutable std::unique_ptr<WorkerPool> ik_pool{};     //!< 批量求解线程池，首次批量求解时创建
+    mutable std::vector<IKSolverCaches> batch_cache{}; //!< 各线程独占的求解器缓存
 #endif // RMVL_LPSS_WITH_KDL
 };
 
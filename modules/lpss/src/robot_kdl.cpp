@@ -9,6 +9,9 @@
  *
  */
 
+#include <atomic>
+#include <cmath>
+
 #include "robot_impl.hpp"
 
 #ifdef RMVL_LPSS_WITH_KDL
@@ -89,100 +92,231 @@ bool RobotPlanner::Impl::buildChain(std::string_view frame, KDL::Chain &chain, s
     return true;
 }
 
-bool RobotPlanner::Impl::solveIK(const KDL::Chain &chain,
-                                 const std::vector<const JointInfo *> &path,
-                                 const msg::Pose &target,
-                                 KDL::JntArray &q_out) const {
-    // 使用 KDL 提供的 LMA（Levenberg-Marquardt）迭代求解器：
-    //   从一个初始关节角出发，不断调整，直到末端位姿和目标足够接近
-    //   迭代最多 5000 次，精度要求 1e-5
-    const unsigned int dof = chain.getNrOfJoints();
-
-    // 以当前关节角作为IK初始值
-    std::unordered_map<std::string, double> q_map;
-    for (std::size_t i = 0; i < joint_state.name.size(); ++i)
-        q_map[joint_state.name[i]] = joint_state.position[i];
-
-    KDL::JntArray q_init(dof);
-    unsigned int qi = 0;
-    for (const auto *j : path) {
-        if (j->type != JointType::Fixed) {
-            auto it = q_map.find(j->name);
-            q_init(qi++) = (it != q_map.end()) ? it->second : 0.0;
-        }
+//! 计算 LMA 任务空间权重
+static Eigen::Matrix<double, 6, 1> taskWeights(const std::vector<const JointInfo *> &active) {
+    // DOF < 6 时默认只约束位置，忽略姿态，避免低自由度机械臂无解
+    // 但单自由度旋转链（如转台）常见需求是“只给姿态目标”，此时应启用姿态约束
+    Eigen::Matrix<double, 6, 1> L;
+    if (active.size() >= 6)
+        L = Eigen::Matrix<double, 6, 1>::Ones();
+    else if (active.size() == 1 && (active[0]->type == JointType::Revolute || active[0]->type == JointType::Continuous))
+        L << 0, 0, 0, 1, 1, 1; // 单自由度旋转链只约束姿态
+    else
+        L << 1, 1, 1, 0, 0, 0;
+    return L;
+}
+
+IKSolverCache *RobotPlanner::Impl::ikSolver(IKSolverCaches &caches, std::string_view frame) const {
+    for (const auto &cache : caches)
+        if (cache->frame == frame)
+            return cache->solver ? cache.get() : nullptr;
+
+    // 连杆不存在或没有活动关节的结果同样缓存，避免重复 DFS
+    auto cache = std::make_unique<IKSolverCache>();
+    cache->frame = frame;
+    if (buildChain(frame, cache->chain, cache->path) && cache->chain.getNrOfJoints() > 0) {
+        for (const auto *j : cache->path)
+            if (j->type != JointType::Fixed)
+                cache->active.push_back(j);
+        const unsigned int dof = cache->chain.getNrOfJoints();
+        cache->solver = std::make_unique<KDL::ChainIkSolverPos_LMA>(cache->chain, taskWeights(cache->active),
+                                                                    ik_options.tolerance, ik_options.max_iterations);
+        cache->seed.resize(dof);
+        cache->last.resize(dof);
     }
+    caches.push_back(std::move(cache));
+    return caches.back()->solver ? caches.back().get() : nullptr;
+}
+
+void RobotPlanner::Impl::clearIKCache() const {
+    std::scoped_lock lock(ik_mutex, batch_mutex);
+    ik_cache.clear();
+    batch_cache.clear();
+}
+
+void RobotPlanner::Impl::stateOf(const IKSolverCache &cache, KDL::JntArray &q) const {
+    const auto &names = joint_state.name;
+    for (std::size_t i = 0; i < cache.active.size(); ++i) {
+        const auto it = std::find(names.begin(), names.end(), cache.active[i]->name);
+        const auto idx = static_cast<std::size_t>(std::distance(names.begin(), it));
+        q(static_cast<unsigned int>(i)) = idx < joint_state.position.size() ? joint_state.position[idx] : 0.0;
+    }
+}
 
+bool RobotPlanner::Impl::solveIK(IKSolverCache &cache, const msg::Pose &target, const KDL::JntArray *seed, KDL::JntArray &q_out, bool retry) const {
     // 将目标位姿从msg::Pose 转换为 KDL::Frame
     const auto &p = target.position;
     const auto &q = target.orientation;
-    KDL::Frame t_goal(KDL::Rotation::Quaternion(q.x, q.y, q.z, q.w),
-                      KDL::Vector(p.x, p.y, p.z));
+    const KDL::Frame t_goal(KDL::Rotation::Quaternion(q.x, q.y, q.z, q.w), KDL::Vector(p.x, p.y, p.z));
+    q_out.resize(cache.chain.getNrOfJoints());
+
+    // 初值优先级：显式初值 > 上一次的解（warm start） > 当前关节状态，前者失败时再以当前关节状态重试
+    const KDL::JntArray *first = seed;
+    if (first == nullptr && ik_options.warm_start && cache.has_last)
+        first = &cache.last;
+    if (first != nullptr && cache.solver->CartToJnt(*first, t_goal, q_out) >= 0) {
+        cache.last = q_out;
+        cache.has_last = true;
+        return true;
+    }
+    if (first != nullptr && !retry)
+        return false;
+    stateOf(cache, cache.seed);
+    if (cache.solver->CartToJnt(cache.seed, t_goal, q_out) < 0)
+        return false;
+    cache.last = q_out;
+    cache.has_last = true;
+    return true;
+}
 
-    // DOF < 6 时默认只约束位置，忽略姿态，避免低自由度机械臂无解
-    // 但单自由度旋转链（如转台）常见需求是“只给姿态目标”，此时应启用姿态约束
-    Eigen::Matrix<double, 6, 1> L;
-    if (dof >= 6) {
-        L = Eigen::Matrix<double, 6, 1>::Ones();
-    } else {
-        bool single_rotational_dof = (dof == 1);
-        if (single_rotational_dof) {
-            for (const auto *j : path) {
-                if (j->type == JointType::Fixed)
-                    continue;
-                if (j->type != JointType::Revolute && j->type != JointType::Continuous) {
-                    single_rotational_dof = false;
+msg::JointState RobotPlanner::solveIK(std::string_view frame, const msg::Pose &target) const {
+    msg::JointState result{};
+    std::lock_guard lock(_impl->ik_mutex);
+    auto *cache = _impl->ikSolver(frame);
+    KDL::JntArray q_out;
+    if (cache == nullptr || !_impl->solveIK(*cache, target, nullptr, q_out))
+        return result;
+
+    const auto dof = cache->active.size();
+    result.name.reserve(dof);
+    for (const auto *j : cache->active)
+        result.name.push_back(j->name);
+    result.position.assign(q_out.data.data(), q_out.data.data() + dof);
+    result.velocity.assign(dof, 0.0);
+    result.effort.assign(dof, 0.0);
+    return result;
+}
+
+IKBatchResult RobotPlanner::Impl::solveBatch(std::string_view frame, const msg::Pose *targets, std::size_t count, std::size_t restarts) const {
+    IKBatchResult result{};
+    std::lock_guard lock(batch_mutex);
+    if (ik_pool == nullptr) {
+        const std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        ik_pool = std::make_unique<WorkerPool>(threads - 1);
+    }
+    batch_cache.resize(ik_pool->size());
+
+    // 由 0 号线程的缓存确认运动链存在，其余线程在各自的缓存中独立构建求解器
+    const auto *probe = ikSolver(batch_cache[0], frame);
+    if (probe == nullptr)
+        return result;
+    const std::size_t dof = probe->active.size();
+    result.joint_names.reserve(dof);
+    for (const auto *j : probe->active)
+        result.joint_names.push_back(j->name);
+    result.positions.assign(count * dof, 0.0);
+    result.success.assign(count, 0);
+    if (count == 0)
+        return result;
+
+    // 首个初值为当前关节状态，其余初值在关节限位内（无限位时在整周内）均匀分布，求解结果与线程调度无关
+    std::vector<KDL::JntArray> seeds(restarts + 1, KDL::JntArray(static_cast<unsigned int>(dof)));
+    stateOf(*probe, seeds[0]);
+    for (std::size_t k = 1; k <= restarts; ++k) {
+        const double ratio = static_cast<double>(k) / static_cast<double>(restarts + 1);
+        for (std::size_t i = 0; i < dof; ++i) {
+            const auto *j = probe->active[i];
+            const auto row = static_cast<unsigned int>(i);
+            seeds[k](row) = j->upper > j->lower ? j->lower + (j->upper - j->lower) * ratio : seeds[0](row) + 2 * KDL::PI * ratio;
+        }
+    }
+
+    // 以小批量动态领取任务，平衡各目标迭代次数差异带来的负载不均
+    constexpr std::size_t grain = 8;
+    std::atomic_size_t next{0};
+    ik_pool->run([&](std::size_t worker) {
+        auto *cache = ikSolver(batch_cache[worker], frame);
+        KDL::JntArray q_out(static_cast<unsigned int>(dof));
+        for (std::size_t begin = next.fetch_add(grain); begin < count; begin = next.fetch_add(grain)) {
+            const std::size_t end = std::min(begin + grain, count);
+            for (std::size_t i = begin; i < end; ++i) {
+                for (const auto &seed : seeds) {
+                    if (!solveIK(*cache, targets[i], &seed, q_out, false))
+                        continue;
+                    std::copy_n(q_out.data.data(), dof, result.positions.data() + i * dof);
+                    result.success[i] = 1;
                     break;
                 }
             }
         }
-        if (single_rotational_dof)
-            L << 0, 0, 0, 1, 1, 1; // 单自由度旋转链只约束姿态
-        else
-            L << 1, 1, 1, 0, 0, 0;
+    });
+    return result;
+}
+
+IKBatchResult RobotPlanner::solveIKBatch(std::string_view frame, const msg::Pose *targets, std::size_t count) const {
+    return _impl->solveBatch(frame, targets, count, 0);
+}
+
+ReachabilityMap RobotPlanner::buildReachabilityMap(std::string_view frame, const ReachabilityOptions &options) const {
+    const double res = options.resolution;
+    if (!(res > 0.0))
+        RMVL_Error(RMVL_StsBadArg, "The resolution of the reachability map must be positive");
+    const auto cells = [res](double lo, double hi) {
+        return hi > lo ? static_cast<uint32_t>(std::ceil((hi - lo) / res - 1e-9)) : 0u;
+    };
+    const std::array<uint32_t, 3> size{cells(options.min.x, options.max.x),
+                                       cells(options.min.y, options.max.y),
+                                       cells(options.min.z, options.max.z)};
+    ReachabilityMap map(options.min, res, size);
+
+    std::vector<msg::Quaternion> identity(1);
+    identity[0].w = 1.0;
+    const auto &orientations = options.orientations.empty() ? identity : options.orientations;
+    const std::size_t n_ori = orientations.size();
+
+    // 按体素分块生成目标，控制单次批量求解的内存占用
+    constexpr std::size_t block = 1024;
+    const std::size_t total = static_cast<std::size_t>(size[0]) * size[1] * size[2];
+    std::vector<msg::Pose> targets;
+    targets.reserve(std::min(total, block) * n_ori);
+    for (std::size_t first = 0; first < total; first += block) {
+        const std::size_t last = std::min(first + block, total);
+        targets.clear();
+        for (std::size_t v = first; v < last; ++v) {
+            msg::Pose pose{};
+            pose.position = map.center(static_cast<uint32_t>(v % size[0]), static_cast<uint32_t>(v / size[0] % size[1]),
+                                       static_cast<uint32_t>(v / size[0] / size[1]));
+            for (const auto &q : orientations) {
+                pose.orientation = q;
+                targets.push_back(pose);
+            }
+        }
+        const auto solved = _impl->solveBatch(frame, targets.data(), targets.size(), options.restarts);
+        if (solved.success.empty())
+            return map;
+        for (std::size_t v = first; v < last; ++v) {
+            const auto *hit = solved.success.data() + (v - first) * n_ori;
+            const auto reached = std::count(hit, hit + n_ori, uint8_t{1});
+            map.set(static_cast<uint32_t>(v % size[0]), static_cast<uint32_t>(v / size[0] % size[1]),
+                    static_cast<uint32_t>(v / size[0] / size[1]), static_cast<double>(reached) / static_cast<double>(n_ori));
+        }
     }
-    KDL::ChainIkSolverPos_LMA ik_solver(chain, L, 1e-5, 5000);
-    q_out.resize(dof);
-    return ik_solver.CartToJnt(q_init, t_goal, q_out) >= 0;
+    return map;
 }
 
 msg::JointTrajectory RobotPlanner::plan(std::string_view frame, const msg::Pose &target) const {
     msg::JointTrajectory traj;
     traj.joint_names = _impl->joint_state.name;
 
-    // 从URDF建运动链，找不到目标连杆则返回空轨迹
-    KDL::Chain chain{};
-    std::vector<const JointInfo *> path{};
-    if (!_impl->buildChain(frame, chain, path) || chain.getNrOfJoints() == 0)
+    // 从缓存获取运动链与求解器，找不到目标连杆则返回空轨迹
+    std::lock_guard lock(_impl->ik_mutex);
+    auto *cache = _impl->ikSolver(frame);
+    if (cache == nullptr)
         return traj;
 
+    // 起点为当前关节角，并作为 IK 的显式初值，使目标解与轨迹起点处于同一分支，不受 warm start 影响
+    const unsigned int dof = cache->chain.getNrOfJoints();
+    KDL::JntArray q_start(dof);
+    _impl->stateOf(*cache, q_start);
+
     // IK求解目标关节角，失败则返回空轨迹
     KDL::JntArray q_out;
-    if (!_impl->solveIK(chain, path, target, q_out))
+    if (!_impl->solveIK(*cache, target, &q_start, q_out))
         return traj;
 
-    // 起点为当前关节角
-    const unsigned int dof = q_out.rows();
-    KDL::JntArray q_start(dof);
-    unsigned int qi = 0;
-    for (const auto *j : path) {
-        if (j->type != JointType::Fixed) {
-            auto it = std::find(_impl->joint_state.name.begin(),
-                                _impl->joint_state.name.end(), j->name);
-            q_start(qi++) = (it != _impl->joint_state.name.end())
-                                ? _impl->joint_state.position[std::distance(
-                                      _impl->joint_state.name.begin(), it)]
-                                : 0.0;
-        }
-    }
-    // 收集路径上的活动关节信息用于时间估算
-    std::vector<const JointInfo *> active_path;
-    for (const auto *j : path)
-        if (j->type != JointType::Fixed)
-            active_path.push_back(j);
-
-    const int64_t duration = estimateDuration(q_start.data.data(), q_out.data.data(),
-                                              active_path, _impl->velocity_scale, _impl->acceleration_scale);
-    traj.points = interpolate(q_start.data.data(), q_out.data.data(), dof, 0, duration, 20);
+    traj.points = _impl->timeParameterize({std::vector<double>(q_start.data.data(), q_start.data.data() + dof),
+                                           std::vector<double>(q_out.data.data(), q_out.data.data() + dof)},
+                                          cache->active);
     return traj;
 }
 
@@ -190,44 +324,29 @@ msg::JointTrajectory RobotPlanner::plan(std::string_view frame, const std::vecto
     msg::JointTrajectory traj;
     traj.joint_names = _impl->joint_state.name;
 
-    KDL::Chain chain;
-    std::vector<const JointInfo *> path;
-    if (!_impl->buildChain(frame, chain, path) || chain.getNrOfJoints() == 0)
+    std::lock_guard lock(_impl->ik_mutex);
+    auto *cache = _impl->ikSolver(frame);
+    if (cache == nullptr)
         return traj;
 
     // 初始化起点为当前关节角
-    const unsigned int dof = chain.getNrOfJoints();
+    const unsigned int dof = cache->chain.getNrOfJoints();
     KDL::JntArray q_prev(dof);
-    unsigned int qi = 0;
-    for (const auto *j : path)
-        if (j->type != JointType::Fixed) {
-            auto it = std::find(_impl->joint_state.name.begin(), _impl->joint_state.name.end(), j->name);
-            q_prev(qi++) = (it != _impl->joint_state.name.end())
-                               ? _impl->joint_state.position[std::distance(
-                                     _impl->joint_state.name.begin(), it)]
-                               : 0.0;
-        }
+    _impl->stateOf(*cache, q_prev);
 
-    // 收集路径上的活动关节信息用于时间估算
-    std::vector<const JointInfo *> active_path;
-    for (const auto *j : path)
-        if (j->type != JointType::Fixed)
-            active_path.push_back(j);
-
-    // 逐段 IK + 插值，每段自动估算时长，时间戳累加
-    int64_t t_offset = 0;
+    // 逐个途经点 IK，每个以上一途经点的解作为初值，任意一个失败则只规划已求解的部分
+    std::vector<std::vector<double>> path{std::vector<double>(q_prev.data.data(), q_prev.data.data() + dof)};
+    path.reserve(waypoints.size() + 1);
+    KDL::JntArray q_curr(dof);
     for (const auto &wp : waypoints) {
-        KDL::JntArray q_curr;
-        if (!_impl->solveIK(chain, path, wp, q_curr))
-            return traj; // 任意一段 IK 失败则返回已有部分
-        const int64_t seg_duration = estimateDuration(q_prev.data.data(), q_curr.data.data(),
-                                                      active_path, _impl->velocity_scale, _impl->acceleration_scale);
-        auto seg_traj = interpolate(q_prev.data.data(), q_curr.data.data(), dof, t_offset, seg_duration, 20);
-        traj.points.insert(traj.points.end(), std::make_move_iterator(seg_traj.begin()), std::make_move_iterator(seg_traj.end()));
+        if (!_impl->solveIK(*cache, wp, &q_prev, q_curr))
+            break;
+        path.emplace_back(q_curr.data.data(), q_curr.data.data() + dof);
         q_prev = q_curr;
-        t_offset += seg_duration;
     }
 
+    // 按当前时间参数化方法生成轨迹，五次多项式插值时各段时长自动估算并首尾拼接
+    traj.points = _impl->timeParameterize(path, cache->active);
     return traj;
 }
 
@@ -245,6 +364,24 @@ msg::JointTrajectory RobotPlanner::plan(std::string_view frame, const std::vecto
     return {};
 }
 
+msg::JointState RobotPlanner::solveIK(std::string_view, const msg::Pose &) const {
+    RMVL_Error(RMVL_StsBadFunc, "this function must be used with Eigen3, please recompile RMVL "
+                                "by setting \"WITH_EIGEN3=ON\" or \"BUILD_EIGEN3=ON\" in CMake");
+    return {};
+}
+
+IKBatchResult RobotPlanner::solveIKBatch(std::string_view, const msg::Pose *, std::size_t) const {
+    RMVL_Error(RMVL_StsBadFunc, "this function must be used with Eigen3, please recompile RMVL "
+                                "by setting \"WITH_EIGEN3=ON\" or \"BUILD_EIGEN3=ON\" in CMake");
+    return {};
+}
+
+ReachabilityMap RobotPlanner::buildReachabilityMap(std::string_view, const ReachabilityOptions &) const {
+    RMVL_Error(RMVL_StsBadFunc, "this function must be used with Eigen3, please recompile RMVL "
+                                "by setting \"WITH_EIGEN3=ON\" or \"BUILD_EIGEN3=ON\" in CMake");
+    return {};
+}
+
 #endif
 
 } // namespace rm::lpss
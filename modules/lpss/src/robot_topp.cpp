@@ -0,0 +1,360 @@
+/**
+ * @file robot_topp.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 基于可达性分析的时间最优轨迹参数化（TOPP-RA）
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "robot_impl.hpp"
+
+namespace rm::lpss {
+
+namespace {
+
+constexpr double inf = std::numeric_limits<double>::infinity();
+
+//! 以弦长为参数、经过全部途经点的自然三次样条路径 \f$q(s)\f$
+class SplinePath {
+public:
+    //! 途经点需去重且至少 2 个，按行存储
+    SplinePath(const std::vector<std::vector<double>> &waypoints) : _dof(waypoints.front().size()) {
+        const std::size_t n = waypoints.size() - 1;
+        _knots.assign(n + 1, 0.0);
+        _y.reserve((n + 1) * _dof);
+        for (const auto &wp : waypoints)
+            _y.insert(_y.end(), wp.begin(), wp.end());
+        for (std::size_t k = 1; k <= n; ++k) {
+            double d2 = 0.0;
+            for (std::size_t j = 0; j < _dof; ++j) {
+                const double d = waypoints[k][j] - waypoints[k - 1][j];
+                d2 += d * d;
+            }
+            _knots[k] = _knots[k - 1] + std::sqrt(d2);
+        }
+
+        // 自然边界条件 M_0 = M_n = 0，内部节点的三对角方程组对所有关节共用，用追赶法求解
+        _m.assign((n + 1) * _dof, 0.0);
+        if (n < 2)
+            return;
+        std::vector<double> c(n + 1, 0.0), d(n + 1, 0.0);
+        for (std::size_t j = 0; j < _dof; ++j) {
+            for (std::size_t k = 1; k < n; ++k) {
+                const double h0 = _knots[k] - _knots[k - 1], h1 = _knots[k + 1] - _knots[k];
+                const double rhs = 6.0 * ((y(k + 1, j) - y(k, j)) / h1 - (y(k, j) - y(k - 1, j)) / h0);
+                const double diag = 2.0 * (h0 + h1) - h0 * c[k - 1];
+                c[k] = h1 / diag;
+                d[k] = (rhs - h0 * d[k - 1]) / diag;
+            }
+            for (std::size_t k = n - 1; k >= 1; --k)
+                _m[k * _dof + j] = d[k] - c[k] * _m[(k + 1) * _dof + j];
+        }
+    }
+
+    //! 路径总长度
+    double length() const noexcept { return _knots.back(); }
+
+    //! 途经点对应的路径参数
+    const std::vector<double> &knots() const noexcept { return _knots; }
+
+    /**
+     * @brief 在路径参数 @p s 处求值
+     *
+     * @param[in] s 路径参数
+     * @param[out] q 位置 \f$q(s)\f$
+     * @param[out] dq 一阶导数 \f$q'(s)\f$
+     * @param[out] ddq 二阶导数 \f$q''(s)\f$
+     * @param[out] dddq 三阶导数 \f$q'''(s)\f$，每段内为常数
+     */
+    void eval(double s, double *q, double *dq, double *ddq, double *dddq) const noexcept {
+        const auto it = std::upper_bound(_knots.begin() + 1, _knots.end() - 1, s);
+        const auto k = static_cast<std::size_t>(std::distance(_knots.begin(), it)) - 1;
+        const double h = _knots[k + 1] - _knots[k];
+        const double a = (_knots[k + 1] - s) / h, b = (s - _knots[k]) / h;
+        for (std::size_t j = 0; j < _dof; ++j) {
+            const double m0 = _m[k * _dof + j], m1 = _m[(k + 1) * _dof + j];
+            q[j] = a * y(k, j) + b * y(k + 1, j) + ((a * a * a - a) * m0 + (b * b * b - b) * m1) * h * h / 6.0;
+            dq[j] = (y(k + 1, j) - y(k, j)) / h - (3.0 * a * a - 1.0) / 6.0 * h * m0 + (3.0 * b * b - 1.0) / 6.0 * h * m1;
+            ddq[j] = a * m0 + b * m1;
+            dddq[j] = (m1 - m0) / h;
+        }
+    }
+
+private:
+    double y(std::size_t k, std::size_t j) const noexcept { return _y[k * _dof + j]; }
+
+    std::size_t _dof{};
+    std::vector<double> _knots{}; //!< 各途经点的弦长参数
+    std::vector<double> _y{};     //!< 途经点，(n+1) × dof
+    std::vector<double> _m{};     //!< 各节点处的二阶导数，(n+1) × dof
+};
+
+//! 半平面约束 \f$c_u u+c_x x\le r\f$
+struct HalfPlane {
+    double cu, cx, rhs;
+};
+
+/**
+ * @brief 二维线性规划：求半平面交中 \f$x\f$ 的取值范围
+ * @details 可行域有界，最优值必在顶点处取得，约束数量很少，直接枚举两两交点
+ *
+ * @param[in] hp 半平面约束
+ * @param[out] x_lo 最小值
+ * @param[out] x_hi 最大值
+ * @return 可行域是否非空
+ */
+bool xRange(const std::vector<HalfPlane> &hp, double &x_lo, double &x_hi) noexcept {
+    x_lo = inf, x_hi = -inf;
+    for (std::size_t p = 0; p < hp.size(); ++p) {
+        for (std::size_t q = p + 1; q < hp.size(); ++q) {
+            const double det = hp[p].cu * hp[q].cx - hp[q].cu * hp[p].cx;
+            if (std::abs(det) < 1e-12)
+                continue;
+            const double u = (hp[p].rhs * hp[q].cx - hp[q].rhs * hp[p].cx) / det;
+            const double x = (hp[p].cu * hp[q].rhs - hp[q].cu * hp[p].rhs) / det;
+            const bool feasible = std::all_of(hp.begin(), hp.end(), [&](const HalfPlane &h) {
+                return h.cu * u + h.cx * x <= h.rhs + 1e-9 * (1.0 + std::abs(h.rhs));
+            });
+            if (feasible)
+                x_lo = std::min(x_lo, x), x_hi = std::max(x_hi, x);
+        }
+    }
+    return x_lo <= x_hi;
+}
+
+//! 单个网格点处的路径约束
+struct GridConstraint {
+    std::vector<double> dq;   //!< q'(s)
+    std::vector<double> ddq;  //!< q''(s)
+    std::vector<double> dddq; //!< q'''(s)
+    double x_vel{inf};        //!< 速度约束给出的 ṡ² 上界
+    double jerk{inf};         //!< 仅考虑 q' 项时加加速度约束给出的 |ds̈/dt| 上界
+};
+
+//! 加速度约束 \f$|q'_j u+q''_j x|\le a_j\f$ 给出的 u 的区间，x 固定
+void accelBounds(const GridConstraint &g, const std::vector<double> &a_max, double x, double &u_lo, double &u_hi) noexcept {
+    for (std::size_t j = 0; j < a_max.size(); ++j) {
+        const double a = g.dq[j], b = g.ddq[j] * x;
+        if (std::abs(a) < 1e-12)
+            continue;
+        const double lo = (-a_max[j] - b) / a, hi = (a_max[j] - b) / a;
+        u_lo = std::max(u_lo, std::min(lo, hi));
+        u_hi = std::min(u_hi, std::max(lo, hi));
+    }
+}
+
+//! 以当前 x 与预计的路径加速度估算一个网格步长的耗时，用于把加加速度限制换算为 u 的变化量上界
+double jerkStep(double x, double delta, double u_guess, double jerk) noexcept {
+    if (!std::isfinite(jerk))
+        return inf;
+    if (x > 1e-12)
+        return jerk * 2.0 * delta / (std::sqrt(x) + std::sqrt(std::max(x, x + 2.0 * delta * u_guess)));
+    // 静止起步：dt = sqrt(2Δ/u)，|Δu| <= J dt 在 Δu = u 时取等
+    return std::cbrt(jerk * jerk * 2.0 * delta);
+}
+
+/**
+ * @brief 加加速度约束给出的路径加速度在一个网格步内的变化区间
+ * @details 关节加加速度为 \f$q'_j\dddot s+3q''_j\dot s\ddot s+q'''_j\dot s^3\f$，后两项以上一步的 \f$\ddot s\f$ 近似，
+ *          曲率项本身已超限时退化为仅约束 \f$q'_j\dddot s\f$ 项
+ */
+void jerkBounds(const GridConstraint &g, const std::vector<double> &j_max, double x, double delta, double u_prev, double &du_lo, double &du_hi) noexcept {
+    du_lo = -inf, du_hi = inf;
+    if (!std::isfinite(g.jerk))
+        return;
+    if (x <= 1e-12) {
+        du_hi = jerkStep(x, delta, u_prev, g.jerk), du_lo = -du_hi;
+        return;
+    }
+    const double sd = std::sqrt(x);
+    const double dt = 2.0 * delta / (sd + std::sqrt(std::max(x, x + 2.0 * delta * u_prev)));
+    for (std::size_t j = 0; j < j_max.size(); ++j) {
+        const double a = g.dq[j];
+        if (std::abs(a) < 1e-12 || !std::isfinite(j_max[j]))
+            continue;
+        const double c = 3.0 * g.ddq[j] * sd * u_prev + g.dddq[j] * x * sd;
+        const double lo = (-j_max[j] - c) / a * dt, hi = (j_max[j] - c) / a * dt;
+        du_lo = std::max(du_lo, std::min(lo, hi));
+        du_hi = std::min(du_hi, std::max(lo, hi));
+    }
+    if (du_lo > du_hi)
+        du_hi = g.jerk * dt, du_lo = -du_hi;
+}
+
+} // namespace
+
+std::vector<msg::JointTrajectoryPoint> parameterizeTOPPRA(const std::vector<std::vector<double>> &waypoints, const std::vector<const JointInfo *> &joints,
+                                                         double velocity_scale, double acceleration_scale) {
+    const std::size_t dof = joints.size();
+    if (dof == 0 || waypoints.empty())
+        return {};
+    velocity_scale = std::clamp(velocity_scale, 0.01, 1.0);
+    acceleration_scale = std::clamp(acceleration_scale, 0.01, 1.0);
+
+    // 剔除重合的相邻途经点，不足两个时无路径可参数化，由调用方回退到五次多项式插值
+    std::vector<std::vector<double>> pts{waypoints.front()};
+    for (std::size_t k = 1; k < waypoints.size(); ++k) {
+        double d2 = 0.0;
+        for (std::size_t j = 0; j < dof; ++j)
+            d2 += (waypoints[k][j] - pts.back()[j]) * (waypoints[k][j] - pts.back()[j]);
+        if (d2 > 1e-18)
+            pts.push_back(waypoints[k]);
+    }
+    if (pts.size() < 2)
+        return {};
+
+    std::vector<double> v_max(dof), a_max(dof), j_max(dof);
+    for (std::size_t j = 0; j < dof; ++j) {
+        v_max[j] = std::max(joints[j]->max_velocity * velocity_scale, 1e-6);
+        a_max[j] = std::max(joints[j]->max_acceleration * acceleration_scale, 1e-6);
+        j_max[j] = joints[j]->max_jerk > 0.0 ? joints[j]->max_jerk * acceleration_scale : inf;
+    }
+
+    // 路径网格：每段等分，途经点恰好落在网格上
+    constexpr std::size_t steps_per_segment = 50;
+    const SplinePath path(pts);
+    const auto &knots = path.knots();
+    std::vector<double> grid{};
+    grid.reserve((knots.size() - 1) * steps_per_segment + 1);
+    for (std::size_t k = 0; k + 1 < knots.size(); ++k)
+        for (std::size_t i = 0; i < steps_per_segment; ++i)
+            grid.push_back(knots[k] + (knots[k + 1] - knots[k]) * static_cast<double>(i) / steps_per_segment);
+    grid.push_back(knots.back());
+    const std::size_t n = grid.size() - 1;
+
+    // 样条在途经点之间可能越过关节限位，限位取途经点范围与 URDF 限位的并集，只拒绝由插值引入的越界
+    std::vector<double> q_lo(dof, -inf), q_hi(dof, inf);
+    for (std::size_t j = 0; j < dof; ++j) {
+        const auto *joint = joints[j];
+        if (joint->type == JointType::Continuous || !(joint->upper > joint->lower))
+            continue;
+        q_lo[j] = joint->lower, q_hi[j] = joint->upper;
+        for (const auto &pt : pts)
+            q_lo[j] = std::min(q_lo[j], pt[j]), q_hi[j] = std::max(q_hi[j], pt[j]);
+    }
+
+    std::vector<std::vector<double>> q(n + 1, std::vector<double>(dof));
+    std::vector<GridConstraint> cons(n + 1, GridConstraint{std::vector<double>(dof), std::vector<double>(dof), std::vector<double>(dof)});
+    for (std::size_t i = 0; i <= n; ++i) {
+        auto &g = cons[i];
+        path.eval(grid[i], q[i].data(), g.dq.data(), g.ddq.data(), g.dddq.data());
+        for (std::size_t j = 0; j < dof; ++j) {
+            if (q[i][j] < q_lo[j] - 1e-9 || q[i][j] > q_hi[j] + 1e-9)
+                return {};
+            const double a = std::abs(g.dq[j]);
+            if (a < 1e-12)
+                continue;
+            g.x_vel = std::min(g.x_vel, (v_max[j] / a) * (v_max[j] / a));
+            g.jerk = std::min(g.jerk, j_max[j] / a);
+        }
+    }
+
+    // 后向可达性分析：K_i 为能以允许的路径加速度到达 K_{i+1} 的 x = ṡ² 集合，终点静止 K_n = {0}
+    std::vector<double> k_lo(n + 1, 0.0), k_hi(n + 1, 0.0);
+    std::vector<HalfPlane> hp{};
+    hp.reserve(2 * dof + 4);
+    for (std::size_t i = n; i-- > 0;) {
+        const auto &g = cons[i];
+        const double delta = grid[i + 1] - grid[i];
+        hp.clear();
+        for (std::size_t j = 0; j < dof; ++j) {
+            hp.push_back({g.dq[j], g.ddq[j], a_max[j]});
+            hp.push_back({-g.dq[j], -g.ddq[j], a_max[j]});
+        }
+        hp.push_back({0.0, 1.0, std::isfinite(g.x_vel) ? g.x_vel : 1e12});
+        hp.push_back({0.0, -1.0, 0.0});
+        hp.push_back({2.0 * delta, 1.0, k_hi[i + 1]});
+        hp.push_back({-2.0 * delta, -1.0, -k_lo[i + 1]});
+        if (!xRange(hp, k_lo[i], k_hi[i]))
+            return {};
+        k_lo[i] = std::max(k_lo[i], 0.0);
+    }
+    if (k_lo[0] > 1e-9)
+        return {};
+
+    // 后向加加速度受限的制动曲线，作为前向过程的上界，使减速段的路径加速度逐步变化
+    std::vector<double> brake(n + 1, 0.0);
+    double u_next = 0.0;
+    for (std::size_t i = n; i-- > 0;) {
+        const auto &g = cons[i];
+        const double delta = grid[i + 1] - grid[i];
+        const double x1 = brake[i + 1];
+        // x_i = x_{i+1} - 2Δu，代入加速度约束后成为 u 的一维约束：(q' - 2Δq'')u + q''x_{i+1} ∈ [-a, a]
+        double u_lo = (x1 - k_hi[i]) / (2.0 * delta), u_hi = (x1 - k_lo[i]) / (2.0 * delta);
+        for (std::size_t j = 0; j < dof; ++j) {
+            const double a = g.dq[j] - 2.0 * delta * g.ddq[j], b = g.ddq[j] * x1;
+            if (std::abs(a) < 1e-12)
+                continue;
+            const double lo = (-a_max[j] - b) / a, hi = (a_max[j] - b) / a;
+            u_lo = std::max(u_lo, std::min(lo, hi));
+            u_hi = std::min(u_hi, std::max(lo, hi));
+        }
+        const double u = std::min(u_hi, std::max(u_lo, u_next - jerkStep(x1, delta, -u_next, g.jerk)));
+        brake[i] = std::clamp(x1 - 2.0 * delta * u, k_lo[i], k_hi[i]);
+        u_next = (x1 - brake[i]) / (2.0 * delta);
+    }
+
+    // 前向贪心：在可控集内取最大的路径加速度，并限制其变化率。若某一步被迫以超过加加速度限制的速率减速，
+    // 则回退一步并压低上一步的路径加速度上界，使减速提前开始
+    std::vector<double> x(n + 1, 0.0), u(n + 1, 0.0), u_cap(n + 1, inf);
+    std::size_t budget = 20 * n;
+    for (std::size_t i = 0; i < n;) {
+        const auto &g = cons[i];
+        const double delta = grid[i + 1] - grid[i];
+        const double u_prev = i > 0 ? u[i - 1] : 0.0;
+        const double x_hi = std::min(k_hi[i + 1], brake[i + 1]);
+        double u_lo = (k_lo[i + 1] - x[i]) / (2.0 * delta), u_hi = (x_hi - x[i]) / (2.0 * delta);
+        accelBounds(g, a_max, x[i], u_lo, u_hi);
+        u_hi = std::min(u_hi, u_cap[i]);
+        double du_lo{}, du_hi{};
+        jerkBounds(g, j_max, x[i], delta, u_prev, du_lo, du_hi);
+        if (i > 0 && budget > 0 && u_hi < u_prev + du_lo - 1e-9) {
+            --budget, --i;
+            u_cap[i] = std::min(u_cap[i], u_hi - du_lo);
+            continue;
+        }
+        // 可行性优先于加加速度约束
+        u[i] = std::max(u_lo, std::min(u_hi, u_prev + du_hi));
+        x[i + 1] = std::clamp(x[i] + 2.0 * delta * u[i], k_lo[i + 1], k_hi[i + 1]);
+        u[i] = (x[i + 1] - x[i]) / (2.0 * delta);
+        ++i;
+    }
+    // 终点沿用最后一步的路径加速度，并截断到终点处的加速度约束内
+    double u_lo = -inf, u_hi = inf;
+    accelBounds(cons[n], a_max, x[n], u_lo, u_hi);
+    u[n] = std::clamp(u[n - 1], std::min(u_lo, u_hi), u_hi);
+
+    // 由 ṡ、s̈ 还原关节速度与加速度，dt = 2Δ / (√x_i + √x_{i+1})。相邻两个网格点都停滞时该步耗时没有意义，视为求解失败
+    std::vector<msg::JointTrajectoryPoint> res(n + 1);
+    double t = 0.0;
+    for (std::size_t i = 0; i <= n; ++i) {
+        if (i > 0) {
+            const double sd_sum = std::sqrt(x[i - 1]) + std::sqrt(x[i]);
+            if (sd_sum < 1e-6)
+                return {};
+            t += 2.0 * (grid[i] - grid[i - 1]) / sd_sum;
+        }
+        const auto &g = cons[i];
+        const double sd = std::sqrt(x[i]);
+        auto &pt = res[i];
+        pt.positions = std::move(q[i]);
+        pt.velocities.resize(dof);
+        pt.accelerations.resize(dof);
+        for (std::size_t j = 0; j < dof; ++j) {
+            pt.velocities[j] = g.dq[j] * sd;
+            pt.accelerations[j] = g.dq[j] * u[i] + g.ddq[j] * x[i];
+        }
+        pt.time_from_start.nanoseconds = static_cast<int64_t>(std::llround(t * 1e9));
+    }
+    res.back().velocities.assign(dof, 0.0);
+    return res;
+}
+
+} // namespace rm::lpss
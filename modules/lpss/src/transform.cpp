@@ -10,14 +10,15 @@
  */
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
+#include <deque>
 #include <limits>
 #include <mutex>
-#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -85,18 +86,65 @@ namespace {
 
 constexpr int64_t kNanosecondsPerSecond = 1'000'000'000ll;
 
+//! 无父坐标系标记
+constexpr uint32_t kNoParent = std::numeric_limits<uint32_t>::max();
+//! 单个样本块的目标容量，写入时仅复制被修改的块
+constexpr std::size_t kChunkCapacity = 64;
+//! 读者纪元槽数量，超过该数量的并发查询会短暂让出时间片
+constexpr std::size_t kReaderSlots = 64;
+
 struct TransformSample {
     int64_t time{};
     msg::Transform transform{};
 };
 
-struct TransformEdge {
-    std::string parent{};
+//! 不可变的样本块，在多个快照之间共享
+struct SampleChunk {
+    std::vector<TransformSample> samples{};
+};
+
+using ChunkPtr = std::shared_ptr<const SampleChunk>;
+
+//! 动态边历史，由按时间排序且非空的样本块组成
+struct SampleHistory {
+    std::vector<ChunkPtr> chunks{};
+
+    bool empty() const noexcept { return chunks.empty(); }
+    const TransformSample &front() const noexcept { return chunks.front()->samples.front(); }
+    const TransformSample &back() const noexcept { return chunks.back()->samples.back(); }
+};
+
+//! 快照中的坐标系节点，若存在父坐标系则同时保存到父坐标系的边
+struct FrameNode {
+    uint32_t parent{kNoParent};
+    uint32_t root{};
+    uint32_t depth{};
+    bool known{};
     bool is_static{};
     msg::Transform static_transform{};
-    std::vector<TransformSample> samples{};
+    std::shared_ptr<const SampleHistory> history{};
+};
+
+//! 坐标系名称到句柄的映射，键引用 Buffer 内地址稳定的名称存储
+struct NameTable {
+    std::unordered_map<std::string_view, uint32_t> ids{};
 };
 
+//! 不可变的坐标树快照
+struct Snapshot {
+    std::vector<FrameNode> nodes{};
+    std::shared_ptr<const NameTable> names{std::make_shared<NameTable>()};
+    std::size_t edge_count{};
+    ExtrapolationPolicy extrapolation{};
+};
+
+//! 读者纪元槽，独占缓存行以避免伪共享
+struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> epoch{};
+};
+
+std::atomic<std::size_t> g_reader_hint{};
+
 msg::Transform identityTransform() noexcept {
     msg::Transform result{};
     result.rotation.w = 1.0;
@@ -183,24 +231,84 @@ msg::Transform interpolate(const TransformSample &lhs, const TransformSample &rh
             slerp(lhs.transform.rotation, rhs.transform.rotation, ratio)};
 }
 
-Status sampleEdge(const TransformEdge &edge, int64_t time, msg::Transform &transform) noexcept {
-    if (edge.is_static) {
-        transform = edge.static_transform;
+bool sampleBefore(const TransformSample &sample, int64_t value) noexcept { return sample.time < value; }
+
+bool chunkBefore(const ChunkPtr &chunk, int64_t value) noexcept { return chunk->samples.back().time < value; }
+
+//! 以两个样本间的线速度和角速度匀速外推到指定时间，角速度在父坐标系中保持不变
+msg::Transform extrapolate(const TransformSample &lhs, const TransformSample &rhs, int64_t time) noexcept {
+    const double ratio = static_cast<double>(time - lhs.time) / static_cast<double>(rhs.time - lhs.time);
+    const auto &lt = lhs.transform.translation;
+    const auto &rt = rhs.transform.translation;
+    msg::Transform result{{lt.x + ratio * (rt.x - lt.x),
+                           lt.y + ratio * (rt.y - lt.y),
+                           lt.z + ratio * (rt.z - lt.z)},
+                          lhs.transform.rotation};
+
+    const auto &lq = lhs.transform.rotation;
+    auto delta = rhs.transform.rotation * msg::Quaternion{-lq.x, -lq.y, -lq.z, lq.w};
+    if (delta.w < 0.0)
+        delta = {-delta.x, -delta.y, -delta.z, -delta.w};
+    const double sin_half = std::sqrt(delta.x * delta.x + delta.y * delta.y + delta.z * delta.z);
+    if (!(sin_half > std::numeric_limits<double>::epsilon()))
+        return result;
+
+    const double half_angle = std::atan2(sin_half, delta.w) * ratio;
+    const double scale = std::sin(half_angle) / sin_half;
+    result.rotation = msg::Quaternion{delta.x * scale, delta.y * scale, delta.z * scale, std::cos(half_angle)} * lq;
+    normalizeQuaternion(result.rotation);
+    return result;
+}
+
+/**
+ * @brief 在动态边历史区间之外按策略采样
+ * @param[in] past 查询时间是否早于历史区间
+ */
+Status extrapolateEdge(const SampleHistory &history, int64_t time, bool past, const ExtrapolationPolicy &policy, msg::Transform &transform) noexcept {
+    const Status out_of_range = past ? Status::ExtrapolationPast : Status::ExtrapolationFuture;
+    if (policy.mode == Extrapolation::None)
+        return out_of_range;
+    const auto &boundary = past ? history.front() : history.back();
+    if (policy.mode == Extrapolation::BoundedHorizon && (past ? boundary.time - time : time - boundary.time) > policy.horizon.count())
+        return out_of_range;
+
+    // 越界一侧最近的第二个样本，可能位于相邻样本块中
+    const TransformSample *neighbor{};
+    const auto &edge_chunk = past ? history.chunks.front()->samples : history.chunks.back()->samples;
+    if (edge_chunk.size() > 1)
+        neighbor = past ? &edge_chunk[1] : &edge_chunk[edge_chunk.size() - 2];
+    else if (history.chunks.size() > 1)
+        neighbor = past ? &history.chunks[1]->samples.front() : &history.chunks[history.chunks.size() - 2]->samples.back();
+
+    transform = neighbor == nullptr ? boundary.transform
+                                    : (past ? extrapolate(boundary, *neighbor, time) : extrapolate(*neighbor, boundary, time));
+    return Status::Ok;
+}
+
+Status sampleEdge(const FrameNode &node, int64_t time, const ExtrapolationPolicy &policy, msg::Transform &transform) noexcept {
+    if (node.is_static) {
+        transform = node.static_transform;
         return Status::Ok;
     }
-    if (time < edge.samples.front().time)
-        return Status::ExtrapolationPast;
-    if (time > edge.samples.back().time)
-        return Status::ExtrapolationFuture;
-
-    const auto upper = std::lower_bound(
-        edge.samples.begin(), edge.samples.end(), time,
-        [](const TransformSample &sample, int64_t value) { return sample.time < value; });
-    if (upper->time == time || upper == edge.samples.begin()) {
+    const auto &history = *node.history;
+    if (time < history.front().time)
+        return extrapolateEdge(history, time, true, policy, transform);
+    if (time > history.back().time)
+        return extrapolateEdge(history, time, false, policy, transform);
+
+    const auto chunk = std::lower_bound(history.chunks.begin(), history.chunks.end(), time, chunkBefore);
+    const auto &samples = (*chunk)->samples;
+    const auto upper = std::lower_bound(samples.begin(), samples.end(), time, sampleBefore);
+    const TransformSample *lower{};
+    if (upper != samples.begin())
+        lower = &*std::prev(upper);
+    else if (chunk != history.chunks.begin())
+        lower = &(*std::prev(chunk))->samples.back();
+    if (upper->time == time || lower == nullptr) {
         transform = upper->transform;
         return Status::Ok;
     }
-    transform = interpolate(*std::prev(upper), *upper, time);
+    transform = interpolate(*lower, *upper, time);
     return Status::Ok;
 }
 
@@ -211,14 +319,153 @@ int64_t cacheCutoff(int64_t latest, std::chrono::nanoseconds cache_duration) noe
                : latest - duration;
 }
 
-void pruneEdge(TransformEdge &edge, std::chrono::nanoseconds cache_duration) {
-    if (edge.is_static || edge.samples.empty())
-        return;
-    const int64_t cutoff = cacheCutoff(edge.samples.back().time, cache_duration);
-    const auto first = std::lower_bound(
-        edge.samples.begin(), edge.samples.end(), cutoff,
-        [](const TransformSample &sample, int64_t value) { return sample.time < value; });
-    edge.samples.erase(edge.samples.begin(), first);
+std::shared_ptr<SampleChunk> makeChunk(std::vector<TransformSample>::const_iterator first, std::vector<TransformSample>::const_iterator last) {
+    auto chunk = std::make_shared<SampleChunk>();
+    chunk->samples.reserve(std::max<std::size_t>(kChunkCapacity, static_cast<std::size_t>(last - first) + 1));
+    chunk->samples.assign(first, last);
+    return chunk;
+}
+
+//! 插入或替换样本，返回共享未修改样本块的新历史
+std::shared_ptr<const SampleHistory> insertSample(const SampleHistory &history, const TransformSample &sample) {
+    auto result = std::make_shared<SampleHistory>(history);
+    auto &chunks = result->chunks;
+    const auto pos = std::lower_bound(chunks.begin(), chunks.end(), sample.time, chunkBefore);
+    if (pos == chunks.end()) {
+        if (!chunks.empty() && chunks.back()->samples.size() < kChunkCapacity) {
+            const auto &samples = chunks.back()->samples;
+            auto chunk = makeChunk(samples.begin(), samples.end());
+            chunk->samples.push_back(sample);
+            chunks.back() = std::move(chunk);
+        } else {
+            auto chunk = std::make_shared<SampleChunk>();
+            chunk->samples.reserve(kChunkCapacity);
+            chunk->samples.push_back(sample);
+            chunks.push_back(std::move(chunk));
+        }
+        return result;
+    }
+
+    const auto index = static_cast<std::size_t>(pos - chunks.begin());
+    auto chunk = makeChunk((*pos)->samples.begin(), (*pos)->samples.end());
+    auto &samples = chunk->samples;
+    const auto it = std::lower_bound(samples.begin(), samples.end(), sample.time, sampleBefore);
+    if (it != samples.end() && it->time == sample.time)
+        it->transform = sample.transform;
+    else
+        samples.insert(it, sample);
+
+    if (samples.size() > 2 * kChunkCapacity) {
+        auto tail = makeChunk(samples.begin() + kChunkCapacity, samples.end());
+        samples.resize(kChunkCapacity);
+        chunks[index] = std::move(chunk);
+        chunks.insert(chunks.begin() + index + 1, std::move(tail));
+    } else
+        chunks[index] = std::move(chunk);
+    return result;
+}
+
+//! 裁剪早于缓存窗口的样本，无需裁剪时返回原历史
+std::shared_ptr<const SampleHistory> pruneHistory(std::shared_ptr<const SampleHistory> history, std::chrono::nanoseconds cache_duration) {
+    if (history->empty())
+        return history;
+    const int64_t cutoff = cacheCutoff(history->back().time, cache_duration);
+    if (history->front().time >= cutoff)
+        return history;
+
+    auto result = std::make_shared<SampleHistory>();
+    const auto first = std::lower_bound(history->chunks.begin(), history->chunks.end(), cutoff, chunkBefore);
+    result->chunks.assign(first, history->chunks.end());
+    const auto &samples = result->chunks.front()->samples;
+    if (samples.front().time < cutoff)
+        result->chunks.front() = makeChunk(std::lower_bound(samples.begin(), samples.end(), cutoff, sampleBefore), samples.end());
+    return result;
+}
+
+//! 坐标树拓扑变化后重新计算各坐标系的根与深度
+void relink(Snapshot &snapshot) noexcept {
+    auto &nodes = snapshot.nodes;
+    for (uint32_t id = 0; id < nodes.size(); ++id) {
+        uint32_t frame = id, depth = 0;
+        for (; nodes[frame].parent != kNoParent; ++depth)
+            frame = nodes[frame].parent;
+        nodes[id].root = frame;
+        nodes[id].depth = depth;
+    }
+}
+
+/**
+ * @brief 在快照上解析 source 到 target 的变换
+ * @note 调用前需保证两个坐标系均已出现在坐标树中，整个过程不分配内存
+ */
+Status resolve(const Snapshot &snapshot, uint32_t target, uint32_t source, const msg::Time &time, int64_t &stamp, msg::Transform &transform) noexcept {
+    if (target == source) {
+        stamp = toNanoseconds(time);
+        transform = identityTransform();
+        return Status::Ok;
+    }
+
+    const auto &nodes = snapshot.nodes;
+    if (nodes[target].root != nodes[source].root)
+        return Status::ConnectivityError;
+
+    uint32_t lhs = source, rhs = target;
+    while (nodes[lhs].depth > nodes[rhs].depth)
+        lhs = nodes[lhs].parent;
+    while (nodes[rhs].depth > nodes[lhs].depth)
+        rhs = nodes[rhs].parent;
+    while (lhs != rhs) {
+        lhs = nodes[lhs].parent;
+        rhs = nodes[rhs].parent;
+    }
+    const uint32_t common = lhs;
+
+    int64_t query_time = toNanoseconds(time);
+    if (isZeroTime(time)) {
+        bool has_dynamic_edge = false;
+        int64_t earliest = std::numeric_limits<int64_t>::min();
+        int64_t latest = std::numeric_limits<int64_t>::max();
+        const auto update_interval = [&](uint32_t frame) {
+            for (; frame != common; frame = nodes[frame].parent) {
+                const auto &node = nodes[frame];
+                if (!node.is_static) {
+                    has_dynamic_edge = true;
+                    earliest = std::max(earliest, node.history->front().time);
+                    latest = std::min(latest, node.history->back().time);
+                }
+            }
+        };
+        update_interval(source);
+        update_interval(target);
+        if (has_dynamic_edge && latest < earliest)
+            return Status::NoCommonTime;
+        query_time = has_dynamic_edge ? latest : 0;
+    }
+
+    const auto compose = [&](uint32_t frame, msg::Transform &common_from_frame) {
+        common_from_frame = identityTransform();
+        for (; frame != common; frame = nodes[frame].parent) {
+            msg::Transform parent_from_child{};
+            const auto status = sampleEdge(nodes[frame], query_time, snapshot.extrapolation, parent_from_child);
+            if (status != Status::Ok)
+                return status;
+            common_from_frame = parent_from_child * common_from_frame;
+        }
+        return Status::Ok;
+    };
+
+    msg::Transform common_from_source{}, common_from_target{};
+    auto status = compose(source, common_from_source);
+    if (status != Status::Ok)
+        return status;
+    status = compose(target, common_from_target);
+    if (status != Status::Ok)
+        return status;
+
+    stamp = query_time;
+    transform = msg::inverse(common_from_target) * common_from_source;
+    normalizeQuaternion(transform.rotation);
+    return Status::Ok;
 }
 
 std::string topicName(std::string_view name, std::string_view suffix) {
@@ -229,16 +476,263 @@ std::string topicName(std::string_view name, std::string_view suffix) {
     return result;
 }
 
+//! 按名称在快照上解析变换，坐标系未出现在坐标树中时返回 `Status::FrameNotFound`
+Status resolve(const Snapshot &snapshot, std::string_view target, std::string_view source, const msg::Time &time, int64_t &stamp, msg::Transform &transform) noexcept {
+    const auto &ids = snapshot.names->ids;
+    const auto target_it = ids.find(target);
+    const auto source_it = ids.find(source);
+    if (target_it == ids.end() || source_it == ids.end() || !snapshot.nodes[target_it->second].known || !snapshot.nodes[source_it->second].known)
+        return Status::FrameNotFound;
+    return resolve(snapshot, target_it->second, source_it->second, time, stamp, transform);
+}
+
+//! 经由参考坐标系的跨时间解析，结果时间戳取目标时间
+Status resolve(const Snapshot &snapshot, uint32_t target, const msg::Time &target_time, uint32_t source, const msg::Time &source_time,
+               uint32_t fixed, int64_t &stamp, msg::Transform &transform) noexcept {
+    int64_t source_stamp{};
+    msg::Transform fixed_from_source{}, target_from_fixed{};
+    auto status = resolve(snapshot, fixed, source, source_time, source_stamp, fixed_from_source);
+    if (status != Status::Ok)
+        return status;
+    status = resolve(snapshot, target, fixed, target_time, stamp, target_from_fixed);
+    if (status != Status::Ok)
+        return status;
+    transform = target_from_fixed * fixed_from_source;
+    normalizeQuaternion(transform.rotation);
+    return Status::Ok;
+}
+
+//! 批量变换的分块长度，每块的 SoA 暂存区位于栈上
+constexpr std::size_t kBatchBlock = 256;
+
+//! 旋转矩阵与平移形式的刚体变换，供批量变换使用
+class BatchKernel {
+public:
+    explicit BatchKernel(const msg::Transform &transform) noexcept : _q(transform.rotation) {
+        const double x = _q.x, y = _q.y, z = _q.z, w = _q.w;
+        _r = {1.0 - 2.0 * (y * y + z * z), 2.0 * (x * y - z * w), 2.0 * (x * z + y * w),
+              2.0 * (x * y + z * w), 1.0 - 2.0 * (x * x + z * z), 2.0 * (y * z - x * w),
+              2.0 * (x * z - y * w), 2.0 * (y * z + x * w), 1.0 - 2.0 * (x * x + y * y)};
+        _t = {transform.translation.x, transform.translation.y, transform.translation.z};
+    }
+
+    //! 原地变换 SoA 布局的位置分量
+    void positions(double *xs, double *ys, double *zs, std::size_t n) const noexcept {
+        const auto [r0, r1, r2, r3, r4, r5, r6, r7, r8] = _r;
+        const auto [tx, ty, tz] = _t;
+        for (std::size_t i = 0; i < n; ++i) {
+            const double x = xs[i], y = ys[i], z = zs[i];
+            xs[i] = r0 * x + r1 * y + r2 * z + tx;
+            ys[i] = r3 * x + r4 * y + r5 * z + ty;
+            zs[i] = r6 * x + r7 * y + r8 * z + tz;
+        }
+    }
+
+    //! 原地左乘 SoA 布局的四元数分量
+    void orientations(double *qx, double *qy, double *qz, double *qw, std::size_t n) const noexcept {
+        const double lx = _q.x, ly = _q.y, lz = _q.z, lw = _q.w;
+        for (std::size_t i = 0; i < n; ++i) {
+            const double x = qx[i], y = qy[i], z = qz[i], w = qw[i];
+            qx[i] = lw * x + lx * w + ly * z - lz * y;
+            qy[i] = lw * y - lx * z + ly * w + lz * x;
+            qz[i] = lw * z + lx * y - ly * x + lz * w;
+            qw[i] = lw * w - lx * x - ly * y - lz * z;
+        }
+    }
+
+    void apply(const msg::Point *input, msg::Point *output, std::size_t count) const noexcept {
+        alignas(64) double xs[kBatchBlock], ys[kBatchBlock], zs[kBatchBlock];
+        for (std::size_t base = 0; base < count; base += kBatchBlock) {
+            const std::size_t n = std::min(kBatchBlock, count - base);
+            const msg::Point *src = input + base;
+            for (std::size_t i = 0; i < n; ++i) {
+                xs[i] = src[i].x;
+                ys[i] = src[i].y;
+                zs[i] = src[i].z;
+            }
+            positions(xs, ys, zs, n);
+            msg::Point *dst = output + base;
+            for (std::size_t i = 0; i < n; ++i) {
+                dst[i].x = xs[i];
+                dst[i].y = ys[i];
+                dst[i].z = zs[i];
+            }
+        }
+    }
+
+    void apply(const msg::Pose *input, msg::Pose *output, std::size_t count) const noexcept {
+        alignas(64) double xs[kBatchBlock], ys[kBatchBlock], zs[kBatchBlock];
+        alignas(64) double qx[kBatchBlock], qy[kBatchBlock], qz[kBatchBlock], qw[kBatchBlock];
+        for (std::size_t base = 0; base < count; base += kBatchBlock) {
+            const std::size_t n = std::min(kBatchBlock, count - base);
+            const msg::Pose *src = input + base;
+            for (std::size_t i = 0; i < n; ++i) {
+                xs[i] = src[i].position.x;
+                ys[i] = src[i].position.y;
+                zs[i] = src[i].position.z;
+                qx[i] = src[i].orientation.x;
+                qy[i] = src[i].orientation.y;
+                qz[i] = src[i].orientation.z;
+                qw[i] = src[i].orientation.w;
+            }
+            positions(xs, ys, zs, n);
+            orientations(qx, qy, qz, qw, n);
+            msg::Pose *dst = output + base;
+            for (std::size_t i = 0; i < n; ++i) {
+                dst[i].position = {xs[i], ys[i], zs[i]};
+                dst[i].orientation = {qx[i], qy[i], qz[i], qw[i]};
+            }
+        }
+    }
+
+private:
+    msg::Quaternion _q{};
+    std::array<double, 9> _r{};
+    std::array<double, 3> _t{};
+};
+
 } // namespace
 
+/**
+ * @brief 坐标变换缓存实现
+ * @details
+ * 写入方在互斥锁保护下复制当前快照、修改副本并原子替换；查询方在纪元槽中登记当前纪元后读取快照指针，
+ * 被替换的旧快照在所有早于其退役纪元的读者离开后由写入方回收。
+ */
 class Buffer::Impl {
 public:
-    explicit Impl(std::chrono::nanoseconds duration) : cache_duration(std::max(duration, std::chrono::nanoseconds::zero())) {}
+    explicit Impl(std::chrono::nanoseconds duration)
+        : current(new Snapshot), cache_duration(std::max(duration, std::chrono::nanoseconds::zero())) {}
+
+    ~Impl() { delete current.load(); }
+
+    //! 查询方持有的快照读保护
+    class Reader {
+    public:
+        explicit Reader(const Impl &impl) {
+            thread_local std::size_t hint = g_reader_hint.fetch_add(1, std::memory_order_relaxed);
+            for (std::size_t i = hint;; ++i) {
+                auto &slot = impl.slots[i % kReaderSlots];
+                uint64_t idle = 0;
+                if (slot.epoch.load(std::memory_order_relaxed) == 0 && slot.epoch.compare_exchange_strong(idle, impl.epoch.load())) {
+                    hint = i % kReaderSlots;
+                    _slot = &slot;
+                    break;
+                }
+                if ((i + 1 - hint) % kReaderSlots == 0)
+                    std::this_thread::yield();
+            }
+            _snapshot = impl.current.load();
+        }
+
+        ~Reader() { _slot->epoch.store(0, std::memory_order_release); }
+
+        Reader(const Reader &) = delete;
+        Reader &operator=(const Reader &) = delete;
+
+        const Snapshot &operator*() const noexcept { return *_snapshot; }
+        const Snapshot *operator->() const noexcept { return _snapshot; }
+
+    private:
+        ReaderSlot *_slot{};
+        const Snapshot *_snapshot{};
+    };
+
+    //! 复制当前快照作为草稿，调用方需持有写锁
+    std::unique_ptr<Snapshot> draft() const { return std::make_unique<Snapshot>(*current.load()); }
+
+    //! 发布新快照并回收已无读者引用的旧快照，调用方需持有写锁
+    void publish(std::unique_ptr<Snapshot> next) {
+        const Snapshot *previous = current.exchange(next.release());
+        retired.emplace_back(epoch.fetch_add(1), std::unique_ptr<const Snapshot>(previous));
+
+        uint64_t oldest = std::numeric_limits<uint64_t>::max();
+        for (const auto &slot : slots) {
+            const uint64_t reader_epoch = slot.epoch.load();
+            if (reader_epoch != 0)
+                oldest = std::min(oldest, reader_epoch);
+        }
+        retired.erase(std::remove_if(retired.begin(), retired.end(), [oldest](const auto &item) { return item.first < oldest; }), retired.end());
+    }
+
+    //! 在草稿中驻留坐标系名称，调用方需持有写锁
+    uint32_t intern(Snapshot &snapshot, std::string_view name) {
+        const auto it = snapshot.names->ids.find(name);
+        if (it != snapshot.names->ids.end())
+            return it->second;
+
+        const auto &stored = names.emplace_back(name);
+        const auto id = static_cast<uint32_t>(snapshot.nodes.size());
+        auto table = std::make_shared<NameTable>(*snapshot.names);
+        table->ids.emplace(stored, id);
+        snapshot.names = std::move(table);
+        snapshot.nodes.emplace_back().root = id;
+        return id;
+    }
+
+    //! 将一条变换写入草稿，调用方需持有写锁
+    Status apply(Snapshot &snapshot, const msg::TransformStamped &input, bool is_static) {
+        if (input.header.frame_id.empty() || input.child_frame_id.empty() || input.header.frame_id == input.child_frame_id || !validTime(input.header.stamp))
+            return Status::InvalidArgument;
+
+        msg::Transform transform = input.transform;
+        if (!normalizeTransform(transform))
+            return Status::InvalidTransform;
+
+        const uint32_t parent = intern(snapshot, input.header.frame_id);
+        const uint32_t child = intern(snapshot, input.child_frame_id);
+        auto &node = snapshot.nodes[child];
+        if (node.parent != kNoParent) {
+            if (node.parent != parent)
+                return Status::MultipleParents;
+            if (node.is_static != is_static)
+                return Status::StaticDynamicConflict;
+        } else {
+            if (snapshot.nodes[parent].root == child)
+                return Status::CycleDetected;
+            node.parent = parent;
+            node.is_static = is_static;
+            node.history = is_static ? nullptr : std::make_shared<SampleHistory>();
+            ++snapshot.edge_count;
+            relink(snapshot);
+        }
 
-    mutable std::shared_mutex mutex{};
-    std::unordered_map<std::string, TransformEdge> edges{};
-    std::unordered_set<std::string> frames{};
-    std::chrono::nanoseconds cache_duration{};
+        if (is_static) {
+            node.static_transform = transform;
+        } else {
+            const int64_t time = toNanoseconds(input.header.stamp);
+            const auto duration = cache_duration.load();
+            if (!node.history->empty() && time < cacheCutoff(node.history->back().time, duration))
+                return Status::TimestampOutOfRange;
+            node.history = pruneHistory(insertSample(*node.history, {time, transform}), duration);
+        }
+
+        node.known = true;
+        snapshot.nodes[parent].known = true;
+        return Status::Ok;
+    }
+
+    //! 批量写入并只发布一次快照
+    Status update(const msg::TransformStamped *first, const msg::TransformStamped *last, bool is_static) {
+        std::lock_guard lock(write_mutex);
+        auto snapshot = draft();
+        Status result = Status::Ok;
+        for (; first != last; ++first) {
+            const auto current_status = apply(*snapshot, *first, is_static);
+            if (result == Status::Ok && current_status != Status::Ok)
+                result = current_status;
+        }
+        publish(std::move(snapshot));
+        return result;
+    }
+
+    std::mutex write_mutex{};
+    std::deque<std::string> names{};
+    std::atomic<const Snapshot *> current{};
+    std::atomic<uint64_t> epoch{1};
+    mutable std::array<ReaderSlot, kReaderSlots> slots{};
+    std::vector<std::pair<uint64_t, std::unique_ptr<const Snapshot>>> retired{};
+    std::atomic<std::chrono::nanoseconds> cache_duration{};
 };
 
 const char *to_string(Status status) noexcept {
@@ -266,186 +760,132 @@ Buffer::Buffer(Buffer &&) noexcept = default;
 Buffer &Buffer::operator=(Buffer &&) noexcept = default;
 Buffer::~Buffer() = default;
 
-Status Buffer::set(const msg::TransformStamped &input) { return setImpl(input, false); }
+Status Buffer::set(const msg::TransformStamped &input) { return _impl->update(&input, &input + 1, false); }
 
 Status Buffer::set(const msg::TF &transforms) {
-    Status result = Status::Ok;
-    for (const auto &transform : transforms.transforms) {
-        const auto current = set(transform);
-        if (result == Status::Ok && current != Status::Ok)
-            result = current;
-    }
-    return result;
+    const auto *first = transforms.transforms.data();
+    return _impl->update(first, first + transforms.transforms.size(), false);
 }
 
-Status Buffer::setStatic(const msg::TransformStamped &input) { return setImpl(input, true); }
+Status Buffer::setStatic(const msg::TransformStamped &input) { return _impl->update(&input, &input + 1, true); }
 
 Status Buffer::setStatic(const msg::TF &transforms) {
-    Status result = Status::Ok;
-    for (const auto &transform : transforms.transforms) {
-        const auto current = setStatic(transform);
-        if (result == Status::Ok && current != Status::Ok)
-            result = current;
-    }
-    return result;
+    const auto *first = transforms.transforms.data();
+    return _impl->update(first, first + transforms.transforms.size(), true);
 }
 
-Status Buffer::setImpl(const msg::TransformStamped &input, bool is_static) {
-    if (input.header.frame_id.empty() || input.child_frame_id.empty() || input.header.frame_id == input.child_frame_id || !validTime(input.header.stamp))
-        return Status::InvalidArgument;
-
-    msg::Transform transform = input.transform;
-    if (!normalizeTransform(transform))
-        return Status::InvalidTransform;
-
-    const std::string parent = input.header.frame_id;
-    const std::string child = input.child_frame_id;
-    const int64_t time = toNanoseconds(input.header.stamp);
-    std::unique_lock lock(_impl->mutex);
-
-    auto edge_it = _impl->edges.find(child);
-    if (edge_it != _impl->edges.end()) {
-        if (edge_it->second.parent != parent)
-            return Status::MultipleParents;
-        if (edge_it->second.is_static != is_static)
-            return Status::StaticDynamicConflict;
-    } else {
-        for (std::string frame = parent;;) {
-            if (frame == child)
-                return Status::CycleDetected;
-            const auto ancestor = _impl->edges.find(frame);
-            if (ancestor == _impl->edges.end())
-                break;
-            frame = ancestor->second.parent;
-        }
-        edge_it = _impl->edges.emplace(child, TransformEdge{parent, is_static, {}, {}}).first;
-    }
-
-    auto &edge = edge_it->second;
-    if (is_static) {
-        edge.static_transform = transform;
-    } else {
-        if (!edge.samples.empty() && time < cacheCutoff(edge.samples.back().time, _impl->cache_duration))
-            return Status::TimestampOutOfRange;
-        const auto pos = std::lower_bound(
-            edge.samples.begin(), edge.samples.end(), time,
-            [](const TransformSample &sample, int64_t value) { return sample.time < value; });
-        if (pos != edge.samples.end() && pos->time == time)
-            pos->transform = transform;
-        else
-            edge.samples.insert(pos, {time, transform});
-        pruneEdge(edge, _impl->cache_duration);
-    }
-
-    _impl->frames.insert(parent);
-    _impl->frames.insert(child);
-    return Status::Ok;
+FrameId Buffer::frame(std::string_view name) {
+    if (name.empty())
+        return {};
+    {
+        Impl::Reader snapshot(*_impl);
+        const auto it = snapshot->names->ids.find(name);
+        if (it != snapshot->names->ids.end())
+            return FrameId(it->second);
+    }
+    std::lock_guard lock(_impl->write_mutex);
+    auto snapshot = _impl->draft();
+    const auto id = _impl->intern(*snapshot, name);
+    _impl->publish(std::move(snapshot));
+    return FrameId(id);
 }
 
 LookupResult Buffer::lookup(
-    std::string_view target_frame_view,
-    std::string_view source_frame_view,
+    std::string_view target_frame,
+    std::string_view source_frame,
     const msg::Time &time) const {
     LookupResult result{};
-    if (target_frame_view.empty() || source_frame_view.empty() || !validTime(time)) {
+    if (target_frame.empty() || source_frame.empty() || !validTime(time)) {
         result.status = Status::InvalidArgument;
         return result;
     }
 
-    const std::string target_frame(target_frame_view);
-    const std::string source_frame(source_frame_view);
-    std::shared_lock lock(_impl->mutex);
-    if (_impl->frames.find(target_frame) == _impl->frames.end() || _impl->frames.find(source_frame) == _impl->frames.end()) {
-        result.status = Status::FrameNotFound;
+    Impl::Reader snapshot(*_impl);
+    int64_t stamp{};
+    result.status = resolve(*snapshot, target_frame, source_frame, time, stamp, result.transform.transform);
+    if (result.status == Status::FrameNotFound)
         return result;
-    }
-
     result.transform.header.frame_id = target_frame;
     result.transform.child_frame_id = source_frame;
-    if (target_frame == source_frame) {
-        result.status = Status::Ok;
-        result.transform.header.stamp = time;
-        result.transform.transform = identityTransform();
+    if (result.status == Status::Ok)
+        result.transform.header.stamp = fromNanoseconds(stamp);
+    return result;
+}
+
+TransformResult Buffer::lookup(FrameId target_frame, FrameId source_frame, const msg::Time &time) const {
+    TransformResult result{};
+    if (!target_frame.valid() || !source_frame.valid() || !validTime(time)) {
+        result.status = Status::InvalidArgument;
         return result;
     }
 
-    std::unordered_set<std::string> source_ancestors{};
-    for (std::string frame = source_frame;;) {
-        source_ancestors.insert(frame);
-        const auto edge = _impl->edges.find(frame);
-        if (edge == _impl->edges.end())
-            break;
-        frame = edge->second.parent;
+    Impl::Reader snapshot(*_impl);
+    const auto &nodes = snapshot->nodes;
+    const uint32_t target = target_frame._id, source = source_frame._id;
+    if (target >= nodes.size() || source >= nodes.size() || !nodes[target].known || !nodes[source].known) {
+        result.status = Status::FrameNotFound;
+        return result;
     }
 
-    std::string common = target_frame;
-    while (source_ancestors.find(common) == source_ancestors.end()) {
-        const auto edge = _impl->edges.find(common);
-        if (edge == _impl->edges.end()) {
-            result.status = Status::ConnectivityError;
-            return result;
-        }
-        common = edge->second.parent;
-    }
+    int64_t stamp{};
+    result.status = resolve(*snapshot, target, source, time, stamp, result.transform);
+    if (result.status == Status::Ok)
+        result.stamp = fromNanoseconds(stamp);
+    return result;
+}
 
-    std::vector<const TransformEdge *> source_edges{};
-    for (std::string frame = source_frame; frame != common;) {
-        const auto edge = _impl->edges.find(frame);
-        source_edges.push_back(&edge->second);
-        frame = edge->second.parent;
-    }
-    std::vector<const TransformEdge *> target_edges{};
-    for (std::string frame = target_frame; frame != common;) {
-        const auto edge = _impl->edges.find(frame);
-        target_edges.push_back(&edge->second);
-        frame = edge->second.parent;
+LookupResult Buffer::lookup(
+    std::string_view target_frame, const msg::Time &target_time,
+    std::string_view source_frame, const msg::Time &source_time,
+    std::string_view fixed_frame) const {
+    LookupResult result{};
+    if (target_frame.empty() || source_frame.empty() || fixed_frame.empty() || !validTime(target_time) || !validTime(source_time)) {
+        result.status = Status::InvalidArgument;
+        return result;
     }
 
-    int64_t query_time = toNanoseconds(time);
-    if (isZeroTime(time)) {
-        bool has_dynamic_edge = false;
-        int64_t earliest = std::numeric_limits<int64_t>::min();
-        int64_t latest = std::numeric_limits<int64_t>::max();
-        const auto update_interval = [&](const TransformEdge *edge) {
-            if (!edge->is_static) {
-                has_dynamic_edge = true;
-                earliest = std::max(earliest, edge->samples.front().time);
-                latest = std::min(latest, edge->samples.back().time);
-            }
-        };
-        for (const auto *edge : source_edges)
-            update_interval(edge);
-        for (const auto *edge : target_edges)
-            update_interval(edge);
-        if (has_dynamic_edge && latest < earliest) {
-            result.status = Status::NoCommonTime;
-            return result;
-        }
-        query_time = has_dynamic_edge ? latest : 0;
+    Impl::Reader snapshot(*_impl);
+    const auto &ids = snapshot->names->ids;
+    const auto target = ids.find(target_frame);
+    const auto source = ids.find(source_frame);
+    const auto fixed = ids.find(fixed_frame);
+    if (target == ids.end() || source == ids.end() || fixed == ids.end() ||
+        !snapshot->nodes[target->second].known || !snapshot->nodes[source->second].known || !snapshot->nodes[fixed->second].known) {
+        result.status = Status::FrameNotFound;
+        return result;
     }
 
-    msg::Transform common_from_source = identityTransform();
-    for (const auto *edge : source_edges) {
-        msg::Transform parent_from_child{};
-        result.status = sampleEdge(*edge, query_time, parent_from_child);
-        if (result.status != Status::Ok)
-            return result;
-        common_from_source = parent_from_child * common_from_source;
+    result.transform.header.frame_id = target_frame;
+    result.transform.child_frame_id = source_frame;
+    int64_t stamp{};
+    result.status = resolve(*snapshot, target->second, target_time, source->second, source_time, fixed->second, stamp, result.transform.transform);
+    if (result.status == Status::Ok)
+        result.transform.header.stamp = fromNanoseconds(stamp);
+    return result;
+}
+
+TransformResult Buffer::lookup(
+    FrameId target_frame, const msg::Time &target_time,
+    FrameId source_frame, const msg::Time &source_time,
+    FrameId fixed_frame) const {
+    TransformResult result{};
+    if (!target_frame.valid() || !source_frame.valid() || !fixed_frame.valid() || !validTime(target_time) || !validTime(source_time)) {
+        result.status = Status::InvalidArgument;
+        return result;
     }
 
-    msg::Transform common_from_target = identityTransform();
-    for (const auto *edge : target_edges) {
-        msg::Transform parent_from_child{};
-        result.status = sampleEdge(*edge, query_time, parent_from_child);
-        if (result.status != Status::Ok)
-            return result;
-        common_from_target = parent_from_child * common_from_target;
+    Impl::Reader snapshot(*_impl);
+    const auto &nodes = snapshot->nodes;
+    const auto known = [&nodes](FrameId frame) { return frame._id < nodes.size() && nodes[frame._id].known; };
+    if (!known(target_frame) || !known(source_frame) || !known(fixed_frame)) {
+        result.status = Status::FrameNotFound;
+        return result;
     }
 
-    result.transform.header.stamp = fromNanoseconds(query_time);
-    result.transform.transform = msg::inverse(common_from_target) * common_from_source;
-    normalizeQuaternion(result.transform.transform.rotation);
-    result.status = Status::Ok;
+    int64_t stamp{};
+    result.status = resolve(*snapshot, target_frame._id, target_time, source_frame._id, source_time, fixed_frame._id, stamp, result.transform);
+    if (result.status == Status::Ok)
+        result.stamp = fromNanoseconds(stamp);
     return result;
 }
 
@@ -456,40 +896,122 @@ bool Buffer::can(
     return static_cast<bool>(lookup(target_frame, source_frame, time));
 }
 
+bool Buffer::can(FrameId target_frame, FrameId source_frame, const msg::Time &time) const {
+    return static_cast<bool>(lookup(target_frame, source_frame, time));
+}
+
+namespace {
+
+template <typename Tp>
+Status transformBatch(const TransformResult &chain, const Tp *input, Tp *output, std::size_t count) noexcept {
+    if (!chain)
+        return chain.status;
+    BatchKernel(chain.transform).apply(input, output, count);
+    return Status::Ok;
+}
+
+bool validBatch(const void *input, const void *output, std::size_t count) noexcept {
+    return count == 0 || (input != nullptr && output != nullptr);
+}
+
+} // namespace
+
+Status Buffer::transform(
+    std::string_view target_frame, std::string_view source_frame, const msg::Time &time,
+    const msg::Point *input, msg::Point *output, std::size_t count) const {
+    TransformResult chain{};
+    if (target_frame.empty() || source_frame.empty() || !validTime(time) || !validBatch(input, output, count))
+        return Status::InvalidArgument;
+    {
+        Impl::Reader snapshot(*_impl);
+        int64_t stamp{};
+        chain.status = resolve(*snapshot, target_frame, source_frame, time, stamp, chain.transform);
+    }
+    return transformBatch(chain, input, output, count);
+}
+
+Status Buffer::transform(
+    FrameId target_frame, FrameId source_frame, const msg::Time &time,
+    const msg::Point *input, msg::Point *output, std::size_t count) const {
+    if (!validBatch(input, output, count))
+        return Status::InvalidArgument;
+    return transformBatch(lookup(target_frame, source_frame, time), input, output, count);
+}
+
+Status Buffer::transform(
+    std::string_view target_frame, std::string_view source_frame, const msg::Time &time,
+    const msg::Pose *input, msg::Pose *output, std::size_t count) const {
+    TransformResult chain{};
+    if (target_frame.empty() || source_frame.empty() || !validTime(time) || !validBatch(input, output, count))
+        return Status::InvalidArgument;
+    {
+        Impl::Reader snapshot(*_impl);
+        int64_t stamp{};
+        chain.status = resolve(*snapshot, target_frame, source_frame, time, stamp, chain.transform);
+    }
+    return transformBatch(chain, input, output, count);
+}
+
+Status Buffer::transform(
+    FrameId target_frame, FrameId source_frame, const msg::Time &time,
+    const msg::Pose *input, msg::Pose *output, std::size_t count) const {
+    if (!validBatch(input, output, count))
+        return Status::InvalidArgument;
+    return transformBatch(lookup(target_frame, source_frame, time), input, output, count);
+}
+
 void Buffer::setCacheDuration(std::chrono::nanoseconds cache_duration) noexcept {
     cache_duration = std::max(cache_duration, std::chrono::nanoseconds::zero());
-    std::unique_lock lock(_impl->mutex);
-    _impl->cache_duration = cache_duration;
-    for (auto &[_, edge] : _impl->edges)
-        pruneEdge(edge, cache_duration);
+    std::lock_guard lock(_impl->write_mutex);
+    _impl->cache_duration.store(cache_duration);
+    auto snapshot = _impl->draft();
+    for (auto &node : snapshot->nodes)
+        if (node.history)
+            node.history = pruneHistory(std::move(node.history), cache_duration);
+    _impl->publish(std::move(snapshot));
 }
 
-std::chrono::nanoseconds Buffer::cacheDuration() const noexcept {
-    std::shared_lock lock(_impl->mutex);
-    return _impl->cache_duration;
+std::chrono::nanoseconds Buffer::cacheDuration() const noexcept { return _impl->cache_duration.load(); }
+
+void Buffer::setExtrapolation(const ExtrapolationPolicy &policy) noexcept {
+    std::lock_guard lock(_impl->write_mutex);
+    auto snapshot = _impl->draft();
+    snapshot->extrapolation = {policy.mode, std::max(policy.horizon, std::chrono::nanoseconds::zero())};
+    _impl->publish(std::move(snapshot));
+}
+
+ExtrapolationPolicy Buffer::extrapolation() const noexcept {
+    Impl::Reader snapshot(*_impl);
+    return snapshot->extrapolation;
 }
 
 std::size_t Buffer::size() const noexcept {
-    std::shared_lock lock(_impl->mutex);
-    return _impl->edges.size();
+    Impl::Reader snapshot(*_impl);
+    return snapshot->edge_count;
 }
 
 void Buffer::clear() noexcept {
-    std::unique_lock lock(_impl->mutex);
-    _impl->edges.clear();
-    _impl->frames.clear();
+    std::lock_guard lock(_impl->write_mutex);
+    auto snapshot = _impl->draft();
+    for (uint32_t id = 0; id < snapshot->nodes.size(); ++id) {
+        snapshot->nodes[id] = {};
+        snapshot->nodes[id].root = id;
+    }
+    snapshot->edge_count = 0;
+    _impl->publish(std::move(snapshot));
 }
 
 namespace {
 
 class PublisherHandle {
 public:
+    // 静态坐标变换使用本地暂存 QoS，后加入的监听器在匹配时即可收到最近一次发布的结果
     PublisherHandle(std::string_view name, std::string_view suffix, Node &node)
-        : _node(&node), _publisher(node.createPublisher<msg::TF>(topicName(name, suffix))) {}
+        : _node(&node), _publisher(node.createPublisher<msg::TF>(topicName(name, suffix), suffix == "tf_static" ? QoS::transientLocal() : QoS{})) {}
 
 #if __cplusplus >= 202002L
     PublisherHandle(std::string_view name, std::string_view suffix, async::Node &node)
-        : _async_node(&node), _async_publisher(node.createPublisher<msg::TF>(topicName(name, suffix))) {}
+        : _async_node(&node), _async_publisher(node.createPublisher<msg::TF>(topicName(name, suffix), suffix == "tf_static" ? QoS::transientLocal() : QoS{})) {}
 #endif
 
     ~PublisherHandle() {
@@ -644,6 +1166,24 @@ bool Broadcaster::invalid() const noexcept { return _impl->invalid(); }
 class StaticBroadcaster::Impl final : public PublisherHandle {
 public:
     using PublisherHandle::PublisherHandle;
+
+    // 按子坐标系合并到已发布的集合并整体重发，使本地暂存的最近一条消息包含全部静态变换
+    void merge(const msg::TF &transforms) {
+        std::lock_guard lk(_mtx);
+        for (const auto &transform : transforms.transforms) {
+            auto it = std::find_if(_merged.transforms.begin(), _merged.transforms.end(),
+                                   [&](const msg::TransformStamped &item) { return item.child_frame_id == transform.child_frame_id; });
+            if (it == _merged.transforms.end())
+                _merged.transforms.push_back(transform);
+            else
+                *it = transform;
+        }
+        send(_merged);
+    }
+
+private:
+    std::mutex _mtx;
+    msg::TF _merged{}; //!< 已发布的全部静态变换，子坐标系唯一
 };
 
 StaticBroadcaster::StaticBroadcaster(std::string_view name, Node &node) : _impl(std::make_unique<Impl>(name, "tf_static", node)) {}
@@ -652,8 +1192,13 @@ StaticBroadcaster::StaticBroadcaster(std::string_view name, async::Node &node) :
 #endif
 StaticBroadcaster::~StaticBroadcaster() = default;
 
-void StaticBroadcaster::send(const msg::TransformStamped &transform) { sendOne(*_impl, transform); }
-void StaticBroadcaster::send(const msg::TF &transforms) { _impl->send(transforms); }
+void StaticBroadcaster::send(const msg::TransformStamped &transform) {
+    msg::TF transforms{};
+    transforms.transforms.push_back(transform);
+    _impl->merge(transforms);
+}
+
+void StaticBroadcaster::send(const msg::TF &transforms) { _impl->merge(transforms); }
 bool StaticBroadcaster::invalid() const noexcept { return _impl->invalid(); }
 
 class Listener::Impl final : public ListenerHandle {
@@ -0,0 +1,146 @@
+/**
+ * @file test_cv.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief LPSS OpenCV 图像消息转换单元测试
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <rmvl/rmvl_modules.hpp>
+
+#ifdef HAVE_OPENCV
+
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/lpss/cv.hpp"
+
+namespace rm_test {
+
+using namespace rm;
+
+//! 编码、矩阵行数与矩阵类型，`yuv420` 的矩阵行数为图像高度的 1.5 倍
+static const std::vector<std::tuple<uint8_t, int, int>> k_layouts{
+    {msg::Image::encoding_rgb8, 6, CV_8UC3},
+    {msg::Image::encoding_bgr8, 6, CV_8UC3},
+    {msg::Image::encoding_mono8, 6, CV_8UC1},
+    {msg::Image::encoding_mono16, 6, CV_16UC1},
+    {msg::Image::encoding_rgba8, 6, CV_8UC4},
+    {msg::Image::encoding_bgra8, 6, CV_8UC4},
+    {msg::Image::encoding_bayer_rggb8, 6, CV_8UC1},
+    {msg::Image::encoding_bayer_bggr8, 6, CV_8UC1},
+    {msg::Image::encoding_bayer_rggb16, 6, CV_16UC1},
+    {msg::Image::encoding_bayer_bggbr16, 6, CV_16UC1},
+    {msg::Image::encoding_yuv422, 6, CV_8UC2},
+    {msg::Image::encoding_yuv420, 9, CV_8UC1},
+};
+
+static cv::Mat makeMat(int rows, int cols, int type) {
+    cv::Mat mat(rows, cols, type);
+    cv::randu(mat, cv::Scalar::all(0), cv::Scalar::all(255));
+    return mat;
+}
+
+static bool sameMat(const cv::Mat &lhs, const cv::Mat &rhs) {
+    return lhs.size() == rhs.size() && lhs.type() == rhs.type() && cv::norm(lhs, rhs, cv::NORM_INF) == 0;
+}
+
+TEST(LPSS_cvmsg, image_roundtrip_all_encodings) {
+    for (const auto &[encoding, rows, type] : k_layouts) {
+        const auto mat = makeMat(rows, 8, type);
+        const auto img = cvmsg::to_msg(mat, encoding);
+        EXPECT_EQ(img.height, 6) << +encoding;
+        EXPECT_EQ(img.width, 8) << +encoding;
+        EXPECT_EQ(img.data.size(), mat.total() * mat.elemSize()) << +encoding;
+        EXPECT_TRUE(sameMat(cvmsg::from_msg(img), mat)) << +encoding;
+
+        // MatImage 与 msg::Image 的序列化结果一致，可以互相反序列化
+        const cvmsg::MatImage mat_img(mat, encoding);
+        const auto str = mat_img.serialize();
+        EXPECT_EQ(str, img.serialize()) << +encoding;
+        EXPECT_EQ(str.size(), mat_img.compact_size()) << +encoding;
+        const auto back = cvmsg::MatImage::deserialize(str.data());
+        EXPECT_EQ(back.encoding, encoding);
+        EXPECT_TRUE(sameMat(back.image, mat)) << +encoding;
+        EXPECT_EQ(msg::Image::deserialize(str.data()).data, img.data) << +encoding;
+    }
+}
+
+TEST(LPSS_cvmsg, view_shares_message_buffer) {
+    for (const auto &[encoding, rows, type] : k_layouts) {
+        auto img = cvmsg::to_msg(makeMat(rows, 8, type), encoding);
+        auto mat = cvmsg::view(img);
+        ASSERT_FALSE(mat.empty()) << +encoding;
+        EXPECT_EQ(mat.data, img.data.data()) << +encoding;
+        EXPECT_EQ(mat.rows, rows);
+        EXPECT_EQ(mat.type(), type);
+        mat.setTo(cv::Scalar::all(7));
+        EXPECT_EQ(img.data.front(), 7) << +encoding;
+
+        const auto &cimg = img;
+        EXPECT_EQ(cvmsg::view(cimg).data, img.data.data()) << +encoding;
+
+#if __cplusplus >= 202002L
+        // 订阅回调中的消息视图直接引用接收缓冲区
+        const auto str = img.serialize();
+        const auto img_view = msg::ImageView::parse(std::as_bytes(std::span(str.data(), str.size())));
+        ASSERT_TRUE(img_view.has_value());
+        const auto vmat = cvmsg::view(*img_view);
+        EXPECT_EQ(vmat.data, img_view->data.data()) << +encoding;
+        EXPECT_TRUE(sameMat(vmat, mat)) << +encoding;
+#endif
+    }
+}
+
+TEST(LPSS_cvmsg, non_continuous_roi) {
+    const auto full = makeMat(40, 60, CV_8UC3);
+    const auto roi = full(cv::Rect(5, 7, 21, 13));
+    ASSERT_FALSE(roi.isContinuous());
+
+    // to_msg 与 MatImage 均按行复制 ROI，得到的数据连续且与 ROI 一致
+    const auto img = cvmsg::to_msg(roi, msg::Image::encoding_bgr8);
+    EXPECT_EQ(img.data.size(), roi.total() * roi.elemSize());
+    EXPECT_TRUE(sameMat(cvmsg::view(img), roi));
+
+    // MatImage 只持有 ROI 的引用，不复制像素
+    const cvmsg::MatImage mat_img(roi, msg::Image::encoding_bgr8);
+    EXPECT_EQ(mat_img.image.data, roi.data);
+    const auto str = mat_img.serialize();
+    EXPECT_EQ(str, img.serialize());
+    EXPECT_EQ(str.size(), mat_img.compact_size());
+    EXPECT_TRUE(sameMat(cvmsg::MatImage::deserialize(str.data()).image, roi));
+    EXPECT_EQ(mat_img.to_msg().data, img.data);
+}
+
+TEST(LPSS_cvmsg, size_mismatch_rejected) {
+    auto img = cvmsg::to_msg(makeMat(6, 8, CV_8UC3), msg::Image::encoding_bgr8);
+    ASSERT_FALSE(cvmsg::from_msg(img).empty());
+
+    // 数据长度与尺寸不符
+    img.data.pop_back();
+    EXPECT_TRUE(cvmsg::view(img).empty());
+    EXPECT_TRUE(cvmsg::from_msg(img).empty());
+    EXPECT_TRUE(cvmsg::MatImage::deserialize(img.serialize().data()).image.empty());
+
+    // 尺寸远超 data_size 的伪造消息在分配前被拒绝
+    img.data.push_back(0);
+    img.height = img.width = 0x7fffffff;
+    EXPECT_TRUE(cvmsg::view(img).empty());
+    EXPECT_TRUE(cvmsg::MatImage::deserialize(img.serialize().data()).image.empty());
+
+    // 未知编码
+    img.height = 6, img.width = 8;
+    img.encoding = 0xff;
+    EXPECT_TRUE(cvmsg::from_msg(img).empty());
+    EXPECT_TRUE(cvmsg::to_msg(makeMat(6, 8, CV_8UC3), 0xff).data.empty());
+}
+
+} // namespace rm_test
+
+#endif
@@ -0,0 +1,253 @@
+/**
+ * @file test_image_transport.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 图像传输编解码单元测试
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/util.hpp"
+#include "rmvl/lpss/image_transport.hpp"
+#include "rmvl/rmvl_modules.hpp"
+
+namespace rm_test {
+
+using namespace rm;
+using namespace rm::lpss;
+
+//! 渐变背景 + 方块，方块左上角位于 (x0, y0)，4 通道图像的 alpha 恒为 255
+static msg::Image makeImage(int32_t height, int32_t width, uint8_t encoding, int x0 = 8, int y0 = 8) {
+    msg::Image img{};
+    img.height = height;
+    img.width = width;
+    img.encoding = encoding;
+    img.data.resize(imageBytes(height, width, encoding));
+    const std::size_t c = img.data.size() / (static_cast<std::size_t>(height) * width);
+    for (int32_t y = 0; y < height; ++y)
+        for (int32_t x = 0; x < width; ++x)
+            for (std::size_t k = 0; k < c; ++k) {
+                const bool box = x >= x0 && x < x0 + 10 && y >= y0 && y < y0 + 10;
+                const auto value = k == 3 ? 255 : box ? 200 + 20 * k : x + 2 * y + 40 * k;
+                img.data[(static_cast<std::size_t>(y) * width + x) * c + k] = static_cast<uint8_t>(value);
+            }
+    return img;
+}
+
+TEST(LPSS_image_transport, builtin_transports_registered) {
+    const auto names = imageTransports();
+    for (const char *name : {"raw", "qoi", "delta"})
+        EXPECT_NE(std::find(names.begin(), names.end(), name), names.end()) << name;
+    EXPECT_EQ(createImageTransport("unknown"), nullptr);
+    EXPECT_THROW(ImageEncoder("unknown"), rm::Exception);
+}
+
+TEST(LPSS_image_transport, qoi_lossless_roundtrip) {
+    for (auto encoding : {msg::Image::encoding_bgr8, msg::Image::encoding_mono8, msg::Image::encoding_rgba8}) {
+        auto img = makeImage(48, 64, encoding);
+        img.header.frame_id = "camera";
+        ImageEncoder encoder("qoi");
+        auto packet = encoder.encode(img);
+        EXPECT_EQ(packet.format, "qoi");
+        EXPECT_LT(packet.data.size(), img.data.size());
+
+        ImageDecoder decoder;
+        msg::Image out{};
+        ASSERT_TRUE(decoder.decode(packet, out));
+        EXPECT_EQ(out.header.frame_id, "camera");
+        EXPECT_EQ(out.height, img.height);
+        EXPECT_EQ(out.width, img.width);
+        EXPECT_EQ(out.encoding, img.encoding);
+        EXPECT_EQ(out.data, img.data);
+
+        // 截断的数据应解码失败
+        packet.data.pop_back();
+        EXPECT_FALSE(decoder.decode(packet, out));
+    }
+}
+
+TEST(LPSS_image_transport, unsupported_encoding_falls_back_to_raw) {
+    auto img = makeImage(16, 16, msg::Image::encoding_mono16);
+    ImageEncoder encoder("qoi");
+    auto packet = encoder.encode(img);
+    EXPECT_EQ(packet.format, "raw");
+    ImageDecoder decoder;
+    EXPECT_EQ(decoder.decode(packet).data, img.data);
+}
+
+TEST(LPSS_image_transport, delta_keyframe_and_delta_frames) {
+    ImageTransportOptions options{};
+    options.keyframe_interval = 4;
+    ImageEncoder encoder("delta", options);
+    ImageDecoder decoder;
+
+    std::vector<msg::CompressedImage> packets{};
+    std::vector<msg::Image> frames{};
+    for (int k = 0; k < 6; ++k) {
+        frames.push_back(makeImage(64, 80, msg::Image::encoding_bgr8, 8 + k, 8));
+        packets.push_back(encoder.encode(frames.back()));
+    }
+    // 第 0、4 帧为关键帧，其余为依赖最近关键帧的差分帧
+    for (int k = 0; k < 6; ++k) {
+        const uint32_t key = k < 4 ? 0 : 4;
+        EXPECT_EQ(packets[k].sequence, static_cast<uint32_t>(k));
+        EXPECT_EQ(packets[k].reference, key);
+    }
+    EXPECT_LT(packets[1].data.size(), packets[0].data.size() / 4);
+
+    // 丢失差分帧不影响后续帧
+    for (int k : {0, 2, 3, 4, 5}) {
+        msg::Image out{};
+        ASSERT_TRUE(decoder.decode(packets[k], out)) << k;
+        EXPECT_EQ(out.data, frames[k].data) << k;
+    }
+
+    // 缺少关键帧时差分帧无法解码
+    ImageDecoder late;
+    msg::Image out{};
+    EXPECT_FALSE(late.decode(packets[1], out));
+    EXPECT_TRUE(late.decode(packets[4], out));
+    EXPECT_TRUE(late.decode(packets[5], out));
+    EXPECT_EQ(out.data, frames[5].data);
+}
+
+TEST(LPSS_image_transport, delta_threshold_bounds_error) {
+    ImageTransportOptions options{};
+    options.delta_threshold = 3;
+    ImageEncoder encoder("delta", options);
+    ImageDecoder decoder;
+
+    auto key = makeImage(32, 32, msg::Image::encoding_mono8);
+    ASSERT_FALSE(decoder.decode(encoder.encode(key)).data.empty());
+    // 叠加不超过阈值的噪声，差分帧应几乎为空，且误差不超过阈值
+    auto noisy = key;
+    for (std::size_t i = 0; i < noisy.data.size(); ++i)
+        noisy.data[i] = static_cast<uint8_t>(noisy.data[i] + i % 4);
+    auto packet = encoder.encode(noisy);
+    EXPECT_LE(packet.data.size(), 1u);
+    auto out = decoder.decode(packet);
+    ASSERT_EQ(out.data.size(), noisy.data.size());
+    for (std::size_t i = 0; i < out.data.size(); ++i)
+        EXPECT_LE(std::abs(out.data[i] - noisy.data[i]), 3);
+}
+
+TEST(LPSS_image_transport, forged_dimensions_rejected_before_allocation) {
+    auto img = makeImage(16, 16, msg::Image::encoding_bgr8);
+    for (const char *name : {"qoi", "delta"}) {
+        ImageEncoder encoder(name);
+        auto packet = encoder.encode(img);
+        ASSERT_EQ(packet.format, name);
+        // 载荷只有几百字节，却声称是一幅约 2^31 x 2^31 的图像
+        packet.height = packet.width = 0x7fffffff;
+        ImageDecoder decoder;
+        msg::Image out{};
+        bool ok = true;
+        EXPECT_NO_THROW(ok = decoder.decode(packet, out)) << name;
+        EXPECT_FALSE(ok) << name;
+    }
+
+    // 未压缩的关键帧必须与图像尺寸完全一致
+    msg::CompressedImage packet{};
+    packet.format = "delta";
+    packet.height = packet.width = 0x10000;
+    packet.encoding = msg::Image::encoding_mono8;
+    packet.data = {'K', 0, 1, 2, 3};
+    ImageDecoder decoder;
+    msg::Image out{};
+    EXPECT_FALSE(decoder.decode(packet, out));
+}
+
+#ifdef HAVE_OPENCV
+
+TEST(LPSS_image_transport, png_lossless_roundtrip) {
+    for (auto encoding : {msg::Image::encoding_mono8, msg::Image::encoding_mono16, msg::Image::encoding_bgr8, msg::Image::encoding_rgba8}) {
+        auto img = makeImage(48, 64, encoding);
+        ImageEncoder encoder("png");
+        auto packet = encoder.encode(img);
+        EXPECT_EQ(packet.format, "png");
+        EXPECT_EQ(packet.reference, packet.sequence);
+        EXPECT_LT(packet.data.size(), img.data.size());
+
+        ImageDecoder decoder;
+        msg::Image out{};
+        ASSERT_TRUE(decoder.decode(packet, out));
+        EXPECT_EQ(out.height, img.height);
+        EXPECT_EQ(out.width, img.width);
+        EXPECT_EQ(out.encoding, img.encoding);
+        EXPECT_EQ(out.data, img.data);
+
+        // 截断的数据应解码失败
+        packet.data.resize(packet.data.size() / 2);
+        EXPECT_FALSE(decoder.decode(packet, out));
+    }
+}
+
+TEST(LPSS_image_transport, jpeg_lossy_roundtrip) {
+    ImageTransportOptions options{};
+    options.quality = 90;
+    for (auto encoding : {msg::Image::encoding_mono8, msg::Image::encoding_bgr8}) {
+        auto img = makeImage(48, 64, encoding);
+        ImageEncoder encoder("jpeg", options);
+        auto packet = encoder.encode(img);
+        EXPECT_EQ(packet.format, "jpeg");
+        EXPECT_LT(packet.data.size(), img.data.size());
+
+        ImageDecoder decoder;
+        msg::Image out{};
+        ASSERT_TRUE(decoder.decode(packet, out));
+        EXPECT_EQ(out.encoding, img.encoding);
+        ASSERT_EQ(out.data.size(), img.data.size());
+        std::size_t error{};
+        for (std::size_t i = 0; i < img.data.size(); ++i)
+            error += static_cast<std::size_t>(std::abs(static_cast<int>(out.data[i]) - static_cast<int>(img.data[i])));
+        EXPECT_LT(static_cast<double>(error) / img.data.size(), 3.0);
+    }
+
+    // JPEG 不支持 4 通道与 16 位图像，空图像无法编码，均回退为不压缩的格式
+    ImageEncoder encoder("jpeg", options);
+    EXPECT_EQ(encoder.encode(makeImage(16, 16, msg::Image::encoding_rgba8)).format, "raw");
+    EXPECT_EQ(encoder.encode(makeImage(16, 16, msg::Image::encoding_mono16)).format, "raw");
+    msg::Image empty{};
+    empty.encoding = msg::Image::encoding_bgr8;
+    EXPECT_EQ(encoder.encode(empty).format, "raw");
+}
+
+#endif // HAVE_OPENCV
+
+TEST(LPSS_image_transport, custom_transport_plugin) {
+    //! 仅保留第一行的示例传输
+    class FirstRow final : public ImageTransport {
+    public:
+        bool encode(const msg::Image &image, msg::CompressedImage &packet) override {
+            const auto row = image.data.size() / image.height;
+            packet.reference = packet.sequence;
+            packet.data.assign(image.data.begin(), image.data.begin() + row);
+            return true;
+        }
+        bool decode(const msg::CompressedImage &packet, msg::Image &image) override {
+            image.data.clear();
+            for (int32_t y = 0; y < packet.height; ++y)
+                image.data.insert(image.data.end(), packet.data.begin(), packet.data.end());
+            return true;
+        }
+    };
+    EXPECT_TRUE(registerImageTransport("test_first_row", [](const ImageTransportOptions &) { return std::make_unique<FirstRow>(); }));
+    EXPECT_FALSE(registerImageTransport("test_first_row", nullptr));
+
+    auto img = makeImage(4, 6, msg::Image::encoding_mono8);
+    ImageEncoder encoder("test_first_row");
+    auto packet = encoder.encode(img);
+    EXPECT_EQ(packet.format, "test_first_row");
+    EXPECT_EQ(packet.data.size(), 6u);
+    ImageDecoder decoder;
+    EXPECT_EQ(decoder.decode(packet).data.size(), img.data.size());
+}
+
+} // namespace rm_test
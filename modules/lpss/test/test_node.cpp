@@ -11,7 +11,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
+#include <cstring>
+#include <functional>
+#include <mutex>
 #include <thread>
 
 #ifdef _WIN32
@@ -75,8 +79,107 @@ public:
     using DataWriterBase::DataWriterBase;
 
     void addWithMtu(lpss::Guid guid, lpss::Locator locator, uint32_t mtu) { _udpv4_targets[guid] = {locator, mtu}; }
+    void addMulticast(lpss::Guid guid, lpss::Locator locator) { _udpv4_targets[guid] = {locator, 1500, true}; }
 };
 
+/**
+ * @brief 环回丢包代理
+ * @details 将写入器发往代理的数据报按丢包规则转发至读取器，并将读取器回复的控制报文转发回写入器
+ */
+class LossyProxy {
+public:
+    //! 丢包规则，参数为数据报序号与内容，返回 `true` 表示丢弃
+    using DropRule = std::function<bool(std::size_t, std::string_view)>;
+
+    LossyProxy(uint16_t reader_port, DropRule drop)
+        : _front(Listener(Endpoint(ip::udp::v4(), Endpoint::ANY_PORT)).create()), _back(Listener(Endpoint(ip::udp::v4(), Endpoint::ANY_PORT)).create()),
+          _reader_port(reader_port), _drop(std::move(drop)) {
+        _front_port = _front.endpoint().port();
+        _back_port = _back.endpoint().port();
+        _forward = std::thread([this] {
+            for (std::size_t index = 0; _running.load(); ++index) {
+                auto [data, addr, port] = _front.read();
+                if (!_running.load())
+                    break;
+                _writer_port.store(port);
+                if (std::string_view(data).substr(0, 4) == "MT02")
+                    ++_fragments;
+                if (_drop(index, data))
+                    continue;
+                _back.write("127.0.0.1", Endpoint(ip::udp::v4(), _reader_port), data);
+            }
+        });
+        _backward = std::thread([this] {
+            while (_running.load()) {
+                auto [data, addr, port] = _back.read();
+                if (!_running.load())
+                    break;
+                if (std::string_view(data).substr(0, 4) == "MN01")
+                    ++_nacks;
+                _front.write("127.0.0.1", Endpoint(ip::udp::v4(), _writer_port.load()), data);
+            }
+        });
+    }
+
+    ~LossyProxy() {
+        _running.store(false);
+        _front.write("127.0.0.1", Endpoint(ip::udp::v4(), _front_port), std::string_view("\0", 1));
+        _back.write("127.0.0.1", Endpoint(ip::udp::v4(), _back_port), std::string_view("\0", 1));
+        _forward.join();
+        _backward.join();
+    }
+
+    //! 写入器应发往的定位器
+    lpss::Locator locator() const { return {_front_port, {127, 0, 0, 1}}; }
+    //! 写入器发出的数据分片总数，包括被丢弃的分片
+    std::size_t fragments() const { return _fragments.load(); }
+    //! 读取器发出的 NACK 总数
+    std::size_t nacks() const { return _nacks.load(); }
+
+private:
+    DgramSocket _front;
+    DgramSocket _back;
+    uint16_t _front_port{};
+    uint16_t _back_port{};
+    uint16_t _reader_port{};
+    std::atomic_uint16_t _writer_port{};
+    DropRule _drop;
+    std::atomic_bool _running{true};
+    std::atomic_size_t _fragments{};
+    std::atomic_size_t _nacks{};
+    std::thread _forward;
+    std::thread _backward;
+};
+
+//! 在截止时间前从读取器中读取 `count` 条消息
+std::vector<std::string> readMessages(lpss::DataReaderBase &reader, std::size_t count, std::chrono::milliseconds timeout) {
+    std::vector<std::string> received{};
+    std::mutex mtx{};
+    std::thread reader_thread([&] {
+        while (true) {
+            auto data = reader.read();
+            if (data.empty())
+                break;
+            std::lock_guard lk(mtx);
+            received.push_back(std::move(data));
+            if (received.size() == count)
+                break;
+        }
+    });
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        {
+            std::lock_guard lk(mtx);
+            if (received.size() == count)
+                break;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    reader.stop();
+    reader_thread.join();
+    return received;
+}
+
 #if __cplusplus >= 202002L
 class TestAsyncDataWriter : public lpss::async::DataWriterBase {
 public:
@@ -173,6 +276,21 @@ TEST(LPSS_node, mtp_reassembles_out_of_order_and_ignores_duplicates) {
     EXPECT_EQ(received, "HelloWorld");
 }
 
+TEST(LPSS_node, mtp_reassembles_when_fragment_size_is_inferred_late) {
+    lpss::DataReaderBase reader(lpss::Guid{1}, msg::String::msg_type, "/mtp");
+    auto sender = Sender(ip::udp::v4()).create();
+    std::string received{};
+    std::thread reader_thread([&]() { received = reader.read(); });
+
+    // 中间分片无法单独确定分片大小，需暂存至后续分片到达
+    sendFragment(sender, reader.port(), 20, 1, 11, "efgh");
+    sendFragment(sender, reader.port(), 20, 2, 11, "ijk");
+    sendFragment(sender, reader.port(), 20, 0, 11, "abcd");
+    reader_thread.join();
+
+    EXPECT_EQ(received, "abcdefghijk");
+}
+
 TEST(LPSS_node, mtp_discards_conflicting_duplicate_fragment) {
     lpss::DataReaderBase reader(lpss::Guid{1}, msg::String::msg_type, "/mtp");
     auto sender = Sender(ip::udp::v4()).create();
@@ -223,6 +341,236 @@ TEST(LPSS_node, mtp_evicts_old_incomplete_sequence_at_budget) {
     EXPECT_EQ(received, "0123456789");
 }
 
+TEST(LPSS_node, mtp_reliable_recovers_lost_fragments) {
+    auto previous_period = para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD;
+    para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD = 5;
+
+    lpss::DataReaderBase reader(lpss::Guid{1}, msg::String::msg_type, "/mtp");
+    // 丢弃 20% 的数据报，包括分片、心跳、NACK 之外的重传分片
+    LossyProxy proxy(reader.port(), [](std::size_t index, std::string_view) { return index % 5 == 2; });
+    TestDataWriter writer(lpss::Guid{2}, msg::String::msg_type, "/mtp", lpss::QoS::reliable());
+    writer.addWithMtu(lpss::Guid{3}, proxy.locator(), 512);
+
+    std::vector<std::string> payloads{};
+    for (int i = 0; i < 3; ++i)
+        payloads.emplace_back(8192, static_cast<char>('a' + i));
+    std::thread writer_thread([&] {
+        for (const auto &payload : payloads)
+            writer.write(payload);
+    });
+    auto received = readMessages(reader, payloads.size(), 2s);
+    writer_thread.join();
+    para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD = previous_period;
+
+    std::sort(received.begin(), received.end());
+    EXPECT_EQ(received, payloads);
+    EXPECT_GT(proxy.nacks(), 0u);
+}
+
+TEST(LPSS_node, mtp_reliable_recovers_whole_lost_message) {
+    auto previous_period = para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD;
+    para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD = 5;
+
+    lpss::DataReaderBase reader(lpss::Guid{1}, msg::String::msg_type, "/mtp");
+    // 在第一个心跳到达前丢弃全部分片，读取器只能通过心跳得知消息的存在
+    LossyProxy proxy(reader.port(), [heartbeat = false](std::size_t, std::string_view data) mutable {
+        heartbeat = heartbeat || data.substr(0, 4) == "MH01";
+        return !heartbeat;
+    });
+    TestDataWriter writer(lpss::Guid{2}, msg::String::msg_type, "/mtp", lpss::QoS::reliable());
+    writer.addWithMtu(lpss::Guid{3}, proxy.locator(), 512);
+
+    std::string payload(4096, 'u');
+    writer.write(payload);
+    auto received = readMessages(reader, 1, 1s);
+    para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD = previous_period;
+
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received.front(), payload);
+}
+
+TEST(LPSS_node, mtp_reliable_retransmission_is_bounded) {
+    auto previous_period = para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD;
+    auto previous_retransmit = para::lpss_param.MTP_RELIABLE_MAX_RETRANSMIT;
+    para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD = 2;
+    para::lpss_param.MTP_RELIABLE_MAX_RETRANSMIT = 3;
+
+    lpss::DataReaderBase reader(lpss::Guid{1}, msg::String::msg_type, "/mtp");
+    // 数据分片全部丢失，只放行心跳
+    LossyProxy proxy(reader.port(), [](std::size_t, std::string_view data) { return data.substr(0, 4) == "MT02"; });
+    std::vector<std::string> received{};
+    {
+        TestDataWriter writer(lpss::Guid{2}, msg::String::msg_type, "/mtp", lpss::QoS::reliable());
+        writer.addWithMtu(lpss::Guid{3}, proxy.locator(), 1500);
+        writer.write("lost");
+        received = readMessages(reader, 1, 300ms);
+    }
+    para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD = previous_period;
+    para::lpss_param.MTP_RELIABLE_MAX_RETRANSMIT = previous_retransmit;
+
+    EXPECT_TRUE(received.empty());
+    // 单分片消息：首次发送 1 次，之后最多重传 3 次
+    EXPECT_EQ(proxy.fragments(), 4u);
+    EXPECT_GE(proxy.nacks(), 3u);
+}
+
+TEST(LPSS_node, mtp_best_effort_writer_sends_no_heartbeat) {
+    lpss::DataReaderBase reader(lpss::Guid{1}, msg::String::msg_type, "/mtp");
+    std::atomic_size_t heartbeats{};
+    LossyProxy proxy(reader.port(), [&heartbeats](std::size_t, std::string_view data) {
+        if (data.substr(0, 4) == "MH01")
+            ++heartbeats;
+        return data.substr(0, 4) == "MT02";
+    });
+    TestDataWriter writer(lpss::Guid{2}, msg::String::msg_type, "/mtp");
+    writer.addWithMtu(lpss::Guid{3}, proxy.locator(), 1500);
+    writer.write("lost");
+    std::this_thread::sleep_for(50ms);
+
+    EXPECT_EQ(heartbeats.load(), 0u);
+    EXPECT_EQ(proxy.nacks(), 0u);
+}
+
+TEST(LPSS_node, mtp_multicast_sends_one_copy_to_group_readers) {
+    auto previous_loopback = para::lpss_param.MTP_MULTICAST_LOOPBACK;
+    para::lpss_param.MTP_MULTICAST_LOOPBACK = true;
+
+    lpss::DataReaderBase reader1(lpss::Guid{1}, msg::String::msg_type, "/mtp_multicast", lpss::QoS::multicastBestEffort(), 37);
+    lpss::DataReaderBase reader2(lpss::Guid{4}, msg::String::msg_type, "/mtp_multicast", lpss::QoS::multicastBestEffort(), 37);
+    if (!reader1.multicast() || !reader2.multicast()) {
+        para::lpss_param.MTP_MULTICAST_LOOPBACK = previous_loopback;
+        GTEST_SKIP() << "IPv4 multicast is unavailable";
+    }
+    // 读取器的单播定位器指向诱饵 Socket，读取器只能通过多播收到数据
+    auto decoy = Listener(Endpoint(ip::udp::v4(), Endpoint::ANY_PORT)).create();
+    lpss::Locator decoy_locator{decoy.endpoint().port(), {127, 0, 0, 1}};
+    TestDataWriter writer(lpss::Guid{2}, msg::String::msg_type, "/mtp_multicast", lpss::QoS::multicastBestEffort(), 37);
+    writer.addMulticast(lpss::Guid{3}, decoy_locator);
+    writer.addMulticast(lpss::Guid{5}, decoy_locator);
+
+    std::string payload(4000, 'm');
+    writer.write(payload);
+    auto received1 = readMessages(reader1, 1, 1s);
+    auto received2 = readMessages(reader2, 1, 1s);
+    para::lpss_param.MTP_MULTICAST_LOOPBACK = previous_loopback;
+
+    EXPECT_EQ(received1, std::vector<std::string>{payload});
+    EXPECT_EQ(received2, std::vector<std::string>{payload});
+    // 本机环回的数据报保序，诱饵 Socket 收到的第一个数据报应为此处的标记
+    decoy.write("127.0.0.1", Endpoint(ip::udp::v4(), decoy_locator.port), "mark");
+    EXPECT_EQ(decoy.read().data, "mark");
+}
+
+TEST(LPSS_node, mtp_multicast_falls_back_to_unicast_below_min_readers) {
+    auto previous_loopback = para::lpss_param.MTP_MULTICAST_LOOPBACK;
+    para::lpss_param.MTP_MULTICAST_LOOPBACK = true;
+
+    lpss::DataReaderBase reader(lpss::Guid{1}, msg::String::msg_type, "/mtp_multicast", lpss::QoS::multicastBestEffort(), 38);
+    TestDataWriter writer(lpss::Guid{2}, msg::String::msg_type, "/mtp_multicast", lpss::QoS::multicastBestEffort(), 38);
+    writer.addMulticast(lpss::Guid{3}, {reader.port(), {127, 0, 0, 1}});
+    writer.write("unicast");
+    // 多播读取器数量不足时只发送单播，读取器不应收到第二份副本
+    auto received = readMessages(reader, 2, 200ms);
+    para::lpss_param.MTP_MULTICAST_LOOPBACK = previous_loopback;
+
+    EXPECT_EQ(received, std::vector<std::string>{"unicast"});
+}
+
+TEST(LPSS_node, mtp_transient_local_replays_history_to_late_reader) {
+    TestDataWriter writer(lpss::Guid(1, 1, 1), msg::String::msg_type, "/mtp", lpss::QoS::transientLocal(2));
+    writer.write("first");
+    writer.write("second");
+    writer.write("third");
+
+    // 读取器在写入之后才被匹配，只能收到最近 2 条缓存消息
+    lpss::DataReaderBase reader(lpss::Guid(2, 1, 1), msg::String::msg_type, "/mtp");
+    writer.add(reader.guid(), {reader.port(), {127, 0, 0, 1}});
+    auto received = readMessages(reader, 3, 200ms);
+
+    EXPECT_EQ(received, (std::vector<std::string>{"second", "third"}));
+}
+
+TEST(LPSS_node, mtp_transient_local_skips_expired_history) {
+    auto qos = lpss::QoS::transientLocal();
+    qos.lifespan = 20ms;
+    TestDataWriter writer(lpss::Guid(1, 1, 1), msg::String::msg_type, "/mtp", qos);
+    writer.write("stale");
+    std::this_thread::sleep_for(40ms);
+
+    lpss::DataReaderBase reader(lpss::Guid(2, 1, 1), msg::String::msg_type, "/mtp");
+    writer.add(reader.guid(), {reader.port(), {127, 0, 0, 1}});
+    auto received = readMessages(reader, 1, 100ms);
+
+    EXPECT_TRUE(received.empty());
+}
+
+TEST(LPSS_node, mtp_deadline_counts_missed_periods) {
+    lpss::DeadlineMonitor disabled(0ms);
+    disabled.mark();
+    EXPECT_EQ(disabled.missed(), 0u);
+
+    lpss::DeadlineMonitor monitor(10ms);
+    // 首个事件之前不计数
+    std::this_thread::sleep_for(25ms);
+    EXPECT_EQ(monitor.missed(), 0u);
+    monitor.mark();
+    std::this_thread::sleep_for(35ms);
+    auto pending = monitor.missed();
+    EXPECT_GE(pending, 3u);
+    monitor.mark();
+    EXPECT_GE(monitor.missed(), pending);
+}
+
+TEST(LPSS_node, mtp_reader_deadline_counts_silent_periods) {
+    auto qos = lpss::QoS::bestEffort();
+    qos.deadline = 10ms;
+    lpss::DataReaderBase reader(lpss::Guid(2, 1, 1), msg::String::msg_type, "/mtp", qos);
+    auto sender = Sender(ip::udp::v4()).create();
+    sendFragment(sender, reader.port(), 30, 0, 4, "tick");
+    ASSERT_EQ(readMessages(reader, 1, 200ms).size(), 1u);
+    std::this_thread::sleep_for(25ms);
+    EXPECT_GE(reader.missedDeadlines(), 2u);
+}
+
+TEST(LPSS_node, invalid_handles_report_no_missed_deadlines) {
+    EXPECT_EQ(lpss::Publisher<msg::String>(nullptr).missedDeadlines(), 0u);
+    EXPECT_EQ(lpss::Subscriber<msg::String>(nullptr).missedDeadlines(), 0u);
+}
+
+#if __cplusplus >= 202002L
+
+TEST(LPSS_node, mtp_view_subscriber_drops_malformed_payload) {
+    std::mutex mtx{};
+    std::string received{};
+    std::atomic_bool done{};
+    lpss::DataReader<msg::String> reader(lpss::Guid{1}, "/mtp", [&](const msg::StringView &view) {
+        std::lock_guard lk(mtx);
+        received = std::string(view.data);
+        done = true;
+    });
+    auto sender = Sender(ip::udp::v4()).create();
+
+    // 长度前缀声明 100 字节，但载荷只有 2 字节
+    std::string malformed(4, '\0');
+    uint32_t fake_size = 100;
+    std::memcpy(malformed.data(), &fake_size, sizeof(fake_size));
+    malformed += "ab";
+    sendFragment(sender, reader.port(), 17, 0, static_cast<uint32_t>(malformed.size()), malformed);
+    msg::String valid{};
+    valid.data = "in place";
+    auto payload = valid.serialize();
+    sendFragment(sender, reader.port(), 18, 0, static_cast<uint32_t>(payload.size()), payload);
+
+    const auto deadline = std::chrono::steady_clock::now() + 500ms;
+    while (!done && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(1ms);
+
+    std::lock_guard lk(mtx);
+    EXPECT_EQ(received, "in place");
+}
+
+#endif
+
 TEST(LPSS_node, mtp_rejects_oversized_topic_or_type) {
     lpss::Node node("mtp_limits", 12);
     auto long_topic = std::string(64, 't');
@@ -313,6 +661,89 @@ TEST(LPSS_node, async_mtp_keeps_latest_pending_write) {
     EXPECT_EQ(received[1], payloads.back());
 }
 
+TEST(LPSS_node, async_mtp_transient_local_replays_history_to_late_reader) {
+    rm::async::IOContext io_context{};
+    auto writer = std::make_shared<TestAsyncDataWriter>(io_context, lpss::Guid(1, 1, 1), msg::String::msg_type, "/mtp", lpss::QoS::transientLocal(2));
+    lpss::async::DataReaderBase reader(io_context, lpss::Guid(2, 1, 1), msg::String::msg_type, "/mtp");
+
+    std::vector<std::string> received{};
+    auto run = [&]() -> rm::async::Task<> {
+        for (std::string payload : {"first", "second", "third"})
+            co_await writer->write(payload);
+        // 读取器在写入之后才被匹配，只能收到最近 2 条缓存消息
+        writer->add(reader.guid(), {reader.port(), {127, 0, 0, 1}});
+        for (std::size_t i = 0; i < 2; ++i)
+            received.push_back(co_await reader.read());
+        io_context.stop();
+    };
+    auto timeout = [&]() -> rm::async::Task<> {
+        rm::async::Timer timer(io_context);
+        co_await timer.sleep_for(1s);
+        io_context.stop();
+    };
+
+    co_spawn(io_context, run);
+    co_spawn(io_context, timeout);
+    io_context.run();
+    EXPECT_EQ(received, (std::vector<std::string>{"second", "third"}));
+}
+
+TEST(LPSS_node, async_mtp_reliable_recovers_lost_fragments) {
+    auto previous_period = para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD;
+    para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD = 5;
+
+    rm::async::IOContext io_context{};
+    lpss::async::DataReaderBase reader(io_context, lpss::Guid{1}, msg::String::msg_type, "/mtp");
+    // 首次发送时丢弃第 2 个分片，重传的分片正常放行
+    LossyProxy proxy(reader.port(), [](std::size_t index, std::string_view) { return index == 1; });
+    auto writer = std::make_shared<TestAsyncDataWriter>(io_context, lpss::Guid{2}, msg::String::msg_type, "/mtp", lpss::QoS::reliable());
+    writer->addWithMtu(lpss::Guid{3}, proxy.locator(), 512);
+    writer->start();
+
+    std::string payload(4096, 'r');
+    std::string received{};
+    auto read = [&]() -> rm::async::Task<> {
+        received = co_await reader.read();
+        writer->stop();
+        io_context.stop();
+    };
+    auto timeout = [&]() -> rm::async::Task<> {
+        rm::async::Timer timer(io_context);
+        co_await timer.sleep_for(1s);
+        io_context.stop();
+    };
+
+    co_spawn(io_context, read);
+    co_spawn(io_context, timeout);
+    co_spawn(io_context, &lpss::async::DataWriterBase::write, writer, payload);
+    io_context.run();
+    para::lpss_param.MTP_RELIABLE_HEARTBEAT_PERIOD = previous_period;
+
+    EXPECT_EQ(received, payload);
+    EXPECT_GT(proxy.nacks(), 0u);
+}
+
+TEST(LPSS_node, async_mtp_reader_deadline_counts_silent_periods) {
+    rm::async::IOContext io_context{};
+    auto qos = lpss::QoS::bestEffort();
+    qos.deadline = 10ms;
+    lpss::async::DataReaderBase reader(io_context, lpss::Guid{1}, msg::String::msg_type, "/mtp", qos);
+    TestAsyncDataWriter writer(io_context, lpss::Guid{2}, msg::String::msg_type, "/mtp");
+    writer.addWithMtu(lpss::Guid{3}, {reader.port(), {127, 0, 0, 1}}, 1500);
+
+    std::string received{};
+    auto read = [&]() -> rm::async::Task<> {
+        received = co_await reader.read();
+        io_context.stop();
+    };
+    co_spawn(io_context, read);
+    co_spawn(io_context, &lpss::async::DataWriterBase::write, &writer, std::string("tick"));
+    io_context.run();
+    ASSERT_EQ(received, "tick");
+    std::this_thread::sleep_for(25ms);
+    EXPECT_GE(reader.missedDeadlines(), 2u);
+}
+
 TEST(LPSS_node, async_mtp_rejects_oversized_topic) {
     lpss::async::Node node("async_mtp_limits", 12);
     auto publisher = node.createPublisher<msg::String>(std::string(64, 't'));
@@ -9,6 +9,8 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 
 #include <gtest/gtest.h>
@@ -564,8 +566,242 @@ TEST(LPSS_robotctl, plan_multistep_pose) {
     EXPECT_NEAR(result.position.y, waypoints.back().position.y, 1e-4);
     EXPECT_NEAR(result.position.z, waypoints.back().position.z, 1e-4);
 }
+
+TEST(LPSS_robotctl, solve_ik_returns_chain_joints) {
+    auto path = writeTempURDF(k_urdf_with_fixed, "test_fixed.urdf");
+    RobotPlanner rp(path);
+    EXPECT_TRUE(rp.solveIK("missing", {}).name.empty());
+
+    msg::JointState js;
+    js.name = {"joint1"};
+    js.position = {rm::PI / 3};
+    js.velocity = {0};
+    js.effort = {0};
+    rp.update(js);
+    const auto target = rp.linkpose("tool");
+
+    js.position = {0};
+    rp.update(js);
+    // 连续两次求解，第二次复用缓存的求解器并以上一次的解作为初值
+    for (int i = 0; i < 2; ++i) {
+        const auto solution = rp.solveIK("tool", target);
+        ASSERT_EQ(solution.name.size(), 1u);
+        EXPECT_EQ(solution.name[0], "joint1");
+        ASSERT_EQ(solution.position.size(), 1u);
+        EXPECT_NEAR(std::remainder(solution.position[0] - rm::PI / 3, 2 * rm::PI), 0.0, 1e-4);
+    }
+}
+
+TEST(LPSS_robotctl, plan_pose_seeds_ik_with_current_state) {
+    auto path = writeTempURDF(k_urdf_with_fixed, "test_fixed.urdf");
+    RobotPlanner rp(path);
+
+    msg::JointState js;
+    js.name = {"joint1"};
+    js.position = {2.5};
+    js.velocity = {0};
+    js.effort = {0};
+    rp.update(js);
+    const auto target = rp.linkpose("tool");
+
+    // 先以关节角 0 为起点求解，缓存的上一次解位于 2.5 附近
+    js.position = {0};
+    rp.update(js);
+    ASSERT_EQ(rp.solveIK("tool", target).position.size(), 1u);
+
+    // 起点移到 -3.0 后，等价解 2.5 - 2π 距起点更近，规划不应沿用上一次的解而绕行近一整圈
+    js.position = {-3.0};
+    rp.update(js);
+    const auto traj = rp.plan("tool", target);
+    ASSERT_FALSE(traj.points.empty());
+    EXPECT_NEAR(traj.points.front().positions[0], -3.0, 1e-9);
+    EXPECT_LT(std::abs(traj.points.back().positions[0] + 3.0), rm::PI);
+    EXPECT_NEAR(std::remainder(traj.points.back().positions[0] - 2.5, 2 * rm::PI), 0.0, 1e-4);
+}
+
+TEST(LPSS_robotctl, ik_options_setter_getter) {
+    auto path = writeTempURDF(k_urdf_2dof, "test_2dof.urdf");
+    RobotPlanner rp(path);
+    EXPECT_NEAR(rp.getIKOptions().tolerance, 1e-5, kEps);
+    EXPECT_EQ(rp.getIKOptions().max_iterations, 5000u);
+    EXPECT_TRUE(rp.getIKOptions().warm_start);
+
+    rp.setIKOptions({1e-6, 200, false});
+    EXPECT_NEAR(rp.getIKOptions().tolerance, 1e-6, kEps);
+    EXPECT_EQ(rp.getIKOptions().max_iterations, 200u);
+    EXPECT_FALSE(rp.getIKOptions().warm_start);
+
+    // 非法参数回退为默认值
+    rp.setIKOptions({-1.0, 0, true});
+    EXPECT_NEAR(rp.getIKOptions().tolerance, 1e-5, kEps);
+    EXPECT_EQ(rp.getIKOptions().max_iterations, 5000u);
+
+    // 参数修改后求解器按新参数重建
+    msg::Pose target;
+    target.position = {0.707107, 0.707107, 0.5};
+    target.orientation = {0, 0, 0.3827, 0.9239};
+    EXPECT_FALSE(rp.plan("link2", target).points.empty());
+}
+
+TEST(LPSS_robotctl, batch_solve_ik_matches_single_target) {
+    auto path = writeTempURDF(k_urdf_2dof, "test_2dof.urdf");
+    RobotPlanner rp(path);
+    EXPECT_TRUE(rp.solveIKBatch("missing", nullptr, 0).joint_names.empty());
+
+    // 半径 1 的圆上可达，圆外的目标不可达
+    std::vector<msg::Pose> targets(5);
+    const double radius[] = {1.0, 1.0, 3.0, 1.0, 1.0};
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        const double angle = 0.4 * static_cast<double>(i);
+        targets[i].position = {radius[i] * std::cos(angle), radius[i] * std::sin(angle), 0.5};
+        targets[i].orientation.w = 1;
+    }
+    const auto batch = rp.solveIKBatch("link2", targets.data(), targets.size());
+    ASSERT_EQ(batch.dof(), 2u);
+    EXPECT_EQ(batch.joint_names[0], "joint1");
+    EXPECT_EQ(batch.joint_names[1], "joint2");
+    ASSERT_EQ(batch.success.size(), targets.size());
+    EXPECT_FALSE(batch.success[2]);
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        if (i == 2)
+            continue;
+        ASSERT_TRUE(batch.success[i]);
+        const auto single = rp.solveIK("link2", targets[i]);
+        ASSERT_EQ(single.position.size(), 2u);
+        EXPECT_NEAR(std::remainder(batch.solution(i)[0] - single.position[0], 2 * rm::PI), 0.0, 1e-4);
+    }
+}
+
+TEST(LPSS_robotctl, reachability_map_build_and_serialize) {
+    auto path = writeTempURDF(k_urdf_2dof, "test_2dof.urdf");
+    RobotPlanner rp(path);
+
+    ReachabilityOptions options;
+    options.min = {-1.25, -1.25, 0.25};
+    options.max = {1.25, 1.25, 0.75};
+    options.resolution = 0.5;
+    const auto map = rp.buildReachabilityMap("link2", options);
+    ASSERT_EQ(map.size()[0], 5u);
+    ASSERT_EQ(map.size()[1], 5u);
+    ASSERT_EQ(map.size()[2], 1u);
+
+    // 仅圆周经过的 4 个体素中心可达
+    std::size_t reachable = 0;
+    for (uint32_t ix = 0; ix < 5; ++ix)
+        for (uint32_t iy = 0; iy < 5; ++iy)
+            reachable += map.reachable(map.center(ix, iy, 0));
+    EXPECT_EQ(reachable, 4u);
+    EXPECT_NEAR(map.score({1.1, 0.1, 0.6}), 1.0, kEps);
+    EXPECT_NEAR(map.score({0.0, -0.9, 0.4}), 1.0, kEps);
+    EXPECT_FALSE(map.reachable({0.0, 0.0, 0.5}));
+    EXPECT_FALSE(map.reachable({1.0, 0.0, 2.0}));
+
+    const auto restored = ReachabilityMap::deserialize(map.serialize());
+    ASSERT_FALSE(restored.empty());
+    EXPECT_EQ(restored.size(), map.size());
+    EXPECT_NEAR(restored.resolution(), 0.5, kEps);
+    EXPECT_NEAR(restored.origin().x, -1.25, kEps);
+    for (uint32_t ix = 0; ix < 5; ++ix)
+        for (uint32_t iy = 0; iy < 5; ++iy)
+            EXPECT_EQ(restored.score(map.center(ix, iy, 0)), map.score(map.center(ix, iy, 0)));
+    EXPECT_TRUE(ReachabilityMap::deserialize("RMRM").empty());
+}
 #endif // RMVL_LPSS_WITH_KDL
 
+TEST(LPSS_robotctl, toppra_respects_limits_and_blends_waypoints) {
+    std::string urdf = k_urdf_2dof;
+    const std::string limit = R"(<limit lower="-3.14" upper="3.14"/>)";
+    for (auto pos = urdf.find(limit); pos != std::string::npos; pos = urdf.find(limit, pos))
+        urdf.replace(pos, limit.size(), R"(<limit lower="-3.14" upper="3.14" velocity="2.0" jerk="200"/>)");
+    auto path = writeTempURDF(urdf.c_str(), "test_2dof_jerk.urdf");
+    RobotPlanner rp(path);
+
+    std::vector<msg::JointState> waypoints(3);
+    waypoints[0].position = {1.0, 0.5};
+    waypoints[1].position = {2.0, -0.5};
+    waypoints[2].position = {1.0, -1.0};
+    const auto quintic = rp.plan(waypoints);
+    ASSERT_FALSE(quintic.points.empty());
+
+    EXPECT_EQ(rp.getTimeParameterization(), TimeParameterization::Quintic);
+    rp.setTimeParameterization(TimeParameterization::TOPPRA);
+    EXPECT_EQ(rp.getTimeParameterization(), TimeParameterization::TOPPRA);
+    const auto topp = rp.plan(waypoints);
+    ASSERT_GT(topp.points.size(), 2u);
+
+    // 不在途经点停止，总时长短于逐段五次多项式
+    const auto &pts = topp.points;
+    EXPECT_LT(pts.back().time_from_start.nanoseconds, quintic.points.back().time_from_start.nanoseconds);
+    for (std::size_t i = 1; i < pts.size(); ++i)
+        EXPECT_GT(pts[i].time_from_start.nanoseconds, pts[i - 1].time_from_start.nanoseconds);
+    for (const auto &pt : pts) {
+        for (std::size_t j = 0; j < 2; ++j) {
+            EXPECT_LE(std::abs(pt.velocities[j]), 2.0 + 1e-6);
+            EXPECT_LE(std::abs(pt.accelerations[j]), 10.0 + 1e-6);
+        }
+    }
+
+    // 起止静止，每个途经点都落在轨迹上，中间途经点处速度不为零
+    for (std::size_t j = 0; j < 2; ++j) {
+        EXPECT_NEAR(pts.front().velocities[j], 0.0, kEps);
+        EXPECT_NEAR(pts.back().velocities[j], 0.0, kEps);
+        EXPECT_NEAR(pts.back().positions[j], waypoints.back().position[j], 1e-9);
+    }
+    for (const auto &wp : waypoints) {
+        const auto hit = std::find_if(pts.begin(), pts.end(), [&](const msg::JointTrajectoryPoint &pt) {
+            return std::abs(pt.positions[0] - wp.position[0]) < 1e-9 && std::abs(pt.positions[1] - wp.position[1]) < 1e-9;
+        });
+        ASSERT_NE(hit, pts.end());
+        if (&wp == &waypoints[1]) {
+            EXPECT_GT(std::hypot(hit->velocities[0], hit->velocities[1]), 0.1);
+        }
+    }
+}
+
+TEST(LPSS_robotctl, toppra_spline_overshoot_falls_back_to_quintic) {
+    // 三次样条在拐点 2.0 处越过 2.0，限位仅略高于途经点
+    std::string urdf = k_urdf_2dof;
+    const std::string limit = R"(<limit lower="-3.14" upper="3.14"/>)";
+    for (auto pos = urdf.find(limit); pos != std::string::npos; pos = urdf.find(limit, pos))
+        urdf.replace(pos, limit.size(), R"(<limit lower="-3.14" upper="2.005" velocity="2.0"/>)");
+    auto path = writeTempURDF(urdf.c_str(), "test_2dof_near_limit.urdf");
+    RobotPlanner rp(path);
+
+    std::vector<msg::JointState> waypoints(3);
+    waypoints[0].position = {1.0, 0.5};
+    waypoints[1].position = {2.0, -0.5};
+    waypoints[2].position = {1.0, -1.0};
+    const auto quintic = rp.plan(waypoints);
+    ASSERT_FALSE(quintic.points.empty());
+
+    rp.setTimeParameterization(TimeParameterization::TOPPRA);
+    const auto topp = rp.plan(waypoints);
+    ASSERT_FALSE(topp.points.empty());
+    EXPECT_EQ(topp.points.back().time_from_start.nanoseconds, quintic.points.back().time_from_start.nanoseconds);
+    for (const auto &pt : topp.points) {
+        EXPECT_LE(pt.positions[0], 2.005 + 1e-9);
+        EXPECT_LE(pt.positions[1], 2.005 + 1e-9);
+    }
+}
+
+TEST(LPSS_robotctl, toppra_stationary_target_falls_back_to_quintic) {
+    auto path = writeTempURDF(k_urdf_2dof, "test_2dof.urdf");
+    RobotPlanner rp(path);
+
+    // 目标与当前关节角重合，两种时间参数化方法的结果一致
+    msg::JointState target;
+    target.name = {"joint1", "joint2"};
+    target.position = {0.0, 0.0};
+    const auto quintic = rp.plan(target);
+    rp.setTimeParameterization(TimeParameterization::TOPPRA);
+    const auto topp = rp.plan(target);
+    ASSERT_EQ(topp.points.size(), quintic.points.size());
+    for (std::size_t i = 0; i < topp.points.size(); ++i) {
+        EXPECT_EQ(topp.points[i].time_from_start.nanoseconds, quintic.points[i].time_from_start.nanoseconds);
+        EXPECT_EQ(topp.points[i].positions, quintic.points[i].positions);
+    }
+}
+
 // setMaxVelocityScalingFactor / setMaxAccelerationScalingFactor
 TEST(LPSS_robotctl, scaling_factor_setter_getter) {
     auto path = writeTempURDF(k_urdf_2dof, "test_2dof.urdf");
@@ -614,4 +850,92 @@ TEST(LPSS_robotctl, scaling_factor_affects_duration) {
               traj_fast.points.back().time_from_start.nanoseconds);
 }
 
+TEST(LPSS_robotctl, urdf_parse_collision_primitives) {
+    lpss::URDFModel model;
+    model.parse(k_urdf_collision);
+
+    const auto &base = model.links[model.link_index.at("base_link")].collisions;
+    ASSERT_EQ(base.size(), 1u);
+    EXPECT_EQ(base[0].type, CollisionShapeType::Box);
+    EXPECT_NEAR(base[0].size[2], 0.1, kEps);
+    EXPECT_NEAR(base[0].origin.position.z, 0.05, kEps);
+
+    const auto &link1 = model.links[model.link_index.at("link1")].collisions;
+    ASSERT_EQ(link1.size(), 1u);
+    EXPECT_EQ(link1[0].type, CollisionShapeType::Capsule);
+    EXPECT_NEAR(link1[0].size[0], 0.05, kEps);
+    EXPECT_NEAR(link1[0].size[1], 0.4, kEps);
+
+    // mesh 被忽略
+    const auto &link2 = model.links[model.link_index.at("link2")].collisions;
+    ASSERT_EQ(link2.size(), 1u);
+    EXPECT_EQ(link2[0].type, CollisionShapeType::Cylinder);
+
+    const auto &tool = model.links[model.link_index.at("tool")].collisions;
+    ASSERT_EQ(tool.size(), 1u);
+    EXPECT_EQ(tool[0].type, CollisionShapeType::Sphere);
+    EXPECT_NEAR(tool[0].origin.orientation.w, 1.0, kEps);
+}
+
+TEST(LPSS_robotctl, self_collision_and_allowed_matrix) {
+    auto path = writeTempURDF(k_urdf_collision, "test_collision.urdf");
+    RobotPlanner rp(path);
+
+    msg::JointState state;
+    state.name = {"joint1", "joint2"};
+    state.position = {0.0, 0.0};
+    EXPECT_FALSE(rp.checkCollision(state));
+
+    // 相邻连杆 link1/link2 重叠但默认允许碰撞，tool 折回后与 link1 碰撞
+    state.position = {0.0, 3.0};
+    auto res = rp.checkCollision(state);
+    ASSERT_TRUE(res);
+    std::array<std::string, 2> pair{res.first, res.second};
+    std::sort(pair.begin(), pair.end());
+    EXPECT_EQ(pair[0], "link1");
+    EXPECT_EQ(pair[1], "tool");
+
+    rp.setAllowedCollision("tool", "link1");
+    EXPECT_FALSE(rp.checkCollision(state));
+    rp.setAllowedCollision("link1", "tool", false);
+    EXPECT_TRUE(rp.checkCollision(state));
+}
+
+TEST(LPSS_robotctl, environment_collision_along_trajectory) {
+    auto path = writeTempURDF(k_urdf_collision, "test_collision.urdf");
+    RobotPlanner rp(path);
+
+    CollisionShape obstacle{};
+    obstacle.type = CollisionShapeType::Box;
+    obstacle.size = {0.1, 0.1, 0.1};
+    obstacle.origin.position = {0.0, 1.0, 0.2};
+    rp.addCollisionObject("obstacle", obstacle);
+    EXPECT_THROW(rp.addCollisionObject("link1", obstacle), rm::Exception);
+
+    // 仅含首末两点的轨迹，两端均无碰撞，需依靠插值发现中途 joint1 ≈ π/2 处的碰撞
+    msg::JointTrajectory traj;
+    traj.joint_names = {"joint1"};
+    traj.points.resize(2);
+    traj.points[0].positions = {-0.5};
+    traj.points[1].positions = {2.0};
+    auto res = rp.checkCollision(traj);
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res.second, "obstacle");
+    EXPECT_EQ(res.segment, 0u);
+    EXPECT_GT(res.fraction, 0.7);
+    EXPECT_LT(res.fraction, 0.85);
+
+    // 规划得到的轨迹同样可以检测
+    msg::JointState target;
+    target.name = {"joint1", "joint2"};
+    target.position = {1.0, 0.0};
+    EXPECT_FALSE(rp.checkCollision(rp.plan(target)));
+    target.position = {2.0, 0.0};
+    EXPECT_TRUE(rp.checkCollision(rp.plan(target)));
+
+    EXPECT_TRUE(rp.removeCollisionObject("obstacle"));
+    EXPECT_FALSE(rp.removeCollisionObject("obstacle"));
+    EXPECT_FALSE(rp.checkCollision(traj));
+}
+
 } // namespace rm_test
@@ -206,4 +206,61 @@ constexpr const char *k_urdf_diagonal_axis = R"(<?xml version="1.0"?>
     <limit lower="-3.14" upper="3.14" effort="40" velocity="2.0"/>
   </joint>
 </robot>
-)";
\ No newline at end of file
+)";
+// 带碰撞几何体的 2-DOF URDF
+// base_link: 0.2x0.2x0.1 长方体，顶面 z=0.1
+// link1: 沿 x 轴的胶囊体（半径 0.05，轴段 x∈[0.05, 0.45]），高度 z=0.2
+// link2: 沿 x 轴的圆柱体，另含一个应被忽略的 mesh
+// tool: 位于 link2 末端 (0.5, 0, 0) 的球体，joint2 接近 ±π 时折回与 link1 碰撞
+constexpr const char *k_urdf_collision = R"(<?xml version="1.0"?>
+<robot name="test_collision">
+  <link name="base_link">
+    <collision>
+      <origin xyz="0 0 0.05" rpy="0 0 0"/>
+      <geometry><box size="0.2 0.2 0.1"/></geometry>
+    </collision>
+  </link>
+  <link name="link1">
+    <collision>
+      <origin xyz="0.25 0 0" rpy="0 1.5707963 0"/>
+      <geometry><capsule radius="0.05" length="0.4"/></geometry>
+    </collision>
+  </link>
+  <link name="link2">
+    <collision>
+      <origin xyz="0.25 0 0" rpy="0 1.5707963 0"/>
+      <geometry><cylinder radius="0.05" length="0.4"/></geometry>
+    </collision>
+    <collision>
+      <geometry><mesh filename="package://test/link2.stl"/></geometry>
+    </collision>
+  </link>
+  <link name="tool">
+    <collision>
+      <geometry><sphere radius="0.05"/></geometry>
+    </collision>
+  </link>
+
+  <joint name="joint1" type="revolute">
+    <parent link="base_link"/>
+    <child link="link1"/>
+    <origin xyz="0 0 0.2" rpy="0 0 0"/>
+    <axis xyz="0 0 1"/>
+    <limit lower="-3.14" upper="3.14"/>
+  </joint>
+
+  <joint name="joint2" type="revolute">
+    <parent link="link1"/>
+    <child link="link2"/>
+    <origin xyz="0.5 0 0" rpy="0 0 0"/>
+    <axis xyz="0 0 1"/>
+    <limit lower="-3.14" upper="3.14"/>
+  </joint>
+
+  <joint name="tool_joint" type="fixed">
+    <parent link="link2"/>
+    <child link="tool"/>
+    <origin xyz="0.5 0 0" rpy="0 0 0"/>
+  </joint>
+</robot>
+)";
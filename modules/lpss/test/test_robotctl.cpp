@@ -9,6 +9,10 @@
  *
  */
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
 #include <gtest/gtest.h>
 
 #include "rmvl/lpss/ctl/ff.hpp"
@@ -17,6 +21,32 @@
 
 namespace rm_test {
 
+//! 计数分配器开关，仅统计开启计数的线程上的分配
+static thread_local bool g_count_allocations = false;
+static std::atomic_size_t g_allocations{0};
+
+} // namespace rm_test
+
+void *operator new(std::size_t size) {
+    if (rm_test::g_count_allocations)
+        rm_test::g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size != 0 ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace rm_test {
+
 using namespace rm;
 using namespace lpss;
 
@@ -254,4 +284,43 @@ TEST(LPSS_ctl, robot_controller_velocity_tracking) {
     EXPECT_NEAR(cmd.velocity[0], 0.2, 0.01); // 允许一点误差
 }
 
+TEST(LPSS_ctl, robot_controller_tick_is_allocation_free) {
+    auto ctl_law = ctl::PID::create({1.0, 1.0, 1.0}, {0.1, 0.1, 0.1}, {0.01, 0.01, 0.01});
+    RobotController controller({"joint3", "joint1", "joint2"}, std::move(ctl_law));
+
+    msg::JointTrajectory traj{};
+    traj.joint_names = {"joint1", "joint2", "joint3"};
+    traj.points.resize(3);
+    for (std::size_t i = 0; i < traj.points.size(); ++i) {
+        traj.points[i].time_from_start.nanoseconds = static_cast<int64_t>(i) * 50'000'000;
+        traj.points[i].positions = {0.1 * i, 0.2 * i, 0.3 * i};
+        traj.points[i].velocities = {0.1, 0.2, 0.3};
+    }
+    ASSERT_TRUE(controller.submit(traj));
+
+    msg::JointState feedback{};
+    feedback.name = {"joint3", "joint1", "joint2"};
+    feedback.position = {0.0, 0.0, 0.0};
+    feedback.velocity = {0.0, 0.0, 0.0};
+    feedback.effort = {0.0, 0.0, 0.0};
+
+    // 首个周期为输出命令分配容量，之后的周期应完全复用
+    msg::JointState cmd{};
+    ASSERT_EQ(controller.sample(feedback, cmd), ctl::ControlStatus::Ok);
+    g_allocations = 0;
+    g_count_allocations = true;
+    for (int i = 0; i < 1000; ++i)
+        controller.sample(feedback, cmd);
+    g_count_allocations = false;
+    EXPECT_EQ(g_allocations.load(), 0u);
+    EXPECT_EQ(cmd.name, feedback.name);
+
+    // 计数器本身可以捕获分配
+    g_count_allocations = true;
+    auto copy = controller.sample(feedback);
+    g_count_allocations = false;
+    EXPECT_GT(g_allocations.load(), 0u);
+    EXPECT_EQ(copy.name, cmd.name);
+}
+
 } // namespace rm_test
@@ -9,6 +9,9 @@
  *
  */
 
+#include <cstring>
+#include <span>
+
 #include <gtest/gtest.h>
 
 #include "nlohmann/json.hpp"
@@ -18,6 +21,8 @@
 #include "rmvlmsg/std/string.hpp"
 #include "rmvlmsg/std/int32.hpp"
 #include "rmvlmsg/motion/joint_trajectory_point.hpp"
+#include "rmvlmsg/sensor/camera_info.hpp"
+#include "rmvlmsg/sensor/image.hpp"
 #include "rmvlmsg/sensor/imu.hpp"
 #include "rmvlmsg/sensor/joint_state.hpp"
 #include "rmvlmsg/geometry/polygon.hpp"
@@ -479,4 +484,112 @@ TEST(LPSS_serialization, nested_message_service) {
     EXPECT_EQ(data.size(), request.compact_size());
 }
 
+template <typename Message>
+static auto viewOf(const std::string &data) {
+    return Message::View::parse(std::as_bytes(std::span(data.data(), data.size())));
+}
+
+TEST(LPSS_serialization, image_view) {
+    msg::Image msg;
+    msg.header.frame_id = "camera";
+    msg.height = 2;
+    msg.width = 3;
+    msg.encoding = msg::Image::encoding_bgr8;
+    msg.data.resize(18);
+    for (std::size_t i = 0; i < msg.data.size(); ++i)
+        msg.data[i] = static_cast<uint8_t>(i * 7);
+
+    auto str = msg.serialize();
+    auto view = viewOf<msg::Image>(str);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->header.frame_id, "camera");
+    EXPECT_EQ(view->height, 2);
+    EXPECT_EQ(view->width, 3);
+    EXPECT_EQ(view->encoding, msg::Image::encoding_bgr8);
+    ASSERT_EQ(view->data.size(), msg.data.size());
+    EXPECT_TRUE(std::equal(view->data.begin(), view->data.end(), msg.data.begin()));
+    // 数组直接引用接收缓冲区
+    EXPECT_GE(reinterpret_cast<const char *>(view->data.data()), str.data());
+    EXPECT_LE(reinterpret_cast<const char *>(view->data.data() + view->data.size()), str.data() + str.size());
+    EXPECT_EQ(view->bytes().size(), str.size());
+
+    auto dst = view->to_msg();
+    EXPECT_EQ(dst.header.frame_id, "camera");
+    EXPECT_EQ(dst.data, msg.data);
+}
+
+TEST(LPSS_serialization, joint_state_view) {
+    msg::JointState msg;
+    msg.header.frame_id = "base_link";
+    msg.name = {"joint1", "", "joint3"};
+    msg.position = {0.1, -0.2, 0.3};
+    msg.velocity = {1.5};
+    msg.effort = {};
+
+    auto str = msg.serialize();
+    auto view = viewOf<msg::JointState>(str);
+    ASSERT_TRUE(view.has_value());
+    ASSERT_EQ(view->name.size(), 3u);
+    std::vector<std::string_view> names(view->name.begin(), view->name.end());
+    EXPECT_EQ(names, (std::vector<std::string_view>{"joint1", "", "joint3"}));
+    ASSERT_EQ(view->position.size(), 3u);
+    EXPECT_DOUBLE_EQ(view->position[1], -0.2);
+    EXPECT_DOUBLE_EQ(view->velocity[0], 1.5);
+    EXPECT_TRUE(view->effort.empty());
+
+    auto dst = view->to_msg();
+    EXPECT_EQ(dst.name, msg.name);
+    EXPECT_EQ(dst.position, msg.position);
+    EXPECT_EQ(dst.velocity, msg.velocity);
+}
+
+TEST(LPSS_serialization, nested_array_view) {
+    msg::Polygon msg;
+    msg.points = {{1.f, 2.f, 3.f}, {4.f, 5.f, 6.f}};
+    auto str = msg.serialize();
+    auto view = viewOf<msg::Polygon>(str);
+    ASSERT_TRUE(view.has_value());
+    ASSERT_EQ(view->points.size(), 2u);
+    std::vector<float> xs{};
+    for (const auto &pt : view->points)
+        xs.push_back(pt.x);
+    EXPECT_EQ(xs, (std::vector<float>{1.f, 4.f}));
+
+    msg::CameraInfo info;
+    info.header.frame_id = "camera";
+    info.K[0] = 1000.0;
+    info.D = {0.1, 0.2};
+    auto info_str = info.serialize();
+    auto info_view = viewOf<msg::CameraInfo>(info_str);
+    ASSERT_TRUE(info_view.has_value());
+    EXPECT_EQ(info_view->K.size(), 9u);
+    EXPECT_DOUBLE_EQ(info_view->K[0], 1000.0);
+    auto dst = info_view->to_msg();
+    EXPECT_EQ(dst.K, info.K);
+    EXPECT_EQ(dst.D, info.D);
+}
+
+TEST(LPSS_serialization, view_rejects_malformed_buffer) {
+    msg::JointState msg;
+    msg.header.frame_id = "base_link";
+    msg.name = {"joint1", "joint2"};
+    msg.position = {0.1, 0.2};
+    auto str = msg.serialize();
+
+    // 任意截断位置均不能越界读取
+    for (std::size_t len = 0; len < str.size(); ++len)
+        EXPECT_FALSE(msg::JointState::View::parse(std::as_bytes(std::span(str.data(), len))).has_value()) << "length: " << len;
+    // 多余的尾部字节视为长度不一致
+    EXPECT_FALSE(viewOf<msg::JointState>(str + '\0').has_value());
+
+    // 伪造超大的数组长度前缀
+    msg::Image img;
+    img.data = {1, 2, 3};
+    auto img_str = img.serialize();
+    auto prefix_offset = img.header.compact_size() + sizeof(img.height) + sizeof(img.width) + sizeof(img.encoding);
+    uint32_t huge = 0xffffffffu;
+    std::memcpy(img_str.data() + prefix_offset, &huge, sizeof(huge));
+    EXPECT_FALSE(viewOf<msg::Image>(img_str).has_value());
+}
+
 } // namespace rm_test
@@ -9,9 +9,18 @@
  *
  */
 
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <limits>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 #include <gtest/gtest.h>
 
@@ -227,6 +236,204 @@ TEST(LPSS_tf_Buffer, inserts_dynamic_and_static_batches) {
     EXPECT_NEAR(result.transform.transform.translation.x, 3.5, kEps);
 }
 
+TEST(LPSS_tf_Buffer, frame_handles_match_string_lookup) {
+    Buffer buffer;
+    const auto map = buffer.frame("map");
+    EXPECT_TRUE(map.valid());
+    EXPECT_EQ(buffer.frame("map"), map);
+    EXPECT_FALSE(buffer.frame("").valid());
+
+    const auto camera = buffer.frame("camera");
+    EXPECT_EQ(buffer.lookup(map, camera).status, Status::FrameNotFound);
+    EXPECT_EQ(buffer.lookup(FrameId{}, camera).status, Status::InvalidArgument);
+
+    ASSERT_EQ(buffer.set(makeTransform("map", "odom", 10, 1.0)), Status::Ok);
+    ASSERT_EQ(buffer.set(makeTransform("map", "odom", 20, 3.0, 0.0, 0.0, yawQuaternion(1.0))), Status::Ok);
+    ASSERT_EQ(buffer.setStatic(makeTransform("odom", "camera", 0, 0.0, 1.0)), Status::Ok);
+
+    const auto by_name = buffer.lookup("map", "camera", {15, 0});
+    const auto by_id = buffer.lookup(map, camera, {15, 0});
+    ASSERT_TRUE(by_name);
+    ASSERT_TRUE(by_id);
+    EXPECT_EQ(by_id.stamp.sec, 15);
+    EXPECT_NEAR(by_id.transform.translation.x, by_name.transform.transform.translation.x, kEps);
+    EXPECT_NEAR(by_id.transform.translation.y, by_name.transform.transform.translation.y, kEps);
+    EXPECT_NEAR(by_id.transform.rotation.z, by_name.transform.transform.rotation.z, kEps);
+    EXPECT_TRUE(buffer.can(camera, map));
+
+    buffer.clear();
+    EXPECT_EQ(buffer.lookup(map, camera).status, Status::FrameNotFound);
+    ASSERT_EQ(buffer.setStatic(makeTransform("map", "camera", 0, 2.0)), Status::Ok);
+    EXPECT_EQ(buffer.frame("camera"), camera);
+    const auto reused = buffer.lookup(map, camera);
+    ASSERT_TRUE(reused);
+    EXPECT_NEAR(reused.transform.translation.x, 2.0, kEps);
+}
+
+TEST(LPSS_tf_Buffer, long_history_spans_sample_chunks) {
+    Buffer buffer(1000s);
+    for (int32_t sec = 0; sec < 500; sec += 2)
+        ASSERT_EQ(buffer.set(makeTransform("odom", "base_link", sec, sec)), Status::Ok);
+    for (int32_t sec = 1; sec < 500; sec += 2)
+        ASSERT_EQ(buffer.set(makeTransform("odom", "base_link", sec, sec)), Status::Ok);
+
+    for (int32_t sec = 0; sec < 499; ++sec) {
+        const auto result = buffer.lookup("odom", "base_link", {sec, 500'000'000u});
+        ASSERT_TRUE(result) << sec;
+        EXPECT_NEAR(result.transform.transform.translation.x, sec + 0.5, kEps);
+    }
+
+    buffer.setCacheDuration(100s);
+    EXPECT_EQ(buffer.lookup("odom", "base_link", {398, 0}).status, Status::ExtrapolationPast);
+    const auto oldest = buffer.lookup("odom", "base_link", {399, 0});
+    ASSERT_TRUE(oldest);
+    EXPECT_NEAR(oldest.transform.transform.translation.x, 399.0, kEps);
+}
+
+TEST(LPSS_tf_Buffer, batch_transform_matches_per_point_lookup) {
+    Buffer buffer;
+    ASSERT_EQ(buffer.setStatic(makeTransform("map", "odom", 0, 1.0, -2.0, 0.5, yawQuaternion(0.3))), Status::Ok);
+    ASSERT_EQ(buffer.set(makeTransform("odom", "camera", 10, 0.2, 0.0, 0.1, {0.1, 0.2, 0.3, 0.9})), Status::Ok);
+
+    std::vector<msg::Point> points(1000);
+    std::vector<msg::Pose> poses(300);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        points[i] = {0.01 * i, -0.02 * i, std::sin(0.1 * i)};
+    for (std::size_t i = 0; i < poses.size(); ++i)
+        poses[i] = {{0.5 * i, 1.0, -0.1 * i}, yawQuaternion(0.01 * i)};
+
+    const auto chain = buffer.lookup("map", "camera");
+    ASSERT_TRUE(chain);
+    std::vector<msg::Point> transformed_points(points.size());
+    ASSERT_EQ(buffer.transform("map", "camera", {}, points.data(), transformed_points.data(), points.size()), Status::Ok);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        const auto expected = chain.transform.transform * points[i];
+        EXPECT_NEAR(transformed_points[i].x, expected.x, kEps);
+        EXPECT_NEAR(transformed_points[i].y, expected.y, kEps);
+        EXPECT_NEAR(transformed_points[i].z, expected.z, kEps);
+    }
+
+    // 原地转换位姿
+    auto transformed_poses = poses;
+    ASSERT_EQ(buffer.transform(buffer.frame("map"), buffer.frame("camera"), {}, transformed_poses.data(), transformed_poses.data(), poses.size()), Status::Ok);
+    for (std::size_t i = 0; i < poses.size(); ++i) {
+        const auto expected = chain.transform.transform * poses[i];
+        EXPECT_NEAR(transformed_poses[i].position.x, expected.position.x, kEps);
+        EXPECT_NEAR(transformed_poses[i].position.y, expected.position.y, kEps);
+        EXPECT_NEAR(transformed_poses[i].position.z, expected.position.z, kEps);
+        EXPECT_NEAR(transformed_poses[i].orientation.x, expected.orientation.x, kEps);
+        EXPECT_NEAR(transformed_poses[i].orientation.y, expected.orientation.y, kEps);
+        EXPECT_NEAR(transformed_poses[i].orientation.z, expected.orientation.z, kEps);
+        EXPECT_NEAR(transformed_poses[i].orientation.w, expected.orientation.w, kEps);
+    }
+
+    auto untouched = points;
+    EXPECT_EQ(buffer.transform("map", "camera", {11, 0}, points.data(), untouched.data(), points.size()), Status::ExtrapolationFuture);
+    EXPECT_NEAR(untouched.back().x, points.back().x, kEps);
+    EXPECT_EQ(buffer.transform("map", "missing", {}, points.data(), untouched.data(), points.size()), Status::FrameNotFound);
+    EXPECT_EQ(buffer.transform("map", "camera", {}, points.data(), nullptr, points.size()), Status::InvalidArgument);
+#if __cplusplus >= 202002L
+    EXPECT_EQ(buffer.transform("map", "camera", {}, std::span<const msg::Point>(points), std::span<msg::Point>(untouched).first(1)), Status::InvalidArgument);
+    EXPECT_EQ(buffer.transform("map", "camera", {}, std::span<const msg::Point>(points), std::span<msg::Point>(untouched)), Status::Ok);
+    EXPECT_NEAR(untouched.back().x, transformed_points.back().x, kEps);
+#endif
+}
+
+TEST(LPSS_tf_Buffer, extrapolation_policies_use_boundary_velocity) {
+    Buffer buffer;
+    ASSERT_EQ(buffer.set(makeTransform("odom", "base_link", 10, 1.0, 0.0, 0.0, yawQuaternion(0.0))), Status::Ok);
+    ASSERT_EQ(buffer.set(makeTransform("odom", "base_link", 11, 2.0, 0.0, 0.0, yawQuaternion(0.1))), Status::Ok);
+    ASSERT_EQ(buffer.set(makeTransform("odom", "base_link", 12, 4.0, 0.0, 0.0, yawQuaternion(0.3))), Status::Ok);
+    EXPECT_EQ(buffer.extrapolation().mode, Extrapolation::None);
+    EXPECT_EQ(buffer.lookup("odom", "base_link", {14, 0}).status, Status::ExtrapolationFuture);
+
+    buffer.setExtrapolation(ExtrapolationPolicy::constantVelocity());
+    const auto future = buffer.lookup("odom", "base_link", {14, 0});
+    ASSERT_TRUE(future);
+    EXPECT_NEAR(future.transform.transform.translation.x, 8.0, kEps);
+    EXPECT_NEAR(future.transform.transform.rotation.z, std::sin(0.35), kEps);
+    EXPECT_NEAR(future.transform.transform.rotation.w, std::cos(0.35), kEps);
+
+    const auto past = buffer.lookup("odom", "base_link", {9, 500'000'000u});
+    ASSERT_TRUE(past);
+    EXPECT_NEAR(past.transform.transform.translation.x, 0.5, kEps);
+    EXPECT_NEAR(past.transform.transform.rotation.z, std::sin(-0.025), kEps);
+
+    // 区间内仍然插值，零时间查询不外推
+    EXPECT_NEAR(buffer.lookup("odom", "base_link", {11, 500'000'000u}).transform.transform.translation.x, 3.0, kEps);
+    EXPECT_EQ(buffer.lookup("odom", "base_link").transform.header.stamp.sec, 12);
+
+    buffer.setExtrapolation(ExtrapolationPolicy::bounded(500ms));
+    EXPECT_NEAR(buffer.lookup("odom", "base_link", {12, 500'000'000u}).transform.transform.translation.x, 5.0, kEps);
+    EXPECT_EQ(buffer.lookup("odom", "base_link", {12, 500'000'001u}).status, Status::ExtrapolationFuture);
+    EXPECT_EQ(buffer.lookup("odom", "base_link", {9, 0}).status, Status::ExtrapolationPast);
+
+    Buffer single;
+    single.setExtrapolation(ExtrapolationPolicy::constantVelocity());
+    ASSERT_EQ(single.set(makeTransform("odom", "base_link", 10, 1.0)), Status::Ok);
+    const auto held = single.lookup("odom", "base_link", {20, 0});
+    ASSERT_TRUE(held);
+    EXPECT_NEAR(held.transform.transform.translation.x, 1.0, kEps);
+}
+
+TEST(LPSS_tf_Buffer, time_travel_lookup_goes_through_fixed_frame) {
+    Buffer buffer;
+    ASSERT_EQ(buffer.set(makeTransform("odom", "base_link", 10, 0.0)), Status::Ok);
+    ASSERT_EQ(buffer.set(makeTransform("odom", "base_link", 12, 2.0, 0.0, 0.0, yawQuaternion(1.0))), Status::Ok);
+    ASSERT_EQ(buffer.setStatic(makeTransform("base_link", "camera", 0, 0.0, 0.0, 1.0)), Status::Ok);
+
+    // 10 s 时相机坐标系中的点在 12 s 时底盘坐标系中的位置
+    const auto result = buffer.lookup("base_link", {12, 0}, "camera", {10, 0}, "odom");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.transform.header.frame_id, "base_link");
+    EXPECT_EQ(result.transform.child_frame_id, "camera");
+    EXPECT_EQ(result.transform.header.stamp.sec, 12);
+    const auto point = result.transform.transform * msg::Point{0.0, 0.0, 0.0};
+    EXPECT_NEAR(point.x, -2.0 * std::cos(1.0), kEps);
+    EXPECT_NEAR(point.y, 2.0 * std::sin(1.0), kEps);
+    EXPECT_NEAR(point.z, 1.0, kEps);
+
+    const auto by_id = buffer.lookup(buffer.frame("base_link"), {12, 0}, buffer.frame("camera"), {10, 0}, buffer.frame("odom"));
+    ASSERT_TRUE(by_id);
+    EXPECT_NEAR(by_id.transform.translation.x, result.transform.transform.translation.x, kEps);
+    EXPECT_NEAR(by_id.transform.rotation.z, result.transform.transform.rotation.z, kEps);
+
+    const auto same_time = buffer.lookup("base_link", {11, 0}, "camera", {11, 0}, "odom");
+    ASSERT_TRUE(same_time);
+    EXPECT_NEAR(same_time.transform.transform.translation.z, 1.0, kEps);
+    EXPECT_EQ(buffer.lookup("base_link", {13, 0}, "camera", {10, 0}, "odom").status, Status::ExtrapolationFuture);
+    EXPECT_EQ(buffer.lookup("base_link", {12, 0}, "camera", {10, 0}, "missing").status, Status::FrameNotFound);
+}
+
+TEST(LPSS_tf_Buffer, lookups_run_concurrently_with_writes) {
+    Buffer buffer(1s);
+    ASSERT_EQ(buffer.setStatic(makeTransform("base_link", "camera", 0, 0.5)), Status::Ok);
+    ASSERT_EQ(buffer.set(makeTransform("odom", "base_link", 1, 1.0)), Status::Ok);
+    const auto odom = buffer.frame("odom");
+    const auto camera = buffer.frame("camera");
+
+    std::atomic_bool stop{};
+    std::thread writer([&] {
+        for (int32_t sec = 2; !stop.load(); ++sec)
+            buffer.set(makeTransform("odom", "base_link", sec, 1.0));
+    });
+    std::vector<std::thread> readers{};
+    std::atomic_size_t failures{};
+    for (int i = 0; i < 4; ++i)
+        readers.emplace_back([&] {
+            for (int n = 0; n < 20000; ++n) {
+                const auto result = buffer.lookup(odom, camera);
+                if (!result || std::abs(result.transform.translation.x - 1.5) > kEps)
+                    ++failures;
+            }
+        });
+    for (auto &reader : readers)
+        reader.join();
+    stop = true;
+    writer.join();
+    EXPECT_EQ(failures.load(), 0u);
+}
+
 TEST(LPSS_tf_transport, sync_endpoints_are_released) {
     lpss::Node node("tf_sync_lifecycle", 45);
     Buffer buffer;
@@ -255,6 +462,44 @@ TEST(LPSS_tf_transport, sync_endpoints_are_released) {
     node.destroyPublisher(static_pub);
 }
 
+#ifndef _WIN32
+
+TEST(LPSS_tf_transport, late_listener_receives_all_static_frames) {
+    // 同一进程内的节点 GUID 相同、互不发现，静态变换由子进程发布
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        lpss::Node node("tf_static_pub", 47);
+        StaticBroadcaster static_broadcaster("robot", node);
+        static_broadcaster.send(makeTransform("base_link", "camera_link", 0, 0.1));
+        static_broadcaster.send(makeTransform("base_link", "imu_link", 0, 0.0, 0.2));
+        static_broadcaster.send(makeTransform("base_link", "camera_link", 0, 0.3));
+        std::this_thread::sleep_for(3s);
+        _exit(0);
+    }
+
+    // 等待子进程发布完毕后再创建监听器
+    std::this_thread::sleep_for(200ms);
+    lpss::Node node("tf_static_sub", 47);
+    Buffer buffer;
+    lpss::tf::Listener listener("robot", node, buffer);
+    ASSERT_FALSE(listener.invalid());
+    const auto deadline = std::chrono::steady_clock::now() + 2s;
+    while (std::chrono::steady_clock::now() < deadline && !(buffer.lookup("base_link", "camera_link") && buffer.lookup("base_link", "imu_link")))
+        std::this_thread::sleep_for(1ms);
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+
+    const auto camera = buffer.lookup("base_link", "camera_link");
+    const auto imu = buffer.lookup("base_link", "imu_link");
+    ASSERT_TRUE(camera);
+    ASSERT_TRUE(imu);
+    EXPECT_NEAR(camera.transform.transform.translation.x, 0.3, kEps);
+    EXPECT_NEAR(imu.transform.transform.translation.y, 0.2, kEps);
+}
+
+#endif
+
 #if __cplusplus >= 202002L
 
 TEST(LPSS_tf_transport, async_endpoints_are_released) {
@@ -138,6 +138,20 @@ public:
     CollisionStopResult filter(const Costmap &costmap, const std::vector<msg::Point> &footprint,
                                const msg::Pose &pose, const msg::Twist &command) const;
 
+    /**
+     * @brief 使用预先栅格化的 footprint 对速度指令执行预测碰撞过滤
+     * @details 结果与使用 `footprint.polygon()` 调用另一重载相同。footprint 只需在机器人外形或地图分辨率改变时重新构造，
+     *          每个采样位姿只按行扫描对应朝向的掩码，适合每个控制周期都要检查大量采样位姿的场景
+     *
+     * @param[in] costmap 已更新的代价地图
+     * @param[in] footprint 按代价地图分辨率栅格化的机器人 footprint
+     * @param[in] pose 机器人在代价地图坐标系中的当前位姿
+     * @param[in] command 待过滤的平面速度指令
+     * @return 过滤结果
+     */
+    CollisionStopResult filter(const Costmap &costmap, const Footprint &footprint,
+                               const msg::Pose &pose, const msg::Twist &command) const;
+
 private:
     CollisionStopOptions _options{};
 };
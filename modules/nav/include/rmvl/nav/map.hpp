@@ -17,8 +17,13 @@
 #include <string_view>
 #include <vector>
 
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
 #include "rmvlmsg/geometry/pose.hpp"
 #include "rmvlmsg/nav/occupancy_grid.hpp"
+#include "rmvlmsg/nav/occupancy_grid_tile_update.hpp"
 #include "rmvlmsg/nav/occupancy_grid_update.hpp"
 
 namespace rm::nav {
@@ -33,10 +38,10 @@ enum class MapStatus : uint8_t {
     Ok,                 //!< 操作成功
     InvalidResolution,  //!< 分辨率不是有限正数
     InvalidDimensions,  //!< 地图或更新区域尺寸无效、溢出或数据长度不匹配
-    InvalidOrigin,      //!< 地图原点不是有效的平面位姿
+    InvalidOrigin,      //!< 地图原点或传感器位姿不是有效的平面位姿
     InvalidValue,       //!< 栅格值不在 \f$[-1,\,100]\f$ 范围
     InvalidProbability, //!< 概率不是 \f$[0,\,1]\f$ 范围内的有限值
-    InvalidOptions,     //!< 代价地图配置无效
+    InvalidOptions,     //!< 代价地图或扫描融合配置无效
     InvalidRevision,    //!< 新版本号未严格递增或本地版本已溢出
     RevisionMismatch,   //!< 增量基线版本与当前地图不一致
     FrameMismatch,      //!< 增量与地图不属于同一坐标系
@@ -59,6 +64,25 @@ struct Cell {
     uint32_t y{}; //!< 纵向索引
 };
 
+//! 分块地图增量中各分块的编码方式
+enum class TileEncoding : uint8_t {
+    Raw,       //!< 逐栅格原样存储
+    RunLength, //!< 行程编码，编码结果不短于原始数据的分块仍原样存储
+};
+
+/**
+ * @brief 激光扫描融合配置
+ * @details 占据概率以对数赔率形式累积，命中与未命中观测分别叠加固定的对数赔率增量，
+ * 累积结果被限制在 \f$[p_{min},\,p_{max}]\f$ 对应的范围内，使长期静止的栅格仍能较快响应环境变化
+ */
+struct ScanOptions {
+    double max_range{30.0};       //!< 最大有效量程，单位为米，超出量程或为正无穷的光束只清除至该距离
+    double hit_probability{0.7};  //!< 光束终点被占据的观测概率，取值范围为 \f$(0.5,\,1)\f$
+    double miss_probability{0.4}; //!< 光束途经栅格被占据的观测概率，取值范围为 \f$(0,\,0.5)\f$
+    double min_probability{0.12}; //!< 累积占据概率下限 \f$p_{min}\f$
+    double max_probability{0.97}; //!< 累积占据概率上限 \f$p_{max}\f$，需满足 \f$0<p_{min}<p_{max}<1\f$
+};
+
 /**
  * @brief 二维占据栅格内存模型
  * @details
@@ -68,10 +92,14 @@ struct Cell {
  * - 每次成功且实际改变地图内容的本地 API 调用视为一次修改，版本递增 1
  * - 一次调用即使修改多个栅格也只递增一次版本
  * - 合并矩形增量时采用消息携带的目标版本
+ * - 本地修改同时按 `tile_size × tile_size` 的分块记录，分散的修改可只发布变化的分块
  * @note 该类不提供内部同步。跨线程访问时由调用方加锁。
  */
 class GridMap {
 public:
+    //! 本地修改分块记录使用的分块边长，单位为格
+    static constexpr uint32_t tile_size = 64;
+
     //! 构造空地图
     GridMap();
     /**
@@ -215,6 +243,55 @@ public:
     MapStatus integrateRay(double start_x, double start_y, double end_x, double end_y, bool hit = true,
                            double free_probability = 0.3, double occupied_probability = 0.7);
 
+    /**
+     * @brief 融合一帧激光扫描
+     * @details
+     * - 第 `i` 条光束的方向为传感器朝向加上 `angle_min + i * angle_increment`
+     * - 先标记全部命中终点，再批量遍历各光束途经的栅格，同一帧内每个栅格只更新一次，命中优先于未命中
+     * - 内部维护对数赔率图层，栅格值为其量化结果；栅格被其他接口改写后，下次融合时以新的栅格值为先验
+     * - 非有限或不为正的距离视为无效光束直接跳过，正无穷视为无回波
+     *
+     * @param[in] origin 传感器在地图所属坐标系中的平面位姿，允许位于地图外
+     * @param[in] ranges 各光束的测距结果，单位为米
+     * @param[in] count 光束数量
+     * @param[in] angle_min 第一条光束相对传感器朝向的角度，单位为弧度
+     * @param[in] angle_increment 相邻光束的角度间隔，单位为弧度
+     * @param[in] options 扫描融合配置
+     * @return 地图操作状态
+     * @remark 一次调用只作为一次地图修改，仅当量化后的栅格值改变时版本递增 1。
+     * @remark 地图版本已达到上限时直接返回 MapStatus::InvalidRevision，不修改地图。
+     */
+    MapStatus integrateScan(const msg::Pose &origin, const float *ranges, std::size_t count, double angle_min,
+                            double angle_increment, const ScanOptions &options = {});
+
+#if __cplusplus >= 202002L
+    /**
+     * @brief 融合一帧激光扫描
+     * @see integrateScan(const msg::Pose &, const float *, std::size_t, double, double, const ScanOptions &)
+     *
+     * @param[in] origin 传感器在地图所属坐标系中的平面位姿，允许位于地图外
+     * @param[in] ranges 各光束的测距结果，单位为米
+     * @param[in] angle_min 第一条光束相对传感器朝向的角度，单位为弧度
+     * @param[in] angle_increment 相邻光束的角度间隔，单位为弧度
+     * @param[in] options 扫描融合配置
+     * @return 地图操作状态
+     */
+    MapStatus integrateScan(const msg::Pose &origin, std::span<const float> ranges, double angle_min,
+                            double angle_increment, const ScanOptions &options = {}) {
+        return integrateScan(origin, ranges.data(), ranges.size(), angle_min, angle_increment, options);
+    }
+#endif
+
+    /**
+     * @brief 以相同几何的全量地图覆盖地图内容
+     * @details 逐分块比较后只写入变化的栅格并记录为本地修改，适合将 Costmap::message() 等整图输出转为分块增量发布
+     *
+     * @param[in] grid 坐标系、尺寸、分辨率和原点均与当前地图一致的全量占据栅格
+     * @return 地图操作状态
+     * @remark 内容实际发生变化时作为一次地图修改，版本递增 1，并采用 @p grid 的时间戳，@p grid 携带的版本被忽略。
+     */
+    MapStatus assign(const msg::OccupancyGrid &grid);
+
     /**
      * @brief 合并矩形地图增量
      *
@@ -225,6 +302,18 @@ public:
      */
     MapStatus apply(const msg::OccupancyGridUpdate &update);
 
+    /**
+     * @brief 合并分块地图增量
+     * @details 先校验全部分块的坐标、数据长度与栅格值，再统一解码写入地图。分块允许与其他来源使用不同的分块边长，
+     *          但不能超过地图的较长边（本类的 tile_size 除外）；分块坐标重复时视为无效
+     *
+     * @param[in] update 待合并的分块增量消息
+     * @return 地图操作状态
+     * @remark 合并成功后采用 @p update 携带的目标版本。
+     * @remark 合并失败时保持地图数据和版本不变，订阅端应重新获取全量地图。
+     */
+    MapStatus apply(const msg::OccupancyGridTileUpdate &update);
+
     /**
      * @brief 获取尚未清除的本地地图增量
      *
@@ -233,6 +322,15 @@ public:
      */
     std::optional<msg::OccupancyGridUpdate> pendingUpdate() const;
 
+    /**
+     * @brief 获取尚未清除的本地分块增量
+     *
+     * @param[in] encoding 分块编码方式
+     * @return 存在本地修改时返回全部发生过修改的分块，按分块行优先排列，否则返回 `std::nullopt`
+     * @note 与 pendingUpdate() 共享同一份本地修改记录，二者的基线版本一致。
+     */
+    std::optional<msg::OccupancyGridTileUpdate> pendingTiles(TileEncoding encoding = TileEncoding::RunLength) const;
+
     //! 清除本地增量记录，不修改地图内容和版本
     void clearPendingUpdate() noexcept;
 
@@ -250,6 +348,55 @@ enum Cost : uint8_t {
     Unknown = 255,   //!< 未知空间
 };
 
+/**
+ * @brief 预先栅格化的机器人 footprint
+ * @details
+ * - 构造时按离散朝向与机器人中心在栅格内的离散偏移（每个方向 4 档）将多边形栅格化为掩码，
+ *   掩码覆盖对应区间内多边形可能接触的全部栅格，只会多覆盖、不会遗漏
+ * - 掩码分为必然与多边形相交的内部栅格和可能相交的边界栅格，内部栅格覆盖不可通行栅格时直接判定碰撞，
+ *   边界栅格先用凸包排除明显分离的情况，剩余的再做精确的多边形相交判断，因此结果与直接传入多边形顶点时一致
+ * - 外接圆半径超过 64 格的 footprint 不生成掩码，碰撞检测退回逐栅格的多边形检测
+ * @note 掩码以栅格为单位，只适用于分辨率相同的代价地图
+ */
+class Footprint {
+public:
+    /**
+     * @brief 栅格化机器人 footprint
+     *
+     * @param[in] polygon 机器人局部坐标系中的闭合多边形顶点，无需重复首顶点
+     * @param[in] resolution 目标代价地图的分辨率，单位为米/格
+     * @param[in] heading_bins 朝向离散数量，取值范围为 \f$[1,\,1024]\f$
+     * @remark 输入无效时构造为无效 footprint，可使用 valid() 检查。
+     */
+    Footprint(std::vector<msg::Point> polygon, double resolution, uint32_t heading_bins = 64);
+
+    //! @cond
+    ~Footprint();
+
+    Footprint(Footprint &&) noexcept;
+    Footprint &operator=(Footprint &&) noexcept;
+    Footprint(const Footprint &);
+    Footprint &operator=(const Footprint &);
+    //! @endcond
+
+    //! @return footprint 是否有效
+    bool valid() const noexcept;
+
+    //! @return 机器人局部坐标系中的多边形顶点
+    const std::vector<msg::Point> &polygon() const noexcept;
+
+    //! @return 栅格化使用的分辨率，单位为米/格
+    double resolution() const noexcept;
+
+    //! @return 朝向离散数量
+    uint32_t headingBins() const noexcept;
+
+private:
+    friend class Costmap;
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
 //! 分层代价地图配置
 struct CostmapOptions {
     int8_t lethal_threshold{65};      //!< 静态占据值达到该阈值时视为致命障碍
@@ -259,6 +406,7 @@ struct CostmapOptions {
     double inflation_radius{0.55};    //!< 障碍膨胀半径，单位为米
     double inscribed_radius{0.20};    //!< 机器人内切半径，单位为米
     double cost_scaling_factor{10.0}; //!< 膨胀区指数衰减系数
+    uint32_t threads{0};              //!< `updateCosts()` 合并图层时参与计算的线程数（含调用线程），0 表示使用硬件线程数
 };
 
 /**
@@ -321,9 +469,32 @@ public:
     //! @return 地图高度，单位为格
     uint32_t height() const noexcept;
 
+    //! @return 地图分辨率，单位为米/格，无效地图返回 0
+    double resolution() const noexcept;
+
     //! @return 代价地图所属坐标系，无效地图返回空字符串
     std::string_view frameId() const noexcept;
 
+    /**
+     * @brief 获取主代价地图的内容标识
+     * @details 每次 `updateCosts()` 实际改变主代价地图后更新为进程内唯一的新值，复制得到的代价地图与原对象标识相同，
+     *          可用于缓存由主代价地图派生的数据
+     *
+     * @return 内容标识，无效地图返回 0
+     */
+    uint64_t stamp() const noexcept;
+
+    /**
+     * @brief 获取指定内容标识之后主代价地图中代价值发生变化的栅格
+     * @details 代价地图记录最近若干次 `updateCosts()` 中代价值实际变化的栅格，供增量规划等派生数据局部修复。
+     *          单次变化或累计记录的栅格数超过地图面积的 1/16（至少 4096 格）时丢弃较早的记录
+     *
+     * @param[in] stamp 此前通过 stamp() 获取的内容标识
+     * @return 变化栅格，跨多次更新时可能包含重复栅格以及先变化后复原的栅格；记录已被丢弃或 @p stamp
+     *         不属于该地图的历史时返回 `std::nullopt`
+     */
+    std::optional<std::vector<Cell>> changesSince(uint64_t stamp) const;
+
     /**
      * @brief 将世界坐标转换为栅格坐标
      *
@@ -374,7 +545,11 @@ public:
      */
     MapStatus clearRay(double start_x, double start_y, double end_x, double end_y);
 
-    //! 合并静态层和局部障碍层，并根据配置重新计算膨胀代价
+    /**
+     * @brief 合并静态层和局部障碍层，并根据配置重新计算膨胀代价
+     * @details 静态层与局部障碍层的修改会记录变化栅格的包围盒，更新时只重新计算该包围盒向外扩展膨胀半径后的区域，
+     *          自上次更新以来没有修改时直接返回
+     */
     void updateCosts();
 
     /**
@@ -394,6 +569,20 @@ public:
      */
     bool collides(const std::vector<msg::Point> &footprint, const msg::Pose &pose) const;
 
+    /**
+     * @brief 使用预先栅格化的 footprint 检测碰撞
+     * @details 先检查机器人中心所在栅格，再按行扫描对应掩码覆盖的主代价，并在首次确认碰撞时立即返回。
+     *          中心栅格的膨胀代价表明最近的致命障碍远于掩码范围与内切半径之和时直接判定无碰撞，
+     *          因此膨胀半径大于 footprint 外接圆半径与内切半径之和时，远离障碍的位姿只需读取一个栅格；
+     *          未知栅格视为碰撞且地图中存在未知栅格时不使用该判定。
+     *          掩码超出地图边界或分辨率与地图不一致时退回逐栅格的多边形检测
+     *
+     * @param[in] footprint 预先栅格化的机器人 footprint
+     * @param[in] pose 机器人在地图坐标系中的平面位姿
+     * @return 与使用 `footprint.polygon()` 调用 collides() 的结果相同，footprint 无效时返回 `true`
+     */
+    bool collides(const Footprint &footprint, const msg::Pose &pose) const;
+
     /**
      * @brief 将当前主代价地图导出为 OccupancyGrid
      *
@@ -13,6 +13,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 
 #include "rmvl/nav/map.hpp"
 #include "rmvlmsg/nav/path.hpp"
@@ -22,7 +23,7 @@ namespace rm::nav {
 //! @defgroup nav_planner 二维路径规划
 //! @ingroup nav
 //! @{
-//! @brief 提供基于代价地图的 A* 搜索、路径简化和平滑
+//! @brief 提供基于代价地图的 A* 搜索、D* Lite 增量重规划、分层规划、路径简化和平滑
 
 //! 路径规划状态
 enum class PlanningStatus : uint8_t {
@@ -44,6 +45,13 @@ enum class PlanningStatus : uint8_t {
  */
 const char *to_string(PlanningStatus status) noexcept;
 
+//! 跳点搜索模式
+enum class JumpPointMode : uint8_t {
+    Disabled,    //!< 逐栅格展开的 A*
+    Online,      //!< 搜索时沿直线扫描跳点（JPS），存在代价不同于自由栅格的可通行栅格时使用逐栅格 A*
+    Precomputed, //!< 预计算并缓存每个栅格 8 个方向的跳跃距离（JPS+），适合代价地图长时间不变的场景，只在代价不同于自由栅格的区域附近逐栅格展开
+};
+
 //! A* 规划配置
 struct AStarOptions {
     bool allow_diagonal{true};             //!< 是否允许八邻域对角移动
@@ -54,6 +62,13 @@ struct AStarOptions {
     bool simplify{true};                    //!< 是否使用可见性检测删除冗余路径点
     std::size_t smoothing_iterations{2};    //!< 路径平滑迭代次数，0 表示不平滑
     double smoothing_weight{0.25};          //!< 每次迭代向相邻点中点移动的比例，范围为 [0, 1]
+    JumpPointMode jump_point{JumpPointMode::Disabled}; //!< 跳点搜索模式，仅在允许对角移动且禁止夹角穿越时生效
+};
+
+//! 分层规划配置
+struct HierarchicalOptions {
+    uint32_t cluster_size{32};   //!< 簇的边长，单位为格，不小于 4
+    uint32_t corridor_margin{1}; //!< 精细搜索的走廊在粗路径经过的簇之外向外扩展的簇数
 };
 
 //! 路径规划结果
@@ -73,7 +88,12 @@ struct PlanningResult {
  * - 默认使用八邻域搜索并禁止夹角穿越
  * - 将代价地图中的膨胀代价加入移动代价
  * - 搜索完成后可执行视线简化和受碰撞约束的迭代平滑
- * @note 起点、终点和返回路径均使用代价地图的坐标系。
+ * - 规划器持有可复用的搜索工作区，按代数标记区分各次搜索的数据，连续重规划时不再分配和清零整张地图大小的数组
+ * - 启用跳点搜索时只在移动代价一致的栅格上跳跃以剪除对称路径，膨胀区域及其边界栅格逐栅格展开，
+ *   得到的路径代价与逐栅格 A* 相同；在线模式下地图含代价不一致的栅格时改用逐栅格的加权 A*
+ * @note
+ * - 起点、终点和返回路径均使用代价地图的坐标系。
+ * - 同一规划器可被多个线程同时调用，工作区被占用时该次调用使用临时工作区。
  */
 class AStarPlanner {
 public:
@@ -82,7 +102,16 @@ public:
      *
      * @param[in] options 规划配置
      */
-    explicit AStarPlanner(AStarOptions options = {}) noexcept;
+    explicit AStarPlanner(AStarOptions options = {});
+
+    //! @cond
+    ~AStarPlanner();
+
+    AStarPlanner(AStarPlanner &&) noexcept;
+    AStarPlanner &operator=(AStarPlanner &&) noexcept;
+    AStarPlanner(const AStarPlanner &other);
+    AStarPlanner &operator=(const AStarPlanner &other);
+    //! @endcond
 
     //! @return 当前规划配置
     const AStarOptions &options() const noexcept;
@@ -98,7 +127,116 @@ public:
     PlanningResult plan(const Costmap &costmap, const msg::Pose &start, const msg::Pose &goal) const;
 
 private:
+    class Workspace;
+
     AStarOptions _options{};
+    std::unique_ptr<Workspace> _workspace; //!< 搜索工作区，复制规划器时不复制
+};
+
+/**
+ * @brief 基于 D* Lite 的增量路径规划器
+ * @details
+ * - 从终点反向搜索并保留搜索状态。终点不变时，后续规划通过 Costmap::changesSince 获取代价发生变化的栅格，
+ *   只修复受这些栅格影响的部分；起点移动时通过累计启发式偏移修正优先级，无需重新搜索
+ * - 首次规划、终点或地图改变，以及代价地图的变化记录不可用时自动重新开始搜索
+ * - 移动规则、代价和路径简化、平滑与 AStarPlanner 相同，`AStarOptions::jump_point` 不生效
+ * @note 规划器保存搜索状态，跨线程使用时由调用方加锁。
+ */
+class DStarLitePlanner {
+public:
+    /**
+     * @brief 创建 D* Lite 增量路径规划器
+     *
+     * @param[in] options 规划配置
+     */
+    explicit DStarLitePlanner(AStarOptions options = {});
+
+    //! @cond
+    ~DStarLitePlanner();
+
+    DStarLitePlanner(DStarLitePlanner &&) noexcept;
+    DStarLitePlanner &operator=(DStarLitePlanner &&) noexcept;
+    DStarLitePlanner(const DStarLitePlanner &other);
+    DStarLitePlanner &operator=(const DStarLitePlanner &other);
+    //! @endcond
+
+    //! @return 当前规划配置
+    const AStarOptions &options() const noexcept;
+
+    /**
+     * @brief 在代价地图上规划或增量修复路径
+     *
+     * @param[in] costmap 已完成图层合成和膨胀的代价地图
+     * @param[in] start 起点位姿，仅使用位置分量
+     * @param[in] goal 终点位姿，仅使用位置分量
+     * @return 路径规划结果，`expanded` 为本次调用展开的栅格数量
+     */
+    PlanningResult plan(const Costmap &costmap, const msg::Pose &start, const msg::Pose &goal);
+
+    //! 丢弃保存的搜索状态，下次规划重新开始搜索
+    void reset() noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+/**
+ * @brief 基于簇抽象图的分层路径规划器（HPA*）
+ * @details
+ * - 将代价地图划分为边长为 `cluster_size` 的方形簇，在相邻簇公共边界的可通行区间上放置入口，
+ *   入口之间以限制在簇内的最短路径代价相连，构成抽象图
+ * - 规划时先将起点、终点接入所在簇的入口并在抽象图上搜索粗路径，再沿粗路径依次连接相邻的入口，
+ *   每段 A* 都限制在粗路径经过的簇及其外扩 `corridor_margin` 圈的走廊内，展开的栅格数量与路径长度和簇的尺寸相关，
+ *   而与地图面积无关
+ * - 代价地图变化时通过 Costmap::changesSince 只重建变化栅格所在的簇和入口发生改变的相邻簇，
+ *   首次规划、地图尺寸改变以及变化记录不可用时整体重建
+ * - 路径经过粗路径上的入口，代价可能略高于全图 A* 的最优代价；允许夹角穿越时抽象图可能遗漏只经过簇角的连通关系，
+ *   抽象图中找不到路径时退回全图 A*
+ * - 移动规则、代价和路径简化、平滑与 AStarPlanner 相同，`AStarOptions::jump_point` 不生效
+ * @note 规划器保存抽象图，跨线程使用时由调用方加锁。
+ */
+class HierarchicalPlanner {
+public:
+    /**
+     * @brief 创建分层路径规划器
+     *
+     * @param[in] options 规划配置
+     * @param[in] hierarchy 分层配置
+     */
+    explicit HierarchicalPlanner(AStarOptions options = {}, HierarchicalOptions hierarchy = {});
+
+    //! @cond
+    ~HierarchicalPlanner();
+
+    HierarchicalPlanner(HierarchicalPlanner &&) noexcept;
+    HierarchicalPlanner &operator=(HierarchicalPlanner &&) noexcept;
+    HierarchicalPlanner(const HierarchicalPlanner &other);
+    HierarchicalPlanner &operator=(const HierarchicalPlanner &other);
+    //! @endcond
+
+    //! @return 当前规划配置
+    const AStarOptions &options() const noexcept;
+
+    //! @return 当前分层配置
+    const HierarchicalOptions &hierarchy() const noexcept;
+
+    /**
+     * @brief 在代价地图上规划路径，必要时先同步抽象图
+     *
+     * @param[in] costmap 已完成图层合成和膨胀的代价地图
+     * @param[in] start 起点位姿，仅使用位置分量
+     * @param[in] goal 终点位姿，仅使用位置分量
+     * @return 路径规划结果，`expanded` 为起终点接入抽象图和精细搜索展开的栅格数量，不含抽象图的维护
+     */
+    PlanningResult plan(const Costmap &costmap, const msg::Pose &start, const msg::Pose &goal);
+
+    //! 丢弃保存的抽象图，下次规划整体重建
+    void reset() noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _impl;
 };
 
 //! @} nav_planner
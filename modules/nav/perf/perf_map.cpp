@@ -3,8 +3,11 @@
  * @brief 二维栅格地图与代价地图性能测试
  */
 
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -65,8 +68,114 @@ static void BM_GridMapApply(benchmark::State &state) {
 
 BENCHMARK(BM_GridMapApply)->Arg(8)->Arg(32)->Arg(128);
 
+/**
+ * @brief 分散修改下的地图增量发布性能
+ * @details 在 2000×2000 的地图上每帧随机修改若干栅格后生成并序列化增量消息，`mode` 为 0 时使用外接矩形增量，
+ * 为 1、2 时分别使用原样存储和行程编码的分块增量，`bytes` 为单帧序列化后的字节数
+ */
+static void BM_GridMapStreamUpdate(benchmark::State &state) {
+    constexpr uint32_t map_size = 2000;
+    const auto changes = static_cast<uint32_t>(state.range(0));
+    const auto mode = state.range(1);
+    GridMap map(makeGrid(map_size, map_size));
+    for (uint32_t y = 0; y < map_size; y += 40)
+        for (uint32_t x = 0; x < map_size; ++x)
+            map.set(x, y, 100);
+    map.clearPendingUpdate();
+
+    uint32_t seed = 1;
+    std::vector<Cell> touched(changes);
+    std::size_t bytes{};
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (auto &cell : touched) {
+            seed = seed * 1664525u + 1013904223u;
+            cell.x = (seed >> 8) % map_size;
+            seed = seed * 1664525u + 1013904223u;
+            cell.y = (seed >> 8) % map_size;
+            map.set(cell.x, cell.y, 50);
+        }
+        state.ResumeTiming();
+        std::string wire{};
+        if (mode == 0)
+            wire = map.pendingUpdate()->serialize();
+        else
+            wire = map.pendingTiles(mode == 1 ? TileEncoding::Raw : TileEncoding::RunLength)->serialize();
+        benchmark::DoNotOptimize(wire.data());
+        bytes += wire.size();
+        // 恢复被修改的栅格，使每帧的地图内容保持一致
+        state.PauseTiming();
+        for (const auto &cell : touched)
+            map.set(cell.x, cell.y, cell.y % 40 == 0 ? 100 : 0);
+        map.clearPendingUpdate();
+        state.ResumeTiming();
+    }
+    state.counters["bytes"] = benchmark::Counter(static_cast<double>(bytes), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_GridMapStreamUpdate)->ArgNames({"changes", "mode"})->ArgsProduct({{16, 256}, {0, 1, 2}})->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief 激光扫描融合性能
+ * @details 在 2000×2000、分辨率 0.05 m 的地图上融合 1080 线、270° 视场的扫描，传感器每帧沿 x 方向移动 2 cm，
+ * 参数为 0 时逐条光束调用 `integrateRay`，为 1 时调用 `integrateScan`，40 Hz 扫描时单帧耗时需低于 25 ms
+ */
+static void BM_GridMapIntegrateScan(benchmark::State &state) {
+    constexpr uint32_t map_size = 2000;
+    constexpr double resolution = 0.05;
+    constexpr std::size_t beams = 1080;
+    constexpr double pi = 3.14159265358979323846;
+    const bool batched = state.range(0) != 0;
+    GridMap map(makeGrid(map_size, map_size, resolution));
+    map.clearPendingUpdate();
+    const double angle_min = -0.75 * pi;
+    const double angle_increment = 1.5 * pi / beams;
+    std::vector<float> ranges(beams);
+    for (std::size_t i = 0; i < beams; ++i) {
+        const double angle = angle_min + static_cast<double>(i) * angle_increment;
+        ranges[i] = i % 60 == 0 ? std::numeric_limits<float>::infinity()
+                                : static_cast<float>(12.0 + 8.0 * std::sin(3.0 * angle) + 2.0 * std::cos(11.0 * angle));
+    }
+    ScanOptions options{};
+    options.max_range = 25.0;
+    msg::Pose origin{};
+    origin.orientation.w = 1.0;
+
+    int64_t ticks{};
+    for (auto _ : state) {
+        origin.position.x = 40.0 + 0.02 * static_cast<double>(ticks % 500);
+        origin.position.y = 50.0;
+        MapStatus status{MapStatus::Ok};
+        if (batched) {
+            status = map.integrateScan(origin, ranges.data(), ranges.size(), angle_min, angle_increment, options);
+        } else {
+            for (std::size_t i = 0; i < beams && status == MapStatus::Ok; ++i) {
+                const double angle = angle_min + static_cast<double>(i) * angle_increment;
+                const double range = std::min(static_cast<double>(ranges[i]), options.max_range);
+                status = map.integrateRay(origin.position.x, origin.position.y, origin.position.x + range * std::cos(angle),
+                                          origin.position.y + range * std::sin(angle), ranges[i] < options.max_range);
+            }
+        }
+        if (status != MapStatus::Ok) {
+            state.SkipWithError(to_string(status));
+            break;
+        }
+        benchmark::ClobberMemory();
+        ++ticks;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(beams));
+}
+
+BENCHMARK(BM_GridMapIntegrateScan)->ArgName("batched")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief 代价地图更新性能
+ * @details 第 2 个参数为 0 时每次交替修改静态地图的两个对角栅格，使整张地图重新膨胀；
+ * 为 1 时模拟激光雷达每个周期新增一个障碍物，只重新膨胀其周围的局部区域
+ */
 static void BM_CostmapUpdateCosts(benchmark::State &state) {
     const auto size = static_cast<uint32_t>(state.range(0));
+    const bool incremental = state.range(1) != 0;
     auto grid = makeGrid(size, size);
     for (uint32_t y = 8; y < size; y += 16)
         for (uint32_t x = 8; x < size; x += 16)
@@ -74,19 +183,77 @@ static void BM_CostmapUpdateCosts(benchmark::State &state) {
     CostmapOptions options{};
     options.inflation_radius = 0.55;
     options.inscribed_radius = 0.20;
+    GridMap static_map(std::move(grid));
+    Costmap costmap(static_map, options);
+    if (!costmap.valid()) {
+        state.SkipWithError("failed to create costmap");
+        return;
+    }
+    auto corners = static_map;
+    corners.set(0, 0, 100);
+    corners.set(size - 1, size - 1, 100);
+
+    uint32_t seed = 1;
+    int64_t ticks{};
+    for (auto _ : state) {
+        if (incremental) {
+            seed = seed * 1664525u + 1013904223u;
+            costmap.markObstacle(Cell{(seed >> 8) % size, (seed >> 20) % size});
+        } else {
+            costmap.setStaticMap(ticks % 2 == 0 ? corners : static_map);
+        }
+        costmap.updateCosts();
+        benchmark::ClobberMemory();
+        // 定期清空障碍层，避免随机障碍物堆积后失去代表性
+        if (incremental && ticks % 256 == 255) {
+            state.PauseTiming();
+            costmap.clearObstacles();
+            costmap.updateCosts();
+            state.ResumeTiming();
+        }
+        ++ticks;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size) * size);
+}
+
+BENCHMARK(BM_CostmapUpdateCosts)->ArgNames({"size", "incremental"})->ArgsProduct({{64, 128, 256}, {0, 1}});
+
+/**
+ * @brief 代价地图图层合并性能
+ * @details 不做膨胀，每次交替标记、清除两个对角栅格，使整张地图的静态层与障碍层重新合并
+ */
+static void BM_CostmapMergeLayers(benchmark::State &state) {
+    const auto size = static_cast<uint32_t>(state.range(0));
+    auto grid = makeGrid(size, size);
+    for (std::size_t i = 0; i < grid.data.size(); i += 7)
+        grid.data[i] = i % 3 == 0 ? -1 : 100;
+    CostmapOptions options{};
+    options.inflation_radius = 0.0;
+    options.inscribed_radius = 0.0;
     Costmap costmap(GridMap(std::move(grid)), options);
     if (!costmap.valid()) {
         state.SkipWithError("failed to create costmap");
         return;
     }
+    const auto first = costmap.mapToWorld(0, 0);
+    const auto last = costmap.mapToWorld(size - 1, size - 1);
 
+    bool mark = true;
     for (auto _ : state) {
+        if (mark) {
+            costmap.markObstacle(Cell{0, 0});
+            costmap.markObstacle(Cell{size - 1, size - 1});
+        } else {
+            costmap.clearRay(first->x, first->y, first->x, first->y);
+            costmap.clearRay(last->x, last->y, last->x, last->y);
+        }
         costmap.updateCosts();
         benchmark::ClobberMemory();
+        mark = !mark;
     }
     state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size) * size);
 }
 
-BENCHMARK(BM_CostmapUpdateCosts)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK(BM_CostmapMergeLayers)->Arg(1024)->Arg(4000)->Unit(benchmark::kMicrosecond)->UseRealTime();
 
 } // namespace rm_test
@@ -43,13 +43,41 @@ msg::OccupancyGrid makeGrid(uint32_t size, bool walls) {
     return grid;
 }
 
-Costmap makeCostmap(uint32_t size, bool walls = false) {
+Costmap makeCostmap(uint32_t size, bool walls = false, double inflation_radius = 0.0) {
     CostmapOptions options{};
-    options.inflation_radius = 0.0;
+    options.inflation_radius = inflation_radius;
     options.inscribed_radius = 0.0;
     return Costmap(GridMap(makeGrid(size, walls)), options);
 }
 
+/**
+ * @brief 生成大场地地图
+ * @details 每隔 1/8 边长设置一道横墙，缺口交替位于左右两端，墙之间随机散布 6×6 的立柱
+ */
+Costmap makeField(uint32_t size) {
+    auto grid = makeGrid(size, false);
+    auto block = [&](uint32_t x, uint32_t y) { grid.data[static_cast<std::size_t>(y) * size + x] = 100; };
+    const uint32_t band = size / 8;
+    for (uint32_t y = band, i = 0; y + 1 < size; y += band, ++i)
+        for (uint32_t x = 0; x < size; ++x)
+            if (i % 2 == 0 ? x + 16 < size : x >= 16)
+                block(x, y);
+    uint32_t seed = 1;
+    for (uint32_t i = 0; i < size * size / 2048; ++i) {
+        seed = seed * 1664525U + 1013904223U;
+        const uint32_t x = (seed >> 8) % (size - 6);
+        seed = seed * 1664525U + 1013904223U;
+        const uint32_t y = (seed >> 8) % (size - 6);
+        for (uint32_t dy = 0; dy < 6; ++dy)
+            for (uint32_t dx = 0; dx < 6; ++dx)
+                block(x + dx, y + dy);
+    }
+    CostmapOptions options{};
+    options.inflation_radius = 0.15;
+    options.inscribed_radius = 0.0;
+    return Costmap(GridMap(std::move(grid)), options);
+}
+
 msg::Pose pose(double x, double y, double yaw = 0.0) {
     msg::Pose result{};
     result.position = {x, y, 0.0};
@@ -73,35 +101,175 @@ msg::Path makePath(std::size_t count) {
     return path;
 }
 
+/**
+ * @brief A* 规划性能
+ * @details 第 2 个参数为 0 时从地图一角规划到对角；为 1 时模拟局部重规划，
+ * 每次迭代沿对角线连续规划 100 条长度约 20 格的短路径
+ */
 void runAStar(benchmark::State &state, bool walls) {
     const auto size = static_cast<uint32_t>(state.range(0));
+    const bool short_replans = state.range(1) != 0;
     const auto costmap = makeCostmap(size, walls);
     const AStarPlanner planner{};
     const double end = (static_cast<double>(size) - 1.5) * 0.05;
+    std::vector<std::pair<msg::Pose, msg::Pose>> queries{};
+    if (short_replans) {
+        // 起点位于墙体之间的通道中，终点在其前方 20 格内
+        for (std::size_t i = 0; i < 100; ++i) {
+            const double along = 0.075 + (end - 1.1) * static_cast<double>(i) / 100.0;
+            queries.emplace_back(pose(std::floor(along / 0.8) * 0.8 + 0.425, along), pose(std::floor(along / 0.8) * 0.8 + 0.425, along + 1.0));
+        }
+    } else {
+        queries.emplace_back(pose(0.075, 0.075), pose(end, end));
+    }
+
+    for (auto _ : state) {
+        for (const auto &[start, goal] : queries) {
+            auto result = planner.plan(costmap, start, goal);
+            if (!result) {
+                state.SkipWithError(to_string(result.status));
+                return;
+            }
+            benchmark::DoNotOptimize(result.path.poses.data());
+            benchmark::DoNotOptimize(result.expanded);
+        }
+    }
+    state.counters["cells"] = static_cast<double>(size) * size;
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+} // namespace
+
+static void BM_AStarOpen(benchmark::State &state) { runAStar(state, false); }
+
+BENCHMARK(BM_AStarOpen)->ArgNames({"size", "short_replans"})->Args({64, 0})->Args({128, 0})->Args({256, 0})->Args({256, 1})->Args({1024, 1});
+
+static void BM_AStarWalls(benchmark::State &state) { runAStar(state, true); }
+
+BENCHMARK(BM_AStarWalls)->ArgNames({"size", "short_replans"})->Args({64, 0})->Args({128, 0})->Args({256, 0})->Args({256, 1})->Args({1024, 1});
+
+/**
+ * @brief 跳点搜索与逐栅格 A* 的对比
+ * @details 在带墙体的地图上从一角规划到对角。第 2 个参数为跳点搜索模式：0 为逐栅格 A*，1 为在线跳点搜索，
+ * 2 为预计算跳跃距离的跳点搜索（跳跃距离表在首次规划时构建并缓存）；第 3 个参数为 1 时对墙体做 0.15 m 膨胀，
+ * 此时在线跳点搜索使用逐栅格 A*，预计算的跳点搜索只在膨胀区域附近逐栅格展开。关闭路径简化与平滑，只比较搜索本身
+ */
+static void BM_AStarJumpPoint(benchmark::State &state) {
+    const auto size = static_cast<uint32_t>(state.range(0));
+    const auto costmap = makeCostmap(size, true, state.range(2) != 0 ? 0.15 : 0.0);
+    AStarOptions options{};
+    options.jump_point = static_cast<JumpPointMode>(state.range(1));
+    options.simplify = false;
+    options.smoothing_iterations = 0;
+    const AStarPlanner planner(options);
+    const double end = (static_cast<double>(size) - 1.5) * 0.05;
     const auto start = pose(0.075, 0.075);
     const auto goal = pose(end, end);
+    std::size_t expanded{};
+    if (!planner.plan(costmap, start, goal)) {
+        state.SkipWithError("failed to plan");
+        return;
+    }
 
     for (auto _ : state) {
         auto result = planner.plan(costmap, start, goal);
         if (!result) {
             state.SkipWithError(to_string(result.status));
-            break;
+            return;
         }
+        expanded = result.expanded;
         benchmark::DoNotOptimize(result.path.poses.data());
-        benchmark::DoNotOptimize(result.expanded);
     }
-    state.counters["cells"] = static_cast<double>(size) * size;
+    state.counters["expanded"] = static_cast<double>(expanded);
 }
 
-} // namespace
+BENCHMARK(BM_AStarJumpPoint)->ArgNames({"size", "mode", "inflated"})->ArgsProduct({{256, 1024}, {0, 1, 2}, {0, 1}})->Unit(benchmark::kMicrosecond);
 
-static void BM_AStarOpen(benchmark::State &state) { runAStar(state, false); }
+/**
+ * @brief 移动障碍物下的重规划性能
+ * @details 在带墙体的地图上，每次迭代移动 3 个障碍物并更新代价地图，机器人沿首条路径前进一格后重新规划到对角。
+ * 第 2 个参数为 0 时每次用 A* 从头规划，为 1 时使用 D* Lite 增量修复搜索状态。两者都包含代价地图更新的耗时
+ */
+static void BM_DStarLiteReplan(benchmark::State &state) {
+    const auto size = static_cast<uint32_t>(state.range(0));
+    const bool incremental = state.range(1) != 0;
+    auto costmap = makeCostmap(size, true, 0.15);
+    AStarOptions options{};
+    options.simplify = false;
+    options.smoothing_iterations = 0;
+    const AStarPlanner planner(options);
+    DStarLitePlanner replanner(options);
+    const double end = (static_cast<double>(size) - 1.5) * 0.05;
+    const auto goal = pose(end, end);
+    const auto route = planner.plan(costmap, pose(0.075, 0.075), goal);
+    if (!route) {
+        state.SkipWithError("failed to plan");
+        return;
+    }
+
+    uint32_t seed = 1;
+    std::size_t step{}, expanded{};
+    for (auto _ : state) {
+        costmap.clearObstacles();
+        for (int robot = 0; robot < 3; ++robot) {
+            seed = seed * 1664525U + 1013904223U;
+            costmap.markObstacle(Cell{(seed >> 8) % size, (seed >> 20) % size});
+        }
+        costmap.updateCosts();
+        const auto &position = route.path.poses[step++ % route.path.poses.size()].pose.position;
+        const auto start = pose(position.x, position.y);
+        auto result = incremental ? replanner.plan(costmap, start, goal) : planner.plan(costmap, start, goal);
+        expanded += result.expanded;
+        benchmark::DoNotOptimize(result.path.poses.data());
+    }
+    state.counters["expanded"] = benchmark::Counter(static_cast<double>(expanded), benchmark::Counter::kAvgIterations);
+}
 
-BENCHMARK(BM_AStarOpen)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK(BM_DStarLiteReplan)->ArgNames({"size", "incremental"})->ArgsProduct({{128, 256}, {0, 1}})->Unit(benchmark::kMicrosecond);
 
-static void BM_AStarWalls(benchmark::State &state) { runAStar(state, true); }
+/**
+ * @brief 分层规划与全图 A* 的查询延迟对比
+ * @details 在带墙体并做 0.15 m 膨胀的大地图上从一角规划到对角。第 2 个参数为 0 时使用全图 A*，
+ * 为 1 时使用簇边长 32 的分层规划（抽象图在首次规划时构建，不计入耗时）；第 3 个参数为 1 时每次迭代移动
+ * 3 个障碍物并更新代价地图，分层规划同时增量维护抽象图，两者都包含代价地图更新的耗时
+ */
+static void BM_HierarchicalPlan(benchmark::State &state) {
+    const auto size = static_cast<uint32_t>(state.range(0));
+    const bool hierarchical = state.range(1) != 0;
+    const bool moving = state.range(2) != 0;
+    auto costmap = makeField(size);
+    AStarOptions options{};
+    options.simplify = false;
+    options.smoothing_iterations = 0;
+    const AStarPlanner planner(options);
+    HierarchicalPlanner layered(options);
+    const double end = (static_cast<double>(size) - 1.5) * 0.05;
+    const auto start = pose(0.075, 0.075);
+    const auto goal = pose(end, end);
+    if (!planner.plan(costmap, start, goal) || !layered.plan(costmap, start, goal)) {
+        state.SkipWithError("failed to plan");
+        return;
+    }
+
+    uint32_t seed = 1;
+    std::size_t expanded{};
+    for (auto _ : state) {
+        if (moving) {
+            costmap.clearObstacles();
+            for (int robot = 0; robot < 3; ++robot) {
+                seed = seed * 1664525U + 1013904223U;
+                costmap.markObstacle(Cell{(seed >> 8) % size, (seed >> 20) % size});
+            }
+            costmap.updateCosts();
+        }
+        auto result = hierarchical ? layered.plan(costmap, start, goal) : planner.plan(costmap, start, goal);
+        expanded += result.expanded;
+        benchmark::DoNotOptimize(result.path.poses.data());
+    }
+    state.counters["expanded"] = benchmark::Counter(static_cast<double>(expanded), benchmark::Counter::kAvgIterations);
+}
 
-BENCHMARK(BM_AStarWalls)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK(BM_HierarchicalPlan)->ArgNames({"size", "hierarchical", "moving"})->ArgsProduct({{1024, 2048}, {0, 1}, {0, 1}})->Unit(benchmark::kMillisecond);
 
 static void BM_PurePursuitCompute(benchmark::State &state) {
     const auto count = static_cast<std::size_t>(state.range(0));
@@ -122,15 +290,32 @@ static void BM_PurePursuitCompute(benchmark::State &state) {
 
 BENCHMARK(BM_PurePursuitCompute)->Arg(32)->Arg(256)->Arg(2048);
 
+/**
+ * @brief 碰撞刹停性能
+ * @details 机器人沿半径 5 m 的圆弧行驶，轨迹两侧 0.22 m 处布置障碍，footprint 的包围盒经常覆盖障碍栅格但不发生碰撞。
+ * 第 1 个参数为预测采样位姿数；第 2 个参数为 0 时每个位姿直接使用多边形顶点检测，
+ * 为 1 时使用按 64 个朝向预先栅格化的 footprint（栅格化在计时循环之外完成）
+ */
 static void BM_CollisionStopFilter(benchmark::State &state) {
     constexpr double linear_step = 0.02;
     const auto samples = static_cast<std::size_t>(state.range(0));
-    const auto costmap = makeCostmap(256);
-    const std::vector<msg::Point> footprint{
+    const bool rasterized = state.range(1) != 0;
+    auto costmap = makeCostmap(256);
+    const double horizon = static_cast<double>(samples) * linear_step;
+    for (double t = -0.3; t <= horizon + 0.3; t += 0.025) {
+        const double yaw = 0.2 * t;
+        const double x = 1.0 + 5.0 * std::sin(yaw);
+        const double y = 3.0 + 5.0 * (1.0 - std::cos(yaw));
+        for (double side : {-0.22, 0.22})
+            costmap.markObstacle(x - side * std::sin(yaw), y + side * std::cos(yaw));
+    }
+    costmap.updateCosts();
+    const std::vector<msg::Point> polygon{
         {-0.20, -0.15, 0.0}, {0.20, -0.15, 0.0}, {0.20, 0.15, 0.0}, {-0.20, 0.15, 0.0}};
+    const Footprint footprint(polygon, costmap.resolution());
     CollisionStopOptions options{};
     options.linear_step = linear_step;
-    options.prediction_horizon = static_cast<double>(samples) * linear_step;
+    options.prediction_horizon = horizon;
     const CollisionStop filter(options);
     const auto current = pose(1.0, 3.0);
     msg::Twist command{};
@@ -138,7 +323,8 @@ static void BM_CollisionStopFilter(benchmark::State &state) {
     command.angular.z = 0.2;
 
     for (auto _ : state) {
-        auto result = filter.filter(costmap, footprint, current, command);
+        auto result = rasterized ? filter.filter(costmap, footprint, current, command)
+                                 : filter.filter(costmap, polygon, current, command);
         if (result.stopped) {
             state.SkipWithError("unexpected collision stop");
             break;
@@ -148,6 +334,6 @@ static void BM_CollisionStopFilter(benchmark::State &state) {
     state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(samples));
 }
 
-BENCHMARK(BM_CollisionStopFilter)->Arg(20)->Arg(50)->Arg(100);
+BENCHMARK(BM_CollisionStopFilter)->ArgNames({"samples", "rasterized"})->ArgsProduct({{20, 50, 100}, {0, 1}});
 
 } // namespace rm_test
@@ -0,0 +1,146 @@
+/**
+ * @file _rm_codegen_msg_map_meta_data.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief MapMetaData source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/nav/map_meta_data.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string MapMetaData::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(map_load_time.compact_size() + sizeof(resolution) + sizeof(width) + sizeof(height) + origin.compact_size());
+    _res_.append(map_load_time.serialize());
+    append_scalar(_res_, resolution);
+    append_scalar(_res_, width);
+    append_scalar(_res_, height);
+    _res_.append(origin.serialize());
+
+    return _res_;
+}
+
+std::string MapMetaData::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"map_load_time\":";
+    _json_str__ += map_load_time.json();
+    _json_str__ += ",";
+    _json_str__ += "\"resolution\":";
+    _json_str__ += std::to_string(resolution);
+    _json_str__ += ",";
+    _json_str__ += "\"width\":";
+    _json_str__ += std::to_string(width);
+    _json_str__ += ",";
+    _json_str__ += "\"height\":";
+    _json_str__ += std::to_string(height);
+    _json_str__ += ",";
+    _json_str__ += "\"origin\":";
+    _json_str__ += origin.json();
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+MapMetaData MapMetaData::deserialize(const char *const str) noexcept {
+    MapMetaData _msg__{};
+    const char *_p__ = str;
+    _msg__.map_load_time = rm::msg::Time::deserialize(_p__);
+    _p__ += _msg__.map_load_time.compact_size();
+    _msg__.resolution = read_scalar<float>(_p__);
+    _msg__.width = read_scalar<uint32_t>(_p__);
+    _msg__.height = read_scalar<uint32_t>(_p__);
+    _msg__.origin = rm::msg::Pose::deserialize(_p__);
+    _p__ += _msg__.origin.compact_size();
+
+    return _msg__;
+}
+
+std::size_t MapMetaData::compact_size() const noexcept {
+    return map_load_time.compact_size() + sizeof(resolution) + sizeof(width) + sizeof(height) + origin.compact_size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<MapMetaDataView> MapMetaDataView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    MapMetaDataView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool MapMetaDataView::parse(ViewReader &_r__, MapMetaDataView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::TimeView::parse(_r__, _v__.map_load_time))
+        return false;
+    if (!_r__.scalar(_v__.resolution))
+        return false;
+    if (!_r__.scalar(_v__.width))
+        return false;
+    if (!_r__.scalar(_v__.height))
+        return false;
+    if (!rm::msg::PoseView::parse(_r__, _v__.origin))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+MapMetaData MapMetaDataView::to_msg() const {
+    MapMetaData _msg__{};
+    _msg__.map_load_time = map_load_time.to_msg();
+    _msg__.resolution = resolution;
+    _msg__.width = width;
+    _msg__.height = height;
+    _msg__.origin = origin.to_msg();
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
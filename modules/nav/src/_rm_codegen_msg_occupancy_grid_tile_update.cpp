@@ -0,0 +1,164 @@
+/**
+ * @file _rm_codegen_msg_occupancy_grid_tile_update.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief OccupancyGridTileUpdate source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/nav/occupancy_grid_tile_update.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string OccupancyGridTileUpdate::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(base_revision) + sizeof(revision) + sizeof(tile_size) + sizeof(uint32_t) + std::accumulate(tiles.begin(), tiles.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }));
+    _res_.append(header.serialize());
+    append_scalar(_res_, base_revision);
+    append_scalar(_res_, revision);
+    append_scalar(_res_, tile_size);
+    uint32_t tiles_size__ = static_cast<uint32_t>(tiles.size());
+    append_scalar(_res_, tiles_size__);
+    for (const auto &v : tiles)
+        _res_.append(v.serialize());
+
+    return _res_;
+}
+
+std::string OccupancyGridTileUpdate::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"base_revision\":";
+    _json_str__ += std::to_string(base_revision);
+    _json_str__ += ",";
+    _json_str__ += "\"revision\":";
+    _json_str__ += std::to_string(revision);
+    _json_str__ += ",";
+    _json_str__ += "\"tile_size\":";
+    _json_str__ += std::to_string(tile_size);
+    _json_str__ += ",";
+    _json_str__ += "\"tiles\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += tiles[i].json();
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+OccupancyGridTileUpdate OccupancyGridTileUpdate::deserialize(const char *const str) noexcept {
+    OccupancyGridTileUpdate _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    _msg__.base_revision = read_scalar<uint64_t>(_p__);
+    _msg__.revision = read_scalar<uint64_t>(_p__);
+    _msg__.tile_size = read_scalar<uint32_t>(_p__);
+    uint32_t tiles_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.tiles.resize(tiles_size__);
+    for (auto& v : _msg__.tiles) {
+        v = rm::msg::OccupancyGridTile::deserialize(_p__);
+        _p__ += v.compact_size();
+    }
+
+    return _msg__;
+}
+
+std::size_t OccupancyGridTileUpdate::compact_size() const noexcept {
+    return header.compact_size() + sizeof(base_revision) + sizeof(revision) + sizeof(tile_size) + sizeof(uint32_t) + std::accumulate(tiles.begin(), tiles.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); });
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<OccupancyGridTileUpdateView> OccupancyGridTileUpdateView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    OccupancyGridTileUpdateView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool OccupancyGridTileUpdateView::parse(ViewReader &_r__, OccupancyGridTileUpdateView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    if (!_r__.scalar(_v__.base_revision))
+        return false;
+    if (!_r__.scalar(_v__.revision))
+        return false;
+    if (!_r__.scalar(_v__.tile_size))
+        return false;
+    uint32_t tiles_size__{};
+    if (!_r__.scalar(tiles_size__))
+        return false;
+    if (!rm::msg::SeqView<rm::msg::OccupancyGridTileView>::parse(_r__, tiles_size__, _v__.tiles))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+OccupancyGridTileUpdate OccupancyGridTileUpdateView::to_msg() const {
+    OccupancyGridTileUpdate _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.base_revision = base_revision;
+    _msg__.revision = revision;
+    _msg__.tile_size = tile_size;
+    _msg__.tiles.reserve(tiles.size());
+    for (const auto &v : tiles)
+        _msg__.tiles.push_back(v.to_msg());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
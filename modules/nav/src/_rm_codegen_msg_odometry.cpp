@@ -0,0 +1,143 @@
+/**
+ * @file _rm_codegen_msg_odometry.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Odometry source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/nav/odometry.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Odometry::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(uint32_t) + child_frame_id.size() + pose.compact_size() + twist.compact_size());
+    _res_.append(header.serialize());
+    uint32_t child_frame_id_size__ = static_cast<uint32_t>(child_frame_id.size());
+    append_scalar(_res_, child_frame_id_size__);
+    _res_.append(child_frame_id.data(), child_frame_id_size__);
+    _res_.append(pose.serialize());
+    _res_.append(twist.serialize());
+
+    return _res_;
+}
+
+std::string Odometry::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"child_frame_id\":";
+    _json_str__ += "\"" + child_frame_id + "\"";
+    _json_str__ += ",";
+    _json_str__ += "\"pose\":";
+    _json_str__ += pose.json();
+    _json_str__ += ",";
+    _json_str__ += "\"twist\":";
+    _json_str__ += twist.json();
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Odometry Odometry::deserialize(const char *const str) noexcept {
+    Odometry _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    uint32_t child_frame_id_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.child_frame_id.assign(_p__, child_frame_id_size__);
+    _p__ += child_frame_id_size__;
+    _msg__.pose = rm::msg::PoseWithCovariance::deserialize(_p__);
+    _p__ += _msg__.pose.compact_size();
+    _msg__.twist = rm::msg::TwistWithCovariance::deserialize(_p__);
+    _p__ += _msg__.twist.compact_size();
+
+    return _msg__;
+}
+
+std::size_t Odometry::compact_size() const noexcept {
+    return header.compact_size() + sizeof(uint32_t) + child_frame_id.size() + pose.compact_size() + twist.compact_size();
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<OdometryView> OdometryView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    OdometryView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool OdometryView::parse(ViewReader &_r__, OdometryView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    if (!_r__.string(_v__.child_frame_id))
+        return false;
+    if (!rm::msg::PoseWithCovarianceView::parse(_r__, _v__.pose))
+        return false;
+    if (!rm::msg::TwistWithCovarianceView::parse(_r__, _v__.twist))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Odometry OdometryView::to_msg() const {
+    Odometry _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.child_frame_id = std::string(child_frame_id);
+    _msg__.pose = pose.to_msg();
+    _msg__.twist = twist.to_msg();
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
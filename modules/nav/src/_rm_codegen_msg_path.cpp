@@ -0,0 +1,140 @@
+/**
+ * @file _rm_codegen_msg_path.cpp
+ * @author Nq139 (fnq409997@gmail.com)
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Path source file (Generated by CMake automatically, DO NOT MODIFY!)
+ *
+ * @copyright Copyright 2026 (c), Nq139 and zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "rmvlmsg/nav/path.hpp"
+
+namespace rm::msg {
+
+namespace {
+
+template <typename Tp>
+static void append_scalar(std::string &dst, const Tp &value) noexcept {
+    const auto offset = dst.size();
+    dst.resize(offset + sizeof(Tp));
+    std::memcpy(dst.data() + offset, &value, sizeof(Tp));
+}
+
+template <typename Tp>
+static void append_array(std::string &dst, const Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    const auto offset = dst.size();
+    dst.resize(offset + size);
+    if (size != 0)
+        std::memcpy(dst.data() + offset, data, size);
+}
+
+template <typename Tp>
+static Tp read_scalar(const char *&src) noexcept {
+    Tp value{};
+    std::memcpy(&value, src, sizeof(Tp));
+    src += sizeof(Tp);
+    return value;
+}
+
+template <typename Tp>
+static void read_array(const char *&src, Tp *data, std::size_t count) noexcept {
+    const auto size = count * sizeof(Tp);
+    if (size != 0)
+        std::memcpy(data, src, size);
+    src += size;
+}
+
+} // namespace
+
+std::string Path::serialize() const noexcept {
+    std::string _res_;
+    _res_.reserve(header.compact_size() + sizeof(uint32_t) + std::accumulate(poses.begin(), poses.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); }));
+    _res_.append(header.serialize());
+    uint32_t poses_size__ = static_cast<uint32_t>(poses.size());
+    append_scalar(_res_, poses_size__);
+    for (const auto &v : poses)
+        _res_.append(v.serialize());
+
+    return _res_;
+}
+
+std::string Path::json() const noexcept {
+    std::string _json_str__ = "{";
+    _json_str__ += "\"header\":";
+    _json_str__ += header.json();
+    _json_str__ += ",";
+    _json_str__ += "\"poses\":";
+    _json_str__ += "[";
+    for (size_t i = 0; i < poses.size(); ++i) {
+        if (i > 0)
+            _json_str__ += ",";
+        _json_str__ += poses[i].json();
+    }
+    _json_str__ += "]";
+    _json_str__ += "}";
+    return _json_str__;
+
+}
+
+Path Path::deserialize(const char *const str) noexcept {
+    Path _msg__{};
+    const char *_p__ = str;
+    _msg__.header = rm::msg::Header::deserialize(_p__);
+    _p__ += _msg__.header.compact_size();
+    uint32_t poses_size__ = read_scalar<uint32_t>(_p__);
+    _msg__.poses.resize(poses_size__);
+    for (auto& v : _msg__.poses) {
+        v = rm::msg::PoseStamped::deserialize(_p__);
+        _p__ += v.compact_size();
+    }
+
+    return _msg__;
+}
+
+std::size_t Path::compact_size() const noexcept {
+    return header.compact_size() + sizeof(uint32_t) + std::accumulate(poses.begin(), poses.end(), size_t(0), [](size_t a, const auto& i) { return a + i.compact_size(); });
+}
+
+#if __cplusplus >= 202002L
+
+std::optional<PathView> PathView::parse(std::span<const std::byte> buf) noexcept {
+    ViewReader _r__(buf);
+    PathView _v__{};
+    if (!parse(_r__, _v__) || _r__.remain() != 0)
+        return std::nullopt;
+    return _v__;
+}
+
+bool PathView::parse(ViewReader &_r__, PathView &_v__) noexcept {
+    const auto *_begin__ = _r__.pos();
+    if (!rm::msg::HeaderView::parse(_r__, _v__.header))
+        return false;
+    uint32_t poses_size__{};
+    if (!_r__.scalar(poses_size__))
+        return false;
+    if (!rm::msg::SeqView<rm::msg::PoseStampedView>::parse(_r__, poses_size__, _v__.poses))
+        return false;
+
+    _v__._bytes__ = {_begin__, _r__.pos()};
+    return true;
+}
+
+Path PathView::to_msg() const {
+    Path _msg__{};
+    _msg__.header = header.to_msg();
+    _msg__.poses.reserve(poses.size());
+    for (const auto &v : poses)
+        _msg__.poses.push_back(v.to_msg());
+
+    return _msg__;
+}
+
+#endif
+
+} // namespace rm::msg
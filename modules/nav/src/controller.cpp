@@ -81,6 +81,55 @@ msg::Quaternion yawQuaternion(double yaw) noexcept {
     return {0.0, 0.0, std::sin(yaw * 0.5), std::cos(yaw * 0.5)};
 }
 
+/**
+ * @brief 沿速度指令积分预测轨迹，并在每个采样位姿执行碰撞检测
+ *
+ * @param[in] options 刹停过滤配置
+ * @param[in] costmap 代价地图
+ * @param[in] pose 机器人当前位姿
+ * @param[in] command 待过滤的速度指令
+ * @param[in] collides 位姿碰撞检测函数
+ */
+template <typename Collides>
+CollisionStopResult predictCollision(const CollisionStopOptions &options, const Costmap &costmap, const msg::Pose &pose,
+                                     const msg::Twist &command, Collides &&collides) {
+    CollisionStopResult result{};
+    double yaw{};
+    if (!validOptions(options) || !costmap.valid() || !finitePosition(pose.position) ||
+        !planarYaw(pose.orientation, yaw) || !finiteVector(command.linear) || !finiteVector(command.angular) ||
+        collides(pose)) {
+        result.stopped = true;
+        return result;
+    }
+
+    const double linear_speed = std::hypot(command.linear.x, command.linear.y);
+    const double linear_samples = linear_speed * options.prediction_horizon / options.linear_step;
+    const double angular_samples = std::abs(command.angular.z) * options.prediction_horizon / options.angular_step;
+    const double requested_samples = std::ceil(std::max({1.0, linear_samples, angular_samples}));
+    if (!std::isfinite(requested_samples) || requested_samples > static_cast<double>(kMaxCollisionSamples)) {
+        result.stopped = true;
+        return result;
+    }
+    const std::size_t samples = static_cast<std::size_t>(requested_samples);
+    const double time_step = samples == 0 ? 0.0 : options.prediction_horizon / static_cast<double>(samples);
+    msg::Pose predicted = pose;
+    for (std::size_t i = 0; i < samples; ++i) {
+        const double midpoint_yaw = yaw + command.angular.z * time_step * 0.5;
+        predicted.position.x += (std::cos(midpoint_yaw) * command.linear.x -
+                                 std::sin(midpoint_yaw) * command.linear.y) * time_step;
+        predicted.position.y += (std::sin(midpoint_yaw) * command.linear.x +
+                                 std::cos(midpoint_yaw) * command.linear.y) * time_step;
+        yaw = normalizeAngle(yaw + command.angular.z * time_step);
+        predicted.orientation = yawQuaternion(yaw);
+        if (collides(predicted)) {
+            result.stopped = true;
+            return result;
+        }
+    }
+    result.command = command;
+    return result;
+}
+
 } // namespace
 
 const char *to_string(TrackingStatus status) noexcept {
@@ -175,41 +224,14 @@ const CollisionStopOptions &CollisionStop::options() const noexcept { return _op
 
 CollisionStopResult CollisionStop::filter(const Costmap &costmap, const std::vector<msg::Point> &footprint,
                                           const msg::Pose &pose, const msg::Twist &command) const {
-    CollisionStopResult result{};
-    double yaw{};
-    if (!validOptions(_options) || !costmap.valid() || !finitePosition(pose.position) ||
-        !planarYaw(pose.orientation, yaw) || !finiteVector(command.linear) || !finiteVector(command.angular) ||
-        costmap.collides(footprint, pose)) {
-        result.stopped = true;
-        return result;
-    }
+    return predictCollision(_options, costmap, pose, command,
+                            [&](const msg::Pose &sample) { return costmap.collides(footprint, sample); });
+}
 
-    const double linear_speed = std::hypot(command.linear.x, command.linear.y);
-    const double linear_samples = linear_speed * _options.prediction_horizon / _options.linear_step;
-    const double angular_samples = std::abs(command.angular.z) * _options.prediction_horizon / _options.angular_step;
-    const double requested_samples = std::ceil(std::max({1.0, linear_samples, angular_samples}));
-    if (!std::isfinite(requested_samples) || requested_samples > static_cast<double>(kMaxCollisionSamples)) {
-        result.stopped = true;
-        return result;
-    }
-    const std::size_t samples = static_cast<std::size_t>(requested_samples);
-    const double time_step = samples == 0 ? 0.0 : _options.prediction_horizon / static_cast<double>(samples);
-    msg::Pose predicted = pose;
-    for (std::size_t i = 0; i < samples; ++i) {
-        const double midpoint_yaw = yaw + command.angular.z * time_step * 0.5;
-        predicted.position.x += (std::cos(midpoint_yaw) * command.linear.x -
-                                 std::sin(midpoint_yaw) * command.linear.y) * time_step;
-        predicted.position.y += (std::sin(midpoint_yaw) * command.linear.x +
-                                 std::cos(midpoint_yaw) * command.linear.y) * time_step;
-        yaw = normalizeAngle(yaw + command.angular.z * time_step);
-        predicted.orientation = yawQuaternion(yaw);
-        if (costmap.collides(footprint, predicted)) {
-            result.stopped = true;
-            return result;
-        }
-    }
-    result.command = command;
-    return result;
+CollisionStopResult CollisionStop::filter(const Costmap &costmap, const Footprint &footprint,
+                                          const msg::Pose &pose, const msg::Twist &command) const {
+    return predictCollision(_options, costmap, pose, command,
+                            [&](const msg::Pose &sample) { return costmap.collides(footprint, sample); });
 }
 
 } // namespace rm::nav
@@ -10,10 +10,21 @@
  */
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <cstring>
+#include <deque>
+#include <iterator>
 #include <limits>
+#include <thread>
 #include <utility>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "rmvl/core/parallel.hpp"
 #include "rmvl/nav/map.hpp"
 
 namespace rm::nav {
@@ -22,6 +33,7 @@ namespace {
 
 constexpr double kPlanarTolerance = 1e-9;
 constexpr double kProbabilityEpsilon = 0.01;
+constexpr double kPi = 3.14159265358979323846;
 
 struct Geometry {
     uint32_t width{};
@@ -170,17 +182,19 @@ bool clipLine(const Geometry &geometry, double &x0, double &y0, double &x1, doub
         return false;
     const double start_x = x0;
     const double start_y = y0;
-    x0 = start_x + lower * dx;
-    y0 = start_y + lower * dy;
-    x1 = start_x + upper * dx;
-    y1 = start_y + upper * dy;
+    // 舍入误差可能使裁剪后的端点略微越过边界
+    x0 = std::clamp(start_x + lower * dx, 0.0, max_x);
+    y0 = std::clamp(start_y + lower * dy, 0.0, max_y);
+    x1 = std::clamp(start_x + upper * dx, 0.0, max_x);
+    y1 = std::clamp(start_y + upper * dy, 0.0, max_y);
     return true;
 }
 
-std::vector<Cell> rasterLine(const Geometry &geometry, double x0, double y0, double x1, double y1) {
-    std::vector<Cell> result{};
+//! 沿 Bresenham 直线依次访问裁剪到地图内的栅格，直线完全位于地图外时不访问任何栅格
+template <typename Visitor>
+void traceLine(const Geometry &geometry, double x0, double y0, double x1, double y1, Visitor &&visit) {
     if (!clipLine(geometry, x0, y0, x1, y1))
-        return result;
+        return;
 
     int x = static_cast<int>(std::floor(x0));
     int y = static_cast<int>(std::floor(y0));
@@ -193,7 +207,7 @@ std::vector<Cell> rasterLine(const Geometry &geometry, double x0, double y0, dou
     int error = dx + dy;
 
     while (true) {
-        result.push_back({static_cast<uint32_t>(x), static_cast<uint32_t>(y)});
+        visit(static_cast<uint32_t>(x), static_cast<uint32_t>(y));
         if (x == end_x && y == end_y)
             break;
         const int twice_error = 2 * error;
@@ -206,6 +220,11 @@ std::vector<Cell> rasterLine(const Geometry &geometry, double x0, double y0, dou
             y += sy;
         }
     }
+}
+
+std::vector<Cell> rasterLine(const Geometry &geometry, double x0, double y0, double x1, double y1) {
+    std::vector<Cell> result{};
+    traceLine(geometry, x0, y0, x1, y1, [&](uint32_t x, uint32_t y) { result.push_back({x, y}); });
     return result;
 }
 
@@ -233,6 +252,135 @@ int8_t probabilityUpdate(int8_t current, double evidence) noexcept {
     return static_cast<int8_t>(std::clamp(std::lround(100.0 * odds / (1.0 + odds)), 0l, 100l));
 }
 
+//! 分块在地图中的栅格范围，右侧和下侧的分块被地图边界截断
+struct TileRect {
+    uint32_t x{};
+    uint32_t y{};
+    uint32_t width{};
+    uint32_t height{};
+};
+
+TileRect tileRect(const Geometry &geometry, uint32_t tile_size, uint32_t tile_x, uint32_t tile_y) noexcept {
+    TileRect rect{tile_x * tile_size, tile_y * tile_size, 0, 0};
+    rect.width = std::min(tile_size, geometry.width - rect.x);
+    rect.height = std::min(tile_size, geometry.height - rect.y);
+    return rect;
+}
+
+//! 返回从 @p first 开始、取值与 @p first 处相同的最长前缀长度，先按 8 字节跳过相同的整字，再逐字节定位，与字节序无关
+std::size_t runLength(const uint8_t *first, std::size_t limit) noexcept {
+    const uint64_t pattern = 0x0101010101010101ull * first[0];
+    std::size_t count{};
+    for (; count + 8 <= limit; count += 8) {
+        uint64_t word{};
+        std::memcpy(&word, first + count, sizeof(word));
+        if (word != pattern)
+            break;
+    }
+    while (count < limit && first[count] == first[0])
+        ++count;
+    return count;
+}
+
+msg::OccupancyGridTile encodeTile(const Geometry &geometry, const std::vector<int8_t> &data, uint32_t tile_size,
+                                  uint32_t tile_x, uint32_t tile_y, TileEncoding encoding) {
+    const auto rect = tileRect(geometry, tile_size, tile_x, tile_y);
+    msg::OccupancyGridTile tile{};
+    tile.x = tile_x;
+    tile.y = tile_y;
+    tile.encoding = msg::OccupancyGridTile::encoding_raw;
+    tile.data.resize(static_cast<std::size_t>(rect.width) * rect.height);
+    for (uint32_t row = 0; row < rect.height; ++row)
+        std::memcpy(tile.data.data() + static_cast<std::size_t>(row) * rect.width,
+                    data.data() + cellIndex(geometry, rect.x, rect.y + row), rect.width);
+    if (encoding != TileEncoding::RunLength)
+        return tile;
+
+    // 行程按 (长度, 栅格值) 成对存储，可以跨越分块内的行，不短于原始数据时放弃编码
+    const std::size_t cells = tile.data.size();
+    std::vector<uint8_t> runs(cells);
+    std::size_t size{};
+    for (std::size_t i = 0; i < cells;) {
+        if (size + 2 >= cells)
+            return tile;
+        const std::size_t count = runLength(tile.data.data() + i, std::min<std::size_t>(255, cells - i));
+        runs[size++] = static_cast<uint8_t>(count);
+        runs[size++] = tile.data[i];
+        i += count;
+    }
+    runs.resize(size);
+    tile.encoding = msg::OccupancyGridTile::encoding_run_length;
+    tile.data = std::move(runs);
+    return tile;
+}
+
+//! 检查分块的编码、数据长度与栅格值，原始数据长度或行程长度之和必须等于分块的栅格数
+MapStatus checkTile(const msg::OccupancyGridTile &tile, std::size_t cells) noexcept {
+    const auto valid_byte = [](uint8_t byte) { return validCellValue(static_cast<int8_t>(byte)); };
+    if (tile.encoding == msg::OccupancyGridTile::encoding_raw) {
+        if (tile.data.size() != cells)
+            return MapStatus::InvalidDimensions;
+        return std::all_of(tile.data.begin(), tile.data.end(), valid_byte) ? MapStatus::Ok : MapStatus::InvalidValue;
+    }
+    if (tile.encoding != msg::OccupancyGridTile::encoding_run_length || tile.data.size() % 2 != 0)
+        return MapStatus::InvalidDimensions;
+    std::size_t written{};
+    bool values_valid = true;
+    for (std::size_t i = 0; i < tile.data.size(); i += 2) {
+        const std::size_t count = tile.data[i];
+        if (count == 0 || count > cells - written)
+            return MapStatus::InvalidDimensions;
+        values_valid = values_valid && valid_byte(tile.data[i + 1]);
+        written += count;
+    }
+    if (written != cells)
+        return MapStatus::InvalidDimensions;
+    return values_valid ? MapStatus::Ok : MapStatus::InvalidValue;
+}
+
+//! 将通过 checkTile() 检查的分块按行写入地图数据
+void writeTile(const Geometry &geometry, const msg::OccupancyGridTile &tile, const TileRect &rect, int8_t *data) noexcept {
+    if (tile.encoding == msg::OccupancyGridTile::encoding_raw) {
+        for (uint32_t row = 0; row < rect.height; ++row)
+            std::memcpy(data + cellIndex(geometry, rect.x, rect.y + row),
+                        tile.data.data() + static_cast<std::size_t>(row) * rect.width, rect.width);
+        return;
+    }
+    // 行程可以跨越分块内的行，按行截断后依次填充
+    uint32_t row{}, column{};
+    for (std::size_t i = 0; i < tile.data.size(); i += 2) {
+        const auto value = static_cast<int8_t>(tile.data[i + 1]);
+        for (uint32_t count = tile.data[i]; count > 0;) {
+            const uint32_t length = std::min(count, rect.width - column);
+            std::fill_n(data + cellIndex(geometry, rect.x + column, rect.y + row), length, value);
+            count -= length;
+            column += length;
+            if (column == rect.width) {
+                column = 0;
+                ++row;
+            }
+        }
+    }
+}
+
+float logOdds(double probability) noexcept { return static_cast<float>(std::log(probability / (1.0 - probability))); }
+
+//! 将对数赔率量化为栅格值，NaN 表示尚未观测的未知栅格
+int8_t quantizeLogOdds(float log_odds) noexcept {
+    if (std::isnan(log_odds))
+        return -1;
+    return static_cast<int8_t>(std::lround(100.0f / (1.0f + std::exp(-log_odds))));
+}
+
+//! 以栅格值作为对数赔率先验，未知栅格返回 NaN
+float seedLogOdds(int8_t value, float min_log_odds, float max_log_odds) noexcept {
+    if (value < 0)
+        return std::numeric_limits<float>::quiet_NaN();
+    const double probability = std::clamp(static_cast<double>(value) / 100.0, kProbabilityEpsilon,
+                                          1.0 - kProbabilityEpsilon);
+    return std::clamp(logOdds(probability), min_log_odds, max_log_odds);
+}
+
 MapStatus validateOptions(const CostmapOptions &options) noexcept {
     if (options.lethal_threshold < 1 || options.lethal_threshold > 100)
         return MapStatus::InvalidOptions;
@@ -300,11 +448,8 @@ bool segmentsIntersect(double ax, double ay, double bx, double by,
            onSegment(cx, cy, dx, dy, ax, ay) || onSegment(cx, cy, dx, dy, bx, by);
 }
 
-bool polygonIntersectsCell(const std::vector<std::pair<double, double>> &polygon, uint32_t x, uint32_t y) noexcept {
-    const double left = x;
-    const double right = static_cast<double>(x) + 1.0;
-    const double bottom = y;
-    const double top = static_cast<double>(y) + 1.0;
+bool polygonIntersectsRect(const std::vector<std::pair<double, double>> &polygon,
+                           double left, double bottom, double right, double top) noexcept {
     for (const auto &[px, py] : polygon)
         if (px >= left && px <= right && py >= bottom && py <= top)
             return true;
@@ -312,21 +457,191 @@ bool polygonIntersectsCell(const std::vector<std::pair<double, double>> &polygon
         pointInPolygon(right, top, polygon) || pointInPolygon(left, top, polygon))
         return true;
 
-    constexpr double square[4][2]{{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}};
+    const double corners[4][2]{{left, bottom}, {right, bottom}, {right, top}, {left, top}};
     for (std::size_t i = 0; i < polygon.size(); ++i) {
         const auto &[ax, ay] = polygon[i];
         const auto &[bx, by] = polygon[(i + 1) % polygon.size()];
         for (std::size_t edge = 0; edge < 4; ++edge) {
-            const auto &start = square[edge];
-            const auto &end = square[(edge + 1) % 4];
-            if (segmentsIntersect(ax, ay, bx, by, left + start[0], bottom + start[1],
-                                  left + end[0], bottom + end[1]))
+            const auto &start = corners[edge];
+            const auto &end = corners[(edge + 1) % 4];
+            if (segmentsIntersect(ax, ay, bx, by, start[0], start[1], end[0], end[1]))
                 return true;
         }
     }
     return false;
 }
 
+bool polygonIntersectsCell(const std::vector<std::pair<double, double>> &polygon, uint32_t x, uint32_t y) noexcept {
+    return polygonIntersectsRect(polygon, x, y, static_cast<double>(x) + 1.0, static_cast<double>(y) + 1.0);
+}
+
+//! 点 (px, py) 到线段 (ax, ay)-(bx, by) 的距离
+double segmentDistance(double px, double py, double ax, double ay, double bx, double by) noexcept {
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double length2 = dx * dx + dy * dy;
+    const double t = length2 > 0.0 ? std::clamp(((px - ax) * dx + (py - ay) * dy) / length2, 0.0, 1.0) : 0.0;
+    return std::hypot(px - ax - t * dx, py - ay - t * dy);
+}
+
+//! 主代价是否阻挡 footprint
+bool blocksFootprint(uint8_t cost, bool unknown_is_lethal) noexcept {
+    return cost == Unknown ? unknown_is_lethal : cost >= Inscribed;
+}
+
+/**
+ * @brief 将机器人局部坐标系中的 footprint 顶点变换为地图连续栅格坐标
+ *
+ * @param[in] geometry 地图几何信息
+ * @param[in] footprint footprint 顶点
+ * @param[in] pose 机器人位姿，位置分量须为有限值
+ * @param[in] pose_cos 机器人朝向的余弦
+ * @param[in] pose_sin 机器人朝向的正弦
+ * @param[out] polygon 变换后的多边形顶点
+ * @return 顶点均为有限值且位于地图内时返回 `true`
+ */
+bool footprintToMap(const Geometry &geometry, const std::vector<msg::Point> &footprint, const msg::Pose &pose,
+                    double pose_cos, double pose_sin, std::vector<std::pair<double, double>> &polygon) {
+    polygon.clear();
+    polygon.reserve(footprint.size());
+    for (const auto &point : footprint) {
+        if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z))
+            return false;
+        const double world_x = pose.position.x + pose_cos * point.x - pose_sin * point.y;
+        const double world_y = pose.position.y + pose_sin * point.x + pose_cos * point.y;
+        double map_x{}, map_y{};
+        if (!worldToContinuous(geometry, world_x, world_y, map_x, map_y) ||
+            map_x < 0.0 || map_y < 0.0 || map_x >= geometry.width || map_y >= geometry.height)
+            return false;
+        polygon.emplace_back(map_x, map_y);
+    }
+    return true;
+}
+
+/**
+ * @brief 计算点集的凸包
+ *
+ * @param[in] points 点集
+ * @return 按逆时针排列的凸包顶点，共线点不保留
+ */
+std::vector<std::pair<double, double>> convexHull(std::vector<std::pair<double, double>> points) {
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    if (points.size() < 3)
+        return points;
+    std::vector<std::pair<double, double>> hull(2 * points.size());
+    std::size_t count{};
+    const auto turn = [&](const std::pair<double, double> &point) {
+        return cross(hull[count - 2].first, hull[count - 2].second, hull[count - 1].first, hull[count - 1].second,
+                     point.first, point.second);
+    };
+    for (const auto &point : points) {
+        while (count >= 2 && turn(point) <= 0.0)
+            --count;
+        hull[count++] = point;
+    }
+    for (std::size_t i = points.size() - 1, lower = count + 1; i-- > 0;) {
+        while (count >= lower && turn(points[i]) <= 0.0)
+            --count;
+        hull[count++] = points[i];
+    }
+    hull.resize(count - 1);
+    return hull;
+}
+
+//! footprint 朝向离散数量上限
+constexpr uint32_t kMaxHeadingBins = 1024;
+//! 机器人中心在栅格内的偏移每个方向的离散数量
+constexpr uint32_t kFootprintOffsetBins = 4;
+//! 生成掩码的 footprint 外接圆半径上限，单位为格，更大的 footprint 栅格化开销过高
+constexpr double kMaxMaskRadius = 64.0;
+
+//! 并行处理的最小栅格数，较小的区域唤醒线程的开销超过收益
+constexpr std::size_t kParallelMinCells = std::size_t{1} << 18;
+
+/**
+ * @brief 按行分块并行执行的常驻工作线程
+ * @details 首次遇到足够大的区域时才创建 WorkerPool，此后每次调用只唤醒已有线程，不再创建与回收线程。
+ *          复制时只复制线程数配置，副本在需要时自行创建线程池
+ */
+class RowWorkers {
+public:
+    RowWorkers() = default;
+    RowWorkers(const RowWorkers &other) : _threads(other._threads) {}
+    RowWorkers &operator=(const RowWorkers &other) {
+        setThreads(other._threads);
+        return *this;
+    }
+
+    /**
+     * @brief 设置参与计算的线程数（含调用线程），线程数改变时丢弃已有的线程池
+     *
+     * @param[in] threads 线程数，0 表示使用硬件线程数
+     */
+    void setThreads(std::size_t threads) {
+        if (threads != _threads)
+            _threads = threads, _pool.reset();
+    }
+
+    /**
+     * @brief 按行分块并行执行
+     * @details 区域不足 `kParallelMinCells` 个栅格或只有一个线程时直接在调用线程中执行，否则调用线程与工作线程共同领取分块
+     *
+     * @param[in] first 首行
+     * @param[in] last 末行（包含）
+     * @param[in] row_cells 每行栅格数
+     * @param[in] fn 形如 `void(uint32_t first, uint32_t last)` 的分块处理函数，不同分块之间不得写入相同的数据
+     */
+    template <typename Fn>
+    void run(uint32_t first, uint32_t last, std::size_t row_cells, Fn &&fn) {
+        const std::size_t rows = static_cast<std::size_t>(last) - first + 1;
+        const std::size_t threads = _threads != 0 ? _threads : std::max(1u, std::thread::hardware_concurrency());
+        const std::size_t chunks = std::min({threads, rows, rows * row_cells / kParallelMinCells});
+        if (chunks <= 1) {
+            fn(first, last);
+            return;
+        }
+        if (!_pool)
+            _pool = std::make_unique<WorkerPool>(threads - 1);
+
+        const std::size_t step = (rows + chunks - 1) / chunks;
+        std::atomic_size_t next{};
+        _pool->run([&](std::size_t) {
+            for (std::size_t chunk = next++; chunk < chunks; chunk = next++) {
+                const std::size_t begin = first + chunk * step;
+                if (begin > last)
+                    break;
+                fn(static_cast<uint32_t>(begin), static_cast<uint32_t>(std::min<std::size_t>(last, begin + step - 1)));
+            }
+        });
+    }
+
+private:
+    std::size_t _threads{};              //!< 参与计算的线程数，0 表示使用硬件线程数
+    std::unique_ptr<WorkerPool> _pool{}; //!< 首次并行执行时创建的线程池
+};
+
+/**
+ * @brief 合并一行静态层与障碍层
+ * @details 障碍层只含 `Free` 与 `Lethal`，合并结果为障碍层中的致命障碍覆盖静态层（包括未知空间），
+ *          SSE2 路径以比较掩码选择两者，与标量路径逐字节一致
+ */
+void mergeRow(const uint8_t *static_row, const uint8_t *obstacle_row, uint8_t *master_row, std::size_t count) noexcept {
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i lethal16 = _mm_set1_epi8(static_cast<char>(Lethal));
+    for (; i + 16 <= count; i += 16) {
+        const __m128i base = _mm_loadu_si128(reinterpret_cast<const __m128i *>(static_row + i));
+        const __m128i obstacle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(obstacle_row + i));
+        const __m128i mask = _mm_cmpeq_epi8(obstacle, lethal16);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(master_row + i),
+                         _mm_or_si128(_mm_and_si128(mask, lethal16), _mm_andnot_si128(mask, base)));
+    }
+#endif
+    for (; i < count; ++i)
+        master_row[i] = obstacle_row[i] == Lethal ? static_cast<uint8_t>(Lethal) : static_row[i];
+}
+
 } // namespace
 
 const char *to_string(MapStatus status) noexcept {
@@ -359,6 +674,7 @@ public:
     };
 
     void markDirty(uint32_t x, uint32_t y, uint64_t base_revision) noexcept {
+        dirty_tiles[static_cast<std::size_t>(y / GridMap::tile_size) * tiles_x + x / GridMap::tile_size] = 1;
         if (!dirty) {
             dirty = DirtyRegion{base_revision, x, y, x, y};
             return;
@@ -369,10 +685,40 @@ public:
         dirty->max_y = std::max(dirty->max_y, y);
     }
 
+    void clearDirty() noexcept {
+        dirty.reset();
+        std::fill(dirty_tiles.begin(), dirty_tiles.end(), 0);
+    }
+
+    //! 按当前几何重建分块记录，并清空本地修改记录与扫描融合图层，装载全量地图后调用
+    void resetTracking() {
+        tiles_x = (geometry.width + GridMap::tile_size - 1) / GridMap::tile_size;
+        const uint32_t tiles_y = (geometry.height + GridMap::tile_size - 1) / GridMap::tile_size;
+        dirty_tiles.assign(static_cast<std::size_t>(tiles_x) * tiles_y, 0);
+        dirty.reset();
+        log_odds = {};
+        scan_values = {};
+        scan_marks = {};
+        scan_generation = 0;
+    }
+
     msg::OccupancyGrid grid{};
     Geometry geometry{};
     std::optional<DirtyRegion> dirty{};
+    //! 发生过本地修改的分块标记，按分块行优先排列
+    std::vector<uint8_t> dirty_tiles{};
+    uint32_t tiles_x{};
     bool valid{};
+
+    //! 对数赔率图层，首次融合扫描时按地图尺寸分配，NaN 表示未知
+    std::vector<float> log_odds{};
+    //! 与对数赔率图层同步的栅格值，与地图不一致说明栅格已被其他接口改写
+    std::vector<int8_t> scan_values{};
+    //! 单帧去重标记，`generation - 1` 表示本帧已记为未命中，`generation` 表示本帧已记为命中
+    std::vector<uint32_t> scan_marks{};
+    uint32_t scan_generation{};
+    std::vector<std::size_t> free_cells{}; //!< 本帧去重后的未命中栅格索引
+    std::vector<std::size_t> hit_cells{};  //!< 本帧去重后的命中栅格索引
 };
 
 GridMap::GridMap() : _impl(std::make_unique<Impl>()) {}
@@ -399,7 +745,7 @@ MapStatus GridMap::reset(const msg::OccupancyGrid &grid) {
     _impl->grid = grid;
     normalizeOrigin(_impl->grid.info.origin);
     _impl->geometry = geometry;
-    _impl->dirty.reset();
+    _impl->resetTracking();
     _impl->valid = true;
     return MapStatus::Ok;
 }
@@ -412,7 +758,7 @@ MapStatus GridMap::reset(msg::OccupancyGrid &&grid) {
     _impl->grid = std::move(grid);
     normalizeOrigin(_impl->grid.info.origin);
     _impl->geometry = geometry;
-    _impl->dirty.reset();
+    _impl->resetTracking();
     _impl->valid = true;
     return MapStatus::Ok;
 }
@@ -524,6 +870,123 @@ MapStatus GridMap::integrateRay(double start_x, double start_y, double end_x, do
     return MapStatus::Ok;
 }
 
+MapStatus GridMap::integrateScan(const msg::Pose &origin, const float *ranges, std::size_t count, double angle_min,
+                                 double angle_increment, const ScanOptions &options) {
+    if (!_impl->valid)
+        return MapStatus::InvalidDimensions;
+    const auto valid_probability = [](double value) { return std::isfinite(value) && value > 0.0 && value < 1.0; };
+    if (!valid_probability(options.hit_probability) || !valid_probability(options.miss_probability) ||
+        !valid_probability(options.min_probability) || !valid_probability(options.max_probability) ||
+        options.hit_probability <= 0.5 || options.miss_probability >= 0.5 ||
+        options.min_probability >= options.max_probability)
+        return MapStatus::InvalidProbability;
+    if (!std::isfinite(options.max_range) || options.max_range <= 0.0 || !std::isfinite(angle_min) ||
+        !std::isfinite(angle_increment) || (ranges == nullptr && count != 0))
+        return MapStatus::InvalidOptions;
+    double sensor_cos{}, sensor_sin{};
+    double start_x{}, start_y{};
+    if (!planarYaw(origin.orientation, sensor_cos, sensor_sin) ||
+        !worldToContinuous(_impl->geometry, origin.position.x, origin.position.y, start_x, start_y))
+        return MapStatus::InvalidOrigin;
+    if (_impl->grid.revision == std::numeric_limits<uint64_t>::max())
+        return MapStatus::InvalidRevision;
+
+    auto &impl = *_impl;
+    const auto &geometry = impl.geometry;
+    if (impl.log_odds.empty()) {
+        impl.log_odds.assign(impl.grid.data.size(), std::numeric_limits<float>::quiet_NaN());
+        impl.scan_values.assign(impl.grid.data.size(), -1);
+        impl.scan_marks.assign(impl.grid.data.size(), 0);
+        impl.scan_generation = 0;
+    }
+    if (impl.scan_generation > std::numeric_limits<uint32_t>::max() - 2) {
+        std::fill(impl.scan_marks.begin(), impl.scan_marks.end(), 0);
+        impl.scan_generation = 0;
+    }
+    impl.scan_generation += 2;
+    const uint32_t free_mark = impl.scan_generation - 1;
+    const uint32_t hit_mark = impl.scan_generation;
+    impl.free_cells.clear();
+    impl.hit_cells.clear();
+
+    // 光束方向从传感器坐标系转换到地图栅格坐标系
+    const double base_angle = std::atan2(sensor_sin, sensor_cos) -
+                              std::atan2(geometry.sin_yaw, geometry.cos_yaw) + angle_min;
+    const double max_cells = options.max_range / geometry.resolution;
+    const auto endpoint = [&](std::size_t i, double &end_x, double &end_y) {
+        const double range = ranges[i];
+        if (std::isnan(range) || range <= 0.0)
+            return false;
+        const double length = std::min(range / geometry.resolution, max_cells);
+        const double angle = base_angle + static_cast<double>(i) * angle_increment;
+        end_x = start_x + length * std::cos(angle);
+        end_y = start_y + length * std::sin(angle);
+        return true;
+    };
+
+    // 先标记全部命中终点，使其他光束途经这些栅格时不会将其记为未命中
+    for (std::size_t i = 0; i < count; ++i) {
+        double end_x{}, end_y{};
+        if (!endpoint(i, end_x, end_y) || !(ranges[i] < options.max_range))
+            continue;
+        const auto cell = continuousToCell(geometry, end_x, end_y);
+        if (!cell)
+            continue;
+        const auto index = cellIndex(geometry, cell->x, cell->y);
+        if (impl.scan_marks[index] != hit_mark) {
+            impl.scan_marks[index] = hit_mark;
+            impl.hit_cells.push_back(index);
+        }
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        double end_x{}, end_y{};
+        if (!endpoint(i, end_x, end_y))
+            continue;
+        traceLine(geometry, start_x, start_y, end_x, end_y, [&](uint32_t x, uint32_t y) {
+            const auto index = cellIndex(geometry, x, y);
+            if (impl.scan_marks[index] < free_mark) {
+                impl.scan_marks[index] = free_mark;
+                impl.free_cells.push_back(index);
+            }
+        });
+    }
+
+    const float min_log_odds = logOdds(options.min_probability);
+    const float max_log_odds = logOdds(options.max_probability);
+    const uint64_t base_revision = impl.grid.revision;
+    bool changed{};
+    const auto integrate = [&](const std::vector<std::size_t> &cells, float delta) {
+        for (const auto index : cells) {
+            auto &value = impl.grid.data[index];
+            float prior = impl.log_odds[index];
+            // 栅格被其他接口改写后，以新的栅格值重新作为先验
+            if (impl.scan_values[index] != value) {
+                prior = seedLogOdds(value, min_log_odds, max_log_odds);
+                impl.log_odds[index] = prior;
+                impl.scan_values[index] = value;
+            }
+            const float posterior = std::clamp((std::isnan(prior) ? 0.0f : prior) + delta, min_log_odds, max_log_odds);
+            // 已饱和的栅格保持不变，省去量化
+            if (posterior == prior)
+                continue;
+            impl.log_odds[index] = posterior;
+            const int8_t updated = quantizeLogOdds(posterior);
+            impl.scan_values[index] = updated;
+            if (updated == value)
+                continue;
+            value = updated;
+            changed = true;
+            impl.markDirty(static_cast<uint32_t>(index % geometry.width), static_cast<uint32_t>(index / geometry.width),
+                           base_revision);
+        }
+    };
+    integrate(impl.free_cells, logOdds(options.miss_probability));
+    integrate(impl.hit_cells, logOdds(options.hit_probability));
+    if (changed)
+        ++impl.grid.revision;
+    return MapStatus::Ok;
+}
+
 MapStatus GridMap::apply(const msg::OccupancyGridUpdate &update) {
     if (!_impl->valid)
         return MapStatus::InvalidDimensions;
@@ -552,7 +1015,92 @@ MapStatus GridMap::apply(const msg::OccupancyGridUpdate &update) {
     _impl->grid.data = std::move(data);
     _impl->grid.header.stamp = update.header.stamp;
     _impl->grid.revision = update.revision;
-    _impl->dirty.reset();
+    _impl->clearDirty();
+    return MapStatus::Ok;
+}
+
+MapStatus GridMap::apply(const msg::OccupancyGridTileUpdate &update) {
+    if (!_impl->valid)
+        return MapStatus::InvalidDimensions;
+    if (update.header.frame_id != _impl->grid.header.frame_id)
+        return MapStatus::FrameMismatch;
+    if (update.base_revision != _impl->grid.revision)
+        return MapStatus::RevisionMismatch;
+    if (update.revision <= update.base_revision)
+        return MapStatus::InvalidRevision;
+    // 分块边长不超过地图的较长边，本类发布的分块边长固定为 tile_size，在较小的地图上同样允许
+    const auto &geometry = _impl->geometry;
+    if (update.tile_size == 0 || update.tile_size > std::max({geometry.width, geometry.height, tile_size}))
+        return MapStatus::InvalidDimensions;
+
+    // 全部分块检查通过后再写入，保证失败时地图不变；写入直接解码到地图，不需要与分块总量成正比的缓冲区
+    std::vector<std::pair<uint32_t, uint32_t>> coordinates{};
+    coordinates.reserve(update.tiles.size());
+    for (const auto &tile : update.tiles) {
+        if (static_cast<uint64_t>(tile.x) * update.tile_size >= geometry.width ||
+            static_cast<uint64_t>(tile.y) * update.tile_size >= geometry.height)
+            return MapStatus::OutOfBounds;
+        coordinates.emplace_back(tile.y, tile.x);
+    }
+    std::sort(coordinates.begin(), coordinates.end());
+    if (std::adjacent_find(coordinates.begin(), coordinates.end()) != coordinates.end())
+        return MapStatus::InvalidDimensions;
+    for (const auto &tile : update.tiles) {
+        const auto rect = tileRect(geometry, update.tile_size, tile.x, tile.y);
+        const auto status = checkTile(tile, static_cast<std::size_t>(rect.width) * rect.height);
+        if (status != MapStatus::Ok)
+            return status;
+    }
+    for (const auto &tile : update.tiles)
+        writeTile(geometry, tile, tileRect(geometry, update.tile_size, tile.x, tile.y), _impl->grid.data.data());
+    _impl->grid.header.stamp = update.header.stamp;
+    _impl->grid.revision = update.revision;
+    _impl->clearDirty();
+    return MapStatus::Ok;
+}
+
+MapStatus GridMap::assign(const msg::OccupancyGrid &grid) {
+    if (!_impl->valid)
+        return MapStatus::InvalidDimensions;
+    Geometry geometry{};
+    const auto status = validateGrid(grid, geometry);
+    if (status != MapStatus::Ok)
+        return status;
+    const auto &current = _impl->geometry;
+    if (grid.header.frame_id != _impl->grid.header.frame_id || geometry.width != current.width ||
+        geometry.height != current.height || geometry.resolution != current.resolution ||
+        geometry.origin_x != current.origin_x || geometry.origin_y != current.origin_y ||
+        std::abs(geometry.cos_yaw - current.cos_yaw) > kPlanarTolerance ||
+        std::abs(geometry.sin_yaw - current.sin_yaw) > kPlanarTolerance)
+        return MapStatus::GeometryMismatch;
+    if (grid.data == _impl->grid.data)
+        return MapStatus::Ok;
+    if (_impl->grid.revision == std::numeric_limits<uint64_t>::max())
+        return MapStatus::InvalidRevision;
+
+    // 按分块内的行段比较，只为实际变化的行段记录首尾栅格，避免逐栅格维护脏区
+    const uint64_t base_revision = _impl->grid.revision;
+    for (uint32_t y = 0; y < current.height; ++y) {
+        for (uint32_t x = 0; x < current.width; x += tile_size) {
+            const uint32_t length = std::min(tile_size, current.width - x);
+            const auto index = cellIndex(current, x, y);
+            const auto source = grid.data.begin() + index;
+            const auto target = _impl->grid.data.begin() + index;
+            const auto first = std::mismatch(source, source + length, target);
+            if (first.first == source + length)
+                continue;
+            const auto last = std::mismatch(std::make_reverse_iterator(source + length),
+                                            std::make_reverse_iterator(first.first),
+                                            std::make_reverse_iterator(target + length));
+            const auto begin_x = x + static_cast<uint32_t>(first.first - source);
+            const auto end_x = x + length - 1 - static_cast<uint32_t>(last.first - std::make_reverse_iterator(source + length));
+            std::copy(first.first, source + length, first.second);
+            _impl->markDirty(begin_x, y, base_revision);
+            _impl->markDirty(end_x, y, base_revision);
+        }
+    }
+    _impl->grid.header.stamp = grid.header.stamp;
+    ++_impl->grid.revision;
     return MapStatus::Ok;
 }
 
@@ -576,19 +1124,404 @@ std::optional<msg::OccupancyGridUpdate> GridMap::pendingUpdate() const {
     return result;
 }
 
-void GridMap::clearPendingUpdate() noexcept { _impl->dirty.reset(); }
+std::optional<msg::OccupancyGridTileUpdate> GridMap::pendingTiles(TileEncoding encoding) const {
+    if (!_impl->valid || !_impl->dirty)
+        return std::nullopt;
+    msg::OccupancyGridTileUpdate result{};
+    result.header = _impl->grid.header;
+    result.base_revision = _impl->dirty->base_revision;
+    result.revision = revision();
+    result.tile_size = tile_size;
+    for (std::size_t i = 0; i < _impl->dirty_tiles.size(); ++i)
+        if (_impl->dirty_tiles[i] != 0)
+            result.tiles.push_back(encodeTile(_impl->geometry, _impl->grid.data, tile_size,
+                                              static_cast<uint32_t>(i % _impl->tiles_x),
+                                              static_cast<uint32_t>(i / _impl->tiles_x), encoding));
+    return result;
+}
+
+void GridMap::clearPendingUpdate() noexcept { _impl->clearDirty(); }
+
+class Footprint::Impl {
+public:
+    //! 掩码中同一行连续的一段栅格，坐标相对于机器人中心所在的栅格，横向为左闭右开区间
+    struct Run {
+        int32_t y{};
+        int32_t begin{};
+        int32_t end{};
+    };
+
+    /**
+     * @brief 一个朝向区间的掩码，包围盒为闭区间
+     * @details `inner` 中的栅格在区间内任意朝向和中心偏移下都与多边形相交，覆盖不可通行栅格即可判定碰撞；
+     *          `boundary` 中的栅格只是可能相交，需要精确判断
+     */
+    struct Mask {
+        std::vector<Run> inner{};
+        std::vector<Run> boundary{};
+        int32_t min_x{};
+        int32_t min_y{};
+        int32_t max_x{};
+        int32_t max_y{};
+        double reach{}; //!< 掩码内的栅格中心到中心栅格中心的最大格距
+    };
+
+    /**
+     * @brief 栅格化一个朝向区间、一个中心偏移区间的掩码
+     * @details 机器人中心在所在栅格内的偏移位于 \f$[o_x,\,o_x+s)\times[o_y,\,o_y+s)\f$ 时，相对坐标为 \f$(i,\,j)\f$
+     *          的栅格在多边形坐标系中位于 \f$[i-o_x-s,\,i+1-o_x]\times[j-o_y-s,\,j+1-o_y]\f$ 内，且始终包含该范围的中心点；
+     *          朝向在区间内变化时多边形内的点最多移动 @p margin。与扩大 @p margin 后的范围相交的栅格构成掩码，
+     *          中心点距多边形边界超过 @p margin 的栅格为内部栅格
+     *
+     * @param[in] rotated 按区间中心朝向旋转后的多边形，单位为格
+     * @param[in] margin 朝向区间内旋转引起的最大位移，单位为格
+     * @param[in] offset_x 中心偏移区间的横向下界 \f$o_x\f$
+     * @param[in] offset_y 中心偏移区间的纵向下界 \f$o_y\f$
+     * @param[in] step 中心偏移区间的宽度 \f$s\f$
+     */
+    static Mask rasterize(const std::vector<std::pair<double, double>> &rotated, double margin,
+                          double offset_x, double offset_y, double step);
+
+    std::vector<msg::Point> polygon{};
+    double resolution{};
+    uint32_t heading_bins{};
+    //! 凸包各边的外法向半平面 \f$(n_x,\,n_y,\,d)\f$，机器人局部坐标系，单位为格，凸包内的点满足 \f$n\cdot p\le d\f$
+    std::vector<std::array<double, 3>> hull_planes{};
+    bool contains_origin{}; //!< 机器人中心是否位于多边形内
+    std::vector<Mask> masks{}; //!< 按朝向、纵向偏移、横向偏移排列的掩码，footprint 过大时为空
+};
+
+Footprint::Impl::Mask Footprint::Impl::rasterize(const std::vector<std::pair<double, double>> &rotated, double margin,
+                                                 double offset_x, double offset_y, double step) {
+    double min_x = std::numeric_limits<double>::max();
+    double min_y = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    double max_y = std::numeric_limits<double>::lowest();
+    for (const auto &[x, y] : rotated) {
+        min_x = std::min(min_x, x);
+        min_y = std::min(min_y, y);
+        max_x = std::max(max_x, x);
+        max_y = std::max(max_y, y);
+    }
+    const auto first_x = static_cast<int32_t>(std::floor(min_x - margin)) - 1;
+    const auto first_y = static_cast<int32_t>(std::floor(min_y - margin)) - 1;
+    const auto last_x = static_cast<int32_t>(std::ceil(max_x + margin)) + 1;
+    const auto last_y = static_cast<int32_t>(std::ceil(max_y + margin)) + 1;
+
+    Mask mask{};
+    const auto append = [](std::vector<Run> &runs, int32_t x, int32_t y) {
+        if (!runs.empty() && runs.back().y == y && runs.back().end == x)
+            ++runs.back().end;
+        else
+            runs.push_back({y, x, x + 1});
+    };
+    for (int32_t y = first_y; y <= last_y; ++y) {
+        for (int32_t x = first_x; x <= last_x; ++x) {
+            const double left = x - offset_x - step;
+            const double bottom = y - offset_y - step;
+            const double right = x + 1.0 - offset_x;
+            const double top = y + 1.0 - offset_y;
+            if (!polygonIntersectsRect(rotated, left - margin, bottom - margin, right + margin, top + margin))
+                continue;
+            const double center_x = (left + right) * 0.5;
+            const double center_y = (bottom + top) * 0.5;
+            bool inner = pointInPolygon(center_x, center_y, rotated);
+            for (std::size_t i = 0; inner && i < rotated.size(); ++i) {
+                const auto &[ax, ay] = rotated[i];
+                const auto &[bx, by] = rotated[(i + 1) % rotated.size()];
+                inner = segmentDistance(center_x, center_y, ax, ay, bx, by) > margin;
+            }
+            append(inner ? mask.inner : mask.boundary, x, y);
+        }
+    }
+    mask.min_x = mask.min_y = std::numeric_limits<int32_t>::max();
+    mask.max_x = mask.max_y = std::numeric_limits<int32_t>::min();
+    for (const auto *runs : {&mask.inner, &mask.boundary}) {
+        for (const auto &run : *runs) {
+            mask.min_x = std::min(mask.min_x, run.begin);
+            mask.max_x = std::max(mask.max_x, run.end - 1);
+            mask.min_y = std::min(mask.min_y, run.y);
+            mask.max_y = std::max(mask.max_y, run.y);
+            mask.reach = std::max(mask.reach, std::hypot(std::max(-run.begin, run.end - 1), run.y));
+        }
+    }
+    return mask;
+}
+
+Footprint::Footprint(std::vector<msg::Point> polygon, double resolution, uint32_t heading_bins)
+    : _impl(std::make_unique<Impl>()) {
+    if (polygon.size() < 3 || !std::isfinite(resolution) || resolution <= 0.0 || heading_bins == 0 ||
+        heading_bins > kMaxHeadingBins)
+        return;
+    std::vector<std::pair<double, double>> local{};
+    local.reserve(polygon.size());
+    double radius{};
+    for (const auto &point : polygon) {
+        if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z))
+            return;
+        local.emplace_back(point.x / resolution, point.y / resolution);
+        radius = std::max(radius, std::hypot(local.back().first, local.back().second));
+    }
+    if (!std::isfinite(radius))
+        return;
+
+    auto &impl = *_impl;
+    impl.contains_origin = pointInPolygon(0.0, 0.0, local);
+    // 法向量取单位长度，偏移量放宽舍入误差，半平面只用于排除与凸包明显分离的栅格
+    const auto hull = convexHull(local);
+    for (std::size_t i = 0; hull.size() >= 3 && i < hull.size(); ++i) {
+        const auto &[ax, ay] = hull[i];
+        const auto &[bx, by] = hull[(i + 1) % hull.size()];
+        const double length = std::hypot(bx - ax, by - ay);
+        const double normal_x = (by - ay) / length;
+        const double normal_y = (ax - bx) / length;
+        impl.hull_planes.push_back({normal_x, normal_y, normal_x * ax + normal_y * ay + 1e-6});
+    }
+    if (radius <= kMaxMaskRadius) {
+        // 旋转半个区间角度时多边形上的点最多移动外接圆半径与该角度之积
+        const double bin_width = 2.0 * kPi / heading_bins;
+        const double margin = radius * bin_width * 0.5 + kPlanarTolerance;
+        std::vector<std::pair<double, double>> rotated(local.size());
+        constexpr double step = 1.0 / kFootprintOffsetBins;
+        impl.masks.reserve(static_cast<std::size_t>(heading_bins) * kFootprintOffsetBins * kFootprintOffsetBins);
+        for (uint32_t bin = 0; bin < heading_bins; ++bin) {
+            const double cos_yaw = std::cos(bin * bin_width);
+            const double sin_yaw = std::sin(bin * bin_width);
+            for (std::size_t i = 0; i < local.size(); ++i)
+                rotated[i] = {cos_yaw * local[i].first - sin_yaw * local[i].second,
+                              sin_yaw * local[i].first + cos_yaw * local[i].second};
+            for (uint32_t offset_y = 0; offset_y < kFootprintOffsetBins; ++offset_y)
+                for (uint32_t offset_x = 0; offset_x < kFootprintOffsetBins; ++offset_x)
+                    impl.masks.push_back(Impl::rasterize(rotated, margin, offset_x * step, offset_y * step, step));
+        }
+    }
+    impl.polygon = std::move(polygon);
+    impl.resolution = resolution;
+    impl.heading_bins = heading_bins;
+}
+
+Footprint::~Footprint() = default;
+Footprint::Footprint(Footprint &&) noexcept = default;
+Footprint &Footprint::operator=(Footprint &&) noexcept = default;
+Footprint::Footprint(const Footprint &other) : _impl(std::make_unique<Impl>(*other._impl)) {}
+Footprint &Footprint::operator=(const Footprint &other) {
+    if (this != &other)
+        *_impl = *other._impl;
+    return *this;
+}
+
+bool Footprint::valid() const noexcept { return _impl->heading_bins != 0; }
+const std::vector<msg::Point> &Footprint::polygon() const noexcept { return _impl->polygon; }
+double Footprint::resolution() const noexcept { return _impl->resolution; }
+uint32_t Footprint::headingBins() const noexcept { return _impl->heading_bins; }
 
 class Costmap::Impl {
 public:
+    //! 自上次 `updateCosts()` 以来静态层或障碍层发生变化的包围盒，闭区间
+    struct DirtyBounds {
+        uint32_t min_x{};
+        uint32_t min_y{};
+        uint32_t max_x{};
+        uint32_t max_y{};
+    };
+
+    void markDirty(uint32_t x, uint32_t y) noexcept {
+        if (!dirty) {
+            dirty = DirtyBounds{x, y, x, y};
+            return;
+        }
+        dirty->min_x = std::min(dirty->min_x, x);
+        dirty->min_y = std::min(dirty->min_y, y);
+        dirty->max_x = std::max(dirty->max_x, x);
+        dirty->max_y = std::max(dirty->max_y, y);
+    }
+
+    void markAllDirty() noexcept {
+        const auto &geometry = geometry_map._impl->geometry;
+        markDirty(0, 0);
+        markDirty(geometry.width - 1, geometry.height - 1);
+    }
+
+    /**
+     * @brief 预计算平方距离到膨胀代价的查找表
+     * @details 膨胀代价随距离单调递减，栅格的膨胀代价由最近的致命障碍决定，因此只需按最近障碍的平方格距查表
+     */
+    void buildCostTable();
+
+    /**
+     * @brief 重新计算主代价地图中的一个矩形区域
+     * @details 区域内每个栅格的膨胀代价只取决于其膨胀半径内的致命障碍，因此只需在区域向外扩展膨胀半径后的窗口内
+     *          计算到最近致命障碍的欧氏距离变换
+     */
+    void recompute(const DirtyBounds &region);
+
     GridMap geometry_map{};
     CostmapOptions options{};
     std::vector<uint8_t> static_layer{};
     std::vector<uint8_t> obstacle_layer{};
     std::vector<uint8_t> master{};
+    std::optional<DirtyBounds> dirty{};
+    int cell_radius{};                      //!< 膨胀半径，单位为格
+    std::vector<uint8_t> cost_table{};      //!< 以平方格距为索引的膨胀代价，0 表示超出膨胀半径
+    std::vector<double> clearance{};        //!< 以主代价为索引，主代价不超过该值的栅格到任意致命障碍的最小格距，不膨胀时为空
+    double inscribed_reach{};               //!< 内切代价覆盖的最大格距
+    std::size_t unknown_cells{};            //!< 主代价地图中的未知栅格数
+    std::vector<uint32_t> column_distance{}; //!< 距离变换缓存：到同列最近致命障碍的格距
+    std::vector<int> envelope{};            //!< 距离变换缓存：下包络抛物线的顶点列
+    std::vector<double> envelope_bound{};   //!< 距离变换缓存：下包络抛物线的左边界
+    RowWorkers row_workers{};               //!< 合并各层时按行并行的常驻工作线程
+    //! 一次 `updateCosts()` 中代价值发生变化的栅格
+    struct ChangeRecord {
+        uint64_t stamp{};        //!< 该次更新后的内容标识
+        std::vector<Cell> cells{};
+    };
+
+    //! 变化记录保留的栅格数上限
+    std::size_t changeLimit() const noexcept {
+        const auto &geometry = geometry_map._impl->geometry;
+        return std::max<std::size_t>(4096, static_cast<std::size_t>(geometry.width) * geometry.height / 16);
+    }
+
     uint64_t revision{};
+    uint64_t stamp{};                       //!< 主代价地图内容标识
+    std::deque<ChangeRecord> changes{};     //!< 最近若干次更新的变化记录，按时间先后排列
+    uint64_t change_base{};                 //!< 最早一条变化记录之前的内容标识
+    std::size_t change_count{};             //!< 变化记录中的栅格总数
+    std::vector<uint8_t> change_snapshot{}; //!< 重新计算前的主代价缓存
     bool valid{};
 };
 
+void Costmap::Impl::buildCostTable() {
+    const auto &geometry = geometry_map._impl->geometry;
+    cell_radius = static_cast<int>(std::ceil(options.inflation_radius / geometry.resolution));
+    cost_table.clear();
+    clearance.clear();
+    if (cell_radius <= 0)
+        return;
+    // 与逐障碍扫描的实现保持相同的距离与代价计算方式，平方格距相同的偏移取其中的最大代价
+    cost_table.assign(2 * static_cast<std::size_t>(cell_radius) * cell_radius + 1, Free);
+    for (int dy = 0; dy <= cell_radius; ++dy) {
+        for (int dx = 0; dx <= cell_radius; ++dx) {
+            const double distance = std::hypot(dx, dy) * geometry.resolution;
+            if (distance > options.inflation_radius)
+                continue;
+            uint8_t inflation_cost{};
+            if (distance <= options.inscribed_radius) {
+                inflation_cost = Inscribed;
+            } else {
+                inflation_cost = static_cast<uint8_t>(std::clamp(
+                    std::lround((Inscribed - 1) * std::exp(-options.cost_scaling_factor *
+                                                          (distance - options.inscribed_radius))),
+                    1l, 252l));
+            }
+            auto &entry = cost_table[static_cast<std::size_t>(dx * dx + dy * dy)];
+            entry = std::max(entry, inflation_cost);
+        }
+    }
+    // 到最近致命障碍的格距为 d 的栅格主代价不低于膨胀代价，因此主代价为 c 时任意致命障碍的格距都不小于
+    // 膨胀代价不超过 c 的最小格距；膨胀半径外第一圈的格距不超过 r^2 + 1，小于超出 [0, r]^2 范围的格距
+    clearance.assign(Inscribed, std::numeric_limits<double>::infinity());
+    inscribed_reach = 0.0;
+    for (int dy = 0; dy <= cell_radius; ++dy) {
+        for (int dx = 0; dx <= cell_radius; ++dx) {
+            const uint8_t inflation_cost = cost_table[static_cast<std::size_t>(dx * dx + dy * dy)];
+            const double distance = std::hypot(dx, dy);
+            if (inflation_cost == Inscribed)
+                inscribed_reach = std::max(inscribed_reach, distance);
+            for (std::size_t cost = inflation_cost; cost < clearance.size(); ++cost)
+                clearance[cost] = std::min(clearance[cost], distance);
+        }
+    }
+}
+
+void Costmap::Impl::recompute(const DirtyBounds &region) {
+    const auto &geometry = geometry_map._impl->geometry;
+    const std::size_t region_width = static_cast<std::size_t>(region.max_x) - region.min_x + 1;
+    row_workers.run(region.min_y, region.max_y, region_width, [&](uint32_t first, uint32_t last) {
+        for (uint32_t y = first; y <= last; ++y) {
+            const std::size_t offset = cellIndex(geometry, region.min_x, y);
+            mergeRow(static_layer.data() + offset, obstacle_layer.data() + offset, master.data() + offset, region_width);
+        }
+    });
+    if (cost_table.empty())
+        return;
+
+    // 两遍可分离的精确欧氏距离变换（Felzenszwalb-Huttenlocher），窗口内每个栅格只访问常数次
+    const int window_min_x = std::max(0, static_cast<int>(region.min_x) - cell_radius);
+    const int window_max_x = std::min(static_cast<int>(geometry.width) - 1, static_cast<int>(region.max_x) + cell_radius);
+    const int window_min_y = std::max(0, static_cast<int>(region.min_y) - cell_radius);
+    const int window_max_y = std::min(static_cast<int>(geometry.height) - 1, static_cast<int>(region.max_y) + cell_radius);
+    const int window_width = window_max_x - window_min_x + 1;
+    const int window_height = window_max_y - window_min_y + 1;
+    // 超过膨胀半径的格距不会产生膨胀代价，统一截断为 far
+    const auto far = static_cast<uint32_t>(cell_radius + 1);
+    column_distance.resize(static_cast<std::size_t>(window_width) * window_height);
+    envelope.resize(static_cast<std::size_t>(window_width));
+    envelope_bound.resize(static_cast<std::size_t>(window_width));
+
+    // 第一遍：沿列方向正反两次传播到同列最近致命障碍的格距
+    for (int wy = 0; wy < window_height; ++wy) {
+        const std::size_t row = cellIndex(geometry, 0, static_cast<uint32_t>(window_min_y + wy));
+        uint32_t *current = column_distance.data() + static_cast<std::size_t>(wy) * window_width;
+        const uint32_t *previous = wy > 0 ? current - window_width : nullptr;
+        for (int wx = 0; wx < window_width; ++wx) {
+            const std::size_t index = row + static_cast<std::size_t>(window_min_x + wx);
+            if (obstacle_layer[index] == Lethal || static_layer[index] == Lethal)
+                current[wx] = 0;
+            else
+                current[wx] = previous != nullptr ? std::min(far, previous[wx] + 1) : far;
+        }
+    }
+    for (int wy = window_height - 2; wy >= 0; --wy) {
+        uint32_t *current = column_distance.data() + static_cast<std::size_t>(wy) * window_width;
+        const uint32_t *next = current + window_width;
+        for (int wx = 0; wx < window_width; ++wx)
+            current[wx] = std::min(current[wx], next[wx] + 1);
+    }
+
+    // 第二遍：逐行求抛物线 (x - i)^2 + g(i)^2 的下包络，得到到最近致命障碍的平方格距
+    for (uint32_t y = region.min_y; y <= region.max_y; ++y) {
+        const uint32_t *g = column_distance.data() + static_cast<std::size_t>(static_cast<int>(y) - window_min_y) * window_width;
+        auto parabola = [g](int i) { return static_cast<double>(i) * i + static_cast<double>(g[i]) * g[i]; };
+        int count = 0;
+        for (int q = 0; q < window_width; ++q) {
+            if (g[q] >= far)
+                continue;
+            double bound = -std::numeric_limits<double>::infinity();
+            while (count > 0) {
+                const int v = envelope[count - 1];
+                bound = (parabola(q) - parabola(v)) / (2.0 * (q - v));
+                if (bound > envelope_bound[count - 1])
+                    break;
+                --count;
+                bound = -std::numeric_limits<double>::infinity();
+            }
+            envelope[count] = q;
+            envelope_bound[count] = bound;
+            ++count;
+        }
+        if (count == 0)
+            continue;
+
+        const std::size_t row = cellIndex(geometry, 0, y);
+        int k = 0;
+        for (uint32_t x = region.min_x; x <= region.max_x; ++x) {
+            const int wx = static_cast<int>(x) - window_min_x;
+            while (k + 1 < count && envelope_bound[k + 1] < wx)
+                ++k;
+            const int v = envelope[k];
+            const auto squared = static_cast<std::size_t>((wx - v) * (wx - v)) + static_cast<std::size_t>(g[v]) * g[v];
+            if (squared >= cost_table.size())
+                continue;
+            const uint8_t inflation_cost = cost_table[squared];
+            auto &cost = master[row + x];
+            if (inflation_cost == Free || cost == Lethal || (cost == Unknown && !options.inflate_unknown))
+                continue;
+            cost = cost == Unknown ? inflation_cost : std::max(cost, inflation_cost);
+        }
+    }
+}
+
 Costmap::Costmap() : _impl(std::make_unique<Impl>()) {}
 
 Costmap::Costmap(const GridMap &static_map, CostmapOptions options) : Costmap() {
@@ -618,9 +1551,13 @@ MapStatus Costmap::reset(const GridMap &static_map, CostmapOptions options) {
     replacement.static_layer = makeStaticLayer(static_map, options);
     replacement.obstacle_layer.assign(replacement.static_layer.size(), Free);
     replacement.master = replacement.static_layer;
+    replacement.unknown_cells = static_cast<std::size_t>(std::count(replacement.master.begin(), replacement.master.end(), Unknown));
     replacement.revision = static_map.revision();
     replacement.valid = true;
+    replacement.row_workers.setThreads(options.threads);
     *_impl = std::move(replacement);
+    _impl->buildCostTable();
+    _impl->markAllDirty();
     updateCosts();
     return MapStatus::Ok;
 }
@@ -632,8 +1569,14 @@ MapStatus Costmap::setStaticMap(const GridMap &static_map) {
         return MapStatus::GeometryMismatch;
     if (_impl->revision == std::numeric_limits<uint64_t>::max())
         return MapStatus::InvalidRevision;
+    auto static_layer = makeStaticLayer(static_map, _impl->options);
+    const auto &geometry = _impl->geometry_map._impl->geometry;
+    for (uint32_t y = 0; y < geometry.height; ++y)
+        for (uint32_t x = 0; x < geometry.width; ++x)
+            if (static_layer[cellIndex(geometry, x, y)] != _impl->static_layer[cellIndex(geometry, x, y)])
+                _impl->markDirty(x, y);
     _impl->geometry_map = static_map;
-    _impl->static_layer = makeStaticLayer(static_map, _impl->options);
+    _impl->static_layer = std::move(static_layer);
     ++_impl->revision;
     updateCosts();
     return MapStatus::Ok;
@@ -643,10 +1586,32 @@ bool Costmap::valid() const noexcept { return _impl->valid; }
 const CostmapOptions &Costmap::options() const noexcept { return _impl->options; }
 uint32_t Costmap::width() const noexcept { return _impl->geometry_map.width(); }
 uint32_t Costmap::height() const noexcept { return _impl->geometry_map.height(); }
+double Costmap::resolution() const noexcept { return _impl->valid ? _impl->geometry_map.resolution() : 0.0; }
 std::string_view Costmap::frameId() const noexcept {
     return _impl->valid ? _impl->geometry_map.frameId() : std::string_view{};
 }
 
+uint64_t Costmap::stamp() const noexcept { return _impl->valid ? _impl->stamp : 0; }
+
+std::optional<std::vector<Cell>> Costmap::changesSince(uint64_t stamp) const {
+    if (!_impl->valid || stamp == 0)
+        return std::nullopt;
+    if (stamp == _impl->stamp)
+        return std::vector<Cell>{};
+    auto first = _impl->changes.begin();
+    if (stamp != _impl->change_base) {
+        first = std::find_if(_impl->changes.begin(), _impl->changes.end(),
+                             [stamp](const Impl::ChangeRecord &change) { return change.stamp == stamp; });
+        if (first == _impl->changes.end())
+            return std::nullopt;
+        ++first;
+    }
+    std::vector<Cell> cells{};
+    for (auto it = first; it != _impl->changes.end(); ++it)
+        cells.insert(cells.end(), it->cells.begin(), it->cells.end());
+    return cells;
+}
+
 std::optional<Cell> Costmap::worldToMap(double world_x, double world_y) const noexcept {
     return _impl->geometry_map.worldToMap(world_x, world_y);
 }
@@ -664,6 +1629,7 @@ MapStatus Costmap::markObstacle(Cell cell) noexcept {
     if (_impl->revision == std::numeric_limits<uint64_t>::max())
         return MapStatus::InvalidRevision;
     cost = Lethal;
+    _impl->markDirty(cell.x, cell.y);
     ++_impl->revision;
     return MapStatus::Ok;
 }
@@ -681,7 +1647,13 @@ MapStatus Costmap::clearObstacles() noexcept {
         return MapStatus::Ok;
     if (_impl->revision == std::numeric_limits<uint64_t>::max())
         return MapStatus::InvalidRevision;
-    std::fill(_impl->obstacle_layer.begin(), _impl->obstacle_layer.end(), Free);
+    const auto &geometry = _impl->geometry_map._impl->geometry;
+    for (uint32_t y = 0; y < geometry.height; ++y)
+        for (uint32_t x = 0; x < geometry.width; ++x)
+            if (auto &cost = _impl->obstacle_layer[cellIndex(geometry, x, y)]; cost != Free) {
+                cost = Free;
+                _impl->markDirty(x, y);
+            }
     ++_impl->revision;
     return MapStatus::Ok;
 }
@@ -698,62 +1670,76 @@ MapStatus Costmap::clearRay(double start_x, double start_y, double end_x, double
     if (cells.empty())
         return MapStatus::OutOfBounds;
 
-    auto updated = _impl->obstacle_layer;
-    for (const auto &cell : cells)
-        updated[cellIndex(geometry, cell.x, cell.y)] = Free;
-    if (updated == _impl->obstacle_layer)
+    const bool changed = std::any_of(cells.begin(), cells.end(), [&](const Cell &cell) {
+        return _impl->obstacle_layer[cellIndex(geometry, cell.x, cell.y)] != Free;
+    });
+    if (!changed)
         return MapStatus::Ok;
     if (_impl->revision == std::numeric_limits<uint64_t>::max())
         return MapStatus::InvalidRevision;
-    _impl->obstacle_layer = std::move(updated);
+    for (const auto &cell : cells)
+        if (auto &cost = _impl->obstacle_layer[cellIndex(geometry, cell.x, cell.y)]; cost != Free) {
+            cost = Free;
+            _impl->markDirty(cell.x, cell.y);
+        }
     ++_impl->revision;
     return MapStatus::Ok;
 }
 
 void Costmap::updateCosts() {
-    if (!_impl->valid)
+    if (!_impl->valid || !_impl->dirty)
         return;
-    _impl->master = _impl->static_layer;
-    for (std::size_t i = 0; i < _impl->master.size(); ++i)
-        if (_impl->obstacle_layer[i] == Lethal)
-            _impl->master[i] = Lethal;
-
+    // 变化栅格的影响范围为其膨胀半径，区域外的主代价保持不变
     const auto &geometry = _impl->geometry_map._impl->geometry;
-    const int cell_radius = static_cast<int>(std::ceil(_impl->options.inflation_radius / geometry.resolution));
-    if (cell_radius <= 0)
-        return;
-    std::vector<Cell> obstacles{};
-    for (uint32_t y = 0; y < geometry.height; ++y)
-        for (uint32_t x = 0; x < geometry.width; ++x)
-            if (_impl->master[cellIndex(geometry, x, y)] == Lethal)
-                obstacles.push_back({x, y});
-
-    for (const auto &obstacle : obstacles) {
-        const int min_x = std::max(0, static_cast<int>(obstacle.x) - cell_radius);
-        const int max_x = std::min(static_cast<int>(geometry.width) - 1, static_cast<int>(obstacle.x) + cell_radius);
-        const int min_y = std::max(0, static_cast<int>(obstacle.y) - cell_radius);
-        const int max_y = std::min(static_cast<int>(geometry.height) - 1, static_cast<int>(obstacle.y) + cell_radius);
-        for (int y = min_y; y <= max_y; ++y) {
-            for (int x = min_x; x <= max_x; ++x) {
-                const double distance = std::hypot(x - static_cast<int>(obstacle.x), y - static_cast<int>(obstacle.y)) * geometry.resolution;
-                if (distance > _impl->options.inflation_radius)
-                    continue;
-                auto &master = _impl->master[cellIndex(geometry, static_cast<uint32_t>(x), static_cast<uint32_t>(y))];
-                if (master == Lethal || (master == Unknown && !_impl->options.inflate_unknown))
-                    continue;
-                uint8_t inflation_cost{};
-                if (distance <= _impl->options.inscribed_radius) {
-                    inflation_cost = Inscribed;
-                } else {
-                    inflation_cost = static_cast<uint8_t>(std::clamp(
-                        std::lround((Inscribed - 1) * std::exp(-_impl->options.cost_scaling_factor *
-                                                              (distance - _impl->options.inscribed_radius))),
-                        1l, 252l));
-                }
-                master = master == Unknown ? inflation_cost : std::max(master, inflation_cost);
-            }
+    const auto cell_radius = static_cast<uint32_t>(std::max(0, _impl->cell_radius));
+    const auto &dirty = *_impl->dirty;
+    Impl::DirtyBounds region{};
+    region.min_x = dirty.min_x > cell_radius ? dirty.min_x - cell_radius : 0;
+    region.min_y = dirty.min_y > cell_radius ? dirty.min_y - cell_radius : 0;
+    region.max_x = static_cast<uint32_t>(std::min<uint64_t>(geometry.width - 1, static_cast<uint64_t>(dirty.max_x) + cell_radius));
+    region.max_y = static_cast<uint32_t>(std::min<uint64_t>(geometry.height - 1, static_cast<uint64_t>(dirty.max_y) + cell_radius));
+    // 比较重新计算前后的主代价，记录实际变化的栅格，单次变化过多时不再记录，由使用方整体重建
+    const std::size_t region_width = static_cast<std::size_t>(region.max_x) - region.min_x + 1;
+    const std::size_t region_height = static_cast<std::size_t>(region.max_y) - region.min_y + 1;
+    auto &snapshot = _impl->change_snapshot;
+    snapshot.resize(region_width * region_height);
+    for (std::size_t row = 0; row < region_height; ++row) {
+        const auto first = _impl->master.begin() + cellIndex(geometry, region.min_x, region.min_y + static_cast<uint32_t>(row));
+        std::copy(first, first + region_width, snapshot.begin() + row * region_width);
+    }
+    _impl->recompute(region);
+    _impl->dirty.reset();
+    static std::atomic<uint64_t> next_stamp{};
+    _impl->stamp = ++next_stamp;
+
+    const std::size_t limit = _impl->changeLimit();
+    Impl::ChangeRecord change{_impl->stamp, {}};
+    for (std::size_t row = 0; row < region_height; ++row) {
+        const uint32_t y = region.min_y + static_cast<uint32_t>(row);
+        const uint8_t *current = _impl->master.data() + cellIndex(geometry, region.min_x, y);
+        const uint8_t *previous = snapshot.data() + row * region_width;
+        for (std::size_t column = 0; column < region_width; ++column) {
+            if (current[column] == previous[column])
+                continue;
+            _impl->unknown_cells += current[column] == Unknown;
+            _impl->unknown_cells -= previous[column] == Unknown;
+            if (change.cells.size() <= limit)
+                change.cells.push_back({region.min_x + static_cast<uint32_t>(column), y});
         }
     }
+    if (change.cells.size() > limit) {
+        _impl->changes.clear();
+        _impl->change_count = 0;
+        _impl->change_base = _impl->stamp;
+        return;
+    }
+    _impl->change_count += change.cells.size();
+    _impl->changes.push_back(std::move(change));
+    while (_impl->change_count > limit) {
+        _impl->change_base = _impl->changes.front().stamp;
+        _impl->change_count -= _impl->changes.front().cells.size();
+        _impl->changes.pop_front();
+    }
 }
 
 std::optional<uint8_t> Costmap::at(uint32_t x, uint32_t y) const noexcept {
@@ -772,21 +1758,13 @@ bool Costmap::collides(const std::vector<msg::Point> &footprint, const msg::Pose
 
     const auto &geometry = _impl->geometry_map._impl->geometry;
     std::vector<std::pair<double, double>> polygon{};
-    polygon.reserve(footprint.size());
+    if (!footprintToMap(geometry, footprint, pose, pose_cos, pose_sin, polygon))
+        return true;
     double min_x = std::numeric_limits<double>::max();
     double min_y = std::numeric_limits<double>::max();
     double max_x = std::numeric_limits<double>::lowest();
     double max_y = std::numeric_limits<double>::lowest();
-    for (const auto &point : footprint) {
-        if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z))
-            return true;
-        const double world_x = pose.position.x + pose_cos * point.x - pose_sin * point.y;
-        const double world_y = pose.position.y + pose_sin * point.x + pose_cos * point.y;
-        double map_x{}, map_y{};
-        if (!worldToContinuous(geometry, world_x, world_y, map_x, map_y) ||
-            map_x < 0.0 || map_y < 0.0 || map_x >= geometry.width || map_y >= geometry.height)
-            return true;
-        polygon.emplace_back(map_x, map_y);
+    for (const auto &[map_x, map_y] : polygon) {
         min_x = std::min(min_x, map_x);
         min_y = std::min(min_y, map_y);
         max_x = std::max(max_x, map_x);
@@ -797,13 +1775,95 @@ bool Costmap::collides(const std::vector<msg::Point> &footprint, const msg::Pose
     const uint32_t first_y = static_cast<uint32_t>(std::max(0.0, std::floor(min_y)));
     const uint32_t last_x = static_cast<uint32_t>(std::min(static_cast<double>(geometry.width - 1), std::floor(max_x)));
     const uint32_t last_y = static_cast<uint32_t>(std::min(static_cast<double>(geometry.height - 1), std::floor(max_y)));
-    for (uint32_t y = first_y; y <= last_y; ++y) {
-        for (uint32_t x = first_x; x <= last_x; ++x) {
-            if (!polygonIntersectsCell(polygon, x, y))
+    for (uint32_t y = first_y; y <= last_y; ++y)
+        for (uint32_t x = first_x; x <= last_x; ++x)
+            if (blocksFootprint(_impl->master[cellIndex(geometry, x, y)], _impl->options.unknown_is_lethal) &&
+                polygonIntersectsCell(polygon, x, y))
+                return true;
+    return false;
+}
+
+bool Costmap::collides(const Footprint &footprint, const msg::Pose &pose) const {
+    const auto &shape = *footprint._impl;
+    if (!_impl->valid || !footprint.valid() || !std::isfinite(pose.position.x) ||
+        !std::isfinite(pose.position.y) || !std::isfinite(pose.position.z))
+        return true;
+    const auto &geometry = _impl->geometry_map._impl->geometry;
+    if (shape.masks.empty() || std::abs(shape.resolution - geometry.resolution) > kPlanarTolerance * geometry.resolution)
+        return collides(shape.polygon, pose);
+    double pose_cos{}, pose_sin{};
+    double center_x{}, center_y{};
+    if (!planarYaw(pose.orientation, pose_cos, pose_sin) ||
+        !worldToContinuous(geometry, pose.position.x, pose.position.y, center_x, center_y))
+        return true;
+
+    // 按机器人相对地图栅格的朝向选择掩码
+    const double cos_yaw = pose_cos * geometry.cos_yaw + pose_sin * geometry.sin_yaw;
+    const double sin_yaw = pose_sin * geometry.cos_yaw - pose_cos * geometry.sin_yaw;
+    const double yaw = std::atan2(sin_yaw, cos_yaw);
+    const auto bins = static_cast<int64_t>(shape.heading_bins);
+    auto bin = static_cast<int64_t>(std::llround(yaw * static_cast<double>(bins) / (2.0 * kPi))) % bins;
+    if (bin < 0)
+        bin += bins;
+    const double cell_x = std::floor(center_x);
+    const double cell_y = std::floor(center_y);
+    const auto offsetBin = [](double offset) {
+        return std::min(kFootprintOffsetBins - 1, static_cast<uint32_t>(offset * kFootprintOffsetBins));
+    };
+    const auto &mask = shape.masks[(static_cast<std::size_t>(bin) * kFootprintOffsetBins + offsetBin(center_y - cell_y)) *
+                                       kFootprintOffsetBins + offsetBin(center_x - cell_x)];
+    if (cell_x + mask.min_x < 0.0 || cell_y + mask.min_y < 0.0 ||
+        cell_x + mask.max_x >= geometry.width || cell_y + mask.max_y >= geometry.height)
+        return collides(shape.polygon, pose);
+
+    const auto x0 = static_cast<int64_t>(cell_x);
+    const auto y0 = static_cast<int64_t>(cell_y);
+    const bool unknown_is_lethal = _impl->options.unknown_is_lethal;
+    const uint8_t *master = _impl->master.data();
+    // 机器人中心位于多边形内时，中心所在栅格必然与多边形相交
+    const uint8_t center_cost = master[cellIndex(geometry, static_cast<uint32_t>(x0), static_cast<uint32_t>(y0))];
+    if (shape.contains_origin && blocksFootprint(center_cost, unknown_is_lethal))
+        return true;
+    // 中心栅格的主代价给出到最近致命障碍的格距下界。掩码内的栅格到中心栅格不超过 reach，内切栅格到致命障碍不超过
+    // inscribed_reach，下界超过两者之和时掩码内既没有致命栅格也没有内切栅格；未知栅格不参与膨胀，需另行排除
+    if (center_cost < _impl->clearance.size() && (!unknown_is_lethal || _impl->unknown_cells == 0) &&
+        _impl->clearance[center_cost] > mask.reach + _impl->inscribed_reach + kPlanarTolerance)
+        return false;
+    const auto rowOf = [&](const Footprint::Impl::Run &run) {
+        return master + cellIndex(geometry, 0, static_cast<uint32_t>(y0 + run.y));
+    };
+    for (const auto &run : mask.inner) {
+        const uint8_t *row = rowOf(run);
+        const auto last = static_cast<uint32_t>(x0 + run.end);
+        for (auto x = static_cast<uint32_t>(x0 + run.begin); x < last; ++x)
+            if (blocksFootprint(row[x], unknown_is_lethal))
+                return true;
+    }
+    // 边界栅格比多边形略大，其中不可通行的栅格先用凸包的分离轴排除，剩余的再做精确判断
+    const auto separated = [&](uint32_t x, uint32_t y) {
+        const double offset_x = x + 0.5 - center_x;
+        const double offset_y = y + 0.5 - center_y;
+        for (const auto &[local_x, local_y, offset] : shape.hull_planes) {
+            const double normal_x = cos_yaw * local_x - sin_yaw * local_y;
+            const double normal_y = sin_yaw * local_x + cos_yaw * local_y;
+            if (normal_x * offset_x + normal_y * offset_y - 0.5 * (std::abs(normal_x) + std::abs(normal_y)) > offset)
+                return true;
+        }
+        return false;
+    };
+    std::vector<std::pair<double, double>> polygon{};
+    for (const auto &run : mask.boundary) {
+        const uint8_t *row = rowOf(run);
+        const auto y = static_cast<uint32_t>(y0 + run.y);
+        const auto last = static_cast<uint32_t>(x0 + run.end);
+        for (auto x = static_cast<uint32_t>(x0 + run.begin); x < last; ++x) {
+            if (!blocksFootprint(row[x], unknown_is_lethal))
                 continue;
-            const uint8_t cost = _impl->master[cellIndex(geometry, x, y)];
-            if ((cost == Unknown && _impl->options.unknown_is_lethal) ||
-                (cost != Unknown && cost >= Inscribed))
+            if (separated(x, y))
+                continue;
+            if (polygon.empty() && !footprintToMap(geometry, shape.polygon, pose, pose_cos, pose_sin, polygon))
+                return true;
+            if (polygonIntersectsCell(polygon, x, y))
                 return true;
         }
     }
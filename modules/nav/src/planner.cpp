@@ -13,7 +13,8 @@
 #include <array>
 #include <cmath>
 #include <limits>
-#include <queue>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,12 +33,64 @@ struct OpenNode {
     double estimate{};
 };
 
-struct OpenNodeGreater {
-    bool operator()(const OpenNode &lhs, const OpenNode &rhs) const noexcept {
-        if (lhs.estimate != rhs.estimate)
-            return lhs.estimate > rhs.estimate;
-        return lhs.cost > rhs.cost;
+//! lhs 是否应先于 rhs 出队：估计总代价小者优先，相同时已知代价小者优先
+bool openBefore(const OpenNode &lhs, const OpenNode &rhs) noexcept {
+    if (lhs.estimate != rhs.estimate)
+        return lhs.estimate < rhs.estimate;
+    return lhs.cost < rhs.cost;
+}
+
+/**
+ * @brief 4 叉小顶堆
+ * @details 相比二叉堆层数减半，下沉时一次比较的 4 个子节点位于同一缓存行附近；`clear()` 保留容量，供多次搜索复用
+ */
+class OpenHeap {
+public:
+    bool empty() const noexcept { return _nodes.empty(); }
+
+    void clear() noexcept { _nodes.clear(); }
+
+    const OpenNode &top() const noexcept { return _nodes.front(); }
+
+    void push(const OpenNode &node) {
+        std::size_t hole = _nodes.size();
+        _nodes.push_back(node);
+        while (hole > 0) {
+            const std::size_t parent = (hole - 1) / 4;
+            if (!openBefore(node, _nodes[parent]))
+                break;
+            _nodes[hole] = _nodes[parent];
+            hole = parent;
+        }
+        _nodes[hole] = node;
+    }
+
+    void pop() noexcept {
+        const OpenNode last = _nodes.back();
+        _nodes.pop_back();
+        const std::size_t size = _nodes.size();
+        if (size == 0)
+            return;
+        std::size_t hole = 0;
+        while (true) {
+            const std::size_t first = hole * 4 + 1;
+            if (first >= size)
+                break;
+            std::size_t best = first;
+            const std::size_t end = std::min(first + 4, size);
+            for (std::size_t child = first + 1; child < end; ++child)
+                if (openBefore(_nodes[child], _nodes[best]))
+                    best = child;
+            if (!openBefore(_nodes[best], last))
+                break;
+            _nodes[hole] = _nodes[best];
+            hole = best;
+        }
+        _nodes[hole] = last;
     }
+
+private:
+    std::vector<OpenNode> _nodes{};
 };
 
 bool validOptions(const AStarOptions &options) noexcept {
@@ -72,6 +125,12 @@ double traversalPenalty(uint8_t cost, const AStarOptions &options) noexcept {
     return options.cost_weight * static_cast<double>(cost) / static_cast<double>(Inscribed - 1);
 }
 
+//! 进入栅格的移动代价系数，不可通行时为无穷大
+double moveFactor(const Costmap &costmap, Cell cell, const AStarOptions &options) noexcept {
+    return traversable(costmap, cell, options) ? 1.0 + traversalPenalty(*costmap.at(cell.x, cell.y), options)
+                                               : std::numeric_limits<double>::infinity();
+}
+
 double heuristic(Cell from, Cell to, bool diagonal) noexcept {
     const double dx = std::abs(static_cast<double>(from.x) - to.x);
     const double dy = std::abs(static_cast<double>(from.y) - to.y);
@@ -216,6 +275,539 @@ msg::Path makePath(const Costmap &costmap, const std::vector<Cell> &cells,
     return path;
 }
 
+//! 8 邻域方向，前 4 个为直线方向
+constexpr std::array<std::pair<int, int>, 8> kDirections{{
+    {1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}}};
+
+//! 方向 (dx, dy) 在 kDirections 中的序号
+constexpr std::size_t directionOf(int dx, int dy) noexcept {
+    for (std::size_t i = 0; i < kDirections.size(); ++i)
+        if (kDirections[i].first == dx && kDirections[i].second == dy)
+            return i;
+    return kDirections.size();
+}
+
+constexpr int sign(int value) noexcept { return (value > 0) - (value < 0); }
+
+/**
+ * @brief 检查规划配置、代价地图与起终点，并换算起终点所在栅格
+ *
+ * @return 全部有效时返回 PlanningStatus::Ok
+ */
+PlanningStatus resolveEndpoints(const Costmap &costmap, const msg::Pose &start, const msg::Pose &goal,
+                                const AStarOptions &options, Cell &start_cell, Cell &goal_cell) noexcept {
+    if (!validOptions(options))
+        return PlanningStatus::InvalidOptions;
+    if (!costmap.valid() || costmap.width() == 0 || costmap.height() == 0 ||
+        static_cast<std::size_t>(costmap.width()) > std::numeric_limits<std::size_t>::max() / costmap.height())
+        return PlanningStatus::InvalidMap;
+    if (!finitePoint(start.position))
+        return PlanningStatus::InvalidStart;
+    if (!finitePoint(goal.position))
+        return PlanningStatus::InvalidGoal;
+    const auto start_result = costmap.worldToMap(start.position.x, start.position.y);
+    if (!start_result)
+        return PlanningStatus::InvalidStart;
+    const auto goal_result = costmap.worldToMap(goal.position.x, goal.position.y);
+    if (!goal_result)
+        return PlanningStatus::InvalidGoal;
+    if (!traversable(costmap, *start_result, options))
+        return PlanningStatus::StartBlocked;
+    if (!traversable(costmap, *goal_result, options))
+        return PlanningStatus::GoalBlocked;
+    start_cell = *start_result;
+    goal_cell = *goal_result;
+    return PlanningStatus::Ok;
+}
+
+/**
+ * @brief 以代数标记区分各次搜索的栅格状态
+ * @details `visited` 不等于当前代数时视为未访问，`closed` 等于当前代数时视为已关闭，
+ *          因此开始新的搜索只需递增代数，而不必清零整张地图大小的数组
+ */
+class SearchNodes {
+public:
+    struct Node {
+        double cost{};             //!< 已知最小代价，仅在 visited 等于当前代数时有效
+        std::size_t parent{};      //!< 父栅格索引，仅在 visited 等于当前代数时有效
+        uint32_t visited{};        //!< 最近一次写入 cost 的代数
+        uint32_t closed{};         //!< 最近一次关闭该栅格的代数
+    };
+
+    //! 开始一次面积为 area 的新搜索
+    void begin(std::size_t area) {
+        if (nodes.size() != area) {
+            nodes.assign(area, Node{});
+            generation = 0;
+        }
+        if (++generation == 0) {
+            // 代数回绕时清零一次标记，避免与很久以前的搜索混淆
+            for (auto &node : nodes)
+                node.visited = node.closed = 0;
+            generation = 1;
+        }
+        open.clear();
+    }
+
+    double cost(std::size_t index) const noexcept {
+        return nodes[index].visited == generation ? nodes[index].cost : std::numeric_limits<double>::infinity();
+    }
+
+    void update(std::size_t index, double cost, std::size_t parent) noexcept {
+        auto &node = nodes[index];
+        node.cost = cost;
+        node.parent = parent;
+        node.visited = generation;
+    }
+
+    bool closed(std::size_t index) const noexcept { return nodes[index].closed == generation; }
+
+    void close(std::size_t index) noexcept { nodes[index].closed = generation; }
+
+    std::vector<Node> nodes{};
+    OpenHeap open{};
+    uint32_t generation{};
+};
+
+/**
+ * @brief 逐栅格展开一个已关闭的栅格，按实际移动代价松弛其邻域
+ *
+ * @param[in] allowed 限制搜索范围的谓词，签名为 `bool(uint32_t x, uint32_t y)`，返回 false 的栅格不会被加入开放列表
+ */
+template <typename Allowed>
+void expandCell(const Costmap &costmap, const AStarOptions &options, SearchNodes &search, std::size_t index, double cost,
+                Cell goal, Allowed &&allowed) {
+    const uint32_t width = costmap.width();
+    const Cell cell = cellOf(width, index);
+    for (const auto &[offset_x, offset_y] : kDirections) {
+        const bool diagonal = offset_x != 0 && offset_y != 0;
+        if (diagonal && !options.allow_diagonal)
+            continue;
+        const int next_x = static_cast<int>(cell.x) + offset_x;
+        const int next_y = static_cast<int>(cell.y) + offset_y;
+        if (next_x < 0 || next_y < 0 || next_x >= static_cast<int>(costmap.width()) ||
+            next_y >= static_cast<int>(costmap.height()))
+            continue;
+        const Cell next{static_cast<uint32_t>(next_x), static_cast<uint32_t>(next_y)};
+        if (!allowed(next.x, next.y) || !traversable(costmap, next, options))
+            continue;
+        if (diagonal && !options.allow_corner_cutting) {
+            const Cell side_x{static_cast<uint32_t>(next_x), cell.y};
+            const Cell side_y{cell.x, static_cast<uint32_t>(next_y)};
+            if (!traversable(costmap, side_x, options) || !traversable(costmap, side_y, options))
+                continue;
+        }
+        const auto cell_cost = costmap.at(next.x, next.y);
+        if (!cell_cost)
+            continue;
+        const double step = diagonal ? kDiagonalCost : 1.0;
+        const double candidate = cost + step * (1.0 + traversalPenalty(*cell_cost, options));
+        const std::size_t next_index = indexOf(width, next);
+        if (candidate >= search.cost(next_index))
+            continue;
+        search.update(next_index, candidate, index);
+        search.open.push({next_index, candidate, candidate + heuristic(next, goal, options.allow_diagonal)});
+    }
+}
+
+/**
+ * @brief 逐栅格展开的加权 A*
+ *
+ * @param[in] allowed 限制搜索范围的谓词，签名为 `bool(uint32_t x, uint32_t y)`，返回 false 的栅格不会被展开
+ */
+template <typename Allowed>
+void searchGrid(const Costmap &costmap, const AStarOptions &options, SearchNodes &search, Cell goal, std::size_t &expanded,
+                Allowed &&allowed) {
+    const std::size_t goal_index = indexOf(costmap.width(), goal);
+    while (!search.open.empty()) {
+        const auto current = search.open.top();
+        search.open.pop();
+        if (search.closed(current.index) || current.cost > search.cost(current.index))
+            continue;
+        search.close(current.index);
+        ++expanded;
+        if (current.index == goal_index)
+            break;
+        expandCell(costmap, options, search, current.index, current.cost, goal, allowed);
+    }
+}
+
+/**
+ * @brief 由搜索树回溯起点到终点途经的全部栅格
+ * @details 相邻两个搜索节点之间按直线或对角线补齐途经的栅格
+ *
+ * @param[out] cells 由起点到终点的栅格序列
+ * @return 搜索树在终点与起点之间断开时返回 false
+ */
+bool tracePath(const SearchNodes &search, uint32_t width, std::size_t start_index, std::size_t goal_index,
+               std::vector<Cell> &cells) {
+    cells.clear();
+    for (std::size_t index = goal_index;; index = search.nodes[index].parent) {
+        const Cell cell = cellOf(width, index);
+        cells.push_back(cell);
+        if (index == start_index)
+            break;
+        const std::size_t parent = search.nodes[index].parent;
+        if (search.nodes[index].visited != search.generation || parent == index)
+            return false;
+        const Cell from = cellOf(width, parent);
+        const int dx = sign(static_cast<int>(from.x) - static_cast<int>(cell.x));
+        const int dy = sign(static_cast<int>(from.y) - static_cast<int>(cell.y));
+        for (Cell between{cell.x + dx, cell.y + dy}; between.x != from.x || between.y != from.y;
+             between = {between.x + dx, between.y + dy})
+            cells.push_back(between);
+    }
+    std::reverse(cells.begin(), cells.end());
+    return true;
+}
+
+/**
+ * @brief 跳点搜索使用的栅格分类与在线跳跃（JPS）
+ * @details 剪枝规则按八邻域、禁止夹角穿越且移动代价相同的栅格推导。附加代价与自由栅格相同的可通行栅格称为均匀栅格，
+ *          跳跃只经过均匀栅格，其余可通行栅格在跳跃中视为障碍；八邻域内存在非均匀可通行栅格的均匀栅格称为边界栅格，
+ *          跳跃到达边界栅格即停止。边界栅格与非均匀栅格由搜索逐栅格展开，因此膨胀代价只在障碍附近使搜索退化为 A*。
+ *          栅格分类以主代价地图内容标识和影响可通行性的配置为键缓存，每个栅格占 1 字节
+ */
+class JumpGrid {
+public:
+    //! 代价地图内容或配置改变时重新分类栅格
+    void assign(const Costmap &costmap, const AStarOptions &options) {
+        if (_stamp != 0 && _stamp == costmap.stamp() && _max_cost == options.max_cost &&
+            _traverse_unknown == options.traverse_unknown && _cost_weight == options.cost_weight)
+            return;
+        _stamp = costmap.stamp();
+        _max_cost = options.max_cost;
+        _traverse_unknown = options.traverse_unknown;
+        _cost_weight = options.cost_weight;
+        _width = static_cast<int>(costmap.width());
+        _height = static_cast<int>(costmap.height());
+        _penalty = traversalPenalty(Free, options);
+        ++_version;
+        _uniform = true;
+        _classes.resize(static_cast<std::size_t>(_width) * _height);
+        for (int y = 0; y < _height; ++y) {
+            for (int x = 0; x < _width; ++x) {
+                const uint8_t cost = *costmap.at(static_cast<uint32_t>(x), static_cast<uint32_t>(y));
+                const bool open = cost == Unknown ? options.traverse_unknown : cost <= options.max_cost;
+                if (!open) {
+                    _classes[index(x, y)] = Blocked;
+                } else if (traversalPenalty(cost, options) == _penalty) {
+                    _classes[index(x, y)] = Uniform;
+                } else {
+                    _classes[index(x, y)] = NonUniform;
+                    _uniform = false;
+                }
+            }
+        }
+        for (int y = 0; y < _height; ++y) {
+            for (int x = 0; x < _width; ++x) {
+                if (_classes[index(x, y)] != Uniform)
+                    continue;
+                for (const auto &[dx, dy] : kDirections) {
+                    if (classOf(x + dx, y + dy) == NonUniform) {
+                        _classes[index(x, y)] = Boundary;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    //! 栅格分类的版本，每次重新分类后递增
+    uint64_t version() const noexcept { return _version; }
+
+    //! 全部可通行栅格是否均为均匀栅格
+    bool uniform() const noexcept { return _uniform; }
+
+    int width() const noexcept { return _width; }
+    int height() const noexcept { return _height; }
+
+    //! 均匀栅格的附加代价
+    double penalty() const noexcept { return _penalty; }
+
+    //! (x, y) 是否为均匀栅格，跳跃只经过均匀栅格
+    bool passable(int x, int y) const noexcept {
+        const uint8_t cls = classOf(x, y);
+        return cls == Uniform || cls == Boundary;
+    }
+
+    //! (x, y) 是否为边界栅格
+    bool boundary(int x, int y) const noexcept { return classOf(x, y) == Boundary; }
+
+    //! 可通行栅格 (x, y) 是否需要逐栅格展开，即不是均匀栅格或是边界栅格
+    bool expandsPerCell(int x, int y) const noexcept { return classOf(x, y) != Uniform; }
+
+    //! 能否从 (x, y) 沿方向 (dx, dy) 移动一步，对角移动时两侧栅格均需可通行
+    bool canStep(int x, int y, int dx, int dy) const noexcept {
+        if (!passable(x + dx, y + dy))
+            return false;
+        return dx == 0 || dy == 0 || (passable(x + dx, y) && passable(x, y + dy));
+    }
+
+    //! 沿直线方向 (dx, dy) 到达 (x, y) 时是否存在强迫邻居
+    bool forced(int x, int y, int dx, int dy) const noexcept {
+        if (dx != 0)
+            return (passable(x, y - 1) && !passable(x - dx, y - 1)) || (passable(x, y + 1) && !passable(x - dx, y + 1));
+        return (passable(x - 1, y) && !passable(x - 1, y - dy)) || (passable(x + 1, y) && !passable(x + 1, y - dy));
+    }
+
+    //! 沿方向 (dx, dy) 到达 (x, y) 后仍需搜索的方向，按 kDirections 中的序号置位
+    uint8_t prune(int x, int y, int dx, int dy) const noexcept {
+        const auto bit = [](int bx, int by) { return static_cast<uint8_t>(1U << directionOf(bx, by)); };
+        if (dx != 0 && dy != 0)
+            return bit(dx, 0) | bit(0, dy) | bit(dx, dy);
+        uint8_t directions = bit(dx, dy);
+        for (const int side : {-1, 1}) {
+            if (dx != 0 && passable(x, y + side))
+                directions |= bit(0, side) | bit(dx, side);
+            if (dy != 0 && passable(x + side, y))
+                directions |= bit(side, 0) | bit(side, dy);
+        }
+        return directions;
+    }
+
+    /**
+     * @brief 从 (x, y) 沿指定方向扫描跳点
+     * @details 对角跳跃途经的栅格沿两个分量方向扫描到的跳点直接交给 @p emit，途经栅格本身不作为跳点，
+     *          因此对角跳跃只在经过终点、到达边界栅格或无法继续移动时停止
+     *
+     * @param[in] x 起始栅格横向索引
+     * @param[in] y 起始栅格纵向索引
+     * @param[in] direction kDirections 中的方向序号
+     * @param[in] goal 终点，经过终点时停止
+     * @param[out] steps 到达跳点的步数
+     * @param[in] emit 形如 `void(int diagonal_steps, std::size_t direction, int steps)` 的回调，
+     *                 表示沿对角方向 `diagonal_steps` 步后再沿直线方向 `direction` 走 `steps` 步到达跳点
+     * @return 是否找到跳点
+     */
+    template <typename Emit>
+    bool jump(int x, int y, std::size_t direction, Cell goal, int &steps, Emit &&emit) const noexcept {
+        const auto [dx, dy] = kDirections[direction];
+        if (dx == 0 || dy == 0)
+            return straight(x, y, direction, goal, steps);
+        steps = 0;
+        while (canStep(x, y, dx, dy)) {
+            x += dx;
+            y += dy;
+            ++steps;
+            if ((x == static_cast<int>(goal.x) && y == static_cast<int>(goal.y)) || boundary(x, y))
+                return true;
+            for (const std::size_t component : {directionOf(dx, 0), directionOf(0, dy)}) {
+                int component_steps{};
+                if (straight(x, y, component, goal, component_steps))
+                    emit(steps, component, component_steps);
+            }
+        }
+        return false;
+    }
+
+private:
+    //! 栅格分类
+    enum : uint8_t {
+        Blocked,    //!< 不可通行或位于地图之外
+        Uniform,    //!< 均匀栅格
+        Boundary,   //!< 边界栅格
+        NonUniform, //!< 非均匀的可通行栅格
+    };
+
+    std::size_t index(int x, int y) const noexcept { return static_cast<std::size_t>(y) * _width + x; }
+
+    uint8_t classOf(int x, int y) const noexcept {
+        if (x < 0 || y < 0 || x >= _width || y >= _height)
+            return Blocked;
+        return _classes[index(x, y)];
+    }
+
+    //! 沿直线方向扫描跳点，参数与返回值同 jump
+    bool straight(int x, int y, std::size_t direction, Cell goal, int &steps) const noexcept {
+        const auto [dx, dy] = kDirections[direction];
+        steps = 0;
+        while (canStep(x, y, dx, dy)) {
+            x += dx;
+            y += dy;
+            ++steps;
+            if ((x == static_cast<int>(goal.x) && y == static_cast<int>(goal.y)) || boundary(x, y) || forced(x, y, dx, dy))
+                return true;
+        }
+        return false;
+    }
+
+    std::vector<uint8_t> _classes{};
+    int _width{};
+    int _height{};
+    double _penalty{};
+    uint64_t _version{};
+    bool _uniform{};
+    uint64_t _stamp{};
+    double _cost_weight{};
+    uint8_t _max_cost{};
+    bool _traverse_unknown{};
+};
+
+/**
+ * @brief 跳点搜索的跳跃距离表（JPS+）
+ * @details 跳跃距离表中每个栅格的每个方向保存一个距离 k：k > 0 表示沿该方向第 k 步为跳点，k ≤ 0 表示沿该方向可以合法移动 -k 步但不存在跳点。
+ *          跳点的判定与 JumpGrid::jump 相同，但与终点无关，查询时再检查终点是否位于跳跃范围内
+ */
+class JumpCache {
+public:
+    //! 栅格分类改变时重建跳跃距离表
+    void prepare(const JumpGrid &grid) {
+        _grid = &grid;
+        if (_version == grid.version() && !_distance.empty())
+            return;
+        _version = grid.version();
+        build(grid);
+    }
+
+    //! 查表得到从 (x, y) 沿指定方向的跳点，参数与返回值同 JumpGrid::jump
+    template <typename Emit>
+    bool jump(int x, int y, std::size_t direction, Cell goal, int &steps, Emit &&emit) const noexcept {
+        const auto [dx, dy] = kDirections[direction];
+        if (dx == 0 || dy == 0)
+            return straight(x, y, direction, goal, steps);
+        // 对角方向的距离表指向下一个边界栅格或分量方向存在跳点的栅格，后者只交给 emit，随后继续查表
+        steps = 0;
+        while (true) {
+            const int32_t distance = _distance[static_cast<std::size_t>(y) * _width + x][direction];
+            // 终点在跳跃范围内时停在与终点同行或同列的栅格
+            const int target = std::min((static_cast<int>(goal.x) - x) * dx, (static_cast<int>(goal.y) - y) * dy);
+            if (target > 0 && target <= std::abs(distance)) {
+                steps += target;
+                return true;
+            }
+            if (distance <= 0)
+                return false;
+            x += dx * distance;
+            y += dy * distance;
+            steps += distance;
+            if (_grid->boundary(x, y))
+                return true;
+            for (const std::size_t component : {directionOf(dx, 0), directionOf(0, dy)}) {
+                int component_steps{};
+                if (straight(x, y, component, goal, component_steps))
+                    emit(steps, component, component_steps);
+            }
+        }
+    }
+
+private:
+    //! 查表得到沿直线方向的跳点，终点在跳跃范围内时直接到达终点
+    bool straight(int x, int y, std::size_t direction, Cell goal, int &steps) const noexcept {
+        const auto [dx, dy] = kDirections[direction];
+        const int32_t distance = _distance[static_cast<std::size_t>(y) * _width + x][direction];
+        int target{};
+        if (dy == 0)
+            target = static_cast<int>(goal.y) == y ? (static_cast<int>(goal.x) - x) * dx : 0;
+        else
+            target = static_cast<int>(goal.x) == x ? (static_cast<int>(goal.y) - y) * dy : 0;
+        if (target > 0 && target <= std::abs(distance)) {
+            steps = target;
+            return true;
+        }
+        steps = distance;
+        return distance > 0;
+    }
+
+    void build(const JumpGrid &grid) {
+        const int width = grid.width();
+        const int height = grid.height();
+        _width = static_cast<std::size_t>(width);
+        // 逆着跳跃方向遍历，使每个栅格的距离由前方相邻栅格递推；直线方向先于对角方向计算
+        _distance.assign(static_cast<std::size_t>(width) * height, {});
+        for (std::size_t direction = 0; direction < kDirections.size(); ++direction) {
+            const auto [dx, dy] = kDirections[direction];
+            for (int row = 0; row < height; ++row) {
+                const int y = dy > 0 ? height - 1 - row : row;
+                for (int column = 0; column < width; ++column) {
+                    const int x = dx > 0 ? width - 1 - column : column;
+                    if (!grid.canStep(x, y, dx, dy))
+                        continue;
+                    const auto &next = _distance[static_cast<std::size_t>(y + dy) * width + x + dx];
+                    const bool jump_point = grid.boundary(x + dx, y + dy) ||
+                                            (dx != 0 && dy != 0 ? next[directionOf(dx, 0)] > 0 || next[directionOf(0, dy)] > 0
+                                                                : grid.forced(x + dx, y + dy, dx, dy));
+                    const int32_t further = next[direction];
+                    _distance[static_cast<std::size_t>(y) * width + x][direction] =
+                        jump_point ? 1 : (further > 0 ? further + 1 : further - 1);
+                }
+            }
+        }
+    }
+
+    std::vector<std::array<int32_t, 8>> _distance{};
+    const JumpGrid *_grid{};
+    std::size_t _width{};
+    uint64_t _version{};
+};
+
+/**
+ * @brief 跳点搜索
+ * @details 起点向全部方向跳跃，其余跳点按到达方向剪枝；边界栅格与非均匀栅格按实际移动代价逐栅格展开。
+ *          对角跳跃途经的栅格只作为其分量方向跳点的父节点写入搜索树，不加入开放列表
+ *
+ * @param[in] grid 栅格判定与剪枝规则
+ * @param[in] jumper 跳跃实现，JumpGrid 或 JumpCache
+ */
+template <typename Jumper>
+void searchJumpPoints(const Costmap &costmap, const AStarOptions &options, const JumpGrid &grid, const Jumper &jumper,
+                      SearchNodes &search, Cell goal, std::size_t &expanded) {
+    const uint32_t width = costmap.width();
+    const std::size_t goal_index = indexOf(width, goal);
+    const double factor = 1.0 + grid.penalty();
+    const auto relax = [&](std::size_t parent, double candidate, Cell next) {
+        const std::size_t next_index = indexOf(width, next);
+        if (candidate >= search.cost(next_index))
+            return;
+        search.update(next_index, candidate, parent);
+        search.open.push({next_index, candidate, candidate + heuristic(next, goal, true)});
+    };
+    while (!search.open.empty()) {
+        const auto current = search.open.top();
+        search.open.pop();
+        if (search.closed(current.index) || current.cost > search.cost(current.index))
+            continue;
+        search.close(current.index);
+        ++expanded;
+        if (current.index == goal_index)
+            break;
+        const Cell cell = cellOf(width, current.index);
+        const int x = static_cast<int>(cell.x);
+        const int y = static_cast<int>(cell.y);
+        if (grid.expandsPerCell(x, y)) {
+            expandCell(costmap, options, search, current.index, current.cost, goal, [](uint32_t, uint32_t) { return true; });
+            continue;
+        }
+        const std::size_t parent = search.nodes[current.index].parent;
+        uint8_t directions = 0xFF;
+        if (parent != current.index) {
+            const Cell from = cellOf(width, parent);
+            directions = grid.prune(x, y, sign(x - static_cast<int>(from.x)), sign(y - static_cast<int>(from.y)));
+        }
+        for (std::size_t direction = 0; direction < kDirections.size(); ++direction) {
+            if ((directions >> direction & 1U) == 0)
+                continue;
+            const auto [dx, dy] = kDirections[direction];
+            const auto emit = [&](int diagonal_steps, std::size_t component, int steps) {
+                const Cell via{static_cast<uint32_t>(x + dx * diagonal_steps), static_cast<uint32_t>(y + dy * diagonal_steps)};
+                const std::size_t via_index = indexOf(width, via);
+                const double via_cost = current.cost + kDiagonalCost * diagonal_steps * factor;
+                if (!search.closed(via_index) && via_cost < search.cost(via_index))
+                    search.update(via_index, via_cost, current.index);
+                const auto [cx, cy] = kDirections[component];
+                relax(via_index, search.cost(via_index) + steps * factor,
+                      {static_cast<uint32_t>(static_cast<int>(via.x) + cx * steps), static_cast<uint32_t>(static_cast<int>(via.y) + cy * steps)});
+            };
+            int steps{};
+            if (!jumper.jump(x, y, direction, goal, steps, emit))
+                continue;
+            const double step = dx != 0 && dy != 0 ? kDiagonalCost : 1.0;
+            relax(current.index, current.cost + step * steps * factor,
+                  {static_cast<uint32_t>(x + dx * steps), static_cast<uint32_t>(y + dy * steps)});
+        }
+    }
+}
+
 } // namespace
 
 const char *to_string(PlanningStatus status) noexcept {
@@ -232,127 +824,905 @@ const char *to_string(PlanningStatus status) noexcept {
     return "unknown planning status";
 }
 
-AStarPlanner::AStarPlanner(AStarOptions options) noexcept : _options(options) {}
+//! A* 搜索工作区
+class AStarPlanner::Workspace {
+public:
+    std::mutex mutex{};
+    SearchNodes search{};
+    JumpGrid jump_grid{};
+    JumpCache jump_cache{};
+};
+
+AStarPlanner::AStarPlanner(AStarOptions options) : _options(options), _workspace(std::make_unique<Workspace>()) {}
+
+AStarPlanner::~AStarPlanner() = default;
+AStarPlanner::AStarPlanner(AStarPlanner &&) noexcept = default;
+AStarPlanner &AStarPlanner::operator=(AStarPlanner &&) noexcept = default;
+AStarPlanner::AStarPlanner(const AStarPlanner &other) : AStarPlanner(other._options) {}
+AStarPlanner &AStarPlanner::operator=(const AStarPlanner &other) {
+    _options = other._options;
+    return *this;
+}
 
 const AStarOptions &AStarPlanner::options() const noexcept { return _options; }
 
 PlanningResult AStarPlanner::plan(const Costmap &costmap, const msg::Pose &start, const msg::Pose &goal) const {
     PlanningResult result{};
-    if (!validOptions(_options)) {
-        result.status = PlanningStatus::InvalidOptions;
+    Cell start_cell{}, goal_cell{};
+    result.status = resolveEndpoints(costmap, start, goal, _options, start_cell, goal_cell);
+    if (result.status != PlanningStatus::Ok)
         return result;
+
+    // 工作区被其他线程占用时使用临时工作区，保证 const 调用可以并发
+    std::unique_lock<std::mutex> lock{};
+    std::unique_ptr<Workspace> temporary{};
+    Workspace *workspace = _workspace.get();
+    if (workspace != nullptr)
+        lock = std::unique_lock<std::mutex>(workspace->mutex, std::try_to_lock);
+    if (workspace == nullptr || !lock.owns_lock()) {
+        temporary = std::make_unique<Workspace>();
+        workspace = temporary.get();
     }
-    if (!costmap.valid() || costmap.width() == 0 || costmap.height() == 0 ||
-        static_cast<std::size_t>(costmap.width()) > std::numeric_limits<std::size_t>::max() / costmap.height()) {
-        result.status = PlanningStatus::InvalidMap;
-        return result;
+    auto &search = workspace->search;
+
+    const uint32_t width = costmap.width();
+    const std::size_t area = static_cast<std::size_t>(width) * costmap.height();
+    const std::size_t start_index = indexOf(width, start_cell);
+    const std::size_t goal_index = indexOf(width, goal_cell);
+    search.begin(area);
+    search.update(start_index, 0.0, start_index);
+    search.open.push({start_index, 0.0, heuristic(start_cell, goal_cell, _options.allow_diagonal)});
+
+    // 跳点的剪枝规则按八邻域、禁止夹角穿越推导，不满足时使用逐栅格 A*
+    const bool jump_point = _options.jump_point != JumpPointMode::Disabled && _options.allow_diagonal &&
+                            !_options.allow_corner_cutting;
+    if (!jump_point) {
+        searchGrid(costmap, _options, search, goal_cell, result.expanded, [](uint32_t, uint32_t) { return true; });
+    } else {
+        auto &grid = workspace->jump_grid;
+        grid.assign(costmap, _options);
+        if (_options.jump_point == JumpPointMode::Online) {
+            // 在线对角跳跃的每一步都要沿两个分量方向扫描，非均匀栅格使跳点变密时扫描量远超逐栅格展开
+            if (grid.uniform())
+                searchJumpPoints(costmap, _options, grid, grid, search, goal_cell, result.expanded);
+            else
+                searchGrid(costmap, _options, search, goal_cell, result.expanded, [](uint32_t, uint32_t) { return true; });
+        } else {
+            workspace->jump_cache.prepare(grid);
+            searchJumpPoints(costmap, _options, grid, workspace->jump_cache, search, goal_cell, result.expanded);
+        }
     }
-    if (!finitePoint(start.position)) {
-        result.status = PlanningStatus::InvalidStart;
+
+    if (!search.closed(goal_index)) {
+        result.status = PlanningStatus::NoPath;
         return result;
     }
-    if (!finitePoint(goal.position)) {
-        result.status = PlanningStatus::InvalidGoal;
+    std::vector<Cell> cells{};
+    if (!tracePath(search, width, start_index, goal_index, cells)) {
+        result.status = PlanningStatus::NoPath;
         return result;
     }
-    const auto start_cell = costmap.worldToMap(start.position.x, start.position.y);
-    if (!start_cell) {
-        result.status = PlanningStatus::InvalidStart;
+    result.path = makePath(costmap, cells, start, goal, _options);
+    if (result.path.poses.empty()) {
+        result.status = PlanningStatus::NoPath;
         return result;
     }
-    const auto goal_cell = costmap.worldToMap(goal.position.x, goal.position.y);
-    if (!goal_cell) {
-        result.status = PlanningStatus::InvalidGoal;
-        return result;
+    result.cost = search.cost(goal_index);
+    result.status = PlanningStatus::Ok;
+    return result;
+}
+
+/**
+ * @brief D* Lite 搜索状态
+ * @details `g` 为栅格到终点的已知代价，`rhs` 为由后继栅格一步前瞻得到的代价，两者不等的栅格位于优先队列中。
+ *          优先队列使用惰性删除：每个栅格记录当前有效条目的版本，弹出版本不符的条目时直接丢弃
+ */
+class DStarLitePlanner::Impl {
+public:
+    struct Key {
+        double first{};
+        double second{};
+
+        bool operator<(const Key &other) const noexcept {
+            return first < other.first || (first == other.first && second < other.second);
+        }
+
+        /**
+         * @brief 终止条件使用的比较，第一分量相差在舍入误差内时视为相等
+         * @note 直线路径上 `g + h` 与逐步累加的 `g` 在数学上相等，但浮点舍入可能使前者略大，
+         *       严格比较会让这类栅格留在队列中，路径经过其旧代价
+         */
+        bool before(const Key &other) const noexcept {
+            const double tolerance = 1e-9 * std::max(1.0, std::abs(other.first));
+            if (std::abs(first - other.first) <= tolerance)
+                return second < other.second;
+            return first < other.first;
+        }
+    };
+
+    struct Node {
+        double g{std::numeric_limits<double>::infinity()};
+        double rhs{std::numeric_limits<double>::infinity()};
+        uint32_t version{}; //!< 当前有效队列条目的版本
+        bool queued{};      //!< 是否位于优先队列中
+    };
+
+    struct Entry {
+        Key key{};
+        std::size_t index{};
+        uint32_t version{};
+    };
+
+    //! 堆比较器，键值小者位于堆顶
+    struct EntryGreater {
+        bool operator()(const Entry &lhs, const Entry &rhs) const noexcept { return rhs.key < lhs.key; }
+    };
+
+    explicit Impl(AStarOptions opts) : options(opts) {}
+
+    std::size_t indexOf(Cell cell) const noexcept { return nav::indexOf(width, cell); }
+
+    //! 以 goal_cell 为根重新开始搜索
+    void restart(const Costmap &costmap, Cell start_cell, Cell goal_cell) {
+        width = costmap.width();
+        height = costmap.height();
+        nodes.assign(static_cast<std::size_t>(width) * height, Node{});
+        factors.resize(nodes.size());
+        for (std::size_t index = 0; index < factors.size(); ++index)
+            refresh(costmap, index);
+        queue.clear();
+        queued_count = 0;
+        km = 0.0;
+        start = start_cell;
+        goal = goal_cell;
+        nodes[indexOf(goal)].rhs = 0.0;
+        push(indexOf(goal));
+        initialized = true;
     }
-    if (!traversable(costmap, *start_cell, _options)) {
-        result.status = PlanningStatus::StartBlocked;
-        return result;
+
+    Key calculateKey(std::size_t index) const noexcept {
+        const auto &node = nodes[index];
+        const double value = std::min(node.g, node.rhs);
+        return {value + heuristic(start, cellOf(width, index), options.allow_diagonal) + km, value};
+    }
+
+    //! 按代价地图刷新栅格的移动代价系数
+    void refresh(const Costmap &costmap, std::size_t index) noexcept {
+        factors[index] = moveFactor(costmap, cellOf(width, index), options);
+    }
+
+    //! 从 from 沿 (dx, dy) 移动一步的代价，不可移动时为无穷大
+    double edgeCost(Cell from, int dx, int dy) const noexcept {
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+        const bool diagonal = dx != 0 && dy != 0;
+        if (diagonal && !options.allow_diagonal)
+            return infinity;
+        const int next_x = static_cast<int>(from.x) + dx;
+        const int next_y = static_cast<int>(from.y) + dy;
+        if (next_x < 0 || next_y < 0 || next_x >= static_cast<int>(width) || next_y >= static_cast<int>(height))
+            return infinity;
+        const Cell next{static_cast<uint32_t>(next_x), static_cast<uint32_t>(next_y)};
+        if (std::isinf(factors[indexOf(from)]))
+            return infinity;
+        if (diagonal && !options.allow_corner_cutting &&
+            (std::isinf(factors[indexOf({next.x, from.y})]) || std::isinf(factors[indexOf({from.x, next.y})])))
+            return infinity;
+        return (diagonal ? kDiagonalCost : 1.0) * factors[indexOf(next)];
+    }
+
+    void push(std::size_t index) {
+        auto &node = nodes[index];
+        if (!node.queued)
+            ++queued_count;
+        node.queued = true;
+        queue.push_back({calculateKey(index), index, ++node.version});
+        std::push_heap(queue.begin(), queue.end(), EntryGreater{});
+    }
+
+    void remove(std::size_t index) noexcept {
+        if (nodes[index].queued) {
+            nodes[index].queued = false;
+            --queued_count;
+        }
+    }
+
+    bool current(const Entry &entry) const noexcept {
+        return nodes[entry.index].queued && nodes[entry.index].version == entry.version;
+    }
+
+    //! 由后继栅格重新计算 rhs，并按 g 与 rhs 是否一致更新队列
+    void updateVertex(std::size_t index) {
+        auto &node = nodes[index];
+        if (index != indexOf(goal)) {
+            const Cell cell = cellOf(width, index);
+            node.rhs = std::numeric_limits<double>::infinity();
+            for (const auto &[dx, dy] : kDirections) {
+                const double cost = edgeCost(cell, dx, dy);
+                if (std::isfinite(cost))
+                    node.rhs = std::min(node.rhs, cost + nodes[indexOf({cell.x + dx, cell.y + dy})].g);
+            }
+        }
+        requeue(index);
+    }
+
+    //! 按 g 与 rhs 是否一致更新队列
+    void requeue(std::size_t index) {
+        remove(index);
+        if (nodes[index].g != nodes[index].rhs)
+            push(index);
+    }
+
+    //! 更新 cell 的全部邻居，即可能经过 cell 或以 cell 为夹角侧栅格移动的栅格
+    void updateNeighbors(Cell cell) {
+        for (const auto &[dx, dy] : kDirections) {
+            const int x = static_cast<int>(cell.x) + dx;
+            const int y = static_cast<int>(cell.y) + dy;
+            if (x >= 0 && y >= 0 && x < static_cast<int>(width) && y < static_cast<int>(height))
+                updateVertex(indexOf({static_cast<uint32_t>(x), static_cast<uint32_t>(y)}));
+        }
+    }
+
+    //! 修复搜索状态直至起点的代价确定，返回展开的栅格数量
+    std::size_t computeShortestPath() {
+        std::size_t expanded{};
+        const std::size_t start_index = indexOf(start);
+        while (true) {
+            // 失效条目过多时整体压缩队列
+            if (queue.size() > 4 * queued_count + 1024) {
+                queue.erase(std::remove_if(queue.begin(), queue.end(), [this](const Entry &entry) { return !current(entry); }),
+                            queue.end());
+                std::make_heap(queue.begin(), queue.end(), EntryGreater{});
+            }
+            while (!queue.empty() && !current(queue.front())) {
+                std::pop_heap(queue.begin(), queue.end(), EntryGreater{});
+                queue.pop_back();
+            }
+            if (queue.empty())
+                break;
+            const auto &start_node = nodes[start_index];
+            if (!queue.front().key.before(calculateKey(start_index)) && start_node.rhs == start_node.g)
+                break;
+            const Entry top = queue.front();
+            std::pop_heap(queue.begin(), queue.end(), EntryGreater{});
+            queue.pop_back();
+            if (top.key < calculateKey(top.index)) {
+                push(top.index);
+                continue;
+            }
+            remove(top.index);
+            ++expanded;
+            auto &node = nodes[top.index];
+            const Cell cell = cellOf(width, top.index);
+            if (node.g > node.rhs) {
+                // 代价降低时邻居的 rhs 只可能经由该栅格变小，无需重新遍历其全部后继
+                node.g = node.rhs;
+                for (const auto &[dx, dy] : kDirections) {
+                    const int x = static_cast<int>(cell.x) - dx;
+                    const int y = static_cast<int>(cell.y) - dy;
+                    if (x < 0 || y < 0 || x >= static_cast<int>(width) || y >= static_cast<int>(height))
+                        continue;
+                    const Cell neighbor{static_cast<uint32_t>(x), static_cast<uint32_t>(y)};
+                    const std::size_t index = indexOf(neighbor);
+                    const double rhs = edgeCost(neighbor, dx, dy) + node.g;
+                    if (rhs < nodes[index].rhs) {
+                        nodes[index].rhs = rhs;
+                        requeue(index);
+                    }
+                }
+            } else {
+                node.g = std::numeric_limits<double>::infinity();
+                updateVertex(top.index);
+                updateNeighbors(cell);
+            }
+        }
+        return expanded;
     }
-    if (!traversable(costmap, *goal_cell, _options)) {
-        result.status = PlanningStatus::GoalBlocked;
+
+    AStarOptions options{};
+    std::vector<Node> nodes{};
+    std::vector<double> factors{}; //!< 进入各栅格的移动代价系数，不可通行时为无穷大
+    std::vector<Entry> queue{};
+    std::size_t queued_count{}; //!< 位于队列中的栅格数量
+    uint32_t width{};
+    uint32_t height{};
+    Cell start{};               //!< 上次规划的起点
+    Cell goal{};                //!< 搜索树的根
+    double km{};                //!< 起点移动累计的启发式偏移
+    uint64_t stamp{};           //!< 搜索状态对应的代价地图内容标识
+    bool initialized{};
+};
+
+DStarLitePlanner::DStarLitePlanner(AStarOptions options) : _impl(std::make_unique<Impl>(options)) {}
+
+DStarLitePlanner::~DStarLitePlanner() = default;
+DStarLitePlanner::DStarLitePlanner(DStarLitePlanner &&) noexcept = default;
+DStarLitePlanner &DStarLitePlanner::operator=(DStarLitePlanner &&) noexcept = default;
+DStarLitePlanner::DStarLitePlanner(const DStarLitePlanner &other) : _impl(std::make_unique<Impl>(*other._impl)) {}
+DStarLitePlanner &DStarLitePlanner::operator=(const DStarLitePlanner &other) {
+    if (this != &other)
+        *_impl = *other._impl;
+    return *this;
+}
+
+const AStarOptions &DStarLitePlanner::options() const noexcept { return _impl->options; }
+
+void DStarLitePlanner::reset() noexcept { _impl->initialized = false; }
+
+PlanningResult DStarLitePlanner::plan(const Costmap &costmap, const msg::Pose &start, const msg::Pose &goal) {
+    PlanningResult result{};
+    Cell start_cell{}, goal_cell{};
+    result.status = resolveEndpoints(costmap, start, goal, _impl->options, start_cell, goal_cell);
+    if (result.status != PlanningStatus::Ok)
         return result;
+
+    auto &impl = *_impl;
+    std::optional<std::vector<Cell>> changes{};
+    if (impl.initialized && impl.width == costmap.width() && impl.height == costmap.height() &&
+        impl.goal.x == goal_cell.x && impl.goal.y == goal_cell.y)
+        changes = costmap.changesSince(impl.stamp);
+    if (!changes) {
+        impl.restart(costmap, start_cell, goal_cell);
+    } else {
+        // 起点移动后队列中已有的键值偏小，累加偏移量使新旧键值保持可比
+        impl.km += heuristic(impl.start, start_cell, impl.options.allow_diagonal);
+        impl.start = start_cell;
+        for (const auto &cell : *changes)
+            impl.refresh(costmap, impl.indexOf(cell));
+        for (const auto &cell : *changes) {
+            impl.updateVertex(impl.indexOf(cell));
+            impl.updateNeighbors(cell);
+        }
     }
+    impl.stamp = costmap.stamp();
+    result.expanded = impl.computeShortestPath();
 
-    const uint32_t width = costmap.width();
-    const std::size_t area = static_cast<std::size_t>(width) * costmap.height();
-    const std::size_t start_index = indexOf(width, *start_cell);
-    const std::size_t goal_index = indexOf(width, *goal_cell);
-    const std::size_t no_parent = std::numeric_limits<std::size_t>::max();
-    std::vector<double> costs(area, std::numeric_limits<double>::infinity());
-    std::vector<std::size_t> parents(area, no_parent);
-    std::vector<bool> closed(area, false);
-    std::priority_queue<OpenNode, std::vector<OpenNode>, OpenNodeGreater> open{};
-    costs[start_index] = 0.0;
-    open.push({start_index, 0.0, heuristic(*start_cell, *goal_cell, _options.allow_diagonal)});
-
-    constexpr std::array<std::pair<int, int>, 8> directions{{
-        {1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}}};
-    while (!open.empty()) {
-        const auto current = open.top();
-        open.pop();
-        if (closed[current.index] || current.cost > costs[current.index])
-            continue;
-        closed[current.index] = true;
-        ++result.expanded;
-        if (current.index == goal_index)
-            break;
-        const Cell cell = cellOf(width, current.index);
-        for (std::size_t direction = 0; direction < directions.size(); ++direction) {
-            const auto [offset_x, offset_y] = directions[direction];
-            const bool diagonal = offset_x != 0 && offset_y != 0;
-            if (diagonal && !_options.allow_diagonal)
+    // 从起点沿代价最小的后继栅格走到终点
+    const std::size_t goal_index = impl.indexOf(goal_cell);
+    std::vector<Cell> cells{start_cell};
+    Cell cell = start_cell;
+    while (impl.indexOf(cell) != goal_index) {
+        double best = std::numeric_limits<double>::infinity();
+        double step{};
+        Cell next{};
+        for (const auto &[dx, dy] : kDirections) {
+            const double cost = impl.edgeCost(cell, dx, dy);
+            if (!std::isfinite(cost))
                 continue;
-            const int next_x = static_cast<int>(cell.x) + offset_x;
-            const int next_y = static_cast<int>(cell.y) + offset_y;
-            if (next_x < 0 || next_y < 0 || next_x >= static_cast<int>(costmap.width()) ||
-                next_y >= static_cast<int>(costmap.height()))
+            const Cell candidate{cell.x + dx, cell.y + dy};
+            const double total = cost + impl.nodes[impl.indexOf(candidate)].g;
+            if (total < best) {
+                best = total;
+                step = cost;
+                next = candidate;
+            }
+        }
+        if (!std::isfinite(best) || cells.size() > impl.nodes.size()) {
+            result.status = PlanningStatus::NoPath;
+            return result;
+        }
+        result.cost += step;
+        cell = next;
+        cells.push_back(cell);
+    }
+    result.path = makePath(costmap, cells, start, goal, impl.options);
+    if (result.path.poses.empty()) {
+        result.status = PlanningStatus::NoPath;
+        return result;
+    }
+    return result;
+}
+
+/**
+ * @brief 分层规划的抽象图与搜索状态
+ * @details
+ * - 相邻两簇公共边界上两侧均可通行的连续区间作为一个入口区间，较短的区间在中点放置一个入口，
+ *   较长的区间在两端各放置一个入口，入口两侧的栅格分别作为两簇的节点，之间以一步直线移动相连
+ * - 簇的节点按左、右、下、上 4 条边界依次排列，跨越边界的相邻节点编号由边界与入口序号直接换算，
+ *   因此重建一个簇时无需改动相邻簇保存的簇内代价
+ */
+class HierarchicalPlanner::Impl {
+public:
+    //! 边界上的入口，`low` 位于坐标较小一侧的簇，`high` 位于坐标较大一侧的簇
+    struct Transition {
+        Cell low{};
+        Cell high{};
+    };
+
+    struct Cluster {
+        std::array<uint32_t, 5> offsets{}; //!< 左、右、下、上 4 条边界的节点在簇内的起始序号，最后一项为节点数
+        std::vector<double> costs{};       //!< 簇内节点两两之间的最短路径代价，按行主序存储，不可达时为无穷大
+    };
+
+    //! 抽象图节点
+    struct Node {
+        Cell cell{};        //!< 所在栅格
+        uint32_t cluster{}; //!< 所在簇
+        uint32_t partner{}; //!< 边界另一侧相连的节点
+    };
+
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    //! 入口区间不短于该长度时在两端各放置一个入口
+    static constexpr uint32_t wide_entrance = 6;
+
+    Impl(AStarOptions opts, HierarchicalOptions hier) : options(opts), hierarchy(hier) {}
+
+    double factor(Cell cell) const noexcept { return factors[indexOf(width, cell)]; }
+
+    std::size_t clusterOf(Cell cell) const noexcept {
+        return static_cast<std::size_t>(cell.y / hierarchy.cluster_size) * clusters_x + cell.x / hierarchy.cluster_size;
+    }
+
+    std::size_t verticalBorders() const noexcept { return static_cast<std::size_t>(clusters_x - 1) * clusters_y; }
+
+    //! 簇在 direction（0 左、1 右、2 下、3 上）一侧的边界，位于地图边缘时返回 npos
+    std::size_t borderOf(std::size_t cluster, std::size_t direction) const noexcept {
+        const std::size_t cx = cluster % clusters_x;
+        const std::size_t cy = cluster / clusters_x;
+        switch (direction) {
+        case 0: return cx > 0 ? cy * (clusters_x - 1) + cx - 1 : npos;
+        case 1: return cx + 1 < clusters_x ? cy * (clusters_x - 1) + cx : npos;
+        case 2: return cy > 0 ? verticalBorders() + (cy - 1) * clusters_x + cx : npos;
+        default: return cy + 1 < clusters_y ? verticalBorders() + cy * clusters_x + cx : npos;
+        }
+    }
+
+    //! 簇在 direction 一侧的相邻簇，调用方保证该侧存在边界
+    std::size_t neighborOf(std::size_t cluster, std::size_t direction) const noexcept {
+        switch (direction) {
+        case 0: return cluster - 1;
+        case 1: return cluster + 1;
+        case 2: return cluster - clusters_x;
+        default: return cluster + clusters_x;
+        }
+    }
+
+    //! 边界两侧的簇，先为坐标较小的一侧
+    std::pair<std::size_t, std::size_t> clustersOf(std::size_t border) const noexcept {
+        if (border < verticalBorders()) {
+            const std::size_t cluster = border / (clusters_x - 1) * clusters_x + border % (clusters_x - 1);
+            return {cluster, cluster + 1};
+        }
+        const std::size_t cluster = border - verticalBorders();
+        return {cluster, cluster + clusters_x};
+    }
+
+    //! 簇内序号为 node 的节点所在栅格，direction 返回其所在边界
+    Cell nodeCell(std::size_t cluster, uint32_t node, std::size_t &direction) const noexcept {
+        const auto &offsets = clusters[cluster].offsets;
+        direction = 0;
+        while (node >= offsets[direction + 1])
+            ++direction;
+        const auto &transition = borders[borderOf(cluster, direction)][node - offsets[direction]];
+        // 左、下边界上本簇位于坐标较大的一侧
+        return direction % 2 == 0 ? transition.high : transition.low;
+    }
+
+    //! 重新放置边界上的入口，返回入口是否改变
+    bool buildBorder(std::size_t border) {
+        const bool vertical = border < verticalBorders();
+        const std::size_t low = clustersOf(border).first;
+        const uint32_t size = hierarchy.cluster_size;
+        const auto cx = static_cast<uint32_t>(low % clusters_x);
+        const auto cy = static_cast<uint32_t>(low / clusters_x);
+        // 边界较小一侧的列或行，以及沿边界的栅格范围
+        const uint32_t line = vertical ? (cx + 1) * size - 1 : (cy + 1) * size - 1;
+        const uint32_t first = vertical ? cy * size : cx * size;
+        const uint32_t last = std::min(first + size, vertical ? height : width);
+        auto at = [&](uint32_t k) {
+            return vertical ? Transition{{line, k}, {line + 1, k}} : Transition{{k, line}, {k, line + 1}};
+        };
+
+        std::vector<Transition> transitions{};
+        uint32_t begin = last;
+        for (uint32_t k = first; k <= last; ++k) {
+            if (k < last && std::isfinite(factor(at(k).low)) && std::isfinite(factor(at(k).high))) {
+                begin = std::min(begin, k);
                 continue;
-            const Cell next{static_cast<uint32_t>(next_x), static_cast<uint32_t>(next_y)};
-            if (!traversable(costmap, next, _options))
+            }
+            if (begin < k) {
+                if (k - begin < wide_entrance) {
+                    transitions.push_back(at(begin + (k - begin) / 2));
+                } else {
+                    transitions.push_back(at(begin));
+                    transitions.push_back(at(k - 1));
+                }
+            }
+            begin = last;
+        }
+        const bool changed = !std::equal(transitions.begin(), transitions.end(), borders[border].begin(), borders[border].end(),
+                                         [](const Transition &lhs, const Transition &rhs) {
+                                             return lhs.low.x == rhs.low.x && lhs.low.y == rhs.low.y;
+                                         });
+        borders[border] = std::move(transitions);
+        return changed;
+    }
+
+    /**
+     * @brief 在簇内搜索 source 到各目标栅格的最短路径代价
+     * @details 移动代价由进入的栅格决定，反向行走同一条路径的代价并不相同，因此反向代价需要单独搜索
+     *
+     * @param[in] targets 目标栅格，均位于该簇内
+     * @param[out] costs 各目标的代价，长度与 targets 相同，不可达时为无穷大
+     * @param[in] backward 为 true 时沿反向边搜索，得到各目标到 source 的代价
+     * @return 展开的栅格数量
+     */
+    std::size_t searchCluster(std::size_t cluster, Cell source, const std::vector<Cell> &targets, double *costs,
+                              bool backward = false) {
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+        const uint32_t size = hierarchy.cluster_size;
+        const auto x0 = static_cast<uint32_t>(cluster % clusters_x) * size;
+        const auto y0 = static_cast<uint32_t>(cluster / clusters_x) * size;
+        const uint32_t w = std::min(size, width - x0);
+        const uint32_t h = std::min(size, height - y0);
+        auto local = [&](Cell cell) { return static_cast<std::size_t>(cell.y - y0) * w + (cell.x - x0); };
+
+        local_costs.assign(static_cast<std::size_t>(w) * h, infinity);
+        local_targets.assign(local_costs.size(), 0);
+        std::size_t remaining{};
+        for (const auto &target : targets) {
+            auto &flag = local_targets[local(target)];
+            remaining += flag == 0;
+            flag = 1;
+        }
+        local_open.clear();
+        local_costs[local(source)] = 0.0;
+        local_open.push({local(source), 0.0, 0.0});
+
+        // 所有目标都已确定代价时提前结束
+        std::size_t expanded{};
+        while (!local_open.empty() && remaining > 0) {
+            const auto current = local_open.top();
+            local_open.pop();
+            if (current.cost > local_costs[current.index])
                 continue;
-            if (diagonal && !_options.allow_corner_cutting) {
-                const Cell side_x{static_cast<uint32_t>(next_x), cell.y};
-                const Cell side_y{cell.x, static_cast<uint32_t>(next_y)};
-                if (!traversable(costmap, side_x, _options) || !traversable(costmap, side_y, _options))
+            ++expanded;
+            if (local_targets[current.index] != 0) {
+                local_targets[current.index] = 0;
+                --remaining;
+            }
+            const auto x = static_cast<int>(current.index % w);
+            const auto y = static_cast<int>(current.index / w);
+            const double current_factor = factor({x0 + x, y0 + y});
+            for (const auto &[dx, dy] : kDirections) {
+                const bool diagonal = dx != 0 && dy != 0;
+                if (diagonal && !options.allow_diagonal)
                     continue;
+                const int next_x = x + dx;
+                const int next_y = y + dy;
+                if (next_x < 0 || next_y < 0 || next_x >= static_cast<int>(w) || next_y >= static_cast<int>(h))
+                    continue;
+                const double next_factor = factor({x0 + next_x, y0 + next_y});
+                if (std::isinf(next_factor))
+                    continue;
+                if (diagonal && !options.allow_corner_cutting &&
+                    (std::isinf(factor({x0 + next_x, y0 + y})) || std::isinf(factor({x0 + x, y0 + next_y}))))
+                    continue;
+                // 反向边由 next 进入当前栅格，代价取当前栅格的系数
+                const double candidate = current.cost + (diagonal ? kDiagonalCost : 1.0) * (backward ? current_factor : next_factor);
+                const std::size_t next = static_cast<std::size_t>(next_y) * w + next_x;
+                if (candidate >= local_costs[next])
+                    continue;
+                local_costs[next] = candidate;
+                local_open.push({next, candidate, candidate});
+            }
+        }
+        for (std::size_t i = 0; i < targets.size(); ++i)
+            costs[i] = local_costs[local(targets[i])];
+        return expanded;
+    }
+
+    //! 重新排列簇的节点并计算簇内代价
+    void buildCluster(std::size_t cluster) {
+        auto &data = clusters[cluster];
+        for (std::size_t direction = 0; direction < 4; ++direction) {
+            const std::size_t border = borderOf(cluster, direction);
+            data.offsets[direction + 1] = data.offsets[direction] + (border == npos ? 0 : static_cast<uint32_t>(borders[border].size()));
+        }
+        const uint32_t count = data.offsets[4];
+        std::vector<Cell> cells(count);
+        for (uint32_t node = 0; node < count; ++node) {
+            std::size_t direction{};
+            cells[node] = nodeCell(cluster, node, direction);
+        }
+        // 正反方向的代价不对称，每个节点分别搜索到其余全部节点的代价
+        data.costs.assign(static_cast<std::size_t>(count) * count, 0.0);
+        for (uint32_t from = 0; from < count; ++from)
+            searchCluster(cluster, cells[from], cells, data.costs.data() + static_cast<std::size_t>(from) * count);
+    }
+
+    //! 为全部簇的节点统一编号，并换算跨越边界相连的节点
+    void rebuildIndex() {
+        node_offsets.resize(clusters.size() + 1);
+        node_offsets[0] = 0;
+        for (std::size_t cluster = 0; cluster < clusters.size(); ++cluster)
+            node_offsets[cluster + 1] = node_offsets[cluster] + clusters[cluster].offsets[4];
+        nodes.resize(node_offsets.back());
+        for (std::size_t cluster = 0; cluster < clusters.size(); ++cluster) {
+            const auto &offsets = clusters[cluster].offsets;
+            for (uint32_t node = 0; node < offsets[4]; ++node) {
+                std::size_t direction{};
+                auto &info = nodes[node_offsets[cluster] + node];
+                info.cell = nodeCell(cluster, node, direction);
+                info.cluster = static_cast<uint32_t>(cluster);
+                const std::size_t neighbor = neighborOf(cluster, direction);
+                info.partner = node_offsets[neighbor] + clusters[neighbor].offsets[direction ^ 1] + (node - offsets[direction]);
             }
-            const auto cell_cost = costmap.at(next.x, next.y);
-            if (!cell_cost)
+        }
+    }
+
+    //! 整体重建抽象图
+    void rebuild(const Costmap &costmap) {
+        width = costmap.width();
+        height = costmap.height();
+        const uint32_t size = hierarchy.cluster_size;
+        clusters_x = width / size + (width % size != 0);
+        clusters_y = height / size + (height % size != 0);
+        factors.resize(static_cast<std::size_t>(width) * height);
+        for (std::size_t index = 0; index < factors.size(); ++index)
+            factors[index] = moveFactor(costmap, cellOf(width, index), options);
+        borders.assign(verticalBorders() + static_cast<std::size_t>(clusters_x) * (clusters_y - 1), {});
+        for (std::size_t border = 0; border < borders.size(); ++border)
+            buildBorder(border);
+        clusters.assign(static_cast<std::size_t>(clusters_x) * clusters_y, {});
+        for (std::size_t cluster = 0; cluster < clusters.size(); ++cluster)
+            buildCluster(cluster);
+        rebuildIndex();
+        corridor.assign(clusters.size(), 0);
+        corridor_generation = 0;
+        initialized = true;
+    }
+
+    //! 按代价发生变化的栅格局部更新抽象图
+    void update(const Costmap &costmap, const std::vector<Cell> &changes) {
+        if (changes.empty())
+            return;
+        const uint32_t size = hierarchy.cluster_size;
+        std::vector<uint8_t> dirty(clusters.size());
+        std::vector<std::size_t> touched{};
+        for (const auto &cell : changes) {
+            factors[indexOf(width, cell)] = moveFactor(costmap, cell, options);
+            const std::size_t cluster = clusterOf(cell);
+            dirty[cluster] = 1;
+            // 位于簇边缘的栅格还可能改变与相邻簇之间的入口
+            if (cell.x % size == 0)
+                touched.push_back(borderOf(cluster, 0));
+            if (cell.x % size == size - 1)
+                touched.push_back(borderOf(cluster, 1));
+            if (cell.y % size == 0)
+                touched.push_back(borderOf(cluster, 2));
+            if (cell.y % size == size - 1)
+                touched.push_back(borderOf(cluster, 3));
+        }
+        std::sort(touched.begin(), touched.end());
+        touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+        for (const auto border : touched) {
+            if (border == npos || !buildBorder(border))
+                continue;
+            const auto [low, high] = clustersOf(border);
+            dirty[low] = dirty[high] = 1;
+        }
+        for (std::size_t cluster = 0; cluster < clusters.size(); ++cluster)
+            if (dirty[cluster] != 0)
+                buildCluster(cluster);
+        rebuildIndex();
+    }
+
+    //! 使抽象图与代价地图一致
+    void synchronize(const Costmap &costmap) {
+        std::optional<std::vector<Cell>> changes{};
+        if (initialized && width == costmap.width() && height == costmap.height())
+            changes = costmap.changesSince(stamp);
+        if (!changes)
+            rebuild(costmap);
+        else
+            update(costmap, *changes);
+        stamp = costmap.stamp();
+    }
+
+    //! 将 cluster 周围 corridor_margin 圈的簇标记为走廊
+    void markCorridor(std::size_t cluster) noexcept {
+        const auto margin = static_cast<int64_t>(std::min(hierarchy.corridor_margin, std::max(clusters_x, clusters_y)));
+        const auto cx = static_cast<int64_t>(cluster % clusters_x);
+        const auto cy = static_cast<int64_t>(cluster / clusters_x);
+        for (int64_t y = std::max<int64_t>(cy - margin, 0); y <= std::min<int64_t>(cy + margin, clusters_y - 1); ++y)
+            for (int64_t x = std::max<int64_t>(cx - margin, 0); x <= std::min<int64_t>(cx + margin, clusters_x - 1); ++x)
+                corridor[static_cast<std::size_t>(y) * clusters_x + x] = corridor_generation;
+    }
+
+    /**
+     * @brief 在抽象图上搜索粗路径，将其经过的簇标记为走廊，并记录沿途节点作为精细搜索的路标
+     *
+     * @param[in,out] expanded 累加起点、终点接入所在簇时展开的栅格数量
+     * @return 是否找到粗路径
+     */
+    bool searchCorridor(Cell start_cell, Cell goal_cell, std::size_t &expanded) {
+        const std::size_t start_cluster = clusterOf(start_cell);
+        const std::size_t goal_cluster = clusterOf(goal_cell);
+        const std::size_t start_first = node_offsets[start_cluster];
+        const std::size_t goal_first = node_offsets[goal_cluster];
+        const bool same_cluster = start_cluster == goal_cluster;
+
+        // 起点、终点临时接入所在簇的全部节点，终点一侧沿反向边搜索得到各节点到终点的代价
+        std::vector<Cell> targets{};
+        for (std::size_t node = start_first; node < node_offsets[start_cluster + 1]; ++node)
+            targets.push_back(nodes[node].cell);
+        if (same_cluster)
+            targets.push_back(goal_cell);
+        std::vector<double> from_start(targets.size());
+        expanded += searchCluster(start_cluster, start_cell, targets, from_start.data());
+        targets.clear();
+        for (std::size_t node = goal_first; node < node_offsets[goal_cluster + 1]; ++node)
+            targets.push_back(nodes[node].cell);
+        std::vector<double> to_goal(targets.size());
+        expanded += searchCluster(goal_cluster, goal_cell, targets, to_goal.data(), true);
+
+        const std::size_t source = nodes.size();
+        const std::size_t target = source + 1;
+        abstract.begin(nodes.size() + 2);
+        abstract.update(source, 0.0, source);
+        abstract.open.push({source, 0.0, heuristic(start_cell, goal_cell, options.allow_diagonal)});
+        auto relax = [&](std::size_t from, std::size_t to, double cost) {
+            const double candidate = abstract.cost(from) + cost;
+            if (!std::isfinite(candidate) || candidate >= abstract.cost(to))
+                return;
+            abstract.update(to, candidate, from);
+            const Cell cell = to == target ? goal_cell : nodes[to].cell;
+            abstract.open.push({to, candidate, candidate + heuristic(cell, goal_cell, options.allow_diagonal)});
+        };
+        while (!abstract.open.empty()) {
+            const auto current = abstract.open.top();
+            abstract.open.pop();
+            if (abstract.closed(current.index) || current.cost > abstract.cost(current.index))
                 continue;
-            const double step = diagonal ? kDiagonalCost : 1.0;
-            const double candidate = costs[current.index] + step * (1.0 + traversalPenalty(*cell_cost, _options));
-            const std::size_t next_index = indexOf(width, next);
-            if (candidate >= costs[next_index])
+            abstract.close(current.index);
+            if (current.index == target)
+                break;
+            if (current.index == source) {
+                for (std::size_t i = 0; i < node_offsets[start_cluster + 1] - start_first; ++i)
+                    relax(source, start_first + i, from_start[i]);
+                if (same_cluster)
+                    relax(source, target, from_start.back());
                 continue;
-            costs[next_index] = candidate;
-            parents[next_index] = current.index;
-            open.push({next_index, candidate, candidate + heuristic(next, *goal_cell, _options.allow_diagonal)});
+            }
+            const auto &node = nodes[current.index];
+            const std::size_t first = node_offsets[node.cluster];
+            const std::size_t count = node_offsets[node.cluster + 1] - first;
+            const std::size_t local = current.index - first;
+            const auto &costs = clusters[node.cluster].costs;
+            for (std::size_t i = 0; i < count; ++i)
+                if (i != local)
+                    relax(current.index, first + i, costs[local * count + i]);
+            if (node.cluster == goal_cluster)
+                relax(current.index, target, to_goal[local]);
+            relax(current.index, node.partner, factor(nodes[node.partner].cell));
         }
+        if (!abstract.closed(target))
+            return false;
+
+        if (++corridor_generation == 0) {
+            std::fill(corridor.begin(), corridor.end(), 0);
+            corridor_generation = 1;
+        }
+        markCorridor(start_cluster);
+        markCorridor(goal_cluster);
+        waypoints.assign(1, goal_cell);
+        for (std::size_t index = abstract.nodes[target].parent; index != source; index = abstract.nodes[index].parent) {
+            markCorridor(nodes[index].cluster);
+            waypoints.push_back(nodes[index].cell);
+        }
+        waypoints.push_back(start_cell);
+        std::reverse(waypoints.begin(), waypoints.end());
+        return true;
+    }
+
+    AStarOptions options{};
+    HierarchicalOptions hierarchy{};
+    std::vector<double> factors{};                  //!< 进入各栅格的移动代价系数，不可通行时为无穷大
+    std::vector<std::vector<Transition>> borders{}; //!< 先按行存储竖直边界，再按行存储水平边界
+    std::vector<Cluster> clusters{};
+    std::vector<std::size_t> node_offsets{};        //!< 各簇节点在抽象图中的起始编号
+    std::vector<Node> nodes{};
+    uint32_t width{};
+    uint32_t height{};
+    uint32_t clusters_x{};
+    uint32_t clusters_y{};
+    uint64_t stamp{};                               //!< 抽象图对应的代价地图内容标识
+    bool initialized{};
+
+    std::vector<uint32_t> corridor{};               //!< 等于 corridor_generation 的簇属于本次规划的走廊
+    uint32_t corridor_generation{};
+    std::vector<Cell> waypoints{};                  //!< 粗路径依次经过的栅格，首尾为起点和终点
+    SearchNodes abstract{};                         //!< 抽象图搜索状态，末尾两个节点为起点和终点
+    SearchNodes search{};                           //!< 精细搜索状态
+    std::vector<double> local_costs{};              //!< 簇内搜索的代价
+    std::vector<uint8_t> local_targets{};           //!< 簇内搜索尚未确定代价的目标栅格
+    OpenHeap local_open{};
+};
+
+HierarchicalPlanner::HierarchicalPlanner(AStarOptions options, HierarchicalOptions hierarchy)
+    : _impl(std::make_unique<Impl>(options, hierarchy)) {}
+
+HierarchicalPlanner::~HierarchicalPlanner() = default;
+HierarchicalPlanner::HierarchicalPlanner(HierarchicalPlanner &&) noexcept = default;
+HierarchicalPlanner &HierarchicalPlanner::operator=(HierarchicalPlanner &&) noexcept = default;
+HierarchicalPlanner::HierarchicalPlanner(const HierarchicalPlanner &other) : _impl(std::make_unique<Impl>(*other._impl)) {}
+HierarchicalPlanner &HierarchicalPlanner::operator=(const HierarchicalPlanner &other) {
+    if (this != &other)
+        *_impl = *other._impl;
+    return *this;
+}
+
+const AStarOptions &HierarchicalPlanner::options() const noexcept { return _impl->options; }
+
+const HierarchicalOptions &HierarchicalPlanner::hierarchy() const noexcept { return _impl->hierarchy; }
+
+void HierarchicalPlanner::reset() noexcept { _impl->initialized = false; }
+
+PlanningResult HierarchicalPlanner::plan(const Costmap &costmap, const msg::Pose &start, const msg::Pose &goal) {
+    PlanningResult result{};
+    auto &impl = *_impl;
+    if (impl.hierarchy.cluster_size < 4) {
+        result.status = PlanningStatus::InvalidOptions;
+        return result;
     }
+    Cell start_cell{}, goal_cell{};
+    result.status = resolveEndpoints(costmap, start, goal, impl.options, start_cell, goal_cell);
+    if (result.status != PlanningStatus::Ok)
+        return result;
+    impl.synchronize(costmap);
 
-    if (!closed[goal_index]) {
+    // 禁止夹角穿越时抽象图与栅格的连通关系一致，抽象图中不可达即不存在路径
+    const bool corridor = impl.searchCorridor(start_cell, goal_cell, result.expanded);
+    if (!corridor && !impl.options.allow_corner_cutting) {
         result.status = PlanningStatus::NoPath;
         return result;
     }
-    std::vector<Cell> cells{};
-    for (std::size_t index = goal_index;; index = parents[index]) {
-        cells.push_back(cellOf(width, index));
-        if (index == start_index)
-            break;
-        if (parents[index] == no_parent) {
+    const uint32_t width = costmap.width();
+    const std::size_t area = static_cast<std::size_t>(width) * costmap.height();
+    auto &search = impl.search;
+    std::vector<Cell> cells{}, segment{};
+    // 依次连接相邻路标，每段 A* 都限制在走廊内，展开范围只与簇的尺寸有关
+    auto connect = [&](Cell from, Cell to, auto &&allowed) {
+        const std::size_t from_index = indexOf(width, from);
+        const std::size_t to_index = indexOf(width, to);
+        search.begin(area);
+        search.update(from_index, 0.0, from_index);
+        search.open.push({from_index, 0.0, heuristic(from, to, impl.options.allow_diagonal)});
+        searchGrid(costmap, impl.options, search, to, result.expanded, allowed);
+        if (!search.closed(to_index) || !tracePath(search, width, from_index, to_index, segment))
+            return false;
+        cells.insert(cells.end(), segment.begin() + (cells.empty() ? 0 : 1), segment.end());
+        result.cost += search.cost(to_index);
+        return true;
+    };
+    bool found = corridor;
+    if (corridor) {
+        const uint32_t size = impl.hierarchy.cluster_size;
+        const auto inside = [&](uint32_t x, uint32_t y) {
+            return impl.corridor[static_cast<std::size_t>(y / size) * impl.clusters_x + x / size] == impl.corridor_generation;
+        };
+        const auto &waypoints = impl.waypoints;
+        for (std::size_t i = 1; i < waypoints.size() && found; ++i)
+            if (waypoints[i].x != waypoints[i - 1].x || waypoints[i].y != waypoints[i - 1].y)
+                found = connect(waypoints[i - 1], waypoints[i], inside);
+    }
+    if (!found) {
+        // 抽象图可能遗漏只经过簇角的夹角穿越，退回全图搜索
+        cells.clear();
+        result.cost = 0.0;
+        if (!connect(start_cell, goal_cell, [](uint32_t, uint32_t) { return true; })) {
             result.status = PlanningStatus::NoPath;
             return result;
         }
     }
-    std::reverse(cells.begin(), cells.end());
-    result.path = makePath(costmap, cells, start, goal, _options);
+    if (cells.empty())
+        cells.push_back(start_cell);
+    result.path = makePath(costmap, cells, start, goal, impl.options);
     if (result.path.poses.empty()) {
         result.status = PlanningStatus::NoPath;
         return result;
     }
-    result.cost = costs[goal_index];
-    result.status = PlanningStatus::Ok;
     return result;
 }
 
@@ -9,8 +9,10 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -24,6 +26,7 @@ using namespace rm::nav;
 namespace {
 
 constexpr double kEps = 1e-9;
+constexpr double kPi = 3.14159265358979323846;
 
 msg::OccupancyGrid makeGrid(uint32_t width, uint32_t height, int8_t value = -1, double resolution = 1.0) {
     msg::OccupancyGrid result{};
@@ -44,6 +47,55 @@ msg::Pose planarPose(double x, double y, double yaw = 0.0) {
     return result;
 }
 
+/**
+ * @brief 逐障碍扫描方形邻域的膨胀参考实现
+ *
+ * @param[in] merged 已合并静态层与障碍层、尚未膨胀的代价
+ * @param[in] width 地图宽度
+ * @param[in] height 地图高度
+ * @param[in] resolution 地图分辨率
+ * @param[in] options 代价地图参数
+ */
+std::vector<uint8_t> referenceInflation(std::vector<uint8_t> merged, uint32_t width, uint32_t height,
+                                        double resolution, const CostmapOptions &options) {
+    const int cell_radius = static_cast<int>(std::ceil(options.inflation_radius / resolution));
+    if (cell_radius <= 0)
+        return merged;
+    std::vector<Cell> obstacles{};
+    for (uint32_t y = 0; y < height; ++y)
+        for (uint32_t x = 0; x < width; ++x)
+            if (merged[static_cast<std::size_t>(y) * width + x] == Lethal)
+                obstacles.push_back({x, y});
+
+    for (const auto &obstacle : obstacles) {
+        const int min_x = std::max(0, static_cast<int>(obstacle.x) - cell_radius);
+        const int max_x = std::min(static_cast<int>(width) - 1, static_cast<int>(obstacle.x) + cell_radius);
+        const int min_y = std::max(0, static_cast<int>(obstacle.y) - cell_radius);
+        const int max_y = std::min(static_cast<int>(height) - 1, static_cast<int>(obstacle.y) + cell_radius);
+        for (int y = min_y; y <= max_y; ++y) {
+            for (int x = min_x; x <= max_x; ++x) {
+                const double distance = std::hypot(x - static_cast<int>(obstacle.x), y - static_cast<int>(obstacle.y)) * resolution;
+                if (distance > options.inflation_radius)
+                    continue;
+                auto &master = merged[static_cast<std::size_t>(y) * width + x];
+                if (master == Lethal || (master == Unknown && !options.inflate_unknown))
+                    continue;
+                uint8_t inflation_cost{};
+                if (distance <= options.inscribed_radius) {
+                    inflation_cost = Inscribed;
+                } else {
+                    inflation_cost = static_cast<uint8_t>(std::clamp(
+                        std::lround((Inscribed - 1) * std::exp(-options.cost_scaling_factor *
+                                                              (distance - options.inscribed_radius))),
+                        1l, 252l));
+                }
+                master = master == Unknown ? inflation_cost : std::max(master, inflation_cost);
+            }
+        }
+    }
+    return merged;
+}
+
 } // namespace
 
 TEST(Nav_GridMap, validates_full_map_without_replacing_previous_state) {
@@ -208,6 +260,199 @@ TEST(Nav_GridMap, rejects_revision_overflow_and_invalid_remote_updates) {
     EXPECT_EQ(map.revision(), 3u);
 }
 
+TEST(Nav_GridMap, streams_dirty_tiles_to_a_consistent_replica) {
+    // 地图尺寸不是分块边长的整数倍，右侧和下侧的分块被截断
+    auto source = makeGrid(200, 150, -1, 0.1);
+    source.revision = 3;
+    GridMap map(source);
+    GridMap replica(source);
+    uint32_t seed = 11;
+    const auto random = [&seed](uint32_t bound) {
+        seed = seed * 1664525U + 1013904223U;
+        return (seed >> 8) % bound;
+    };
+    for (int round = 0; round < 80; ++round) {
+        switch (random(4)) {
+        case 0:
+            for (uint32_t i = 0, count = 1 + random(20); i < count; ++i)
+                map.set(random(200), random(150), static_cast<int8_t>(static_cast<int>(random(102)) - 1));
+            break;
+        case 1:
+            map.integrateRay(0.1 * random(200), 0.1 * random(150), 0.1 * random(200), 0.1 * random(150), random(2) == 0);
+            break;
+        case 2: {
+            const std::vector<float> ranges(90, 0.5f + 0.1f * static_cast<float>(random(60)));
+            map.integrateScan(planarPose(0.1 * random(200), 0.1 * random(150)), ranges.data(), ranges.size(), -kPi, 2 * kPi / 90);
+            break;
+        }
+        default: {
+            auto full = map.message();
+            for (uint32_t i = 0, count = random(400); i < count; ++i)
+                full.data[random(200 * 150)] = static_cast<int8_t>(random(101));
+            ASSERT_EQ(map.assign(full), MapStatus::Ok);
+            ASSERT_EQ(map.message().data, full.data);
+            break;
+        }
+        }
+        if (random(3) == 0)
+            continue;
+        const auto tiles = map.pendingTiles(random(2) == 0 ? TileEncoding::Raw : TileEncoding::RunLength);
+        if (!tiles) {
+            EXPECT_EQ(replica.revision(), map.revision());
+            continue;
+        }
+        EXPECT_EQ(tiles->tile_size, GridMap::tile_size);
+        const auto wire = tiles->serialize();
+        ASSERT_EQ(replica.apply(msg::OccupancyGridTileUpdate::deserialize(wire.data())), MapStatus::Ok);
+        map.clearPendingUpdate();
+        EXPECT_FALSE(map.pendingTiles());
+        ASSERT_EQ(replica.message().data, map.message().data);
+        ASSERT_EQ(replica.revision(), map.revision());
+    }
+    EXPECT_GT(map.revision(), 40u);
+}
+
+TEST(Nav_GridMap, emits_only_dirty_tiles_for_scattered_changes) {
+    GridMap map(makeGrid(256, 256, 0));
+    ASSERT_EQ(map.set(0, 0, 100), MapStatus::Ok);
+    ASSERT_EQ(map.set(255, 255, 100), MapStatus::Ok);
+    const auto rect = map.pendingUpdate();
+    const auto tiles = map.pendingTiles();
+    ASSERT_TRUE(rect && tiles);
+    EXPECT_EQ(rect->data.size(), 256u * 256u);
+    ASSERT_EQ(tiles->tiles.size(), 2u);
+    EXPECT_EQ(tiles->tiles[0].x, 0u);
+    EXPECT_EQ(tiles->tiles[0].y, 0u);
+    EXPECT_EQ(tiles->tiles[1].x, 3u);
+    EXPECT_EQ(tiles->tiles[1].y, 3u);
+    EXPECT_EQ(tiles->tiles[0].encoding, msg::OccupancyGridTile::encoding_run_length);
+    EXPECT_LT(tiles->compact_size() * 100, rect->compact_size());
+
+    const auto raw = map.pendingTiles(TileEncoding::Raw);
+    ASSERT_TRUE(raw);
+    EXPECT_EQ(raw->tiles[1].encoding, msg::OccupancyGridTile::encoding_raw);
+    EXPECT_EQ(raw->tiles[1].data.size(), 64u * 64u);
+}
+
+TEST(Nav_GridMap, rejects_invalid_tile_updates_atomically) {
+    const auto source = makeGrid(100, 70, 0);
+    GridMap map(source);
+    msg::OccupancyGridTileUpdate update{};
+    update.header.frame_id = "map";
+    update.base_revision = 0;
+    update.revision = 1;
+    update.tile_size = 64;
+    msg::OccupancyGridTile valid{};
+    valid.encoding = msg::OccupancyGridTile::encoding_run_length;
+    for (int i = 0; i < 16; ++i)
+        valid.data.insert(valid.data.end(), {255, 100});
+    valid.data.insert(valid.data.end(), {16, 100});
+    // 右下角分块被截断为 36×6
+    msg::OccupancyGridTile corner{};
+    corner.x = 1;
+    corner.y = 1;
+    corner.encoding = msg::OccupancyGridTile::encoding_raw;
+    corner.data.assign(36u * 6u, 50);
+
+    const auto rejects = [&](msg::OccupancyGridTileUpdate candidate, MapStatus expected) {
+        EXPECT_EQ(map.apply(candidate), expected);
+        EXPECT_EQ(map.message().data, source.data);
+        EXPECT_EQ(map.revision(), 0u);
+    };
+    auto broken = corner;
+    broken.data.pop_back();
+    update.tiles = {valid, broken};
+    rejects(update, MapStatus::InvalidDimensions);
+    broken = valid;
+    broken.data[broken.data.size() - 2] = 15;
+    update.tiles = {corner, broken};
+    rejects(update, MapStatus::InvalidDimensions);
+    broken.data = {0, 100};
+    update.tiles = {broken};
+    rejects(update, MapStatus::InvalidDimensions);
+    broken = corner;
+    broken.data[7] = 101;
+    update.tiles = {valid, broken};
+    rejects(update, MapStatus::InvalidValue);
+    broken.encoding = 2;
+    update.tiles = {broken};
+    rejects(update, MapStatus::InvalidDimensions);
+    broken = corner;
+    broken.x = 2;
+    update.tiles = {valid, broken};
+    rejects(update, MapStatus::OutOfBounds);
+    // 重复的分块坐标会让解码量超出地图面积，在写入前拒绝
+    update.tiles.assign(4096, corner);
+    rejects(update, MapStatus::InvalidDimensions);
+    broken = valid;
+    broken.data.back() = 101;
+    update.tiles = {corner, broken};
+    rejects(update, MapStatus::InvalidValue);
+
+    update.tiles = {valid, corner};
+    auto oversized = update;
+    oversized.tile_size = 101;
+    oversized.tiles = {valid};
+    rejects(oversized, MapStatus::InvalidDimensions);
+    auto other = update;
+    other.tile_size = 0;
+    rejects(other, MapStatus::InvalidDimensions);
+    other = update;
+    other.base_revision = 1;
+    other.revision = 2;
+    rejects(other, MapStatus::RevisionMismatch);
+    other = update;
+    other.header.frame_id = "odom";
+    rejects(other, MapStatus::FrameMismatch);
+
+    ASSERT_EQ(map.apply(update), MapStatus::Ok);
+    EXPECT_EQ(map.revision(), 1u);
+    EXPECT_EQ(map.at(63, 63), 100);
+    EXPECT_EQ(map.at(64, 63), 0);
+    EXPECT_EQ(map.at(64, 64), 50);
+    EXPECT_EQ(map.at(99, 69), 50);
+
+    // 小于分块边长的地图仍能合并本类发布的分块
+    GridMap small(makeGrid(10, 10, 0)), small_replica(makeGrid(10, 10, 0));
+    ASSERT_EQ(small.set(9, 9, 100), MapStatus::Ok);
+    const auto small_tiles = small.pendingTiles();
+    ASSERT_TRUE(small_tiles);
+    ASSERT_EQ(small_replica.apply(*small_tiles), MapStatus::Ok);
+    EXPECT_EQ(small_replica.at(9, 9), 100);
+}
+
+TEST(Nav_GridMap, streams_costmap_exports_through_assign) {
+    auto source = makeGrid(160, 120, 0, 0.05);
+    source.data[30 * 160 + 30] = 100;
+    CostmapOptions options{};
+    options.inflation_radius = 0.2;
+    options.inscribed_radius = 0.1;
+    Costmap costmap(GridMap(source), options);
+    ASSERT_TRUE(costmap.valid());
+    GridMap publisher(costmap.message());
+    GridMap subscriber(costmap.message());
+
+    ASSERT_EQ(costmap.markObstacle(Cell{150, 110}), MapStatus::Ok);
+    costmap.updateCosts();
+    ASSERT_EQ(publisher.assign(costmap.message()), MapStatus::Ok);
+    EXPECT_EQ(publisher.revision(), 1u);
+    const auto tiles = publisher.pendingTiles();
+    ASSERT_TRUE(tiles);
+    ASSERT_EQ(tiles->tiles.size(), 1u);
+    EXPECT_EQ(tiles->tiles[0].x, 2u);
+    EXPECT_EQ(tiles->tiles[0].y, 1u);
+    ASSERT_EQ(subscriber.apply(*tiles), MapStatus::Ok);
+    EXPECT_EQ(subscriber.message().data, costmap.message().data);
+
+    // 内容未变时不产生修改，几何不一致时拒绝覆盖
+    publisher.clearPendingUpdate();
+    ASSERT_EQ(publisher.assign(costmap.message()), MapStatus::Ok);
+    EXPECT_EQ(publisher.revision(), 1u);
+    EXPECT_FALSE(publisher.pendingTiles());
+    EXPECT_EQ(publisher.assign(makeGrid(160, 121, 0, 0.05)), MapStatus::GeometryMismatch);
+    EXPECT_EQ(publisher.assign(makeGrid(160, 120, 0, 0.1)), MapStatus::GeometryMismatch);
+}
+
 TEST(Nav_GridMap, integrates_clipped_sensor_rays) {
     GridMap map(makeGrid(5, 3));
     ASSERT_EQ(map.integrateRay(-2.0, 1.5, 3.5, 1.5), MapStatus::Ok);
@@ -224,6 +469,92 @@ TEST(Nav_GridMap, integrates_clipped_sensor_rays) {
     EXPECT_EQ(map.at(4, 1), 30);
 }
 
+TEST(Nav_GridMap, integrates_laser_scan_with_log_odds) {
+    GridMap map(makeGrid(21, 21));
+    // 传感器朝向 +y，三条光束依次指向世界坐标系 +x、+y、-x
+    const auto origin = planarPose(10.5, 10.5, kPi / 2);
+    ScanOptions options{};
+    options.max_range = 5.0;
+    const std::vector<float> ranges{4.0f, std::numeric_limits<float>::infinity(), std::nanf("")};
+    ASSERT_EQ(map.integrateScan(origin, ranges.data(), ranges.size(), -kPi / 2, kPi / 2, options), MapStatus::Ok);
+    EXPECT_EQ(map.revision(), 1u);
+    // 两条光束共享的起点栅格在同一帧内只更新一次
+    EXPECT_EQ(map.at(10, 10), 40);
+    for (uint32_t x = 11; x < 14; ++x)
+        EXPECT_EQ(map.at(x, 10), 40);
+    EXPECT_EQ(map.at(14, 10), 70);
+    for (uint32_t y = 11; y <= 15; ++y)
+        EXPECT_EQ(map.at(10, y), 40);
+    EXPECT_EQ(map.at(10, 16), -1);
+    EXPECT_EQ(map.at(9, 10), -1);
+    const auto update = map.pendingUpdate();
+    ASSERT_TRUE(update.has_value());
+    EXPECT_EQ(update->x, 10u);
+    EXPECT_EQ(update->y, 10u);
+    EXPECT_EQ(update->width, 5u);
+    EXPECT_EQ(update->height, 6u);
+
+    // 反复观测后累积概率被限制在上下限之间
+    for (int i = 0; i < 20; ++i)
+        ASSERT_EQ(map.integrateScan(origin, ranges.data(), ranges.size(), -kPi / 2, kPi / 2, options), MapStatus::Ok);
+    EXPECT_EQ(map.at(14, 10), 97);
+    EXPECT_EQ(map.at(12, 10), 12);
+    const auto saturated = map.revision();
+    ASSERT_EQ(map.integrateScan(origin, ranges.data(), ranges.size(), -kPi / 2, kPi / 2, options), MapStatus::Ok);
+    EXPECT_EQ(map.revision(), saturated);
+
+    // 被其他接口改写的栅格以新值为先验
+    ASSERT_EQ(map.set(14, 10, 0), MapStatus::Ok);
+    ASSERT_EQ(map.integrateScan(origin, ranges.data(), ranges.size(), -kPi / 2, kPi / 2, options), MapStatus::Ok);
+    EXPECT_EQ(map.at(14, 10), 24);
+}
+
+TEST(Nav_GridMap, scan_hits_take_precedence_over_misses) {
+    GridMap map(makeGrid(21, 21));
+    const std::vector<float> ranges{2.0f, 4.0f};
+    ASSERT_EQ(map.integrateScan(planarPose(10.5, 10.5), ranges.data(), ranges.size(), 0.0, 0.0), MapStatus::Ok);
+    EXPECT_EQ(map.at(11, 10), 40);
+    EXPECT_EQ(map.at(12, 10), 70);
+    EXPECT_EQ(map.at(13, 10), 40);
+    EXPECT_EQ(map.at(14, 10), 70);
+
+#if __cplusplus >= 202002L
+    GridMap span_map(makeGrid(21, 21));
+    ASSERT_EQ(span_map.integrateScan(planarPose(10.5, 10.5), std::span(ranges), 0.0, 0.0), MapStatus::Ok);
+    EXPECT_EQ(span_map.message().data, map.message().data);
+#endif
+
+    // 传感器位于地图外时光束被裁剪至地图边界
+    const float far_range{6.0f};
+    ASSERT_EQ(map.integrateScan(planarPose(-3.5, 0.5), &far_range, 1, 0.0, 0.0), MapStatus::Ok);
+    EXPECT_EQ(map.at(0, 0), 40);
+    EXPECT_EQ(map.at(2, 0), 70);
+    EXPECT_EQ(map.at(3, 0), -1);
+}
+
+TEST(Nav_GridMap, rejects_invalid_scan_inputs) {
+    const std::vector<float> ranges{1.0f};
+    EXPECT_EQ(GridMap().integrateScan(planarPose(0.5, 0.5), ranges.data(), ranges.size(), 0.0, 0.0), MapStatus::InvalidDimensions);
+
+    GridMap map(makeGrid(4, 4));
+    ScanOptions options{};
+    options.hit_probability = 0.4;
+    EXPECT_EQ(map.integrateScan(planarPose(0.5, 0.5), ranges.data(), ranges.size(), 0.0, 0.0, options), MapStatus::InvalidProbability);
+    options = {};
+    options.min_probability = 0.98;
+    EXPECT_EQ(map.integrateScan(planarPose(0.5, 0.5), ranges.data(), ranges.size(), 0.0, 0.0, options), MapStatus::InvalidProbability);
+    options = {};
+    options.max_range = 0.0;
+    EXPECT_EQ(map.integrateScan(planarPose(0.5, 0.5), ranges.data(), ranges.size(), 0.0, 0.0, options), MapStatus::InvalidOptions);
+    EXPECT_EQ(map.integrateScan(planarPose(0.5, 0.5), ranges.data(), ranges.size(), std::nan(""), 0.0), MapStatus::InvalidOptions);
+    auto tilted = planarPose(0.5, 0.5);
+    tilted.orientation = {0.3, 0.0, 0.0, 0.95};
+    EXPECT_EQ(map.integrateScan(tilted, ranges.data(), ranges.size(), 0.0, 0.0), MapStatus::InvalidOrigin);
+    EXPECT_EQ(map.integrateScan(planarPose(0.5, 0.5), nullptr, 1, 0.0, 0.0), MapStatus::InvalidOptions);
+    EXPECT_EQ(map.revision(), 0u);
+    EXPECT_FALSE(map.pendingUpdate().has_value());
+}
+
 TEST(Nav_Costmap, builds_static_layer_and_inflates_lethal_obstacles) {
     auto source = makeGrid(7, 7, 0);
     source.data[3 * 7 + 3] = 100;
@@ -290,6 +621,216 @@ TEST(Nav_Costmap, updates_static_layer_only_for_matching_geometry) {
     EXPECT_EQ(costmap.reset(grid, options), MapStatus::InvalidOptions);
 }
 
+TEST(Nav_Costmap, incremental_updates_match_full_inflation) {
+    auto source = makeGrid(40, 30, 0, 0.1);
+    for (uint32_t x = 5; x < 35; ++x)
+        source.data[20 * 40 + x] = 100;
+    source.data[3 * 40 + 3] = -1;
+    GridMap grid(source);
+    CostmapOptions options{};
+    options.inflation_radius = 0.45;
+    options.inscribed_radius = 0.15;
+    options.cost_scaling_factor = 3.0;
+    Costmap costmap(grid, options);
+
+    // 以相同障碍层重新构造的代价地图作为整图膨胀的参考结果
+    std::vector<Cell> obstacles{};
+    auto expectFullInflation = [&](const GridMap &static_map) {
+        Costmap reference(static_map, options);
+        for (const auto &cell : obstacles)
+            reference.markObstacle(cell);
+        reference.updateCosts();
+        costmap.updateCosts();
+        EXPECT_EQ(costmap.message().data, reference.message().data);
+    };
+
+    uint32_t seed = 7;
+    for (int i = 0; i < 40; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        const Cell cell{(seed >> 8) % 40, (seed >> 20) % 30};
+        ASSERT_EQ(costmap.markObstacle(cell), MapStatus::Ok);
+        obstacles.push_back(cell);
+        if (i % 8 == 7)
+            expectFullInflation(grid);
+    }
+
+    ASSERT_EQ(costmap.clearRay(0.05, 1.05, 3.95, 1.05), MapStatus::Ok);
+    obstacles.erase(std::remove_if(obstacles.begin(), obstacles.end(), [](const Cell &cell) { return cell.y == 10; }),
+                    obstacles.end());
+    expectFullInflation(grid);
+
+    auto updated = grid;
+    ASSERT_EQ(updated.set(20, 20, 0), MapStatus::Ok);
+    ASSERT_EQ(updated.set(2, 28, 100), MapStatus::Ok);
+    ASSERT_EQ(costmap.setStaticMap(updated), MapStatus::Ok);
+    expectFullInflation(updated);
+
+    ASSERT_EQ(costmap.clearObstacles(), MapStatus::Ok);
+    obstacles.clear();
+    expectFullInflation(updated);
+}
+
+TEST(Nav_Costmap, reports_changed_cells_since_stamp) {
+    GridMap grid(makeGrid(100, 100, 0, 0.1));
+    CostmapOptions options{};
+    options.inflation_radius = 0.45;
+    options.inscribed_radius = 0.15;
+    Costmap costmap(grid, options);
+    const auto snapshot = [&costmap] {
+        std::vector<uint8_t> costs{};
+        for (uint32_t y = 0; y < costmap.height(); ++y)
+            for (uint32_t x = 0; x < costmap.width(); ++x)
+                costs.push_back(*costmap.at(x, y));
+        return costs;
+    };
+    // 变化记录应覆盖前后两次主代价的全部逐格差异，只跨一次更新时两者完全一致
+    const auto expectChanges = [&](uint64_t stamp, const std::vector<uint8_t> &before, bool exact) {
+        const auto changes = costmap.changesSince(stamp);
+        ASSERT_TRUE(changes);
+        std::vector<uint8_t> reported(before.size());
+        for (const auto &cell : *changes)
+            reported[static_cast<std::size_t>(cell.y) * costmap.width() + cell.x] = 1;
+        const auto after = snapshot();
+        for (std::size_t i = 0; i < after.size(); ++i) {
+            if (exact) {
+                EXPECT_EQ(reported[i] != 0, after[i] != before[i]) << "cell " << i;
+            } else if (after[i] != before[i]) {
+                EXPECT_NE(reported[i], 0) << "cell " << i;
+            }
+        }
+    };
+
+    const uint64_t first = costmap.stamp();
+    const auto first_costs = snapshot();
+    ASSERT_NE(first, 0u);
+    ASSERT_TRUE(costmap.changesSince(first));
+    EXPECT_TRUE(costmap.changesSince(first)->empty());
+    ASSERT_EQ(costmap.markObstacle(Cell{20, 30}), MapStatus::Ok);
+    ASSERT_EQ(costmap.markObstacle(Cell{22, 31}), MapStatus::Ok);
+    costmap.updateCosts();
+    const uint64_t second = costmap.stamp();
+    const auto second_costs = snapshot();
+    EXPECT_NE(second, first);
+    expectChanges(first, first_costs, true);
+
+    ASSERT_EQ(costmap.markObstacle(Cell{70, 60}), MapStatus::Ok);
+    ASSERT_EQ(costmap.clearRay(2.05, 3.05, 2.05, 3.05), MapStatus::Ok);
+    costmap.updateCosts();
+    expectChanges(first, first_costs, false);
+    expectChanges(second, second_costs, true);
+    const Costmap copy = costmap;
+    EXPECT_EQ(copy.stamp(), costmap.stamp());
+    ASSERT_TRUE(copy.changesSince(second));
+    EXPECT_EQ(copy.changesSince(second)->size(), costmap.changesSince(second)->size());
+
+    EXPECT_FALSE(costmap.changesSince(0));
+    EXPECT_FALSE(costmap.changesSince(Costmap(grid, options).stamp()));
+    // 重新计算的区域很大但变化的栅格很少时照常记录
+    const uint64_t third = costmap.stamp();
+    const auto third_costs = snapshot();
+    auto corners = grid;
+    ASSERT_EQ(corners.set(0, 0, 100), MapStatus::Ok);
+    ASSERT_EQ(corners.set(99, 99, 100), MapStatus::Ok);
+    ASSERT_EQ(costmap.setStaticMap(corners), MapStatus::Ok);
+    expectChanges(third, third_costs, true);
+    // 单次变化的栅格超过上限时丢弃全部记录
+    auto stripes = grid;
+    for (uint32_t y = 0; y < 100; ++y)
+        for (uint32_t x = 0; x < 100; x += 4)
+            ASSERT_EQ(stripes.set(x, y, 100), MapStatus::Ok);
+    ASSERT_EQ(costmap.setStaticMap(stripes), MapStatus::Ok);
+    EXPECT_FALSE(costmap.changesSince(first));
+    EXPECT_FALSE(costmap.changesSince(third));
+    ASSERT_TRUE(costmap.changesSince(costmap.stamp()));
+}
+
+TEST(Nav_Costmap, distance_transform_inflation_matches_reference) {
+    struct Case {
+        uint32_t width;
+        uint32_t height;
+        double resolution;
+        double inflation_radius;
+        double inscribed_radius;
+        double cost_scaling_factor;
+        bool inflate_unknown;
+    };
+    const Case cases[] = {{48, 37, 0.05, 0.55, 0.20, 10.0, false},
+                          {31, 52, 0.1, 0.45, 0.0, 3.0, true},
+                          {25, 25, 1.0, 2.5, 1.0, 1.0, false},
+                          {40, 9, 0.07, 0.3, 0.3, 5.0, true}};
+    uint32_t seed = 11;
+    for (const auto &c : cases) {
+        auto source = makeGrid(c.width, c.height, 0, c.resolution);
+        for (auto &value : source.data) {
+            seed = seed * 1664525u + 1013904223u;
+            const uint32_t roll = (seed >> 16) % 100;
+            value = roll < 4 ? int8_t{100} : roll < 10 ? int8_t{-1} : roll < 15 ? static_cast<int8_t>(roll * 3) : int8_t{0};
+        }
+        GridMap grid(source);
+        CostmapOptions options{};
+        options.inflation_radius = c.inflation_radius;
+        options.inscribed_radius = c.inscribed_radius;
+        options.cost_scaling_factor = c.cost_scaling_factor;
+        options.inflate_unknown = c.inflate_unknown;
+        auto merged_options = options;
+        merged_options.inflation_radius = 0.0;
+        merged_options.inscribed_radius = 0.0;
+        Costmap costmap(grid, options), merged(grid, merged_options);
+        for (int i = 0; i < 20; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const Cell cell{(seed >> 8) % c.width, (seed >> 20) % c.height};
+            ASSERT_EQ(costmap.markObstacle(cell), MapStatus::Ok);
+            ASSERT_EQ(merged.markObstacle(cell), MapStatus::Ok);
+        }
+        costmap.updateCosts();
+        merged.updateCosts();
+
+        std::vector<uint8_t> layers{}, actual{};
+        for (uint32_t y = 0; y < c.height; ++y)
+            for (uint32_t x = 0; x < c.width; ++x) {
+                layers.push_back(*merged.at(x, y));
+                actual.push_back(*costmap.at(x, y));
+            }
+        const double resolution = grid.message().info.resolution;
+        EXPECT_EQ(actual, referenceInflation(layers, c.width, c.height, resolution, options));
+    }
+}
+
+TEST(Nav_Costmap, merges_large_layers_identically_to_scalar_rule) {
+    // 非 16/32 整数倍的宽度覆盖 SIMD 尾部，面积超过并行阈值，固定 2 个线程使单核机器同样经过并行路径
+    constexpr uint32_t width = 1037;
+    constexpr uint32_t height = 611;
+    auto source = makeGrid(width, height, 0);
+    uint32_t seed = 3;
+    for (auto &value : source.data) {
+        seed = seed * 1664525u + 1013904223u;
+        const uint32_t roll = (seed >> 16) % 10;
+        value = roll == 0 ? int8_t{100} : roll == 1 ? int8_t{-1} : int8_t{0};
+    }
+    GridMap grid(source);
+    CostmapOptions options{};
+    options.inflation_radius = 0.0;
+    options.inscribed_radius = 0.0;
+    options.threads = 2;
+    Costmap costmap(grid, options);
+    std::vector<bool> obstacle(source.data.size(), false);
+    for (int i = 0; i < 5000; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        const Cell cell{(seed >> 4) % width, (seed >> 16) % height};
+        ASSERT_EQ(costmap.markObstacle(cell), MapStatus::Ok);
+        obstacle[static_cast<std::size_t>(cell.y) * width + cell.x] = true;
+    }
+    costmap.updateCosts();
+
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            const std::size_t index = static_cast<std::size_t>(y) * width + x;
+            const uint8_t base = source.data[index] < 0 ? Unknown : source.data[index] == 100 ? Lethal : Free;
+            ASSERT_EQ(costmap.at(x, y), obstacle[index] ? static_cast<uint8_t>(Lethal) : base) << x << ", " << y;
+        }
+    }
+}
+
 TEST(Nav_Costmap, detects_footprint_collision_and_map_boundary) {
     GridMap grid(makeGrid(10, 10, 0));
     CostmapOptions options{};
@@ -308,6 +849,118 @@ TEST(Nav_Costmap, detects_footprint_collision_and_map_boundary) {
     EXPECT_TRUE(costmap.collides({}, planarPose(3.5, 3.5)));
 }
 
+TEST(Nav_Costmap, rasterized_footprint_matches_polygon_collision) {
+    // 原点带旋转、含未知区域和膨胀障碍的地图
+    auto message = makeGrid(80, 60, 0, 0.05);
+    message.info.origin.position = {-1.0, 0.5, 0.0};
+    message.info.origin.orientation.z = std::sin(0.3);
+    message.info.origin.orientation.w = std::cos(0.3);
+    uint32_t seed = 7;
+    for (auto &value : message.data) {
+        seed = seed * 1664525U + 1013904223U;
+        const uint32_t draw = (seed >> 16) % 100;
+        value = draw < 2 ? 100 : (draw < 4 ? -1 : 0);
+    }
+    GridMap grid(std::move(message));
+    CostmapOptions options{};
+    options.inflation_radius = 0.1;
+    options.inscribed_radius = 0.03;
+    Costmap costmap(grid, options);
+    ASSERT_TRUE(costmap.valid());
+
+    // 凹多边形，机器人中心位于多边形外
+    const std::vector<msg::Point> concave{{-0.2, -0.15, 0.0}, {0.2, -0.15, 0.0}, {0.2, 0.15, 0.0},
+                                          {0.05, 0.15, 0.0}, {0.05, -0.05, 0.0}, {-0.2, -0.05, 0.0}};
+    const std::vector<msg::Point> box{{-0.12, -0.08, 0.0}, {0.12, -0.08, 0.0}, {0.12, 0.08, 0.0}, {-0.12, 0.08, 0.0}};
+    for (const auto &polygon : {concave, box}) {
+        for (uint32_t bins : {1U, 64U}) {
+            const Footprint footprint(polygon, costmap.resolution(), bins);
+            ASSERT_TRUE(footprint.valid());
+            std::size_t collisions{};
+            for (int i = 0; i < 2000; ++i) {
+                seed = seed * 1664525U + 1013904223U;
+                const double u = static_cast<double>(seed >> 8) / (1U << 24);
+                seed = seed * 1664525U + 1013904223U;
+                const double v = static_cast<double>(seed >> 8) / (1U << 24);
+                seed = seed * 1664525U + 1013904223U;
+                const double yaw = static_cast<double>(seed >> 8) / (1U << 24) * 8.0 - 4.0;
+                // 世界坐标覆盖整张地图及其边界外侧
+                const auto pose = planarPose(-1.5 + 5.0 * u, 0.0 + 4.5 * v, yaw);
+                const bool expected = costmap.collides(polygon, pose);
+                EXPECT_EQ(costmap.collides(footprint, pose), expected) << "pose " << i << ", bins " << bins;
+                collisions += expected;
+            }
+            EXPECT_GT(collisions, 0u);
+            EXPECT_LT(collisions, 2000u);
+        }
+    }
+
+    // 分辨率不一致时退回多边形检测，无效输入一律视为碰撞
+    const auto pose = planarPose(0.5, 1.5, 0.4);
+    EXPECT_EQ(costmap.collides(Footprint(box, 0.1), pose), costmap.collides(box, pose));
+    EXPECT_FALSE(Footprint({}, 0.05).valid());
+    EXPECT_FALSE(Footprint(box, 0.0).valid());
+    EXPECT_FALSE(Footprint(box, 0.05, 0).valid());
+    EXPECT_TRUE(costmap.collides(Footprint({}, 0.05), pose));
+    auto invalid_pose = pose;
+    invalid_pose.orientation.x = 0.5;
+    EXPECT_TRUE(costmap.collides(Footprint(box, 0.05), invalid_pose));
+}
+
+TEST(Nav_Costmap, footprint_clearance_exit_matches_polygon_collision) {
+    // 稀疏障碍、膨胀半径大于 footprint 外接圆半径，远离障碍的位姿可由中心栅格的膨胀代价直接判定无碰撞
+    auto message = makeGrid(100, 100, 0, 0.05);
+    uint32_t seed = 11;
+    const auto draw = [&seed]() {
+        seed = seed * 1664525U + 1013904223U;
+        return static_cast<double>(seed >> 8) / (1U << 24);
+    };
+    for (int i = 0; i < 12; ++i)
+        message.data[static_cast<std::size_t>(draw() * 100) * 100 + static_cast<std::size_t>(draw() * 100)] = 100;
+    CostmapOptions options{};
+    options.inflation_radius = 0.6;
+    options.inscribed_radius = 0.15;
+    Costmap costmap(GridMap(message), options);
+    ASSERT_TRUE(costmap.valid());
+
+    const std::vector<msg::Point> box{{-0.12, -0.08, 0.0}, {0.12, -0.08, 0.0}, {0.12, 0.08, 0.0}, {-0.12, 0.08, 0.0}};
+    const Footprint footprint(box, costmap.resolution());
+    const auto check = [&](const char *stage) {
+        std::size_t collisions{};
+        for (int i = 0; i < 3000; ++i) {
+            const auto pose = planarPose(0.3 + 4.4 * draw(), 0.3 + 4.4 * draw(), draw() * 8.0 - 4.0);
+            const bool expected = costmap.collides(box, pose);
+            EXPECT_EQ(costmap.collides(footprint, pose), expected) << stage << ", pose " << i;
+            collisions += expected;
+        }
+        EXPECT_GT(collisions, 0u) << stage;
+        EXPECT_LT(collisions, 3000u) << stage;
+    };
+    check("no unknown");
+
+    // 紧贴内切区域边缘的位姿：中心栅格不在内切区域内，footprint 只覆盖内切栅格
+    message.data.assign(message.data.size(), 0);
+    message.data[50 * 100 + 50] = 100;
+    ASSERT_EQ(costmap.setStaticMap(GridMap(message)), MapStatus::Ok);
+    for (double x = 2.5; x < 3.2; x += 0.01)
+        EXPECT_EQ(costmap.collides(footprint, planarPose(x, 2.525)), costmap.collides(box, planarPose(x, 2.525))) << x;
+
+    // 未知栅格不参与膨胀，出现后不能再由膨胀代价排除碰撞
+    for (uint32_t y = 70; y < 80; ++y)
+        for (uint32_t x = 10; x < 20; ++x)
+            message.data[y * 100 + x] = -1;
+    ASSERT_EQ(costmap.setStaticMap(GridMap(message)), MapStatus::Ok);
+    EXPECT_TRUE(costmap.collides(footprint, planarPose(0.75, 3.75)));
+    check("unknown");
+    // 未知栅格清除后恢复提前返回，结果保持一致
+    for (uint32_t y = 70; y < 80; ++y)
+        for (uint32_t x = 10; x < 20; ++x)
+            message.data[y * 100 + x] = 0;
+    ASSERT_EQ(costmap.setStaticMap(GridMap(message)), MapStatus::Ok);
+    EXPECT_FALSE(costmap.collides(footprint, planarPose(0.75, 3.75)));
+    check("unknown cleared");
+}
+
 TEST(Nav_Costmap, applies_unknown_space_collision_policy) {
     GridMap grid(makeGrid(4, 4));
     CostmapOptions options{};
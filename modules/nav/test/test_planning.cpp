@@ -178,6 +178,310 @@ TEST(Nav_AStar, smooths_grid_turns_without_entering_blocked_cells) {
     EXPECT_TRUE(changed);
 }
 
+TEST(Nav_AStar, reused_planner_matches_fresh_planner_across_maps) {
+    auto walls = makeGrid(24, 16);
+    for (uint32_t y = 0; y < 16; ++y)
+        if (y != 3 && y != 12)
+            walls.data[static_cast<std::size_t>(y) * 24 + 9] = 100;
+    auto blocked = makeGrid(6, 6);
+    for (uint32_t y = 0; y < 6; ++y)
+        blocked.data[static_cast<std::size_t>(y) * 6 + 3] = 100;
+    const auto wall_map = makeCostmap(std::move(walls));
+    const auto blocked_map = makeCostmap(std::move(blocked));
+    const auto open_map = makeCostmap(makeGrid(40, 40));
+
+    AStarOptions options{};
+    options.simplify = false;
+    options.smoothing_iterations = 0;
+    AStarPlanner reused(options);
+    const auto check = [&](const Costmap &costmap, const msg::Pose &start, const msg::Pose &goal) {
+        const auto expected = AStarPlanner(options).plan(costmap, start, goal);
+        const auto actual = reused.plan(costmap, start, goal);
+        ASSERT_EQ(actual.status, expected.status);
+        EXPECT_EQ(actual.expanded, expected.expanded);
+        EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+        ASSERT_EQ(actual.path.poses.size(), expected.path.poses.size());
+        for (std::size_t i = 0; i < actual.path.poses.size(); ++i) {
+            EXPECT_DOUBLE_EQ(actual.path.poses[i].pose.position.x, expected.path.poses[i].pose.position.x);
+            EXPECT_DOUBLE_EQ(actual.path.poses[i].pose.position.y, expected.path.poses[i].pose.position.y);
+        }
+    };
+    for (int round = 0; round < 3; ++round) {
+        check(wall_map, pose(1.5, 1.5), pose(22.5, 14.5));
+        check(wall_map, pose(22.5, 1.5), pose(1.5, 14.5));
+        check(blocked_map, pose(0.5, 2.5), pose(5.5, 2.5));
+        check(open_map, pose(0.5, 0.5), pose(39.5, 20.5));
+        check(wall_map, pose(8.5, 3.5), pose(10.5, 3.5));
+    }
+
+    // 复制得到的规划器拥有独立的工作区
+    AStarPlanner copied = reused;
+    const auto original = reused.plan(wall_map, pose(1.5, 1.5), pose(22.5, 14.5));
+    const auto copy = copied.plan(wall_map, pose(1.5, 1.5), pose(22.5, 14.5));
+    ASSERT_TRUE(copy);
+    EXPECT_DOUBLE_EQ(copy.cost, original.cost);
+    EXPECT_EQ(copy.expanded, original.expanded);
+}
+
+TEST(Nav_AStar, jump_point_search_matches_grid_search_cost) {
+    AStarOptions grid_options{};
+    grid_options.simplify = false;
+    grid_options.smoothing_iterations = 0;
+    auto online_options = grid_options;
+    online_options.jump_point = JumpPointMode::Online;
+    auto precomputed_options = grid_options;
+    precomputed_options.jump_point = JumpPointMode::Precomputed;
+    const AStarPlanner grid_planner(grid_options);
+    const AStarPlanner online_planner(online_options);
+    const AStarPlanner precomputed_planner(precomputed_options);
+
+    uint32_t seed = 7;
+    const auto random = [&seed](uint32_t bound) {
+        seed = seed * 1664525U + 1013904223U;
+        return (seed >> 8) % bound;
+    };
+    // 稀疏障碍的无膨胀地图与带膨胀代价的地图交替出现，后者中在线跳点搜索使用逐栅格 A*，预计算的跳点搜索只在膨胀区域逐栅格展开
+    for (int trial = 0; trial < 40; ++trial) {
+        const uint32_t width = 20 + random(30), height = 20 + random(30);
+        auto grid = makeGrid(width, height);
+        grid.info.resolution = 0.1F;
+        for (uint32_t i = 0, count = width * height / (4 + random(6)); i < count; ++i)
+            grid.data[random(width * height)] = 100;
+        CostmapOptions costmap_options{};
+        costmap_options.inscribed_radius = 0.0;
+        costmap_options.inflation_radius = trial % 2 == 0 ? 0.0 : 0.25;
+        Costmap costmap(GridMap(std::move(grid)), costmap_options);
+        for (int query = 0; query < 5; ++query) {
+            const auto start = pose(0.1 * random(width) + 0.05, 0.1 * random(height) + 0.05);
+            const auto goal = pose(0.1 * random(width) + 0.05, 0.1 * random(height) + 0.05);
+            const auto expected = grid_planner.plan(costmap, start, goal);
+            for (const auto *planner : {&online_planner, &precomputed_planner}) {
+                const auto actual = planner->plan(costmap, start, goal);
+                ASSERT_EQ(actual.status, expected.status) << "trial " << trial << ", query " << query;
+                if (!expected)
+                    continue;
+                EXPECT_NEAR(actual.cost, expected.cost, 1e-9 * expected.cost);
+                EXPECT_LE(actual.expanded, expected.expanded);
+                for (std::size_t i = 1; i < actual.path.poses.size(); ++i) {
+                    const auto &from = actual.path.poses[i - 1].pose.position;
+                    const auto &to = actual.path.poses[i].pose.position;
+                    const auto cell = costmap.worldToMap(to.x, to.y);
+                    ASSERT_TRUE(cell);
+                    EXPECT_LE(*costmap.at(cell->x, cell->y), grid_options.max_cost);
+                    EXPECT_LE(std::max(std::abs(to.x - from.x), std::abs(to.y - from.y)), 0.1 + 1e-6);
+                }
+            }
+        }
+        // 代价地图变化后预计算的跳跃距离需要重建
+        costmap.markObstacle(Cell{width / 2, height / 2});
+        costmap.markObstacle(Cell{width / 2 + 1, height / 2});
+        costmap.updateCosts();
+        const auto start = pose(0.05, 0.1 * (height / 2) + 0.05);
+        const auto goal = pose(0.1 * width - 0.05, 0.1 * (height / 2) + 0.05);
+        const auto expected = grid_planner.plan(costmap, start, goal);
+        const auto actual = precomputed_planner.plan(costmap, start, goal);
+        ASSERT_EQ(actual.status, expected.status) << "trial " << trial;
+        if (expected) {
+            EXPECT_NEAR(actual.cost, expected.cost, 1e-9 * expected.cost);
+        }
+    }
+
+    // 带膨胀代价的开阔地图上，远离障碍的均匀区域仍然按跳点展开
+    auto grid = makeGrid(80, 80);
+    grid.info.resolution = 0.1F;
+    for (uint32_t y = 0; y < 72; ++y)
+        grid.data[static_cast<std::size_t>(y) * 80 + 40] = 100;
+    CostmapOptions costmap_options{};
+    costmap_options.inscribed_radius = 0.0;
+    costmap_options.inflation_radius = 0.25;
+    const Costmap costmap(GridMap(std::move(grid)), costmap_options);
+    const auto start = pose(0.05, 0.05), goal = pose(7.95, 0.05);
+    const auto expected = grid_planner.plan(costmap, start, goal);
+    const auto actual = precomputed_planner.plan(costmap, start, goal);
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(actual);
+    EXPECT_NEAR(actual.cost, expected.cost, 1e-9 * expected.cost);
+    EXPECT_LT(actual.expanded * 4, expected.expanded);
+}
+
+TEST(Nav_DStarLite, incremental_replans_match_fresh_grid_search) {
+    auto grid = makeGrid(60, 40);
+    for (uint32_t y = 0; y < 40; ++y)
+        if (y < 18 || y > 21)
+            grid.data[static_cast<std::size_t>(y) * 60 + 30] = 100;
+    grid.info.resolution = 0.1F;
+    CostmapOptions costmap_options{};
+    costmap_options.inflation_radius = 0.3;
+    costmap_options.inscribed_radius = 0.0;
+    Costmap costmap(GridMap(std::move(grid)), costmap_options);
+
+    AStarOptions options{};
+    options.simplify = false;
+    options.smoothing_iterations = 0;
+    DStarLitePlanner incremental(options);
+    const AStarPlanner reference(options);
+    const auto goal = pose(5.55, 3.55);
+    const auto expectSameCost = [&](const msg::Pose &start) {
+        const auto expected = reference.plan(costmap, start, goal);
+        const auto actual = incremental.plan(costmap, start, goal);
+        EXPECT_EQ(actual.status, expected.status);
+        if (expected) {
+            EXPECT_NEAR(actual.cost, expected.cost, 1e-9 * expected.cost);
+            EXPECT_DOUBLE_EQ(actual.path.poses.back().pose.position.x, 5.55);
+        }
+        return actual;
+    };
+
+    const auto first = expectSameCost(pose(0.35, 0.35));
+    ASSERT_TRUE(first);
+    uint32_t seed = 11;
+    for (int step = 0; step < 30; ++step) {
+        // 机器人沿上次路径前进，其他机器人在地图中移动
+        const auto &next = first.path.poses[std::min<std::size_t>(step, first.path.poses.size() - 1)].pose.position;
+        costmap.clearObstacles();
+        for (int robot = 0; robot < 3; ++robot) {
+            seed = seed * 1664525U + 1013904223U;
+            costmap.markObstacle(Cell{20 + (seed >> 8) % 30, (seed >> 20) % 40});
+        }
+        if (step % 10 == 9)
+            for (uint32_t y = 18; y <= 21; ++y)
+                costmap.markObstacle(Cell{30, y});
+        costmap.updateCosts();
+        const auto replanned = expectSameCost(pose(next.x, next.y));
+        if (replanned && step % 10 != 9) {
+            EXPECT_LT(replanned.expanded, first.expanded);
+        }
+    }
+
+    // 终点改变或显式重置后重新开始搜索
+    costmap.clearObstacles();
+    costmap.updateCosts();
+    const auto other_goal = reference.plan(costmap, pose(0.35, 0.35), pose(5.55, 0.35));
+    const auto restarted = incremental.plan(costmap, pose(0.35, 0.35), pose(5.55, 0.35));
+    ASSERT_TRUE(restarted);
+    EXPECT_NEAR(restarted.cost, other_goal.cost, 1e-9 * other_goal.cost);
+    incremental.reset();
+    EXPECT_NEAR(incremental.plan(costmap, pose(0.35, 0.35), pose(5.55, 0.35)).cost, other_goal.cost, 1e-9 * other_goal.cost);
+    EXPECT_EQ(DStarLitePlanner().plan(costmap, pose(-1.0, 0.0), goal).status, PlanningStatus::InvalidStart);
+}
+
+TEST(Nav_Hierarchical, corridor_paths_match_grid_search_reachability) {
+    AStarOptions options{};
+    options.simplify = false;
+    options.smoothing_iterations = 0;
+    const AStarPlanner reference(options);
+    HierarchicalOptions hierarchy{};
+    hierarchy.cluster_size = 8;
+    HierarchicalPlanner planner(options, hierarchy);
+
+    uint32_t seed = 5;
+    const auto random = [&seed](uint32_t bound) {
+        seed = seed * 1664525U + 1013904223U;
+        return (seed >> 8) % bound;
+    };
+    double ratio_sum{};
+    int paths{};
+    // 随机墙段将地图分隔为多个区域，地图尺寸不一定是簇边长的整数倍
+    for (int trial = 0; trial < 20; ++trial) {
+        const uint32_t width = 30 + random(50), height = 30 + random(50);
+        auto grid = makeGrid(width, height);
+        grid.info.resolution = 0.1F;
+        for (int wall = 0; wall < 12; ++wall) {
+            const uint32_t x = random(width), y = random(height), length = 5 + random(25);
+            for (uint32_t i = 0; i < length; ++i)
+                grid.data[wall % 2 == 0 ? static_cast<std::size_t>(y) * width + std::min(x + i, width - 1)
+                                        : static_cast<std::size_t>(std::min(y + i, height - 1)) * width + x] = 100;
+        }
+        CostmapOptions costmap_options{};
+        costmap_options.inscribed_radius = 0.0;
+        costmap_options.inflation_radius = trial % 2 == 0 ? 0.0 : 0.25;
+        const Costmap costmap(GridMap(std::move(grid)), costmap_options);
+        for (int query = 0; query < 5; ++query) {
+            const auto start = pose(0.1 * random(width) + 0.05, 0.1 * random(height) + 0.05);
+            const auto goal = pose(0.1 * random(width) + 0.05, 0.1 * random(height) + 0.05);
+            const auto expected = reference.plan(costmap, start, goal);
+            const auto actual = planner.plan(costmap, start, goal);
+            ASSERT_EQ(actual.status, expected.status) << "trial " << trial << ", query " << query;
+            if (!expected)
+                continue;
+            EXPECT_GE(actual.cost, expected.cost - 1e-9 * expected.cost);
+            EXPECT_LE(actual.cost, expected.cost * 1.35);
+            ratio_sum += actual.cost / expected.cost;
+            ++paths;
+            for (std::size_t i = 1; i < actual.path.poses.size(); ++i) {
+                const auto &from = actual.path.poses[i - 1].pose.position;
+                const auto &to = actual.path.poses[i].pose.position;
+                const auto cell = costmap.worldToMap(to.x, to.y);
+                ASSERT_TRUE(cell);
+                EXPECT_LE(*costmap.at(cell->x, cell->y), options.max_cost);
+                EXPECT_LE(std::max(std::abs(to.x - from.x), std::abs(to.y - from.y)), 0.1 + 1e-6);
+            }
+        }
+    }
+
+    // 路径被迫经过簇边界上的入口，单次查询的代价可能偏高，总体上应接近最优
+    ASSERT_GT(paths, 0);
+    EXPECT_LE(ratio_sum / paths, 1.1);
+
+    HierarchicalOptions invalid{};
+    invalid.cluster_size = 2;
+    const auto costmap = makeCostmap(makeGrid(10, 10));
+    EXPECT_EQ(HierarchicalPlanner(options, invalid).plan(costmap, pose(0.5, 0.5), pose(8.5, 8.5)).status,
+              PlanningStatus::InvalidOptions);
+}
+
+TEST(Nav_Hierarchical, incremental_graph_matches_rebuilt_graph) {
+    auto grid = makeGrid(96, 64);
+    for (uint32_t y = 0; y < 64; ++y)
+        if (y < 30 || y > 33)
+            grid.data[static_cast<std::size_t>(y) * 96 + 47] = 100;
+    grid.info.resolution = 0.1F;
+    CostmapOptions costmap_options{};
+    costmap_options.inflation_radius = 0.3;
+    costmap_options.inscribed_radius = 0.0;
+    Costmap costmap(GridMap(std::move(grid)), costmap_options);
+
+    AStarOptions options{};
+    options.simplify = false;
+    options.smoothing_iterations = 0;
+    HierarchicalOptions hierarchy{};
+    hierarchy.cluster_size = 16;
+    hierarchy.corridor_margin = 0;
+    HierarchicalPlanner incremental(options, hierarchy);
+    const auto start = pose(0.35, 0.35);
+    const auto goal = pose(9.15, 6.05);
+    // 首次构建时缺口被堵住，之后清除障碍物需要在簇边界上新增入口
+    for (uint32_t y = 30; y <= 33; ++y)
+        costmap.markObstacle(Cell{47, y});
+    costmap.updateCosts();
+    EXPECT_EQ(incremental.plan(costmap, start, goal).status, PlanningStatus::NoPath);
+
+    // 障碍物落在簇内部和簇边界上，每次更新后增量维护的抽象图与重新构建的抽象图给出相同的结果
+    uint32_t seed = 3;
+    for (int step = 0; step < 30; ++step) {
+        costmap.clearObstacles();
+        for (int robot = 0; robot < 4; ++robot) {
+            seed = seed * 1664525U + 1013904223U;
+            const uint32_t x = (seed >> 8) % 96, y = (seed >> 20) % 64;
+            costmap.markObstacle(Cell{step % 3 == 0 ? x / 16 * 16 + 15 : x, y});
+        }
+        if (step % 10 == 9)
+            for (uint32_t y = 30; y <= 33; ++y)
+                costmap.markObstacle(Cell{47, y});
+        costmap.updateCosts();
+        const auto expected = HierarchicalPlanner(options, hierarchy).plan(costmap, start, goal);
+        const auto actual = incremental.plan(costmap, start, goal);
+        ASSERT_EQ(actual.status, expected.status) << "step " << step;
+        EXPECT_EQ(actual.status == PlanningStatus::NoPath, step % 10 == 9);
+        if (expected) {
+            EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+            EXPECT_EQ(actual.expanded, expected.expanded);
+        }
+    }
+    incremental.reset();
+    EXPECT_EQ(incremental.plan(costmap, start, goal).status, PlanningStatus::NoPath);
+}
+
 TEST(Nav_PurePursuit, tracks_straight_and_curved_paths) {
     PurePursuit controller;
     const auto straight = controller.compute(pose(0.0, 0.0), path({{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {2.0, 0.0, 0.0}}));
@@ -219,10 +523,14 @@ TEST(Nav_CollisionStop, filters_commands_that_enter_an_obstacle) {
     EXPECT_TRUE(blocked.stopped);
     EXPECT_DOUBLE_EQ(blocked.command.linear.x, 0.0);
 
+    const Footprint footprint(kFootprint, costmap.resolution());
+    EXPECT_TRUE(stop.filter(costmap, footprint, pose(0.5, 2.5), forward).stopped);
+
     options.prediction_horizon = 1.0;
     const auto safe = CollisionStop(options).filter(costmap, kFootprint, pose(0.5, 2.5), forward);
     EXPECT_FALSE(safe.stopped);
     EXPECT_DOUBLE_EQ(safe.command.linear.x, 1.0);
+    EXPECT_FALSE(CollisionStop(options).filter(costmap, footprint, pose(0.5, 2.5), forward).stopped);
 }
 
 TEST(Nav_CollisionStop, fails_closed_for_invalid_footprint_or_command) {
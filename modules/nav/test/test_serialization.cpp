@@ -18,6 +18,7 @@
 #include "nlohmann/json.hpp"
 
 #include "rmvlmsg/nav/occupancy_grid.hpp"
+#include "rmvlmsg/nav/occupancy_grid_tile_update.hpp"
 #include "rmvlmsg/nav/occupancy_grid_update.hpp"
 #include "rmvlmsg/nav/odometry.hpp"
 #include "rmvlmsg/nav/path.hpp"
@@ -164,4 +165,39 @@ TEST(Nav_serialization, occupancy_grid_update) {
     EXPECT_EQ(j["revision"].get<uint64_t>(), 18u);
 }
 
+TEST(Nav_serialization, occupancy_grid_tile_update) {
+    msg::OccupancyGridTileUpdate source;
+    source.header.stamp = {6000, 0};
+    source.header.frame_id = "map";
+    source.base_revision = 18;
+    source.revision = 21;
+    source.tile_size = 64;
+    source.tiles.resize(2);
+    source.tiles[0].x = 1;
+    source.tiles[0].encoding = msg::OccupancyGridTile::encoding_run_length;
+    source.tiles[0].data = {255, 0, 1, 100};
+    source.tiles[1].x = 3;
+    source.tiles[1].y = 2;
+    source.tiles[1].encoding = msg::OccupancyGridTile::encoding_raw;
+    source.tiles[1].data = {0xff, 0, 50, 100};
+
+    const auto data = source.serialize();
+    const auto decoded = msg::OccupancyGridTileUpdate::deserialize(data.data());
+    EXPECT_EQ(data.size(), source.compact_size());
+    EXPECT_EQ(decoded.base_revision, 18u);
+    EXPECT_EQ(decoded.revision, 21u);
+    EXPECT_EQ(decoded.tile_size, 64u);
+    ASSERT_EQ(decoded.tiles.size(), 2u);
+    EXPECT_EQ(decoded.tiles[0].encoding, msg::OccupancyGridTile::encoding_run_length);
+    EXPECT_EQ(decoded.tiles[0].data, source.tiles[0].data);
+    EXPECT_EQ(decoded.tiles[1].x, 3u);
+    EXPECT_EQ(decoded.tiles[1].y, 2u);
+    EXPECT_EQ(decoded.tiles[1].data, source.tiles[1].data);
+
+    const auto j = jsonRoundTrip(source);
+    ASSERT_EQ(j["tiles"].size(), 2u);
+    EXPECT_EQ(j["tiles"][1]["encoding"].get<int>(), msg::OccupancyGridTile::encoding_raw);
+    EXPECT_EQ(j["tiles"][0]["data"].size(), 4u);
+}
+
 } // namespace rm_test